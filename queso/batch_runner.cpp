@@ -0,0 +1,135 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+//// STL includes
+#include <omp.h>
+#include <cmath>
+#include <algorithm>
+#include <exception>
+#include <iomanip>
+
+//// Project includes
+#include "queso/batch_runner.h"
+#include "queso/embedded_model.h"
+#include "queso/includes/timer.hpp"
+
+namespace queso {
+
+BatchRunner::BatchRunner(IndexType NumOuterThreads, IndexType NumInnerThreads)
+    : mNumOuterThreads( NumOuterThreads > 0 ? NumOuterThreads : static_cast<IndexType>(omp_get_max_threads()) ),
+      mNumInnerThreads( std::max<IndexType>(NumInnerThreads, 1) )
+{
+}
+
+void BatchRunner::AddModel(const Settings& rSettings) {
+    mSettingsVector.push_back(rSettings);
+}
+
+const BatchRunner::BatchResultVectorType& BatchRunner::Run() {
+    Timer timer{};
+    const int num_models = static_cast<int>(mSettingsVector.size());
+    mResults.clear();
+    mResults.resize(num_models);
+
+    // Nested parallelism is only enabled if each model uses more than one thread.
+    const int max_active_levels = omp_get_max_active_levels();
+    omp_set_max_active_levels( (mNumInnerThreads > 1) ? 2 : 1 );
+
+    const int num_outer_threads = static_cast<int>(std::min<IndexType>(mNumOuterThreads, std::max(num_models, 1)));
+    const int num_inner_threads = static_cast<int>(mNumInnerThreads);
+    #pragma omp parallel num_threads(num_outer_threads)
+    {
+        // Only affects parallel regions inside this thread (i.e. within EmbeddedModel).
+        omp_set_num_threads(num_inner_threads);
+
+        // Large and small models are mixed. Hence, dynamic scheduling with chunk size 1.
+        #pragma omp for schedule(dynamic, 1)
+        for( int i = 0; i < num_models; ++i ){
+            mResults[i] = RunModel(mSettingsVector[i]);
+        }
+    }
+
+    omp_set_max_active_levels(max_active_levels);
+    mElapsedTime = timer.Measure();
+
+    return mResults;
+}
+
+BatchRunner::BatchResult BatchRunner::RunModel(const Settings& rSettings) {
+    BatchResult result{};
+    result.input_filename = rSettings[MainSettings::general_settings].GetValue<std::string>(GeneralSettings::input_filename);
+
+    Timer timer{};
+    // Exceptions must not leave the OpenMP region.
+    try {
+        EmbeddedModel embedded_model(rSettings);
+        embedded_model.CreateAllFromSettings();
+
+        const auto& r_model_info = embedded_model.GetModelInfo();
+        const auto& r_grid_info = r_model_info[MainInfo::background_grid_info];
+        const auto& r_quad_info = r_model_info[MainInfo::quadrature_info];
+        result.num_active_elements = r_grid_info.GetValue<IndexType>(BackgroundGridInfo::num_active_elements);
+        result.num_trimmed_elements = r_grid_info.GetValue<IndexType>(BackgroundGridInfo::num_trimmed_elements);
+        result.tot_num_points = r_quad_info.GetValue<IndexType>(QuadratureInfo::tot_num_points);
+        result.volume_error = std::abs(r_quad_info.GetValue<double>(QuadratureInfo::percentage_of_geometry_volume) - 100.0) / 100.0;
+        result.success = true;
+    }
+    catch( const std::exception& rException ){
+        result.success = false;
+        result.error_message = rException.what();
+    }
+    result.elapsed_time = timer.Measure();
+
+    return result;
+}
+
+double BatchRunner::GetAccumulatedModelTime() const {
+    double accumulated_time = 0.0;
+    for( const auto& r_result : mResults ){
+        accumulated_time += r_result.elapsed_time;
+    }
+    return accumulated_time;
+}
+
+IndexType BatchRunner::NumberOfFailedModels() const {
+    IndexType num_failed = 0;
+    for( const auto& r_result : mResults ){
+        num_failed += !r_result.success;
+    }
+    return num_failed;
+}
+
+void BatchRunner::PrintReport(std::ostream& rOStream) const {
+    rOStream << "input_filename, success, elapsed_time, volume_error, num_active_elements, num_trimmed_elements, tot_num_points, error_message\n";
+    for( const auto& r_result : mResults ){
+        // Error message is written on a single line.
+        std::string error_message{};
+        for( const char c : r_result.error_message ){
+            const bool is_space = (c == '\n' || c == '\t' || c == ' ');
+            if( !is_space ){
+                error_message.push_back(c);
+            } else if( !error_message.empty() && error_message.back() != ' ' ){
+                error_message.push_back(' ');
+            }
+        }
+        rOStream << r_result.input_filename << ", " << r_result.success << ", " << r_result.elapsed_time << ", "
+                 << std::scientific << r_result.volume_error << std::defaultfloat << ", " << r_result.num_active_elements << ", "
+                 << r_result.num_trimmed_elements << ", " << r_result.tot_num_points << ", " << error_message << '\n';
+    }
+    rOStream << ":: BatchRunner :: Computed " << mResults.size() << " models (" << NumberOfFailedModels() << " failed) with "
+             << mNumOuterThreads << " x " << mNumInnerThreads << " threads.\n";
+    rOStream << ":: BatchRunner :: Elapsed time: " << mElapsedTime << " sec. Accumulated time of all models: "
+             << GetAccumulatedModelTime() << " sec.\n";
+}
+
+} // End namespace queso
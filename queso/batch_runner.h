@@ -0,0 +1,151 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#ifndef BATCH_RUNNER_INCLUDE_H
+#define BATCH_RUNNER_INCLUDE_H
+
+/// STL includes
+#include <vector>
+#include <string>
+#include <ostream>
+
+/// Project includes
+#include "queso/includes/define.hpp"
+#include "queso/includes/settings.hpp"
+
+namespace queso {
+
+///@name QuESo Classes
+///@{
+
+/**
+ * @class  BatchRunner
+ * @author Manuel Messmer
+ * @brief  Computes many (small) embedded models within one process.
+ * @details Models are scheduled dynamically over 'NumOuterThreads' threads. Each model itself is computed with 'NumInnerThreads'
+ *          threads (nested OpenMP parallelism). For small models, NumInnerThreads=1 yields the best throughput, since a single model
+ *          can not saturate many cores. Each EmbeddedModel is destroyed directly after its results are collected.
+ *          Errors are caught per model and reported in the respective BatchResult. Hence, a flawed model does not abort the batch.
+ * @see    EmbeddedModel.
+**/
+class BatchRunner
+{
+public:
+    ///@name Type Definitions
+    ///@{
+
+    /// @brief Stores results of a single model.
+    struct BatchResult {
+        std::string input_filename;
+        bool success = false;
+        std::string error_message;
+        double elapsed_time = 0.0;
+        double volume_error = 0.0; // Relative error between represented volume and volume of input STL.
+        IndexType num_active_elements = 0;
+        IndexType num_trimmed_elements = 0;
+        IndexType tot_num_points = 0;
+    };
+    typedef std::vector<BatchResult> BatchResultVectorType;
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// @brief Constructor.
+    /// @param NumOuterThreads Number of models that are computed concurrently. If 0, omp_get_max_threads() is used.
+    /// @param NumInnerThreads Number of threads used within each model.
+    BatchRunner(IndexType NumOuterThreads = 0, IndexType NumInnerThreads = 1);
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+    /// @brief Adds model to the batch. Settings are copied.
+    /// @param rSettings
+    void AddModel(const Settings& rSettings);
+
+    /// @brief Computes all models and returns results (in the order in which the models were added).
+    /// @return const BatchResultVectorType&
+    const BatchResultVectorType& Run();
+
+    /// @brief Returns results of last call to Run().
+    /// @return const BatchResultVectorType&
+    const BatchResultVectorType& GetResults() const {
+        return mResults;
+    }
+
+    /// @brief Returns wall-clock time of last call to Run().
+    /// @return double
+    double GetElapsedTime() const {
+        return mElapsedTime;
+    }
+
+    /// @brief Returns sum of the elapsed times of all models of last call to Run().
+    /// @return double
+    double GetAccumulatedModelTime() const;
+
+    /// @brief Returns number of models that failed during last call to Run().
+    /// @return IndexType
+    IndexType NumberOfFailedModels() const;
+
+    /// @brief Prints report (one line per model plus summary) to rOStream.
+    /// @param rOStream
+    void PrintReport(std::ostream& rOStream) const;
+
+    /// @brief Returns number of models added to the batch.
+    /// @return IndexType
+    IndexType NumberOfModels() const {
+        return mSettingsVector.size();
+    }
+
+    /// @brief Returns number of models that are computed concurrently.
+    /// @return IndexType
+    IndexType NumberOfOuterThreads() const {
+        return mNumOuterThreads;
+    }
+
+    /// @brief Returns number of threads used within each model.
+    /// @return IndexType
+    IndexType NumberOfInnerThreads() const {
+        return mNumInnerThreads;
+    }
+
+    ///@}
+
+private:
+
+    ///@name Private Operations
+    ///@{
+
+    /// @brief Computes a single model and collects its results.
+    /// @param rSettings
+    /// @return BatchResult
+    static BatchResult RunModel(const Settings& rSettings);
+
+    ///@}
+    ///@name Private Members
+    ///@{
+
+    IndexType mNumOuterThreads;
+    IndexType mNumInnerThreads;
+    std::vector<Settings> mSettingsVector;
+    BatchResultVectorType mResults;
+    double mElapsedTime = 0.0;
+
+    ///@}
+}; // End class BatchRunner
+///@} // End QuESo classes
+
+} // End namespace queso
+
+#endif // BATCH_RUNNER_INCLUDE_H
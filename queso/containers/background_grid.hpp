@@ -21,6 +21,8 @@
 #include "queso/containers/grid_indexer.hpp"
 #include "queso/containers/element.hpp"
 #include "queso/containers/condition.hpp"
+#include "queso/containers/face_adjacency.hpp"
+#include "queso/quadrature/integration_points_1d/integration_points_factory_1d.h"
 #include "queso/includes/settings.hpp"
 
 namespace queso {
@@ -297,6 +299,114 @@ public:
         return mGridIndexer.IsEnd(CurrentId-1, Direction);
     }
 
+    /// @brief Computes the face-adjacency of all active elements in CSR format (see: FaceAdjacency).
+    ///        Neighbours are found via the strides of GridIndexer. Only faces shared by two active elements are stored.
+    /// @param OnlyGhostFaces If true, only faces of trimmed elements are stored (i.e., faces with at least one trimmed adjacent element).
+    /// @param ComputeFacePoints If true, Gauss points are stored on each face.
+    /// @param FaceOrder Polynomial order that is integrated exactly by the face points (in both tangential directions).
+    /// @return FaceAdjacency
+    FaceAdjacency ComputeFaceAdjacency(bool OnlyGhostFaces=false, bool ComputeFacePoints=false, IndexType FaceOrder=1) const {
+        typedef FaceAdjacency::FlagType FlagType;
+        const int num_elements = static_cast<int>(NumberOfActiveElements());
+
+        FaceAdjacency adjacency;
+        adjacency.mElementIds.resize(num_elements);
+        adjacency.mOffsets.assign(num_elements+1, 0);
+
+        // Returns the neighbour in the given direction. nullptr, if no active neighbour exists.
+        auto p_get_neighbour = [this](IndexType ElementId, IndexType Direction) -> const ElementType* {
+            const auto [next_index, index_info] = mGridIndexer.GetNextIndex(ElementId-1, Direction);
+            if( index_info != GridIndexer::IndexInfo::middle ){
+                return nullptr;
+            }
+            return pGetElement(next_index+1);
+        };
+
+        // Count faces of each row.
+        #pragma omp parallel for
+        for( int i = 0; i < num_elements; ++i ){
+            const auto& r_element = *mElements[i];
+            adjacency.mElementIds[i] = r_element.GetId();
+            IndexType count = 0;
+            for( IndexType direction = 0; direction < 6; ++direction ){
+                const ElementType* p_neighbour = p_get_neighbour(r_element.GetId(), direction);
+                if( p_neighbour && (!OnlyGhostFaces || r_element.IsTrimmed() || p_neighbour->IsTrimmed()) ){
+                    ++count;
+                }
+            }
+            adjacency.mOffsets[i+1] = count;
+        }
+        for( int i = 0; i < num_elements; ++i ){
+            adjacency.mOffsets[i+1] += adjacency.mOffsets[i];
+        }
+
+        const IndexType num_entries = adjacency.mOffsets[num_elements];
+        adjacency.mNeighbourIds.resize(num_entries);
+        adjacency.mDirections.resize(num_entries);
+        adjacency.mFlags.resize(num_entries);
+
+        // Face points: Each face holds the same number of points.
+        const auto& r_ip_list = IntegrationPointFactory1D::GetGauss(FaceOrder, IntegrationMethod::gauss);
+        const IndexType num_points_per_face = r_ip_list.size()*r_ip_list.size();
+        if( ComputeFacePoints ){
+            adjacency.mFacePointOffsets.resize(num_entries+1);
+            for( IndexType j = 0; j < num_entries+1; ++j ){
+                adjacency.mFacePointOffsets[j] = j*num_points_per_face;
+            }
+            adjacency.mFacePoints.resize(3*num_entries*num_points_per_face);
+            adjacency.mFaceWeights.resize(num_entries*num_points_per_face);
+        }
+
+        // Fill entries.
+        #pragma omp parallel for
+        for( int i = 0; i < num_elements; ++i ){
+            const auto& r_element = *mElements[i];
+            IndexType entry = adjacency.mOffsets[i];
+            for( IndexType direction = 0; direction < 6; ++direction ){
+                const ElementType* p_neighbour = p_get_neighbour(r_element.GetId(), direction);
+                if( !p_neighbour || (OnlyGhostFaces && !r_element.IsTrimmed() && !p_neighbour->IsTrimmed()) ){
+                    continue;
+                }
+                FlagType flags = 0;
+                if( r_element.IsTrimmed() ){
+                    flags |= FaceAdjacency::element_is_trimmed;
+                }
+                if( p_neighbour->IsTrimmed() ){
+                    flags |= FaceAdjacency::neighbour_is_trimmed;
+                }
+                adjacency.mNeighbourIds[entry] = p_neighbour->GetId();
+                adjacency.mDirections[entry] = static_cast<FaceAdjacency::DirectionType>(direction);
+                adjacency.mFlags[entry] = flags;
+
+                if( ComputeFacePoints ){
+                    // Normal axis and tangential axes of the face.
+                    const IndexType axis = direction / 2;
+                    const IndexType axis_t1 = (axis+1) % 3;
+                    const IndexType axis_t2 = (axis+2) % 3;
+                    const auto& r_bounds = r_element.GetBoundsXYZ();
+                    const double coordinate = (direction % 2 == 0) ? r_bounds.second[axis] : r_bounds.first[axis];
+                    const double length_t1 = r_bounds.second[axis_t1] - r_bounds.first[axis_t1];
+                    const double length_t2 = r_bounds.second[axis_t2] - r_bounds.first[axis_t2];
+
+                    IndexType point_index = entry*num_points_per_face;
+                    for( const auto& r_ip_t1 : r_ip_list ){
+                        for( const auto& r_ip_t2 : r_ip_list ){
+                            double* p_point = &adjacency.mFacePoints[3*point_index];
+                            p_point[axis] = coordinate;
+                            p_point[axis_t1] = r_bounds.first[axis_t1] + length_t1*r_ip_t1[0];
+                            p_point[axis_t2] = r_bounds.first[axis_t2] + length_t2*r_ip_t2[0];
+                            adjacency.mFaceWeights[point_index] = r_ip_t1[1]*length_t1*r_ip_t2[1]*length_t2;
+                            ++point_index;
+                        }
+                    }
+                }
+                ++entry;
+            }
+        }
+
+        return adjacency;
+    }
+
     /// @brief Returns the volume stored on all integration points.
     /// @return double.
     /// @todo Remove this function
@@ -83,6 +83,12 @@ public:
         return *mpTriangleMesh;
     }
 
+    /// @brief Returns index of the background grid cell that contains this ConditionSegment. @see GridIndexer.
+    /// @return IndexType
+    IndexType GetBackgroundGridIndex() const {
+        return mBackgroundGridIndex;
+    }
+
     /// @brief Returns true if ConditionSegment is contained within in active parent element.
     /// @return bool
     bool IsInActiveElement() const {
@@ -34,7 +34,7 @@ namespace queso {
  * @class  KeyValuePair
  * @author Manuel Messmer
  * @brief  Stores Key/Value pairs. Keys are stored as TVariantKeyType. Values are stored as VariantValueType, which is hard-coded to:
- *         std::variant<PointType, Vector3i, bool, double, IndexType, std::string, IntegrationMethodType, GridTypeType>.
+ *         std::variant<PointType, Vector3i, bool, double, IndexType, std::string, IntegrationMethodType, GridTypeType, InsideTestMethodType, NNLSSolverType>.
  * @tparam TVariantKey. This should be an pack of enum classes, wrapped inside an std::variant<...enum class>.
  * @see    Dictionary, which uses KeyValuePair.
 **/
@@ -45,7 +45,7 @@ public:
     ///@name Type definitions
     ///@{
 
-    typedef std::variant<PointType, Vector3i, bool, double, IndexType, std::string, IntegrationMethodType, GridTypeType> VariantValueType;
+    typedef std::variant<PointType, Vector3i, bool, double, IndexType, std::string, IntegrationMethodType, GridTypeType, InsideTestMethodType, NNLSSolverType> VariantValueType;
 
     ///@}
     ///@name Life cycle
@@ -212,6 +212,8 @@ private:
         std::string operator()(const bool& rValue){return "bool"; };
         std::string operator()(const IntegrationMethodType& rValue){return "IntegrationMethod"; };
         std::string operator()(const GridTypeType& rValue){return "GridType"; };
+        std::string operator()(const InsideTestMethodType& rValue){return "InsideTestMethod"; };
+        std::string operator()(const NNLSSolverType& rValue){return "NNLSSolver"; };
     };
 
     /// Visit struct to print values in JSON format.
@@ -226,6 +228,8 @@ private:
         void operator()(const bool& rValue){std::string out = (rValue) ? "true" : "false"; mOstream << out; };
         void operator()(const IntegrationMethodType& rValue){ mOstream << '\"' << rValue << '\"'; };
         void operator()(const GridTypeType& rValue){ mOstream << '\"' << rValue << '\"'; };
+        void operator()(const InsideTestMethodType& rValue){ mOstream << '\"' << rValue << '\"'; };
+        void operator()(const NNLSSolverType& rValue){ mOstream << '\"' << rValue << '\"'; };
 
     private:
         std::ostream& mOstream;
@@ -272,7 +276,7 @@ struct DictStarts {
  *    When we now want to e.g. access the first KeyValuePair, we just have to substract 'start_values = 256' from the enum.
  *    Hence, we get {0, 1, 0, 1, 0, 1}.
  *
- * @see KeyValuePair. Possible ValueTypes are: PointType, Vector3i, bool, double, IndexType, std::string, IntegrationMethodType, GridTypeType.
+ * @see KeyValuePair. Possible ValueTypes are: PointType, Vector3i, bool, double, IndexType, std::string, IntegrationMethodType, GridTypeType, InsideTestMethodType, NNLSSolverType.
  * @see Settings. Settings derives from Dictionary.
  * @see ModelInfo. ModelInfo derives from Dictionary.
  * @tparam TEnumKeys. This should be a pack of enum classes.
@@ -19,6 +19,7 @@
 //// Project includes
 #include "queso/includes/define.hpp"
 #include "queso/embedding/trimmed_domain.h"
+#include "queso/containers/shape_sensitivities.hpp"
 #include "queso/utilities/mapping_utilities.hpp"
 
 namespace queso {
@@ -32,6 +33,7 @@ namespace queso {
  * @brief  Container to store data on element level.
  *         Is is defined by a simpe bounding box in physical and in parametric space.
  *         Stores quadrature points and trimmed domain (if element is trimmed).
+ *         Optionally, stores the shape sensitivities of the integration weights (see: ShapeSensitivities).
  * @tparam TIntegrationPointType
  * @tparam TBoundaryIntegrationPointType
  * @see    background_grid.hpp
@@ -52,6 +54,7 @@ public:
     typedef std::vector<IntegrationPointType> IntegrationPointVectorType;
     typedef std::vector<BoundaryIntegrationPointType> BoundaryIntegrationPointVectorType;
     typedef Unique<TrimmedDomain> TrimmedDomainPtrType;
+    typedef Unique<ShapeSensitivities> ShapeSensitivitiesPtrType;
 
     ///@}
     ///@name Life Cycle
@@ -63,7 +66,7 @@ public:
     ///@param rBoundUVW Bounds of Element in parametric space.
     Element(IndexType ElementId, const BoundingBoxType& rBoundXYZ, const BoundingBoxType& rBoundUVW) :
                 mElementId(ElementId), mIsTrimmed(false), mIsVisited(false), mBoundsXYZ(rBoundXYZ),
-                mBoundsUVW(rBoundUVW), mpTrimmedDomain(nullptr)
+                mBoundsUVW(rBoundUVW), mpTrimmedDomain(nullptr), mpShapeSensitivities(nullptr)
     {
     }
 
@@ -171,11 +174,36 @@ public:
         return mpTrimmedDomain.get();
     }
 
+    /// @brief Returns true, if trimmed domain is set. Elements restored from a checkpoint might not store their trimmed domain.
+    /// @return bool
+    bool HasTrimmedDomain() const {
+        return mpTrimmedDomain != nullptr;
+    }
+
     /// @brief Clear trimmed domain of element.
     void ClearTrimmedDomain(){
         mpTrimmedDomain = nullptr;
     }
 
+    /// @brief Set shape sensitivities of the integration weights.
+    /// @param pShapeSensitivities Ptr (Unique) to new shape sensitivities.
+    void pSetShapeSensitivities(ShapeSensitivitiesPtrType& pShapeSensitivities){
+        mpShapeSensitivities = std::move(pShapeSensitivities);
+    }
+
+    /// @brief Returns true, if shape sensitivities are set (see: TrimmedQuadratureRuleSettings::compute_shape_sensitivities).
+    /// @return bool
+    bool HasShapeSensitivities() const {
+        return mpShapeSensitivities != nullptr;
+    }
+
+    /// @brief Returns shape sensitivities of the integration weights.
+    /// @return const ShapeSensitivities&
+    const ShapeSensitivities& GetShapeSensitivities() const {
+        QuESo_ERROR_IF( !mpShapeSensitivities ) << "Shape sensitivities have not been computed.\n";
+        return *mpShapeSensitivities;
+    }
+
     /// @brief Set neighbour coefficient. Required for assembly of GGQ rule. See: multiple_elements.hpp.
     /// @param Value New Value.
     /// @param Direction Space Direction: 0-x, 1-y, 2-z.
@@ -218,6 +246,7 @@ private:
     const BoundingBoxType mBoundsUVW;
 
     TrimmedDomainPtrType mpTrimmedDomain;
+    ShapeSensitivitiesPtrType mpShapeSensitivities;
 
     /// @todo Remove this member
     PointType mNumberOfNeighbours;
@@ -0,0 +1,165 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#ifndef FACE_ADJACENCY_INCLUDE_HPP
+#define FACE_ADJACENCY_INCLUDE_HPP
+
+//// STL includes
+#include <vector>
+#include <cstdint>
+//// Project includes
+#include "queso/includes/define.hpp"
+
+namespace queso {
+
+///@name QuESo Classes
+///@{
+
+/**
+ * @class  FaceAdjacency
+ * @author Manuel Messmer
+ * @brief  Face-adjacency of the active elements of a BackgroundGrid in compressed sparse row (CSR) format.
+ * @details Row i corresponds to the i-th active element (see: BackgroundGrid::GetElements()), whose id is ElementIds()[i].
+ *          The entries of row i are stored in [Offsets()[i], Offsets()[i+1]). Each entry represents one face shared with an active
+ *          neighbour and stores the id of the neighbour, the direction of the face (0:+x, 1:-x, 2:+y, 3:-y, 4:+z, 5:-z; see: GridIndexer)
+ *          and the flags (see: FaceAdjacency::FlagType). Interior faces appear twice, once in the row of each adjacent element.
+ *          Optionally, tensor-product Gauss points are stored on each face. The points of entry j are stored in
+ *          [FacePointOffsets()[j], FacePointOffsets()[j+1]). Points are given in global coordinates (x,y,z, flattened) and
+ *          the weights are scaled by the area of the face. Note that trimmed faces are integrated over the entire face.
+ * @see    BackgroundGrid::ComputeFaceAdjacency().
+**/
+class FaceAdjacency {
+
+public:
+    ///@name Type Definitions
+    ///@{
+
+    typedef std::uint8_t FlagType;
+    typedef std::uint8_t DirectionType;
+
+    /// Bit flags of each entry. Faces with any flag set are ghost faces (faces of cut cells).
+    enum Flags : FlagType {element_is_trimmed = 1, neighbour_is_trimmed = 2};
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+    /// @brief Returns number of rows (number of active elements).
+    /// @return IndexType
+    IndexType NumberOfRows() const {
+        return mElementIds.size();
+    }
+
+    /// @brief Returns number of entries (number of stored faces).
+    /// @return IndexType
+    IndexType NumberOfEntries() const {
+        return mNeighbourIds.size();
+    }
+
+    /// @brief Returns total number of face points.
+    /// @return IndexType
+    IndexType NumberOfFacePoints() const {
+        return mFaceWeights.size();
+    }
+
+    /// @brief Returns true, if face points are stored.
+    /// @return bool
+    bool HasFacePoints() const {
+        return !mFacePointOffsets.empty();
+    }
+
+    /// @brief Returns true, if the given flags denote a ghost face, i.e., a face of a trimmed element.
+    /// @param Flags
+    /// @return bool
+    static bool IsGhostFace(FlagType Flags) {
+        return Flags != 0;
+    }
+
+    /// @brief Returns the row offsets. Size: NumberOfRows()+1.
+    /// @return const std::vector<IndexType>&
+    const std::vector<IndexType>& Offsets() const {
+        return mOffsets;
+    }
+
+    /// @brief Returns the element id of each row. Size: NumberOfRows().
+    /// @return const std::vector<IndexType>&
+    const std::vector<IndexType>& ElementIds() const {
+        return mElementIds;
+    }
+
+    /// @brief Returns the neighbour id of each entry. Size: NumberOfEntries().
+    /// @return const std::vector<IndexType>&
+    const std::vector<IndexType>& NeighbourIds() const {
+        return mNeighbourIds;
+    }
+
+    /// @brief Returns the face direction of each entry (0:+x, 1:-x, 2:+y, 3:-y, 4:+z, 5:-z). Size: NumberOfEntries().
+    /// @return const std::vector<DirectionType>&
+    const std::vector<DirectionType>& Directions() const {
+        return mDirections;
+    }
+
+    /// @brief Returns the flags of each entry (see: FaceAdjacency::Flags). Size: NumberOfEntries().
+    /// @return const std::vector<FlagType>&
+    const std::vector<FlagType>& GetFlags() const {
+        return mFlags;
+    }
+
+    /// @brief Returns the face point offsets. Size: NumberOfEntries()+1, or 0 if no face points are stored.
+    /// @return const std::vector<IndexType>&
+    const std::vector<IndexType>& FacePointOffsets() const {
+        return mFacePointOffsets;
+    }
+
+    /// @brief Returns the global coordinates of all face points (x0, y0, z0, x1, ...). Size: 3*NumberOfFacePoints().
+    /// @return const std::vector<double>&
+    const std::vector<double>& FacePoints() const {
+        return mFacePoints;
+    }
+
+    /// @brief Returns the weights of all face points. Size: NumberOfFacePoints().
+    /// @return const std::vector<double>&
+    const std::vector<double>& FaceWeights() const {
+        return mFaceWeights;
+    }
+
+private:
+
+    ///@}
+    ///@name Private member variables
+    ///@{
+
+    std::vector<IndexType> mOffsets;
+    std::vector<IndexType> mElementIds;
+    std::vector<IndexType> mNeighbourIds;
+    std::vector<DirectionType> mDirections;
+    std::vector<FlagType> mFlags;
+
+    std::vector<IndexType> mFacePointOffsets;
+    std::vector<double> mFacePoints;
+    std::vector<double> mFaceWeights;
+
+    ///@}
+    ///@name Friends
+    ///@{
+
+    template<typename TElementType>
+    friend class BackgroundGrid;
+
+    ///@}
+}; // End class FaceAdjacency
+///@} // End QuESo classes
+
+} // End namespace queso
+
+#endif // FACE_ADJACENCY_INCLUDE_HPP
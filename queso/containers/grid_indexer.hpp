@@ -14,6 +14,9 @@
 #ifndef GRID_INDEXER_INCLUDE_HPP
 #define GRID_INDEXER_INCLUDE_HPP
 
+//// STL includes
+#include <algorithm>
+#include <cmath>
 //// Project includes
 #include "queso/includes/define.hpp"
 #include "queso/utilities/math_utilities.hpp"
@@ -144,6 +147,25 @@ public:
         return mBoundUVW;
     }
 
+    /// @brief Returns the range of trivariate indices (first, last) of all elements, whose bounding box in physical space overlaps
+    ///        the given AABB enlarged by Tolerance. Indices are clamped to the grid.
+    /// @param rLowerBound Lower bound of AABB.
+    /// @param rUpperBound Upper bound of AABB.
+    /// @param Tolerance
+    /// @return PartitionBoxType
+    inline PartitionBoxType GetIndexRangeXYZ(const PointType& rLowerBound, const PointType& rUpperBound, double Tolerance) const {
+        PartitionBoxType range{};
+        for( IndexType dir = 0; dir < 3; ++dir ){
+            const double delta = std::abs(mBoundXYZ.second[dir] - mBoundXYZ.first[dir]) / (mNumberOfElements[dir]);
+            const double upper = static_cast<double>(mNumberOfElements[dir]-1);
+            const double first = std::floor((rLowerBound[dir] - Tolerance - mBoundXYZ.first[dir]) / delta);
+            const double last = std::floor((rUpperBound[dir] + Tolerance - mBoundXYZ.first[dir]) / delta);
+            range.first[dir] = static_cast<IndexType>(std::max(0.0, std::min(first, upper)));
+            range.second[dir] = static_cast<IndexType>(std::max(0.0, std::min(last, upper)));
+        }
+        return range;
+    }
+
     /// @brief Returns global number of elements (including inactive elements).
     /// @return IndexType.
     inline IndexType NumberOfElements() const {
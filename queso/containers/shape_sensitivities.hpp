@@ -0,0 +1,106 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#ifndef SHAPE_SENSITIVITIES_INCLUDE_HPP
+#define SHAPE_SENSITIVITIES_INCLUDE_HPP
+
+//// STL includes
+#include <vector>
+//// Project includes
+#include "queso/includes/define.hpp"
+
+namespace queso {
+
+///@name QuESo Classes
+///@{
+
+/**
+ * @class  ShapeSensitivities
+ * @author Manuel Messmer
+ * @brief  Stores the derivatives of the integration weights of a trimmed element with respect to the positions of the vertices
+ *         of the embedded triangle mesh (sparse: only vertices of triangles that intersect the element are stored).
+ * @details The derivative of the weight of point p with respect to coordinate d (0:x, 1:y, 2:z) of the i-th stored vertex (global id: VertexIds()[i])
+ *          is stored at Derivatives()[(i*NumberOfPoints() + p)*3 + d]. The points refer to Element::GetIntegrationPoints() and the weights are
+ *          scaled in the same way (divided by det(J)).
+ * @see    QuadratureTrimmedElement::ComputeShapeSensitivities().
+**/
+class ShapeSensitivities {
+
+public:
+    ///@name Life Cycle
+    ///@{
+
+    /// @brief Constructor.
+    /// @param rVertexIds Global ids of the vertices.
+    /// @param rDerivatives Size: rVertexIds.size()*NumberOfPoints*3.
+    /// @param NumberOfPoints Number of integration points of the element.
+    ShapeSensitivities(std::vector<IndexType>&& rVertexIds, std::vector<double>&& rDerivatives, IndexType NumberOfPoints)
+        : mVertexIds(std::move(rVertexIds)), mDerivatives(std::move(rDerivatives)), mNumberOfPoints(NumberOfPoints)
+    {
+        QuESo_ERROR_IF( mDerivatives.size() != 3*mNumberOfPoints*mVertexIds.size() ) << "Size of derivatives does not match.\n";
+    }
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+    /// @brief Returns number of stored vertices.
+    /// @return IndexType
+    IndexType NumberOfVertices() const {
+        return mVertexIds.size();
+    }
+
+    /// @brief Returns number of integration points.
+    /// @return IndexType
+    IndexType NumberOfPoints() const {
+        return mNumberOfPoints;
+    }
+
+    /// @brief Returns global ids of the stored vertices (sorted in ascending order).
+    /// @return const std::vector<IndexType>&
+    const std::vector<IndexType>& VertexIds() const {
+        return mVertexIds;
+    }
+
+    /// @brief Returns all derivatives. Size: NumberOfVertices()*NumberOfPoints()*3.
+    /// @return const std::vector<double>&
+    const std::vector<double>& Derivatives() const {
+        return mDerivatives;
+    }
+
+    /// @brief Returns derivative of the weight of point PointIndex with respect to coordinate Direction of the VertexIndex-th stored vertex.
+    /// @param VertexIndex Local index of vertex (see: VertexIds()).
+    /// @param PointIndex
+    /// @param Direction 0:x, 1:y, 2:z.
+    /// @return double
+    double Derivative(IndexType VertexIndex, IndexType PointIndex, IndexType Direction) const {
+        return mDerivatives[(VertexIndex*mNumberOfPoints + PointIndex)*3 + Direction];
+    }
+
+    ///@}
+private:
+
+    ///@name Private member variables
+    ///@{
+
+    std::vector<IndexType> mVertexIds;
+    std::vector<double> mDerivatives;
+    IndexType mNumberOfPoints;
+
+    ///@}
+}; // End class ShapeSensitivities
+///@} // End QuESo classes
+
+} // End namespace queso
+
+#endif // SHAPE_SENSITIVITIES_INCLUDE_HPP
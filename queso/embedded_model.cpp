@@ -13,14 +13,22 @@
 
 //// STL includes
 #include <omp.h>
+#include <sstream>
+#include <algorithm>
+#include <cmath>
 
 //// Project includes
 #include "queso/embedded_model.h"
 #include "queso/io/io_utilities.h"
+#include "queso/io/slab_partitioner.h"
 #include "queso/utilities/mesh_utilities.h"
+#include "queso/utilities/cpu_dispatch.h"
 #include "queso/embedding/brep_operator.h"
+#include "queso/embedding/flood_fill.h"
 #include "queso/quadrature/single_element.hpp"
 #include "queso/quadrature/trimmed_element.hpp"
+#include "queso/quadrature/trimmed_element_tuner.hpp"
+#include "queso/quadrature/background_grid_planner.hpp"
 #include "queso/quadrature/multiple_elements.hpp"
 
 namespace queso {
@@ -36,38 +44,341 @@ void EmbeddedModel::ComputeVolume(const TriangleMeshInterface& rTriangleMesh){
     mModelInfo[MainInfo::embedded_geometry_info].SetValue(EmbeddedGeometryInfo::volume, volume);
     const bool is_closed = MeshUtilities::EstimateQuality(rTriangleMesh) < 1e-10;
     mModelInfo[MainInfo::embedded_geometry_info].SetValue(EmbeddedGeometryInfo::is_closed, is_closed);
+    mModelInfo[MainInfo::embedded_geometry_info].SetValue(EmbeddedGeometryInfo::num_triangles, rTriangleMesh.NumOfTriangles());
+    // SystemInfo
+    std::stringstream instruction_set;
+    instruction_set << CpuDispatch::GetInstructionSet();
+    mModelInfo[MainInfo::system_info].SetValue(SystemInfo::instruction_set, instruction_set.str());
 
     /// Get neccessary settings
-    /// @todo Pass mSettings to all functions.
-    const IntegrationMethod integration_method = mSettings[MainSettings::non_trimmed_quadrature_rule_settings]
-        .GetValue<IntegrationMethod>(NonTrimmedQuadratureRuleSettings::integration_method);
-    const bool ggq_rule_ise_used =  static_cast<int>(integration_method) >= 3;
-    const auto& r_trimmed_quad_rule_settings = mSettings[MainSettings::trimmed_quadrature_rule_settings];
-    const double min_vol_element_ratio = std::max<double>(r_trimmed_quad_rule_settings.GetValue<double>(TrimmedQuadratureRuleSettings::min_element_volume_ratio), 1e-10);
-    const IndexType num_boundary_triangles = r_trimmed_quad_rule_settings.GetValue<IndexType>(TrimmedQuadratureRuleSettings::min_num_boundary_triangles);
-    const double moment_fitting_residual = r_trimmed_quad_rule_settings.GetValue<double>(TrimmedQuadratureRuleSettings::moment_fitting_residual);
-    const bool neglect_elements_if_stl_is_flawed = r_trimmed_quad_rule_settings.GetValue<bool>(TrimmedQuadratureRuleSettings::neglect_elements_if_stl_is_flawed);
-    const auto& r_grid_settings = mSettings[MainSettings::background_grid_settings];
-    const Vector3i polynomial_order = r_grid_settings.GetValue<Vector3i>(BackgroundGridSettings::polynomial_order);
-    const Vector3i number_of_elements = r_grid_settings.GetValue<Vector3i>(BackgroundGridSettings::number_of_elements);
-    const IndexType echo_level = mSettings[MainSettings::general_settings].GetValue<IndexType>(GeneralSettings::echo_level);
+    ElementParameters parameters = GetElementParameters();
+    mDiagnostics.Clear();
+    const bool auto_tuning = mSettings[MainSettings::trimmed_quadrature_rule_settings].GetValue<bool>(TrimmedQuadratureRuleSettings::auto_tuning);
+    const auto& r_general_settings = mSettings[MainSettings::general_settings];
+    const std::string& r_checkpoint_filename = r_general_settings.GetValue<std::string>(GeneralSettings::checkpoint_filename);
 
     // Start timer
     Timer timer_total{};
 
+    // Plan background grid. The grid of this model is fixed. Hence, the proposal is only reported.
+    if( mSettings[MainSettings::background_grid_settings].GetValue<bool>(BackgroundGridSettings::grid_planning) ){
+        PlanBackgroundGrid(rTriangleMesh, mSettings, mModelInfo);
+        const auto& r_proposed = mModelInfo[MainInfo::grid_planning_info].GetValue<Vector3i>(GridPlanningInfo::proposed_number_of_elements);
+        const auto& r_given = mSettings[MainSettings::background_grid_settings].GetValue<Vector3i>(BackgroundGridSettings::number_of_elements);
+        QuESo_INFO_IF(parameters.echo_level > 0 && r_proposed != r_given) << ":: Grid Planning :: Proceeding with the given 'number_of_elements': ["
+            << r_given[0] << ", " << r_given[1] << ", " << r_given[2] << "].\n";
+    }
+
     // Reserve element container
     const IndexType global_number_of_elements = mGridIndexer.NumberOfElements();
     mBackgroundGrid.ReserveElements(global_number_of_elements);
 
-    // Construct BRepOperator
-    BRepOperator brep_operator(rTriangleMesh);
+    // Restore elements from checkpoint (if available) and start new checkpoint.
+    Checkpoint::RecordVectorType checkpoint_records{};
+    std::vector<const Checkpoint::BufferType*> restored_elements(global_number_of_elements, nullptr);
+    const Checkpoint::BufferType* p_restored_classifications = nullptr;
+    if( !r_checkpoint_filename.empty() ){
+        // Shape sensitivities are not serialized.
+        QuESo_ERROR_IF( parameters.compute_shape_sensitivities ) << "'checkpoint_filename' can not be combined with 'compute_shape_sensitivities'.\n";
+        const std::uint64_t volume_hash = ComputeVolumeHash(rTriangleMesh);
+        checkpoint_records = Checkpoint::ReadRecords(r_checkpoint_filename, volume_hash);
+        mRestoredConditions.clear();
+        IndexType num_restored_elements = 0;
+        for( const auto& r_record : checkpoint_records ){
+            if( r_record.type == Checkpoint::RecordType::element && r_record.key < global_number_of_elements ){
+                num_restored_elements += (restored_elements[r_record.key] == nullptr);
+                restored_elements[r_record.key] = &r_record.data;
+            } else if( r_record.type == Checkpoint::RecordType::condition ){
+                mRestoredConditions[r_record.key] = r_record.data;
+            } else if( r_record.type == Checkpoint::RecordType::classification && r_record.data.size() == global_number_of_elements ){
+                p_restored_classifications = &r_record.data;
+            }
+        }
+        QuESo_INFO_IF(parameters.echo_level > 0 && num_restored_elements > 0) << ":: Checkpoint :: Restore " << num_restored_elements
+            << " elements from: '" << r_checkpoint_filename << "'\n";
 
-    // Classify all elements.
+        // File is rewritten. Restored elements are written first.
+        mpCheckpointWriter = MakeUnique<CheckpointWriter>(r_checkpoint_filename, volume_hash,
+            r_general_settings.GetValue<double>(GeneralSettings::checkpoint_interval));
+        if( p_restored_classifications ){
+            Checkpoint::BufferType buffer(*p_restored_classifications);
+            mpCheckpointWriter->AddRecord(Checkpoint::RecordType::classification, 0, buffer);
+        }
+        for( IndexType index = 0; index < global_number_of_elements; ++index ){
+            if( restored_elements[index] ){
+                Checkpoint::BufferType buffer(*restored_elements[index]);
+                mpCheckpointWriter->AddRecord(Checkpoint::RecordType::element, index, buffer);
+            }
+        }
+    }
+
+    // Classify all elements (or restore classification from checkpoint).
     Timer timer_check_intersect{};
-    Unique<BRepOperator::StatusVectorType> p_classifications = brep_operator.pGetElementClassifications(mSettings);
+    Unique<BRepOperator> p_brep_operator = nullptr;
+    Unique<BRepOperator::StatusVectorType> p_classifications = nullptr;
+    if( p_restored_classifications ){
+        p_classifications = MakeUnique<BRepOperator::StatusVectorType>(global_number_of_elements);
+        for( IndexType index = 0; index < global_number_of_elements; ++index ){
+            const auto status = static_cast<std::uint8_t>((*p_restored_classifications)[index]);
+            QuESo_ERROR_IF( status > static_cast<std::uint8_t>(IntersectionState::trimmed) ) << "Checkpoint record is corrupted.\n";
+            (*p_classifications)[index] = static_cast<IntersectionState>(status);
+        }
+    } else {
+        p_brep_operator = MakeUnique<BRepOperator>(rTriangleMesh, mSettings);
+        p_classifications = p_brep_operator->pGetElementClassifications(mSettings);
+        if( mpCheckpointWriter ){
+            Checkpoint::BufferType buffer{};
+            buffer.reserve(global_number_of_elements);
+            for( const auto status : *p_classifications ){
+                Checkpoint::Write(buffer, static_cast<std::uint8_t>(status));
+            }
+            mpCheckpointWriter->AddRecord(Checkpoint::RecordType::classification, 0, buffer);
+        }
+    }
     auto& r_volume_time_info = mModelInfo[MainInfo::elapsed_time_info][ElapsedTimeInfo::volume_time_info];
     r_volume_time_info.SetValue(VolumeTimeInfo::classification_of_elements, timer_check_intersect.Measure());
 
+    // Construct BRepOperator only if there are elements left that must be computed.
+    if( !p_brep_operator ){
+        for( IndexType index = 0; index < global_number_of_elements; ++index ){
+            if( (*p_classifications)[index] != IntersectionState::outside && !restored_elements[index] ){
+                p_brep_operator = MakeUnique<BRepOperator>(rTriangleMesh, mSettings);
+                break;
+            }
+        }
+    }
+
+    // Tune parameters of trimmed elements on a sample of the trimmed cells (if enabled).
+    if( auto_tuning && p_brep_operator ){
+        Timer timer_auto_tuning{};
+        std::vector<IndexType> trimmed_cell_indices{};
+        for( IndexType index = 0; index < global_number_of_elements; ++index ){
+            if( (*p_classifications)[index] == IntersectionState::trimmed && !restored_elements[index] ){
+                trimmed_cell_indices.push_back(index);
+            }
+        }
+        const auto tuning_result = QuadratureTrimmedElementTuner<ElementType>::Tune(*p_brep_operator, mGridIndexer, trimmed_cell_indices, mSettings);
+        parameters.min_num_boundary_triangles = tuning_result.parameters.min_num_boundary_triangles;
+        parameters.init_point_distribution_factor = tuning_result.parameters.init_point_distribution_factor;
+        parameters.max_octree_refinement_level = tuning_result.parameters.max_octree_refinement_level;
+
+        auto& r_auto_tuning_info = mModelInfo[MainInfo::auto_tuning_info];
+        r_auto_tuning_info.SetValue(AutoTuningInfo::min_num_boundary_triangles, parameters.min_num_boundary_triangles);
+        r_auto_tuning_info.SetValue(AutoTuningInfo::init_point_distribution_factor, parameters.init_point_distribution_factor);
+        r_auto_tuning_info.SetValue(AutoTuningInfo::max_octree_refinement_level, parameters.max_octree_refinement_level);
+        r_auto_tuning_info.SetValue(AutoTuningInfo::num_sampled_elements, tuning_result.num_sampled_elements);
+        r_auto_tuning_info.SetValue(AutoTuningInfo::num_candidates, tuning_result.num_candidates);
+        r_auto_tuning_info.SetValue(AutoTuningInfo::volume_error, tuning_result.volume_error);
+        r_auto_tuning_info.SetValue(AutoTuningInfo::speedup, tuning_result.speedup);
+        r_volume_time_info.SetValue(VolumeTimeInfo::auto_tuning, timer_auto_tuning.Measure());
+
+        QuESo_INFO_IF(parameters.echo_level > 0) << ":: Auto Tuning :: Selected parameters: min_num_boundary_triangles: " << parameters.min_num_boundary_triangles
+            << ", init_point_distribution_factor: " << parameters.init_point_distribution_factor << ", max_octree_refinement_level: " << parameters.max_octree_refinement_level
+            << " (Sample: " << tuning_result.num_sampled_elements << " elements, " << tuning_result.num_candidates << " candidates)\n";
+    }
+
+    // Compute all active elements.
+    std::vector<IndexType> active_indices{};
+    for( IndexType index = 0; index < global_number_of_elements; ++index ){
+        if( (*p_classifications)[index] != IntersectionState::outside ){
+            active_indices.push_back(index);
+        }
+    }
+    VolumeStatistics statistics{};
+    ComputeElements(active_indices, *p_classifications, p_brep_operator.get(), restored_elements, parameters, statistics);
+
+    if( mpCheckpointWriter ){
+        mpCheckpointWriter->Flush();
+    }
+
+    if( mSettings[MainSettings::trimmed_quadrature_rule_settings].GetValue<bool>(TrimmedQuadratureRuleSettings::verify_quadrature_rules) ){
+        VerifyQuadratureRules(parameters);
+    }
+
+    FinalizeVolume(volume, parameters, statistics, timer_total);
+}
+
+void EmbeddedModel::ComputeVolumeOutOfCore(const std::string& rFilename){
+    const auto& r_general_settings = mSettings[MainSettings::general_settings];
+    QuESo_ERROR_IF( r_general_settings.GetValue<InsideTestMethod>(GeneralSettings::inside_test_method) != InsideTestMethod::ray_tracing )
+        << "'out_of_core_slab_thickness' requires 'inside_test_method': 'ray_tracing'.\n";
+    QuESo_ERROR_IF( !r_general_settings.GetValue<std::string>(GeneralSettings::checkpoint_filename).empty() )
+        << "'out_of_core_slab_thickness' can not be combined with 'checkpoint_filename'.\n";
+    QuESo_ERROR_IF( mSettings[MainSettings::trimmed_quadrature_rule_settings].GetValue<bool>(TrimmedQuadratureRuleSettings::auto_tuning) )
+        << "'out_of_core_slab_thickness' can not be combined with 'auto_tuning'.\n";
+    QuESo_ERROR_IF( r_general_settings.GetValue<double>(GeneralSettings::mesh_decimation_tolerance) > 0.0 )
+        << "'out_of_core_slab_thickness' can not be combined with 'mesh_decimation_tolerance'.\n";
+    QuESo_ERROR_IF( mSettings[MainSettings::background_grid_settings].GetValue<bool>(BackgroundGridSettings::grid_planning) )
+        << "'out_of_core_slab_thickness' can not be combined with 'grid_planning'.\n";
+    QuESo_ERROR_IF( mSettings[MainSettings::trimmed_quadrature_rule_settings].GetValue<bool>(TrimmedQuadratureRuleSettings::compute_shape_sensitivities) )
+        << "'out_of_core_slab_thickness' can not be combined with 'compute_shape_sensitivities'.\n";
+
+    const ElementParameters parameters = GetElementParameters();
+    mDiagnostics.Clear();
+
+    // Start timer
+    Timer timer_total{};
+
+    // Stream input file into slabs.
+    SlabPartitioner slab_partitioner(rFilename, mSettings);
+    QuESo_INFO_IF(parameters.echo_level > 0) << ":: Out-Of-Core :: Split " << slab_partitioner.NumberOfTriangles() << " triangles into "
+        << slab_partitioner.NumberOfSlabs() << " slabs.\n";
+
+    CheckIfMeshIsWithinBoundingBox(slab_partitioner.GetBoundingBox());
+
+    /// Set ModelInfo
+    // EmbeddedGeometryInfo
+    const double volume = slab_partitioner.Volume();
+    mModelInfo[MainInfo::embedded_geometry_info].SetValue(EmbeddedGeometryInfo::volume, volume);
+    const bool is_closed = slab_partitioner.EstimateQuality() < 1e-10;
+    mModelInfo[MainInfo::embedded_geometry_info].SetValue(EmbeddedGeometryInfo::is_closed, is_closed);
+    mModelInfo[MainInfo::embedded_geometry_info].SetValue(EmbeddedGeometryInfo::num_triangles, slab_partitioner.NumberOfTriangles());
+    // SystemInfo
+    std::stringstream instruction_set;
+    instruction_set << CpuDispatch::GetInstructionSet();
+    mModelInfo[MainInfo::system_info].SetValue(SystemInfo::instruction_set, instruction_set.str());
+
+    // Reserve element container
+    const IndexType global_number_of_elements = mGridIndexer.NumberOfElements();
+    mBackgroundGrid.ReserveElements(global_number_of_elements);
+
+    // Process slab by slab. Only the triangles of the current slab are kept in memory.
+    double et_classification = 0.0;
+    BRepOperator::StatusVectorType classifications(global_number_of_elements, IntersectionState::outside);
+    FloodFill::GroupSetVectorType groups{};
+    FloodFill::BoundaryIndicesVectorType boundary_indices{};
+    const auto& r_partitions = slab_partitioner.GetPartitions();
+    const std::vector<const Checkpoint::BufferType*> restored_elements{};
+    VolumeStatistics statistics{};
+    for( IndexType slab_index = 0; slab_index < slab_partitioner.NumberOfSlabs(); ++slab_index ){
+        TriangleMesh slab_mesh{};
+        slab_partitioner.ReadSlab(slab_index, slab_mesh);
+        BRepOperator brep_operator(slab_mesh, mSettings);
+        brep_operator.SetSlabDirection(slab_partitioner.GetDirection());
+
+        // Find trimmed elements and groups of non-trimmed elements.
+        Timer timer_check_intersect{};
+        FloodFill flood_fill(&brep_operator, mSettings);
+        flood_fill.FillPartition(slab_index, r_partitions, groups, boundary_indices, classifications);
+        et_classification += timer_check_intersect.Measure();
+
+        // Compute trimmed elements of this slab.
+        std::vector<IndexType> trimmed_indices{};
+        const auto& r_partition = r_partitions[slab_index];
+        for( IndexType i = r_partition.first[0]; i <= r_partition.second[0]; ++i ){
+            for( IndexType j = r_partition.first[1]; j <= r_partition.second[1]; ++j ){
+                for( IndexType k = r_partition.first[2]; k <= r_partition.second[2]; ++k ){
+                    const IndexType index = mGridIndexer.GetVectorIndexFromMatrixIndices(i, j, k);
+                    if( classifications[index] == IntersectionState::trimmed ){
+                        trimmed_indices.push_back(index);
+                    }
+                }
+            }
+        }
+        std::sort(trimmed_indices.begin(), trimmed_indices.end());
+        ComputeElements(trimmed_indices, classifications, &brep_operator, restored_elements, parameters, statistics);
+    }
+
+    // Classify groups of all slabs. No triangles are required.
+    Timer timer_classify_groups{};
+    FloodFill flood_fill(nullptr, mSettings);
+    FloodFill::GroupSetVectorType merged_groups{};
+    flood_fill.ClassifyGroups(groups, boundary_indices, merged_groups, classifications);
+    et_classification += timer_classify_groups.Measure();
+    auto& r_volume_time_info = mModelInfo[MainInfo::elapsed_time_info][ElapsedTimeInfo::volume_time_info];
+    r_volume_time_info.SetValue(VolumeTimeInfo::classification_of_elements, et_classification);
+
+    // Compute inside elements.
+    std::vector<IndexType> inside_indices{};
+    for( IndexType index = 0; index < global_number_of_elements; ++index ){
+        if( classifications[index] == IntersectionState::inside ){
+            inside_indices.push_back(index);
+        }
+    }
+    ComputeElements(inside_indices, classifications, nullptr, restored_elements, parameters, statistics);
+
+    if( mSettings[MainSettings::trimmed_quadrature_rule_settings].GetValue<bool>(TrimmedQuadratureRuleSettings::verify_quadrature_rules) ){
+        VerifyQuadratureRules(parameters);
+    }
+
+    FinalizeVolume(volume, parameters, statistics, timer_total);
+}
+
+void EmbeddedModel::ComputeVolume2D(const BRepOperator2D& rBRepOperator){
+    const auto& r_general_settings = mSettings[MainSettings::general_settings];
+    const auto& r_grid_settings = mSettings[MainSettings::background_grid_settings];
+    const auto& r_trimmed_settings = mSettings[MainSettings::trimmed_quadrature_rule_settings];
+    QuESo_ERROR_IF( r_grid_settings.GetValue<Vector3i>(BackgroundGridSettings::number_of_elements)[2] != 1 )
+        << "2D mode requires a single element in z-direction ('number_of_elements'[2] = 1).\n";
+    QuESo_ERROR_IF( !r_general_settings.GetValue<std::string>(GeneralSettings::checkpoint_filename).empty() )
+        << "2D mode can not be combined with 'checkpoint_filename'.\n";
+    QuESo_ERROR_IF( r_grid_settings.GetValue<bool>(BackgroundGridSettings::grid_planning) )
+        << "2D mode can not be combined with 'grid_planning'.\n";
+    QuESo_ERROR_IF( r_trimmed_settings.GetValue<bool>(TrimmedQuadratureRuleSettings::auto_tuning) )
+        << "2D mode can not be combined with 'auto_tuning'.\n";
+    QuESo_ERROR_IF( r_trimmed_settings.GetValue<bool>(TrimmedQuadratureRuleSettings::verify_quadrature_rules) )
+        << "2D mode can not be combined with 'verify_quadrature_rules'.\n";
+    QuESo_ERROR_IF( r_trimmed_settings.GetValue<bool>(TrimmedQuadratureRuleSettings::compute_shape_sensitivities) )
+        << "2D mode can not be combined with 'compute_shape_sensitivities'.\n";
+
+    // Moments are constant in z-direction.
+    ElementParameters parameters = GetElementParameters();
+    QuESo_ERROR_IF( parameters.ggq_rule_is_used ) << "2D mode does not support GGQ rules.\n";
+    parameters.polynomial_order[2] = 0;
+    mDiagnostics.Clear();
+
+    // Start timer
+    Timer timer_total{};
+
+    const double lower_bound_z = r_grid_settings.GetValue<PointType>(BackgroundGridSettings::lower_bound_xyz)[2];
+    const double upper_bound_z = r_grid_settings.GetValue<PointType>(BackgroundGridSettings::upper_bound_xyz)[2];
+    BoundingBoxType bounding_box = rBRepOperator.GetBoundingBox();
+    bounding_box.first[2] = lower_bound_z;
+    bounding_box.second[2] = upper_bound_z;
+    CheckIfMeshIsWithinBoundingBox(bounding_box);
+
+    /// Set ModelInfo
+    // EmbeddedGeometryInfo: The domain is the prism, which is spanned by the polylines and the z-range of the background grid.
+    const double area = rBRepOperator.Area();
+    QuESo_ERROR_IF( area <= 0.0 ) << "Polylines must be oriented counter-clockwise (holes clockwise).\n";
+    const double volume = area*(upper_bound_z - lower_bound_z);
+    mModelInfo[MainInfo::embedded_geometry_info].SetValue(EmbeddedGeometryInfo::volume, volume);
+    mModelInfo[MainInfo::embedded_geometry_info].SetValue(EmbeddedGeometryInfo::is_closed, true);
+    mModelInfo[MainInfo::embedded_geometry_info].SetValue(EmbeddedGeometryInfo::num_triangles, 2*rBRepOperator.NumberOfSegments());
+    // SystemInfo
+    std::stringstream instruction_set;
+    instruction_set << CpuDispatch::GetInstructionSet();
+    mModelInfo[MainInfo::system_info].SetValue(SystemInfo::instruction_set, instruction_set.str());
+
+    // Reserve element container
+    const IndexType global_number_of_elements = mGridIndexer.NumberOfElements();
+    mBackgroundGrid.ReserveElements(global_number_of_elements);
+
+    // Classify all elements via 2D flood fill.
+    Timer timer_check_intersect{};
+    const auto p_classifications = rBRepOperator.pGetElementClassifications(mSettings);
+    auto& r_volume_time_info = mModelInfo[MainInfo::elapsed_time_info][ElapsedTimeInfo::volume_time_info];
+    r_volume_time_info.SetValue(VolumeTimeInfo::classification_of_elements, timer_check_intersect.Measure());
+
+    // Compute all active elements.
+    std::vector<IndexType> active_indices{};
+    for( IndexType index = 0; index < global_number_of_elements; ++index ){
+        if( (*p_classifications)[index] != IntersectionState::outside ){
+            active_indices.push_back(index);
+        }
+    }
+    const std::vector<const Checkpoint::BufferType*> restored_elements{};
+    VolumeStatistics statistics{};
+    ComputeElements(active_indices, *p_classifications, nullptr, restored_elements, parameters, statistics, &rBRepOperator);
+
+    FinalizeVolume(volume, parameters, statistics, timer_total);
+}
+
+void EmbeddedModel::ComputeElements(const std::vector<IndexType>& rIndices, const BRepOperator::StatusVectorType& rClassifications,
+        const BRepOperator* pBRepOperator, const std::vector<const Checkpoint::BufferType*>& rRestoredElements,
+        const ElementParameters& rParameters, VolumeStatistics& rStatistics, const BRepOperator2D* pBRepOperator2D){
+    const bool checkpoint_trimmed_domains = mSettings[MainSettings::general_settings].GetValue<bool>(GeneralSettings::checkpoint_trimmed_domains);
+
     //// Info variables
     // TimeInfo
     double et_compute_intersection = 0.0;
@@ -75,21 +386,38 @@ void EmbeddedModel::ComputeVolume(const TriangleMeshInterface& rTriangleMesh){
     // GridInfo
     SizeType num_active_elements = 0;
     SizeType num_trimmed_elements = 0;
+    SizeType num_planar_cut_elements = 0;
     // Num of threads
     IndexType num_threads = 1;
 
-    // Loop over all elements
+    // Loop over given elements
     #pragma omp parallel
     {
         #pragma omp single
         num_threads = omp_get_num_threads();
 
-        #pragma omp for reduction(+ : et_compute_intersection, et_moment_fitting, num_active_elements, num_trimmed_elements) schedule(dynamic)
-        for( int index = 0; index < static_cast<int>(global_number_of_elements); ++index) {
+        // Thread local buffer for diagnostic events.
+        Diagnostics::BufferType diagnostics_buffer{};
+
+        #pragma omp for reduction(+ : et_compute_intersection, et_moment_fitting, num_active_elements, num_trimmed_elements, num_planar_cut_elements) schedule(dynamic)
+        for( int i = 0; i < static_cast<int>(rIndices.size()); ++i) {
+            const IndexType index = rIndices[i];
             // Check classification status
-            const IntersectionState status = (*p_classifications)[index];
+            const IntersectionState status = rClassifications[index];
 
             if( status == IntersectionState::inside || status == IntersectionState::trimmed ) {
+                // Skip elements that are restored from checkpoint.
+                if( !rRestoredElements.empty() && rRestoredElements[index] ){
+                    Unique<ElementType> restored_element = pRestoreElement(*rRestoredElements[index], index);
+                    if( restored_element ){
+                        ++num_active_elements;
+                        if( restored_element->IsTrimmed() ) { ++num_trimmed_elements; }
+                        #pragma omp critical
+                        mBackgroundGrid.AddElement(restored_element);
+                    }
+                    continue;
+                }
+
                 // Get bounding box of element
                 const auto bounding_box_xyz = mGridIndexer.GetBoundingBoxXYZFromIndex(index);
                 const auto bounding_box_uvw = mGridIndexer.GetBoundingBoxUVWFromIndex(index);
@@ -102,33 +430,67 @@ void EmbeddedModel::ComputeVolume(const TriangleMeshInterface& rTriangleMesh){
                 if( status == IntersectionState::trimmed) {
                     new_element->SetIsTrimmed(true);
                     Timer timer_compute_intersection{};
-                    auto p_trimmed_domain = brep_operator.pGetTrimmedDomain(bounding_box_xyz.first, bounding_box_xyz.second,
-                                                                            min_vol_element_ratio, num_boundary_triangles, neglect_elements_if_stl_is_flawed);
-                    if( p_trimmed_domain ){
-                        new_element->pSetTrimmedDomain(p_trimmed_domain);
-                        valid_element = true;
+                    Unique<BRepOperator2D::PolylineVectorType> p_boundary_loops = nullptr;
+                    if( pBRepOperator2D ){
+                        // 2D mode: Trimmed domain is given by its boundary loops.
+                        p_boundary_loops = pBRepOperator2D->pGetTrimmedDomain(bounding_box_xyz.first, bounding_box_xyz.second, rParameters.min_vol_element_ratio);
+                        valid_element = (p_boundary_loops != nullptr);
+                    } else {
+                        auto p_trimmed_domain = pBRepOperator->pGetTrimmedDomain(index, bounding_box_xyz.first, bounding_box_xyz.second,
+                            rParameters.min_vol_element_ratio, rParameters.min_num_boundary_triangles, rParameters.neglect_elements_if_stl_is_flawed);
+                        if( p_trimmed_domain ){
+                            new_element->pSetTrimmedDomain(p_trimmed_domain);
+                            valid_element = true;
+                        }
                     }
                     et_compute_intersection += timer_compute_intersection.Measure();
 
                     // If valid solve moment fitting equation
                     if( valid_element ){
                         Timer timer_moment_fitting{};
-                        QuadratureTrimmedElement<ElementType>::AssembleIPs(*new_element, polynomial_order, moment_fitting_residual, echo_level);
-                        et_moment_fitting += timer_moment_fitting.Measure();
-
+                        // Try fast path for cells cut by a few planes first.
+                        double residual = (rParameters.max_num_cut_planes > 0 && !p_boundary_loops) ? QuadratureTrimmedElement<ElementType>::AssembleIPsPlanarCut(
+                            *new_element, rParameters.polynomial_order, rParameters.moment_fitting_residual, rParameters.max_num_cut_planes,
+                            rParameters.nnls_solver) : MAXD;
+                        if( p_boundary_loops ){
+                            residual = QuadratureTrimmedElement<ElementType>::AssembleIPs2D(*new_element, *p_boundary_loops, rParameters.polynomial_order,
+                                rParameters.moment_fitting_residual, rParameters.nnls_solver, rParameters.init_point_distribution_factor, rParameters.max_octree_refinement_level);
+                        } else if( residual <= rParameters.moment_fitting_residual ){
+                            ++num_planar_cut_elements;
+                        } else {
+                            residual = QuadratureTrimmedElement<ElementType>::AssembleIPs(*new_element, rParameters.polynomial_order, rParameters.moment_fitting_residual,
+                                rParameters.nnls_solver, rParameters.init_point_distribution_factor, rParameters.max_octree_refinement_level);
+                        }
+                        // Warnings are only recorded here. They are reported after the loop (see: FinalizeVolume()).
                         if( new_element->GetIntegrationPoints().size() == 0 ){
                             valid_element = false;
+                            Diagnostics::Record(diagnostics_buffer, new_element->GetId(), DiagnosticKind::element_neglected_after_moment_fitting, residual);
+                        } else if( residual > rParameters.moment_fitting_residual ){
+                            Diagnostics::Record(diagnostics_buffer, new_element->GetId(), DiagnosticKind::moment_fitting_residual_not_achieved, residual);
+                        }
+                        if( valid_element && rParameters.compute_shape_sensitivities ){
+                            const auto p_triangle_ids = pBRepOperator->GetIntersectedTriangleIds(bounding_box_xyz.first, bounding_box_xyz.second);
+                            QuadratureTrimmedElement<ElementType>::ComputeShapeSensitivities(*new_element, rParameters.polynomial_order,
+                                pBRepOperator->GetTriangleMesh(), *p_triangle_ids);
                         }
+                        et_moment_fitting += timer_moment_fitting.Measure();
                     }
                 }
                 else if( status == IntersectionState::inside){
                     // Get standard gauss legendre points
-                    if( !ggq_rule_ise_used ){
-                        QuadratureSingleElement<ElementType>::AssembleIPs(*new_element, polynomial_order, integration_method);
+                    if( !rParameters.ggq_rule_is_used ){
+                        QuadratureSingleElement<ElementType>::AssembleIPs(*new_element, rParameters.polynomial_order, rParameters.integration_method);
                     }
                     valid_element = true;
                 }
 
+                // Add completed element to checkpoint.
+                if( mpCheckpointWriter ){
+                    Checkpoint::BufferType buffer{};
+                    SerializeElement(buffer, valid_element ? new_element.get() : nullptr, checkpoint_trimmed_domains);
+                    mpCheckpointWriter->AddRecord(Checkpoint::RecordType::element, index, buffer);
+                }
+
                 if( valid_element ){
                     ++num_active_elements;
                     if( new_element->IsTrimmed() ) { ++num_trimmed_elements; }
@@ -137,29 +499,52 @@ void EmbeddedModel::ComputeVolume(const TriangleMeshInterface& rTriangleMesh){
                 }
             }
         } /// #pragma omp for reduction
+
+        // Merge diagnostic events once per thread.
+        #pragma omp critical
+        mDiagnostics.Merge(diagnostics_buffer);
     } /// End #pragma omp parallel
 
+    rStatistics.et_compute_intersection += et_compute_intersection;
+    rStatistics.et_moment_fitting += et_moment_fitting;
+    rStatistics.num_active_elements += num_active_elements;
+    rStatistics.num_trimmed_elements += num_trimmed_elements;
+    rStatistics.num_planar_cut_elements += num_planar_cut_elements;
+    rStatistics.num_threads = num_threads;
+}
+
+void EmbeddedModel::FinalizeVolume(double Volume, const ElementParameters& rParameters, const VolumeStatistics& rStatistics, Timer& rTimerTotal){
     /// Assmble Generalized Gaussian quadrature rules (if enabled).
     double et_ggq_rules = 0.0;
-    if( ggq_rule_ise_used ){
+    if( rParameters.ggq_rule_is_used ){
         Timer timer_ggq_rules{};
-        QuadratureMultipleElements<ElementType>::AssembleIPs(mBackgroundGrid, number_of_elements, polynomial_order, integration_method);
+        const Vector3i number_of_elements = mSettings[MainSettings::background_grid_settings].GetValue<Vector3i>(BackgroundGridSettings::number_of_elements);
+        QuadratureMultipleElements<ElementType>::AssembleIPs(mBackgroundGrid, number_of_elements, rParameters.polynomial_order, rParameters.integration_method);
         et_ggq_rules = timer_ggq_rules.Measure();
     }
-    const double elapsed_time_total = timer_total.Measure();
+    /// Derive quadrature rules of coarse grid levels (if enabled).
+    Timer timer_coarse_grid_levels{};
+    ComputeCoarseGridLevels(rParameters);
+    const double et_coarse_grid_levels = timer_coarse_grid_levels.Measure();
+    const double elapsed_time_total = rTimerTotal.Measure();
 
     /// Set ModelInfo
     // ElpasedTimeInfo
     auto& r_elapsed_time_info = mModelInfo[MainInfo::elapsed_time_info];
-    r_elapsed_time_info[ElapsedTimeInfo::volume_time_info].SetValue(VolumeTimeInfo::total, elapsed_time_total);
+    auto& r_volume_time_info = r_elapsed_time_info[ElapsedTimeInfo::volume_time_info];
+    r_volume_time_info.SetValue(VolumeTimeInfo::total, elapsed_time_total);
     const double total_time = (r_elapsed_time_info.IsSet(ElapsedTimeInfo::total)) ?
         r_elapsed_time_info.GetValue<double>(ElapsedTimeInfo::total) : 0.0;
     r_elapsed_time_info.SetValue(ElapsedTimeInfo::total, (total_time+elapsed_time_total) );
-    r_volume_time_info.SetValue(VolumeTimeInfo::computation_of_intersections, et_compute_intersection / ((double) num_threads) );
-    r_volume_time_info.SetValue(VolumeTimeInfo::solution_of_moment_fitting_eqs, et_moment_fitting / ((double) num_threads) );
+    const double num_threads = static_cast<double>(rStatistics.num_threads);
+    r_volume_time_info.SetValue(VolumeTimeInfo::computation_of_intersections, rStatistics.et_compute_intersection / num_threads );
+    r_volume_time_info.SetValue(VolumeTimeInfo::solution_of_moment_fitting_eqs, rStatistics.et_moment_fitting / num_threads );
     r_volume_time_info.SetValue(VolumeTimeInfo::construction_of_ggq_rules, et_ggq_rules);
+    r_volume_time_info.SetValue(VolumeTimeInfo::construction_of_coarse_grid_levels, et_coarse_grid_levels);
 
     // BackgroundGridInfo
+    const SizeType num_active_elements = rStatistics.num_active_elements;
+    const SizeType num_trimmed_elements = rStatistics.num_trimmed_elements;
     mModelInfo[MainInfo::background_grid_info].SetValue(BackgroundGridInfo::num_active_elements, num_active_elements );
     mModelInfo[MainInfo::background_grid_info].SetValue(BackgroundGridInfo::num_trimmed_elements, num_trimmed_elements );
     const IndexType num_full_elements = (num_active_elements-num_trimmed_elements);
@@ -189,17 +574,262 @@ void EmbeddedModel::ComputeVolume(const TriangleMeshInterface& rTriangleMesh){
     const SizeType tot_num_points = tot_num_points_trimmed + tot_num_points_full;
     mModelInfo[MainInfo::quadrature_info].SetValue(QuadratureInfo::tot_num_points, tot_num_points);
     mModelInfo[MainInfo::quadrature_info].SetValue(QuadratureInfo::represented_volume, represented_volume);
-    mModelInfo[MainInfo::quadrature_info].SetValue(QuadratureInfo::percentage_of_geometry_volume, represented_volume/volume*100.0);
+    mModelInfo[MainInfo::quadrature_info].SetValue(QuadratureInfo::percentage_of_geometry_volume, represented_volume/Volume*100.0);
     const double num_of_points_per_full_element = (num_full_elements > 0) ?
         static_cast<double>(tot_num_points_full)/static_cast<double>(num_full_elements) : 0.0;
     mModelInfo[MainInfo::quadrature_info].SetValue(QuadratureInfo::num_of_points_per_full_element, num_of_points_per_full_element);
     const double num_of_points_per_trimmed_element = (num_trimmed_elements > 0) ?
         static_cast<double>(tot_num_points_trimmed)/static_cast<double>(num_trimmed_elements) : 0.0;
     mModelInfo[MainInfo::quadrature_info].SetValue(QuadratureInfo::num_of_points_per_trimmed_element, num_of_points_per_trimmed_element);
+    mModelInfo[MainInfo::quadrature_info].SetValue(QuadratureInfo::num_planar_cut_elements, rStatistics.num_planar_cut_elements);
+
+    // DiagnosticsInfo
+    auto& r_diagnostics_info = mModelInfo[MainInfo::diagnostics_info];
+    r_diagnostics_info.SetValue(DiagnosticsInfo::num_events, mDiagnostics.NumberOfEvents());
+    for( IndexType i = 0; i < NumberOfDiagnosticKinds; ++i ){
+        const auto kind = static_cast<DiagnosticKind>(i);
+        const IndexType num_events = mDiagnostics.NumberOfEvents(kind);
+        if( num_events > 0 ){
+            const auto worst_event = mDiagnostics.GetWorstEvents(kind, 1)[0];
+            auto& r_summary_info = mModelInfo.CreateNewDiagnosticsSummaryInfo();
+            r_summary_info.SetValue(DiagnosticsSummaryInfo::kind, std::string(Diagnostics::GetKindName(kind)));
+            r_summary_info.SetValue(DiagnosticsSummaryInfo::num_events, num_events);
+            r_summary_info.SetValue(DiagnosticsSummaryInfo::max_value, worst_event.value);
+            r_summary_info.SetValue(DiagnosticsSummaryInfo::worst_element_id, worst_event.element_id);
+        }
+    }
 
     PrintVolumeInfo();
 }
 
+void EmbeddedModel::ComputeCoarseGridLevels(const ElementParameters& rParameters) {
+    mCoarseBackgroundGrids.clear();
+    const IndexType number_of_grid_levels = mSettings[MainSettings::background_grid_settings].GetValue<IndexType>(BackgroundGridSettings::number_of_grid_levels);
+
+    Settings fine_settings(mSettings);
+    for( IndexType level = 1; level < number_of_grid_levels; ++level ){
+        // Each direction with more than one element is coarsened by a factor of two.
+        const Vector3i fine_number_of_elements = fine_settings[MainSettings::background_grid_settings].GetValue<Vector3i>(BackgroundGridSettings::number_of_elements);
+        Vector3i factors{};
+        Vector3i coarse_number_of_elements{};
+        for( IndexType dir = 0; dir < 3; ++dir ){
+            factors[dir] = (fine_number_of_elements[dir] > 1) ? 2 : 1;
+            coarse_number_of_elements[dir] = fine_number_of_elements[dir] / factors[dir];
+        }
+        Settings coarse_settings(fine_settings);
+        coarse_settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::number_of_elements, coarse_number_of_elements);
+
+        const GridIndexer fine_grid_indexer(fine_settings);
+        const GridIndexer coarse_grid_indexer(coarse_settings);
+        const BackgroundGridType& r_fine_grid = (level == 1) ? mBackgroundGrid : *mCoarseBackgroundGrids.back();
+        Unique<BackgroundGridType> p_coarse_grid = MakeUnique<BackgroundGridType>(coarse_settings);
+        const IndexType max_num_children = factors[0]*factors[1]*factors[2];
+
+        #pragma omp parallel for schedule(dynamic)
+        for( int i = 0; i < static_cast<int>(coarse_grid_indexer.NumberOfElements()); ++i ){
+            const IndexType index = static_cast<IndexType>(i);
+            const Vector3i indices = coarse_grid_indexer.GetMatrixIndicesFromVectorIndex(index);
+
+            // Collect active children on fine level.
+            std::vector<const ElementType*> children{};
+            children.reserve(max_num_children);
+            bool has_trimmed_child = false;
+            for( IndexType i_x = 0; i_x < factors[0]; ++i_x ){
+                for( IndexType i_y = 0; i_y < factors[1]; ++i_y ){
+                    for( IndexType i_z = 0; i_z < factors[2]; ++i_z ){
+                        const IndexType child_index = fine_grid_indexer.GetVectorIndexFromMatrixIndices(
+                            indices[0]*factors[0]+i_x, indices[1]*factors[1]+i_y, indices[2]*factors[2]+i_z);
+                        const ElementType* p_child = r_fine_grid.pGetElement(child_index+1);
+                        if( p_child ){
+                            children.push_back(p_child);
+                            has_trimmed_child |= p_child->IsTrimmed();
+                        }
+                    }
+                }
+            }
+            if( children.empty() ){
+                continue;
+            }
+
+            const auto bounding_box_xyz = coarse_grid_indexer.GetBoundingBoxXYZFromIndex(index);
+            const auto bounding_box_uvw = coarse_grid_indexer.GetBoundingBoxUVWFromIndex(index);
+            Unique<ElementType> new_element = MakeUnique<ElementType>(index+1, bounding_box_xyz, bounding_box_uvw);
+            if( !has_trimmed_child && children.size() == max_num_children ){
+                // All children are full elements.
+                QuadratureSingleElement<ElementType>::AssembleIPs(*new_element, rParameters.polynomial_order, rParameters.integration_method);
+            } else {
+                // Only the moment fitting equation is solved. No geometrical operations are required.
+                new_element->SetIsTrimmed(true);
+                QuadratureTrimmedElement<ElementType>::AssembleIPsFromChildren(*new_element, children, rParameters.polynomial_order,
+                    rParameters.moment_fitting_residual, rParameters.nnls_solver);
+            }
+
+            if( new_element->GetIntegrationPoints().size() > 0 ){
+                #pragma omp critical
+                p_coarse_grid->AddElement(new_element);
+            }
+        }
+
+        mCoarseBackgroundGrids.push_back(std::move(p_coarse_grid));
+        fine_settings = coarse_settings;
+    }
+}
+
+void EmbeddedModel::VerifyQuadratureRules(const ElementParameters& rParameters) {
+    Timer timer_verification{};
+    const Vector3i& r_order = rParameters.polynomial_order;
+    const Vector3i test_order{r_order[0]+1, r_order[1]+1, r_order[2]+1};
+
+    // Negative errors mark elements that are not verified.
+    const IndexType num_elements = mBackgroundGrid.NumberOfActiveElements();
+    std::vector<double> moment_errors(num_elements, -1.0);
+    SizeType num_skipped_elements = 0;
+    const auto el_it_ptr_begin = mBackgroundGrid.ElementsBegin();
+    #pragma omp parallel for reduction(+ : num_skipped_elements) schedule(dynamic)
+    for( int i = 0; i < static_cast<int>(num_elements); ++i ){
+        const auto& el_ptr = *(el_it_ptr_begin + i);
+        if( el_ptr->IsTrimmed() ){
+            // Elements restored from checkpoint might not store their trimmed domain.
+            if( el_ptr->HasTrimmedDomain() ){
+                moment_errors[i] = QuadratureTrimmedElement<ElementType>::ComputeMomentError(*el_ptr, test_order);
+            } else {
+                ++num_skipped_elements;
+            }
+        }
+    }
+
+    // Histogram with one bin per decade. First bin: [0, 1e-12), last bin: [1, MAXD).
+    constexpr int min_exponent = -12;
+    std::vector<IndexType> histogram(2-min_exponent, 0);
+    std::vector<IndexType> verified_indices{};
+    double max_moment_error = 0.0;
+    double sum_moment_error = 0.0;
+    for( IndexType i = 0; i < num_elements; ++i ){
+        const double error = moment_errors[i];
+        if( error >= 0.0 ){
+            verified_indices.push_back(i);
+            max_moment_error = std::max(max_moment_error, error);
+            sum_moment_error += error;
+            const int exponent = (error > 0.0) ? static_cast<int>(std::floor(std::log10(error))) : min_exponent-1;
+            ++histogram[std::clamp(exponent, min_exponent-1, 0) - (min_exponent-1)];
+        }
+    }
+    const IndexType num_verified_elements = verified_indices.size();
+
+    /// Set ModelInfo
+    // VerificationInfo
+    auto& r_verification_info = mModelInfo[MainInfo::verification_info];
+    r_verification_info.SetValue(VerificationInfo::test_polynomial_order, test_order);
+    r_verification_info.SetValue(VerificationInfo::num_verified_elements, num_verified_elements);
+    r_verification_info.SetValue(VerificationInfo::num_skipped_elements, num_skipped_elements);
+    r_verification_info.SetValue(VerificationInfo::max_moment_error, max_moment_error);
+    const double mean_moment_error = (num_verified_elements > 0) ? sum_moment_error/static_cast<double>(num_verified_elements) : 0.0;
+    r_verification_info.SetValue(VerificationInfo::mean_moment_error, mean_moment_error);
+
+    // Only non-empty bins are stored.
+    for( IndexType bin = 0; bin < histogram.size(); ++bin ){
+        if( histogram[bin] > 0 ){
+            const int exponent = static_cast<int>(bin) + (min_exponent-1);
+            auto& r_bin_info = mModelInfo.CreateNewMomentErrorHistogramInfo();
+            r_bin_info.SetValue(MomentErrorHistogramInfo::lower_bound, (exponent < min_exponent) ? 0.0 : std::pow(10.0, exponent));
+            r_bin_info.SetValue(MomentErrorHistogramInfo::upper_bound, (exponent < 0) ? std::pow(10.0, exponent+1) : MAXD);
+            r_bin_info.SetValue(MomentErrorHistogramInfo::num_elements, histogram[bin]);
+        }
+    }
+
+    // Elements with the largest errors in descending order.
+    constexpr IndexType max_num_worst_elements = 10;
+    const IndexType num_worst_elements = std::min(max_num_worst_elements, num_verified_elements);
+    std::partial_sort(verified_indices.begin(), verified_indices.begin() + num_worst_elements, verified_indices.end(),
+        [&moment_errors](IndexType Left, IndexType Right){ return moment_errors[Left] > moment_errors[Right]; });
+    for( IndexType i = 0; i < num_worst_elements; ++i ){
+        const IndexType index = verified_indices[i];
+        auto& r_element_info = mModelInfo.CreateNewWorstElementInfo();
+        r_element_info.SetValue(WorstElementInfo::element_id, (*(el_it_ptr_begin + index))->GetId());
+        r_element_info.SetValue(WorstElementInfo::moment_error, moment_errors[index]);
+    }
+
+    // ElapsedTimeInfo
+    auto& r_volume_time_info = mModelInfo[MainInfo::elapsed_time_info][ElapsedTimeInfo::volume_time_info];
+    r_volume_time_info.SetValue(VolumeTimeInfo::verification_of_quadrature_rules, timer_verification.Measure());
+
+    QuESo_INFO_IF(rParameters.echo_level > 0) << ":: Verification :: Verified " << num_verified_elements << " trimmed elements with test polynomials of order "
+        << test_order << ". Max. moment error: " << max_moment_error << ", mean moment error: " << mean_moment_error << ".\n";
+}
+
+ModelInfo EmbeddedModel::PlanBackgroundGrid(const Settings& rSettings) {
+    const auto& r_filename = rSettings[MainSettings::general_settings].GetValue<std::string>(GeneralSettings::input_filename);
+    TriangleMesh triangle_mesh{};
+    IO::ReadMeshFromSTL(triangle_mesh, r_filename.c_str());
+
+    ModelInfo model_info{};
+    PlanBackgroundGrid(triangle_mesh, rSettings, model_info);
+    return model_info;
+}
+
+void EmbeddedModel::PlanBackgroundGrid(const TriangleMeshInterface& rTriangleMesh, const Settings& rSettings, ModelInfo& rModelInfo) {
+    Timer timer{};
+    const auto result = BackgroundGridPlanner<ElementType>::Plan(rTriangleMesh, rSettings);
+    BackgroundGridPlanner<ElementType>::AddToModelInfo(result, rModelInfo);
+    const double elapsed_time = timer.Measure();
+    rModelInfo[MainInfo::elapsed_time_info][ElapsedTimeInfo::volume_time_info].SetValue(VolumeTimeInfo::grid_planning, elapsed_time);
+
+    const IndexType echo_level = rSettings[MainSettings::general_settings].GetValue<IndexType>(GeneralSettings::echo_level);
+    if( echo_level > 0 && !result.candidates.empty() ){
+        const auto& r_selected = result.candidates[result.selected];
+        const auto& r_number_of_elements = r_selected.number_of_elements;
+        QuESo_INFO << ":: Grid Planning :: Proposed 'number_of_elements': [" << r_number_of_elements[0] << ", " << r_number_of_elements[1] << ", "
+            << r_number_of_elements[2] << "]" << (result.target_met ? "" : " (targets not met)") << ". Elapsed time: " << elapsed_time << " sec\n";
+        QuESo_INFO << "   -- Local feature size (5% quantile / median): " << result.min_feature_size << " / " << result.median_feature_size << '\n';
+        QuESo_INFO << "   -- Predicted number of trimmed elements:      " << r_selected.num_trimmed_elements << '\n';
+        QuESo_INFO << "   -- Predicted volume error:                    " << r_selected.volume_error << '\n';
+        QuESo_INFO << "   -- Predicted runtime:                         " << r_selected.runtime << " sec\n";
+    }
+}
+
+void EmbeddedModel::DecimateMesh(TriangleMeshInterface& rTriangleMesh) {
+    const auto& r_general_settings = mSettings[MainSettings::general_settings];
+    const double relative_tolerance = r_general_settings.GetValue<double>(GeneralSettings::mesh_decimation_tolerance);
+    if( relative_tolerance <= 0.0 ){
+        return;
+    }
+    // Shape sensitivities refer to the vertices of the input mesh.
+    QuESo_ERROR_IF( mSettings[MainSettings::trimmed_quadrature_rule_settings].GetValue<bool>(TrimmedQuadratureRuleSettings::compute_shape_sensitivities) )
+        << "'mesh_decimation_tolerance' can not be combined with 'compute_shape_sensitivities'.\n";
+
+    Timer timer{};
+    const auto bounding_box = mGridIndexer.GetBoundingBoxXYZFromIndex(0);
+    const double tolerance = relative_tolerance * Math::Min( Math::Subtract(bounding_box.second, bounding_box.first) );
+    const IndexType num_input_triangles = rTriangleMesh.NumOfTriangles();
+    const double deviation = MeshUtilities::Decimate(rTriangleMesh, tolerance);
+
+    mModelInfo[MainInfo::embedded_geometry_info].SetValue(EmbeddedGeometryInfo::num_input_triangles, num_input_triangles);
+    mModelInfo[MainInfo::embedded_geometry_info].SetValue(EmbeddedGeometryInfo::decimation_deviation, deviation);
+    QuESo_INFO_IF(r_general_settings.GetValue<IndexType>(GeneralSettings::echo_level) > 0) << ":: Mesh Decimation :: Reduced number of triangles from "
+        << num_input_triangles << " to " << rTriangleMesh.NumOfTriangles() << ". Deviation: " << deviation << " (Tolerance: " << tolerance
+        << "). Elapsed time: " << timer.Measure() << " sec\n";
+}
+
+EmbeddedModel::ElementParameters EmbeddedModel::GetElementParameters() const {
+    ElementParameters parameters{};
+    parameters.integration_method = mSettings[MainSettings::non_trimmed_quadrature_rule_settings]
+        .GetValue<IntegrationMethod>(NonTrimmedQuadratureRuleSettings::integration_method);
+    parameters.ggq_rule_is_used = static_cast<int>(parameters.integration_method) >= 3;
+    parameters.polynomial_order = mSettings[MainSettings::background_grid_settings].GetValue<Vector3i>(BackgroundGridSettings::polynomial_order);
+    const auto& r_trimmed_quad_rule_settings = mSettings[MainSettings::trimmed_quadrature_rule_settings];
+    parameters.min_vol_element_ratio = std::max<double>(r_trimmed_quad_rule_settings.GetValue<double>(TrimmedQuadratureRuleSettings::min_element_volume_ratio), 1e-10);
+    parameters.min_num_boundary_triangles = r_trimmed_quad_rule_settings.GetValue<IndexType>(TrimmedQuadratureRuleSettings::min_num_boundary_triangles);
+    parameters.init_point_distribution_factor = r_trimmed_quad_rule_settings.GetValue<IndexType>(TrimmedQuadratureRuleSettings::init_point_distribution_factor);
+    parameters.max_octree_refinement_level = r_trimmed_quad_rule_settings.GetValue<IndexType>(TrimmedQuadratureRuleSettings::max_octree_refinement_level);
+    parameters.max_num_cut_planes = r_trimmed_quad_rule_settings.GetValue<IndexType>(TrimmedQuadratureRuleSettings::max_num_cut_planes);
+    parameters.moment_fitting_residual = r_trimmed_quad_rule_settings.GetValue<double>(TrimmedQuadratureRuleSettings::moment_fitting_residual);
+    parameters.neglect_elements_if_stl_is_flawed = r_trimmed_quad_rule_settings.GetValue<bool>(TrimmedQuadratureRuleSettings::neglect_elements_if_stl_is_flawed);
+    parameters.nnls_solver = r_trimmed_quad_rule_settings.GetValue<NNLSSolver>(TrimmedQuadratureRuleSettings::nnls_solver);
+    parameters.compute_shape_sensitivities = r_trimmed_quad_rule_settings.GetValue<bool>(TrimmedQuadratureRuleSettings::compute_shape_sensitivities);
+    parameters.echo_level = mSettings[MainSettings::general_settings].GetValue<IndexType>(GeneralSettings::echo_level);
+    return parameters;
+}
+
 void EmbeddedModel::ComputeCondition(const TriangleMeshInterface& rTriangleMesh, const SettingsBaseType& rConditionSettings) {
 
     CheckIfMeshIsWithinBoundingBox(rTriangleMesh);
@@ -213,35 +843,106 @@ void EmbeddedModel::ComputeCondition(const TriangleMeshInterface& rTriangleMesh,
     const double surface_area = MeshUtilities::AreaOMP(rTriangleMesh);
     r_new_cond_info.SetValue(ConditionInfo::surf_area, surface_area);
 
-    // Create new condition and brep_operator
+    // Create new condition
     Unique<ConditionType> p_new_condition = MakeUnique<ConditionType>(rConditionSettings, r_new_cond_info);
-    BRepOperator brep_operator(rTriangleMesh);
 
     /// Info variables
     double surf_area_segments = 0.0;
     double surf_area_in_active_domain = 0.0;
+    // In surface-only mode, no volume is computed. Hence, the entire background grid is considered as active domain.
+    const auto& r_general_settings = mSettings[MainSettings::general_settings];
+    const bool surface_only = r_general_settings.GetValue<bool>(GeneralSettings::surface_only);
+
+    // Key of condition in checkpoint.
+    std::uint64_t condition_key = 0;
+    auto restored_condition_it = mRestoredConditions.end();
+    if( mpCheckpointWriter ){
+        std::stringstream condition_settings;
+        rConditionSettings.PrintInfo(condition_settings);
+        condition_key = Checkpoint::Hash(rTriangleMesh, Checkpoint::Hash(condition_settings.str()));
+        restored_condition_it = mRestoredConditions.find(condition_key);
+    }
 
-    // Loop over background grid
-    #pragma omp parallel for reduction(+ : surf_area_segments, surf_area_in_active_domain)
-    for( int index = 0; index < static_cast<int>(mGridIndexer.NumberOfElements()); ++index ) {
-        const auto bounding_box_xyz = mGridIndexer.GetBoundingBoxXYZFromIndex(index);
-        auto p_new_mesh = brep_operator.pClipTriangleMeshUnique(bounding_box_xyz.first, bounding_box_xyz.second);
-        if( p_new_mesh->NumOfTriangles() > 0 ) {
+    if( restored_condition_it != mRestoredConditions.end() ){
+        // Restore segments from checkpoint.
+        const auto& r_buffer = restored_condition_it->second;
+        std::size_t position = 0;
+        const IndexType num_segments = Checkpoint::Read<std::uint64_t>(r_buffer, position);
+        for( IndexType i = 0; i < num_segments; ++i ){
+            const IndexType index = Checkpoint::Read<std::uint64_t>(r_buffer, position);
+            auto p_new_mesh = Checkpoint::pReadMesh(r_buffer, position);
             const auto p_el = mBackgroundGrid.pGetElement(index+1);
             const double surf_area_segment = MeshUtilities::Area(*p_new_mesh);
             surf_area_segments += surf_area_segment;
             auto p_new_segment = p_el ? MakeUnique<ConditionType::ConditionSegmentType>(index, p_el, p_new_mesh)
                 : MakeUnique<ConditionType::ConditionSegmentType>(index, p_new_mesh);
-            surf_area_in_active_domain += p_el ?  surf_area_segment : 0.0;
-            #pragma omp critical
+            surf_area_in_active_domain += (p_el || surface_only) ?  surf_area_segment : 0.0;
             p_new_condition->AddSegment(p_new_segment);
         }
+        Checkpoint::BufferType buffer(r_buffer);
+        mpCheckpointWriter->AddRecord(Checkpoint::RecordType::condition, condition_key, buffer);
+        mRestoredConditions.erase(restored_condition_it);
+    }
+    else {
+        BRepOperator brep_operator(rTriangleMesh);
+
+        // Only cells that overlap the bounding box of at least one triangle are clipped.
+        const auto candidate_indices = GetCellsOverlappingTriangles(rTriangleMesh);
+
+        // Loop over candidate cells
+        #pragma omp parallel for reduction(+ : surf_area_segments, surf_area_in_active_domain) schedule(dynamic)
+        for( int i = 0; i < static_cast<int>(candidate_indices.size()); ++i ) {
+            const IndexType index = candidate_indices[i];
+            const auto bounding_box_xyz = mGridIndexer.GetBoundingBoxXYZFromIndex(index);
+            auto p_new_mesh = brep_operator.pClipTriangleMeshUnique(bounding_box_xyz.first, bounding_box_xyz.second);
+            if( p_new_mesh->NumOfTriangles() > 0 ) {
+                const auto p_el = mBackgroundGrid.pGetElement(index+1);
+                const double surf_area_segment = MeshUtilities::Area(*p_new_mesh);
+                surf_area_segments += surf_area_segment;
+                auto p_new_segment = p_el ? MakeUnique<ConditionType::ConditionSegmentType>(index, p_el, p_new_mesh)
+                    : MakeUnique<ConditionType::ConditionSegmentType>(index, p_new_mesh);
+                surf_area_in_active_domain += (p_el || surface_only) ?  surf_area_segment : 0.0;
+                #pragma omp critical
+                p_new_condition->AddSegment(p_new_segment);
+            }
+        }
+
+        // Add completed condition to checkpoint.
+        if( mpCheckpointWriter ){
+            Checkpoint::BufferType buffer{};
+            Checkpoint::Write(buffer, static_cast<std::uint64_t>(p_new_condition->NumberOfSegments()));
+            for( const auto& r_segment : p_new_condition->GetSegments() ){
+                Checkpoint::Write(buffer, static_cast<std::uint64_t>(r_segment->GetBackgroundGridIndex()));
+                Checkpoint::WriteMesh(buffer, r_segment->GetTriangleMesh());
+            }
+            mpCheckpointWriter->AddRecord(Checkpoint::RecordType::condition, condition_key, buffer);
+        }
+    }
+    // In surface-only mode, each condition is written to file as soon as it is completed (see: WriteModelToFile()).
+    if( surface_only && r_general_settings.GetValue<bool>(GeneralSettings::write_output_to_file) ){
+        const std::string output_directory_name = r_general_settings.GetValue<std::string>(GeneralSettings::output_directory_name);
+        const std::string bc_filename = output_directory_name + "/condition_id_" + std::to_string(condition_id) + ".stl";
+        IO::WriteConditionToSTL(*p_new_condition, bc_filename, true);
     }
     mBackgroundGrid.AddCondition(p_new_condition);
+    if( mpCheckpointWriter ){
+        mpCheckpointWriter->Flush();
+    }
 
     /// Set ModelInfo
     // ConditionInfo
     r_new_cond_info.SetValue(ConditionInfo::perc_surf_area_in_active_domain, surf_area_in_active_domain/surface_area*100.0);
+    // VerificationInfo: Surface area of all conditions.
+    if( mSettings[MainSettings::trimmed_quadrature_rule_settings].GetValue<bool>(TrimmedQuadratureRuleSettings::verify_quadrature_rules) ){
+        auto& r_verification_info = mModelInfo[MainInfo::verification_info];
+        const double total_surface_area = surface_area + ((r_verification_info.IsSet(VerificationInfo::surface_area)) ?
+            r_verification_info.GetValue<double>(VerificationInfo::surface_area) : 0.0);
+        const double represented_surface_area = surf_area_in_active_domain + ((r_verification_info.IsSet(VerificationInfo::represented_surface_area)) ?
+            r_verification_info.GetValue<double>(VerificationInfo::represented_surface_area) : 0.0);
+        r_verification_info.SetValue(VerificationInfo::surface_area, total_surface_area);
+        r_verification_info.SetValue(VerificationInfo::represented_surface_area, represented_surface_area);
+        r_verification_info.SetValue(VerificationInfo::percentage_of_surface_area, represented_surface_area/total_surface_area*100.0);
+    }
     auto& r_time_info = mModelInfo[MainInfo::elapsed_time_info];
     auto& r_condition_time_info = r_time_info[ElapsedTimeInfo::conditions_time_info];
     // ElapsedTimeInfo
@@ -265,15 +966,18 @@ void EmbeddedModel::WriteModelToFile() {
         const IndexType echo_level = r_general_settings.GetValue<IndexType>(GeneralSettings::echo_level);
         QuESo_INFO_IF(echo_level > 0) << ":: WriteFileInfo :: Output directory: '" << output_directory_name << "'\n";
 
-        // Write vtk files (binary = true)
-        IO::WriteElementsToVTK(mBackgroundGrid, (output_directory_name + "/elements.vtk"), true);
-        IO::WritePointsToVTK(mBackgroundGrid, (output_directory_name + "/integration_points.vtk"), true);
-        std::for_each(mBackgroundGrid.ConditionsBegin(), mBackgroundGrid.ConditionsEnd(),
-            [&output_directory_name](const auto& r_condition){
-                IndexType condition_id = r_condition.GetSettings().template GetValue<IndexType>(ConditionSettings::condition_id);
-                const std::string bc_filename = output_directory_name + "/condition_id_" + std::to_string(condition_id) + ".stl";
-                IO::WriteConditionToSTL(r_condition, bc_filename, true);
-        });
+        // In surface-only mode, there are no elements and the conditions are already written (see: ComputeCondition()).
+        if( !r_general_settings.GetValue<bool>(GeneralSettings::surface_only) ){
+            // Write vtk files (binary = true)
+            IO::WriteElementsToVTK(mBackgroundGrid, (output_directory_name + "/elements.vtk"), true);
+            IO::WritePointsToVTK(mBackgroundGrid, (output_directory_name + "/integration_points.vtk"), true);
+            std::for_each(mBackgroundGrid.ConditionsBegin(), mBackgroundGrid.ConditionsEnd(),
+                [&output_directory_name](const auto& r_condition){
+                    IndexType condition_id = r_condition.GetSettings().template GetValue<IndexType>(ConditionSettings::condition_id);
+                    const std::string bc_filename = output_directory_name + "/condition_id_" + std::to_string(condition_id) + ".stl";
+                    IO::WriteConditionToSTL(r_condition, bc_filename, true);
+            });
+        }
 
         /// Set model info
         const double measured_time = timer_output.Measure();
@@ -286,16 +990,124 @@ void EmbeddedModel::WriteModelToFile() {
         r_time_info.SetValue(ElapsedTimeInfo::total, (total_time+measured_time) );
 
         IO::WriteDictionaryToJSON(mModelInfo, (output_directory_name + "/model_info.json"));
+        if( mDiagnostics.NumberOfEvents() > 0 ){
+            IO::WriteDiagnosticsToJSON(mDiagnostics, (output_directory_name + "/diagnostics.json"));
+        }
         QuESo_INFO_IF(echo_level > 0) << ":: ElapsedTimeInfo :: Elapsed time: " << measured_time << " sec\n";
     }
 }
 
+std::vector<IndexType> EmbeddedModel::GetCellsOverlappingTriangles(const TriangleMeshInterface& rTriangleMesh) const {
+    const IndexType num_elements = mGridIndexer.NumberOfElements();
+    const auto bounding_box = mGridIndexer.GetBoundingBoxXYZFromIndex(0);
+    const double tolerance = RelativeSnapTolerance(bounding_box.first, bounding_box.second, SNAPTOL) + 100.0*ZEROTOL;
+
+    std::vector<std::uint8_t> is_candidate(num_elements, 0);
+    #pragma omp parallel for
+    for( int triangle_id = 0; triangle_id < static_cast<int>(rTriangleMesh.NumOfTriangles()); ++triangle_id ){
+        const auto& r_p1 = rTriangleMesh.P1(triangle_id);
+        const auto& r_p2 = rTriangleMesh.P2(triangle_id);
+        const auto& r_p3 = rTriangleMesh.P3(triangle_id);
+        const PointType lower_bound{ std::min({r_p1[0], r_p2[0], r_p3[0]}), std::min({r_p1[1], r_p2[1], r_p3[1]}), std::min({r_p1[2], r_p2[2], r_p3[2]}) };
+        const PointType upper_bound{ std::max({r_p1[0], r_p2[0], r_p3[0]}), std::max({r_p1[1], r_p2[1], r_p3[1]}), std::max({r_p1[2], r_p2[2], r_p3[2]}) };
+        const auto range = mGridIndexer.GetIndexRangeXYZ(lower_bound, upper_bound, tolerance);
+        for( IndexType i = range.first[0]; i <= range.second[0]; ++i ){
+            for( IndexType j = range.first[1]; j <= range.second[1]; ++j ){
+                for( IndexType k = range.first[2]; k <= range.second[2]; ++k ){
+                    const IndexType index = mGridIndexer.GetVectorIndexFromMatrixIndices(i, j, k);
+                    #pragma omp atomic write
+                    is_candidate[index] = 1;
+                }
+            }
+        }
+    }
+
+    std::vector<IndexType> candidate_indices{};
+    for( IndexType index = 0; index < num_elements; ++index ){
+        if( is_candidate[index] ){
+            candidate_indices.push_back(index);
+        }
+    }
+    return candidate_indices;
+}
+
+std::uint64_t EmbeddedModel::ComputeVolumeHash(const TriangleMeshInterface& rTriangleMesh) const {
+    // Only settings that affect the computed elements are considered.
+    std::stringstream settings_stream;
+    mSettings[MainSettings::background_grid_settings].PrintInfo(settings_stream);
+    mSettings[MainSettings::trimmed_quadrature_rule_settings].PrintInfo(settings_stream);
+    mSettings[MainSettings::non_trimmed_quadrature_rule_settings].PrintInfo(settings_stream);
+    const auto& r_general_settings = mSettings[MainSettings::general_settings];
+    settings_stream << r_general_settings.GetValue<InsideTestMethod>(GeneralSettings::inside_test_method)
+                    << r_general_settings.GetValue<bool>(GeneralSettings::checkpoint_trimmed_domains);
+
+    return Checkpoint::Hash(rTriangleMesh, Checkpoint::Hash(settings_stream.str()));
+}
+
+void EmbeddedModel::SerializeElement(Checkpoint::BufferType& rBuffer, const ElementType* pElement, bool WriteTrimmedDomain) {
+    const bool is_valid = (pElement != nullptr);
+    const bool is_trimmed = is_valid && pElement->IsTrimmed();
+    const bool has_trimmed_domain = is_trimmed && WriteTrimmedDomain;
+    const std::uint8_t flags = static_cast<std::uint8_t>(is_valid) | (static_cast<std::uint8_t>(is_trimmed) << 1)
+        | (static_cast<std::uint8_t>(has_trimmed_domain) << 2);
+    Checkpoint::Write(rBuffer, flags);
+    if( !is_valid ){
+        return;
+    }
+
+    const auto& r_points = pElement->GetIntegrationPoints();
+    Checkpoint::Write(rBuffer, static_cast<std::uint64_t>(r_points.size()));
+    for( const auto& r_point : r_points ){
+        Checkpoint::Write(rBuffer, std::array<double, 4>{r_point.X(), r_point.Y(), r_point.Z(), r_point.Weight()});
+    }
+    if( has_trimmed_domain ){
+        Checkpoint::WriteMesh(rBuffer, pElement->pGetTrimmedDomain()->GetTriangleMesh());
+    }
+}
+
+Unique<EmbeddedModel::ElementType> EmbeddedModel::pRestoreElement(const Checkpoint::BufferType& rBuffer, IndexType Index) const {
+    std::size_t position = 0;
+    const std::uint8_t flags = Checkpoint::Read<std::uint8_t>(rBuffer, position);
+    const bool is_valid = flags & 1;
+    const bool is_trimmed = flags & 2;
+    const bool has_trimmed_domain = flags & 4;
+    if( !is_valid ){
+        return nullptr;
+    }
+
+    const auto bounding_box_xyz = mGridIndexer.GetBoundingBoxXYZFromIndex(Index);
+    const auto bounding_box_uvw = mGridIndexer.GetBoundingBoxUVWFromIndex(Index);
+    Unique<ElementType> p_element = MakeUnique<ElementType>(Index+1, bounding_box_xyz, bounding_box_uvw);
+    p_element->SetIsTrimmed(is_trimmed);
+
+    const IndexType num_points = Checkpoint::Read<std::uint64_t>(rBuffer, position);
+    auto& r_points = p_element->GetIntegrationPoints();
+    r_points.reserve(num_points);
+    for( IndexType i = 0; i < num_points; ++i ){
+        const auto values = Checkpoint::Read<std::array<double, 4>>(rBuffer, position);
+        r_points.push_back( IntegrationPointType(values[0], values[1], values[2], values[3]) );
+    }
+    if( has_trimmed_domain ){
+        auto p_trimmed_domain = MakeUnique<TrimmedDomain>(Checkpoint::pReadMesh(rBuffer, position),
+                                                          bounding_box_xyz.first, bounding_box_xyz.second);
+        p_element->pSetTrimmedDomain(p_trimmed_domain);
+    }
+
+    return p_element;
+}
+
 void EmbeddedModel::CheckIfMeshIsWithinBoundingBox(const TriangleMeshInterface& rTriangleMesh) const {
+    if( mSettings[MainSettings::general_settings].GetValue<IndexType>(GeneralSettings::echo_level) > 0 ){
+        CheckIfMeshIsWithinBoundingBox(MeshUtilities::BoundingBox(rTriangleMesh));
+    }
+}
+
+void EmbeddedModel::CheckIfMeshIsWithinBoundingBox(const BoundingBoxType& rMeshBoundingBox) const {
     // Check if bounding box fully contains the triangle mesh.
     if( mSettings[MainSettings::general_settings].GetValue<IndexType>(GeneralSettings::echo_level) > 0 ){
         PointType lower_bound = mSettings[MainSettings::background_grid_settings].GetValue<PointType>(BackgroundGridSettings::lower_bound_xyz);
         PointType upper_bound = mSettings[MainSettings::background_grid_settings].GetValue<PointType>(BackgroundGridSettings::upper_bound_xyz);
-        auto bb_mesh = MeshUtilities::BoundingBox(rTriangleMesh);
+        const auto& bb_mesh = rMeshBoundingBox;
         if( lower_bound[0] > bb_mesh.first[0]  ||
             lower_bound[1] > bb_mesh.first[1]  ||
             lower_bound[2] > bb_mesh.first[2]  ||
@@ -322,6 +1134,18 @@ void EmbeddedModel::PrintVolumeInfo() const {
         const auto& r_quad_info = mModelInfo[MainInfo::quadrature_info];
         const IndexType num_quadrature_points = r_quad_info.GetValue<IndexType>(QuadratureInfo::tot_num_points);
         QuESo_INFO << ":: QuadratureRuleInfo :: Number of integration points: " << num_quadrature_points << std::endl;
+        for( const auto& r_summary_info : mModelInfo[MainInfo::diagnostics_info].GetList(DiagnosticsInfo::events_summary_list) ){
+            QuESo_INFO << "Warning :: Diagnostics :: " << r_summary_info.GetValue<std::string>(DiagnosticsSummaryInfo::kind) << " :: Number of elements: "
+                << r_summary_info.GetValue<IndexType>(DiagnosticsSummaryInfo::num_events) << ". Worst element id: "
+                << r_summary_info.GetValue<IndexType>(DiagnosticsSummaryInfo::worst_element_id) << " (Value: "
+                << r_summary_info.GetValue<double>(DiagnosticsSummaryInfo::max_value) << ").\n";
+        }
+        if( echo_level > 2 ) {
+            for( const auto& r_event : mDiagnostics.GetEvents() ){
+                QuESo_INFO << "Warning :: Diagnostics :: " << Diagnostics::GetKindName(r_event.kind) << " :: Element id: "
+                    << r_event.element_id << ". Value: " << r_event.value << ".\n";
+            }
+        }
         if( echo_level > 1 ) {
             const auto& r_quad_info = mModelInfo[MainInfo::quadrature_info];
             const double percentage_of_geometry_volume = r_quad_info.GetValue<double>(QuadratureInfo::percentage_of_geometry_volume);
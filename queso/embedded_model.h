@@ -15,17 +15,25 @@
 #define EMBEDDED_MODEL_INCLUDE_H
 
 /// STL includes
+#include <unordered_map>
+#include <vector>
 
 /// Project includes
 #include "queso/containers/triangle_mesh_interface.hpp"
 #include "queso/containers/boundary_integration_point.hpp"
 #include "queso/containers/background_grid.hpp"
+#include "queso/embedding/brep_operator_2d.h"
 #include "queso/io/io_utilities.h"
+#include "queso/io/checkpoint.h"
 #include "queso/includes/settings.hpp"
 #include "queso/includes/model_info.hpp"
+#include "queso/includes/diagnostics.hpp"
+#include "queso/includes/timer.hpp"
 
 namespace queso {
 
+class BRepOperator;
+
 ///@name QuESo Classes
 ///@{
 
@@ -40,6 +48,19 @@ namespace queso {
  *         split into ConditionSegment's (that conform to the boundaries of the elements in the background grid).
  *         The corresponding boundary integration points are stored on these ConditionSegments.
  *         EmbeddedModel also stores some information regearding the created model in mModelInfo.
+ *         If 'checkpoint_filename' is set, all completed elements and conditions are periodically written to a binary
+ *         checkpoint file (see: CheckpointWriter). A restarted run with identical inputs restores them instead of recomputing them.
+ *         If 'out_of_core_slab_thickness' is set, CreateAllFromSettings() never loads the volume mesh as a whole. The input STL is split
+ *         into slabs (see: SlabPartitioner), which are classified and computed one after another.
+ *         If 'mesh_decimation_tolerance' is set, CreateAllFromSettings() simplifies the volume mesh before embedding (see: MeshUtilities::Decimate()).
+ *         If 'verify_quadrature_rules' is set, the final quadrature rules of all trimmed elements are checked (see: VerifyQuadratureRules()).
+ *         If 'compute_shape_sensitivities' is set, the derivatives of the weights of all trimmed elements with respect to the vertex positions
+ *         of the volume mesh are stored on the elements (see: QuadratureTrimmedElement::ComputeShapeSensitivities()).
+ *         Warnings of the element loop are collected as Diagnostics and reported after the loop (see: diagnostics_info, 'diagnostics.json').
+ *         Planar domains, which are bounded by closed polylines, can be computed in 2D mode (see: CreateVolume2D()).
+ *         If 'number_of_grid_levels' > 1, quadrature rules of nested coarse grids are derived from the finest grid (see: ComputeCoarseGridLevels()).
+ *         If 'surface_only' is set, CreateAllFromSettings() skips the volume and only clips the condition meshes into ConditionSegments.
+ *         Each condition is written to file as soon as it is completed.
 **/
 class EmbeddedModel
 {
@@ -63,7 +84,10 @@ public:
         mSettings(rSettings.Check()),
         mGridIndexer(mSettings),
         mBackgroundGrid(mSettings),
-        mModelInfo{}
+        mCoarseBackgroundGrids{},
+        mModelInfo{},
+        mDiagnostics{},
+        mpCheckpointWriter(nullptr)
     {
     }
 
@@ -92,11 +116,18 @@ public:
         QuESo_INFO_IF(echo_level > 0) << "QuESo: Create Volume -------------------------------------- START" << std::endl;
 
         const auto& r_filename = r_general_settings.GetValue<std::string>(GeneralSettings::input_filename);
-        TriangleMesh triangle_mesh{};
-        IO::ReadMeshFromSTL(triangle_mesh, r_filename.c_str());
-
-        ComputeVolume(triangle_mesh);
-        PrintVolumeElapsedTimeInfo();
+        if( r_general_settings.GetValue<bool>(GeneralSettings::surface_only) ){
+            QuESo_INFO_IF(echo_level > 0) << ":: Surface-only mode :: Volume is not computed.\n";
+        } else if( r_general_settings.GetValue<IndexType>(GeneralSettings::out_of_core_slab_thickness) > 0 ){
+            ComputeVolumeOutOfCore(r_filename);
+            PrintVolumeElapsedTimeInfo();
+        } else {
+            TriangleMesh triangle_mesh{};
+            IO::ReadMeshFromSTL(triangle_mesh, r_filename.c_str());
+            DecimateMesh(triangle_mesh);
+            ComputeVolume(triangle_mesh);
+            PrintVolumeElapsedTimeInfo();
+        }
 
         QuESo_INFO_IF(echo_level > 0) << "QuESo: Create Volume ---------------------------------------- End\n";
 
@@ -121,6 +152,12 @@ public:
 
     }
 
+    ///@brief Proposes the number of elements of the background grid for the input STL given in rSettings without running the
+    ///       actual computation (see: BackgroundGridPlanner). 'number_of_elements' is not required.
+    ///@param rSettings
+    ///@return ModelInfo The proposal and the predictions are stored in grid_planning_info.
+    static ModelInfo PlanBackgroundGrid(const Settings& rSettings);
+
     ///@brief Creates integration points for an embedded volume that is enclosed/defined by rTriangleMesh.
     ///       This interface enables to pass a TriangleMeshInterface and, hence, facilitates other applications to
     ///       use QuESo on C++ level, which do not want QuESo to read rTriangleMesh from an input file.
@@ -131,6 +168,32 @@ public:
         ComputeVolume(rTriangleMesh);
     }
 
+    ///@brief Creates integration points for a planar domain (2D mode), which is bounded by closed polylines in the xy-plane (see: BRepOperator2D).
+    ///       The domain is the prism that is spanned by the polylines and the z-range of the background grid. Hence, the created elements and
+    ///       integration points are the same as for a 3D grid with a single element in z-direction. However, the elements are classified via a
+    ///       2D flood fill and the moment fitting equations are solved in their planar form (see: QuadratureTrimmedElement::AssembleIPs2D()).
+    ///       Requires 'number_of_elements'[2] = 1. 'polynomial_order'[2] is ignored (one point in z-direction).
+    ///       If the z-range of the background grid is [0, 1] in physical and parametric space, the weights directly integrate over the area.
+    ///@param rPolylines Outer boundaries counter-clockwise, holes clockwise.
+    ///@todo Add try{} catch{} plus error handler
+    void CreateVolume2D(const BRepOperator2D::PolylineVectorType& rPolylines){
+        BRepOperator2D brep_operator(rPolylines);
+        ComputeVolume2D(brep_operator);
+    }
+
+    ///@brief Creates integration points for a condition of a planar domain (2D mode), which is defined by (open) polylines in the xy-plane.
+    ///       The polylines are extruded over the z-range of the background grid (see: BRepOperator2D::pGetExtrudedMesh()).
+    ///@param rPolylines
+    ///@param rConditionSettings
+    ///@see CreateVolume2D()
+    void CreateCondition2D(const BRepOperator2D::PolylineVectorType& rPolylines, const SettingsBaseType& rConditionSettings){
+        const auto& r_grid_settings = mSettings[MainSettings::background_grid_settings];
+        BRepOperator2D brep_operator(rPolylines, false);
+        const auto p_triangle_mesh = brep_operator.pGetExtrudedMesh(r_grid_settings.GetValue<PointType>(BackgroundGridSettings::lower_bound_xyz)[2],
+                                                                    r_grid_settings.GetValue<PointType>(BackgroundGridSettings::upper_bound_xyz)[2]);
+        ComputeCondition(*p_triangle_mesh, rConditionSettings);
+    }
+
     ///@brief Creates integration points for an embedded condition defined by rTriangleMesh.
     ///       This interface enables to pass a TriangleMeshInterface and, hence, facilitates other applications to
     ///       use QuESo on C++ level, which do not want QuESo to read rTriangleMesh from an input file.
@@ -156,6 +219,27 @@ public:
         return mBackgroundGrid.GetElements();
     }
 
+    /// @brief Returns the background grid, which stores all active elements and conditions.
+    /// @return const BackgroundGridType&
+    const BackgroundGridType& GetBackgroundGrid() const {
+        return mBackgroundGrid;
+    }
+
+    /// @brief Returns the background grid of the given level. Level 0 is the finest grid (see: GetBackgroundGrid()).
+    ///        Coarse grids only store active elements. Conditions are only stored on level 0.
+    /// @param Level Must be smaller than NumberOfGridLevels().
+    /// @return const BackgroundGridType&
+    const BackgroundGridType& GetBackgroundGrid(IndexType Level) const {
+        QuESo_ERROR_IF( Level >= NumberOfGridLevels() ) << "Grid level " << Level << " does not exist. Number of grid levels: " << NumberOfGridLevels() << ".\n";
+        return (Level == 0) ? mBackgroundGrid : *mCoarseBackgroundGrids[Level-1];
+    }
+
+    /// @brief Returns number of available grid levels (including the finest grid).
+    /// @return IndexType
+    IndexType NumberOfGridLevels() const {
+        return mCoarseBackgroundGrids.size() + 1;
+    }
+
     /// @brief Returns all conditions.
     /// @return const Reference to ElementVectorPtrType
     const BackgroundGridType::ConditionContainerType& GetConditions() const {
@@ -176,10 +260,48 @@ public:
         return mModelInfo;
     }
 
+    ///@brief Returns all diagnostic events of the last created volume.
+    ///@return const Diagnostics&
+    ///@see includes/diagnostics.hpp
+    const Diagnostics& GetDiagnostics() const {
+        return mDiagnostics;
+    }
+
     ///@}
 
 private:
 
+    ///@name Private Type Definitions
+    ///@{
+
+    /// Parameters required to compute the elements. Extracted once from mSettings (see: GetElementParameters()).
+    struct ElementParameters {
+        IntegrationMethod integration_method;
+        bool ggq_rule_is_used;
+        Vector3i polynomial_order;
+        double min_vol_element_ratio;
+        IndexType min_num_boundary_triangles;
+        IndexType init_point_distribution_factor;
+        IndexType max_octree_refinement_level;
+        IndexType max_num_cut_planes;
+        double moment_fitting_residual;
+        bool neglect_elements_if_stl_is_flawed;
+        NNLSSolver nnls_solver;
+        bool compute_shape_sensitivities;
+        IndexType echo_level;
+    };
+
+    /// Accumulated info of ComputeElements().
+    struct VolumeStatistics {
+        double et_compute_intersection = 0.0;
+        double et_moment_fitting = 0.0;
+        SizeType num_active_elements = 0;
+        SizeType num_trimmed_elements = 0;
+        SizeType num_planar_cut_elements = 0;
+        IndexType num_threads = 1;
+    };
+
+    ///@}
     ///@name Private Member Operations
     ///@{
 
@@ -187,16 +309,103 @@ private:
     ///@param rTriangleMesh
     void ComputeVolume(const TriangleMeshInterface& rTriangleMesh);
 
+    ///@brief Computes the integration points for the volume enclosed by the given STL file without loading the entire mesh.
+    ///       The file is split into slabs (see: SlabPartitioner). Each slab is classified (see: FloodFill::FillPartition()) and its
+    ///       trimmed elements are computed, before the next slab is loaded. Afterwards, the inside elements are computed.
+    ///       Yields the same elements as ComputeVolume().
+    ///@param rFilename
+    void ComputeVolumeOutOfCore(const std::string& rFilename);
+
+    ///@brief Computes the integration points for a planar domain (2D mode). See: CreateVolume2D().
+    ///@param rBRepOperator
+    void ComputeVolume2D(const BRepOperator2D& rBRepOperator);
+
+    ///@brief Runs BackgroundGridPlanner and stores results in rModelInfo[MainInfo::grid_planning_info].
+    ///@param rTriangleMesh
+    ///@param rSettings
+    ///@param[out] rModelInfo
+    static void PlanBackgroundGrid(const TriangleMeshInterface& rTriangleMesh, const Settings& rSettings, ModelInfo& rModelInfo);
+
+    ///@brief Simplifies rTriangleMesh, if 'mesh_decimation_tolerance' > 0. The absolute tolerance is given by
+    ///       'mesh_decimation_tolerance' times the minimum edge length of the background elements (see: MeshUtilities::Decimate()).
+    ///@param rTriangleMesh
+    void DecimateMesh(TriangleMeshInterface& rTriangleMesh);
+
+    ///@brief Computes the elements with the given indices and adds all valid elements to mBackgroundGrid.
+    ///@param rIndices Indices of elements in background grid.
+    ///@param rClassifications Classification of all elements.
+    ///@param pBRepOperator Only required for trimmed elements.
+    ///@param rRestoredElements Elements restored from checkpoint (see: pRestoreElement()). May be empty.
+    ///@param rParameters
+    ///@param[out] rStatistics Info is added.
+    ///@param pBRepOperator2D If given, trimmed elements are computed in 2D mode and pBRepOperator is not used (see: ComputeVolume2D()).
+    void ComputeElements(const std::vector<IndexType>& rIndices, const std::vector<IntersectionStateType>& rClassifications,
+                         const BRepOperator* pBRepOperator, const std::vector<const Checkpoint::BufferType*>& rRestoredElements,
+                         const ElementParameters& rParameters, VolumeStatistics& rStatistics, const BRepOperator2D* pBRepOperator2D = nullptr);
+
+    ///@brief Constructs GGQ rules (if enabled) and sets the volume related info in mModelInfo.
+    ///@param Volume Volume of the input mesh.
+    ///@param rParameters
+    ///@param rStatistics
+    ///@param rTimerTotal Timer started at the beginning of the volume computation.
+    void FinalizeVolume(double Volume, const ElementParameters& rParameters, const VolumeStatistics& rStatistics, Timer& rTimerTotal);
+
+    ///@brief Derives the quadrature rules of 'number_of_grid_levels'-1 nested coarse grids and stores them in mCoarseBackgroundGrids.
+    ///       Each level halves the number of elements in each direction with more than one element. The constant terms of each coarse trimmed
+    ///       element are computed from the quadrature rules of its children on the next finer level. Hence, only the moment fitting equation
+    ///       is solved per coarse element (see: QuadratureTrimmedElement::AssembleIPsFromChildren()). Coarse elements, whose children are all full
+    ///       elements, obtain standard tensor-product rules.
+    ///@param rParameters
+    void ComputeCoarseGridLevels(const ElementParameters& rParameters);
+
+    ///@brief Verifies the quadrature rules of all trimmed elements (see: 'verify_quadrature_rules'). Each rule integrates the Legendre polynomials
+    ///       of order p+1, which are compared to the boundary integral of the trimmed domain (see: QuadratureTrimmedElement::ComputeMomentError()).
+    ///       Results are stored in mModelInfo[MainInfo::verification_info]. The surface areas are added by ComputeCondition().
+    ///@param rParameters
+    void VerifyQuadratureRules(const ElementParameters& rParameters);
+
+    ///@brief Returns the parameters required to compute the elements.
+    ///@return ElementParameters
+    ElementParameters GetElementParameters() const;
+
     ///@brief Main function to compute the integration points for a condition defined by rTriangleMesh.
     ///@param rTriangleMesh
     ///@param rConditionSettings
     void ComputeCondition(const TriangleMeshInterface& rTriangleMesh, const SettingsBaseType& rConditionSettings);
 
+    ///@brief Returns the indices of all cells, which overlap the bounding box of at least one triangle of rTriangleMesh (sorted).
+    ///       Only these cells can be intersected by rTriangleMesh.
+    ///@param rTriangleMesh
+    ///@return std::vector<IndexType>
+    std::vector<IndexType> GetCellsOverlappingTriangles(const TriangleMeshInterface& rTriangleMesh) const;
+
+    ///@brief Returns hash of all inputs that affect the volume computation (relevant settings and rTriangleMesh).
+    ///       Checkpoints are only restored, if this hash matches.
+    ///@param rTriangleMesh
+    ///@return std::uint64_t
+    std::uint64_t ComputeVolumeHash(const TriangleMeshInterface& rTriangleMesh) const;
+
+    ///@brief Serializes element into rBuffer (see: Checkpoint).
+    ///@param[out] rBuffer
+    ///@param pElement Ptr to element. If nullptr, element is stored as invalid (processed, but not active).
+    ///@param WriteTrimmedDomain If true, the boundary mesh of the trimmed domain is stored as well.
+    static void SerializeElement(Checkpoint::BufferType& rBuffer, const ElementType* pElement, bool WriteTrimmedDomain);
+
+    ///@brief Restores element from rBuffer (see: SerializeElement()).
+    ///@param rBuffer
+    ///@param Index Index of element in background grid.
+    ///@return Unique<ElementType>. nullptr, if element was stored as invalid.
+    Unique<ElementType> pRestoreElement(const Checkpoint::BufferType& rBuffer, IndexType Index) const;
+
     ///@brief Prints a warning, if the rTriangleMesh is not fully contained within the bounding box defined
     ///       by 'lower_bound_xyz' and 'upper_bound_xyz' in mSettings.
     ///@param rTriangleMesh
     void CheckIfMeshIsWithinBoundingBox(const TriangleMeshInterface& rTriangleMesh) const;
 
+    ///@brief Same as above, but takes the bounding box of the mesh.
+    ///@param rMeshBoundingBox
+    void CheckIfMeshIsWithinBoundingBox(const BoundingBoxType& rMeshBoundingBox) const;
+
     ///@brief Prints some info to the console regarding the computed volume.
     ///       Since only one volume per EmbeddedModel can be created no arguments have to be passed.
     void PrintVolumeInfo() const;
@@ -219,7 +428,11 @@ private:
     const Settings mSettings;
     const GridIndexer mGridIndexer;
     BackgroundGridType mBackgroundGrid;
+    std::vector<Unique<BackgroundGridType>> mCoarseBackgroundGrids;
     ModelInfo mModelInfo;
+    Diagnostics mDiagnostics;
+    Unique<CheckpointWriter> mpCheckpointWriter;
+    std::unordered_map<std::uint64_t, Checkpoint::BufferType> mRestoredConditions;
     ///@}
 };
 ///@} End QuESo Classes
@@ -13,6 +13,7 @@
 
 //// Project includes
 #include "queso/embedding/aabb_primitive.h"
+#include "queso/utilities/cpu_dispatch.h"
 
 namespace queso {
 
@@ -131,6 +132,9 @@ bool AABB_primitive::intersect(const Vector3d &v0, const Vector3d &v1, const Vec
     return true;
 }
 
+void AABB_primitive::intersect(const double* pVertices, IndexType NumTriangles, double tolerance, std::uint8_t* pResults) const {
+    CpuDispatch::IntersectTrianglesAABB(lowerBound, upperBound, centre, tolerance, pVertices, NumTriangles, pResults);
+}
 
 bool AABB_primitive::check_axis( const Vector3d &u0, const Vector3d &u1, const Vector3d &u2,
                                  const Vector3d &v0, const Vector3d &v1, const Vector3d &v2,
@@ -66,6 +66,14 @@ public:
     bool intersect(const Vector3d &v0, const Vector3d &v1, const Vector3d &v2,
                    double tolerance) const;
 
+    ///@brief Tests a batch of triangles for intersection with AABB. Same as intersect(v0, v1, v2, tolerance) for each triangle.
+    ///@details Uses the best instruction set supported by the CPU (see CpuDispatch).
+    ///@param pVertices 9 values per triangle: (v0, v1, v2).
+    ///@param NumTriangles
+    ///@param tolerance. Reduces extent of aabb.
+    ///@param[out] pResults 1 if intersected, 0 otherwise. Size: NumTriangles.
+    void intersect(const double* pVertices, IndexType NumTriangles, double tolerance, std::uint8_t* pResults) const;
+
 private:
 
     ///@}
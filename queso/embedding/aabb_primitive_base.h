@@ -17,6 +17,7 @@
 //// STL includes
 #include <cstddef>
 #include <array>
+#include <cstdint>
 //// Project includes
 #include "queso/includes/define.hpp"
 
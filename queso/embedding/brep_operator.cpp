@@ -28,6 +28,23 @@ typedef BRepOperator::TrimmedDomainPtrType TrimmedDomainPtrType;
 typedef BRepOperator::StatusVectorType StatusVectorType;
 
 bool BRepOperator::IsInside(const PointType& rPoint) const {
+    if( mInsideTestMethod == InsideTestMethod::winding_number ){
+        return WindingNumber(rPoint) > 0.5;
+    }
+    return IsInsideRayTracing(rPoint);
+}
+
+double BRepOperator::WindingNumber(const PointType& rPoint) const {
+    return GetFastWindingNumber().WindingNumber(rPoint);
+}
+
+const FastWindingNumber& BRepOperator::GetFastWindingNumber() const {
+    std::call_once(mFastWindingNumberFlag, [this](){
+        mpFastWindingNumber = MakeUnique<FastWindingNumber>(mTriangleMesh, mGeometryQuery.GetAABBTree()); });
+    return *mpFastWindingNumber;
+}
+
+bool BRepOperator::IsInsideRayTracing(const PointType& rPoint) const {
     std::random_device rd;
     std::mt19937 gen(rd());
     std::uniform_real_distribution<> drandon(0.5, 1.5);
@@ -43,6 +60,9 @@ bool BRepOperator::IsInside(const PointType& rPoint) const {
             iteration++;
             // Get random direction. Must be postive! -> x>0, y>0, z>0
             Vector3d direction{drandon(gen), drandon(gen), drandon(gen)};
+            if( mSlabDirection != NoSlabDirection ){
+                direction[mSlabDirection] = 0.0;
+            }
 
             // Normalize
             const double norm_direction = Math::Norm( direction );
@@ -73,22 +93,31 @@ bool BRepOperator::IsTrimmed(const PointType& rLowerBound,  const PointType& rUp
 
 
 bool BRepOperator::OnBoundedSideOfClippedSection( const PointType& rPoint, const PointType& rLowerBound, const PointType& rUpperBound ) const {
-    double tolerance = RelativeSnapTolerance(rLowerBound, rUpperBound, SNAPTOL);
-
     auto p_clipped_mesh = pClipTriangleMesh(rLowerBound, rUpperBound);
-    auto& clipped_mesh = *p_clipped_mesh;
+    return OnBoundedSideOfClippedMesh(rPoint, *p_clipped_mesh, rLowerBound, rUpperBound);
+}
+
+bool BRepOperator::OnBoundedSideOfClippedSection( const PointType& rPoint, IndexType CellIndex, const BoundingBoxType& rCellBounds,
+        const PointType& rLowerBound, const PointType& rUpperBound ) const {
+    auto p_clipped_mesh = pClipTriangleMesh(CellIndex, rCellBounds, rLowerBound, rUpperBound);
+    return OnBoundedSideOfClippedMesh(rPoint, *p_clipped_mesh, rLowerBound, rUpperBound);
+}
+
+bool BRepOperator::OnBoundedSideOfClippedMesh( const PointType& rPoint, const TriangleMeshInterface& rClippedMesh,
+        const PointType& rLowerBound, const PointType& rUpperBound ) const {
+    double tolerance = RelativeSnapTolerance(rLowerBound, rUpperBound, SNAPTOL);
 
-    GeometryQuery geometry_query_local(clipped_mesh, false);
+    GeometryQuery geometry_query_local(rClippedMesh, false);
 
     IndexType current_id = 0;
-    const IndexType num_triangles = clipped_mesh.NumOfTriangles();
+    const IndexType num_triangles = rClippedMesh.NumOfTriangles();
     if( num_triangles == 0 ){ return false; }
 
     IndexType success_count = 0;
     int inside_count = 0;
     while( success_count < 10 && current_id < num_triangles ){
         // Get direction
-        const auto center_triangle = clipped_mesh.Center(current_id);
+        const auto center_triangle = rClippedMesh.Center(current_id);
         Vector3d direction = Math::Subtract( center_triangle, rPoint );
 
         // Normalize
@@ -99,12 +128,12 @@ bool BRepOperator::OnBoundedSideOfClippedSection( const PointType& rPoint, const
         Ray_AABB_primitive ray(rPoint, direction);
 
         // Get vertices of current triangle
-        const auto& p1 = clipped_mesh.P1(current_id);
-        const auto& p2 = clipped_mesh.P2(current_id);
-        const auto& p3 = clipped_mesh.P3(current_id);
+        const auto& p1 = rClippedMesh.P1(current_id);
+        const auto& p2 = rClippedMesh.P2(current_id);
+        const auto& p3 = rClippedMesh.P3(current_id);
 
         // Make sure target triangle is not parallel and has a significant area.
-        const double area = clipped_mesh.Area(current_id);
+        const double area = rClippedMesh.Area(current_id);
         if( !ray.is_parallel(p1, p2, p3, 100.0*tolerance) && area >  100*ZEROTOL) {
             auto [is_inside, success] = geometry_query_local.IsInside(ray);
             if( success ){
@@ -153,12 +182,19 @@ Unique<StatusVectorType> BRepOperator::pGetElementClassifications(const Settings
 
 TrimmedDomainPtrType BRepOperator::pGetTrimmedDomain(const PointType& rLowerBound, const PointType& rUpperBound,
         double MinElementVolumeRatio, IndexType MinNumberOfBoundaryTriangles, bool NeglectIfMeshIsFlawed ) const {
+    return pGetTrimmedDomain(ClippedMeshCache::NoCellIndex, rLowerBound, rUpperBound, MinElementVolumeRatio,
+        MinNumberOfBoundaryTriangles, NeglectIfMeshIsFlawed);
+}
+
+TrimmedDomainPtrType BRepOperator::pGetTrimmedDomain(IndexType CellIndex, const PointType& rLowerBound, const PointType& rUpperBound,
+        double MinElementVolumeRatio, IndexType MinNumberOfBoundaryTriangles, bool NeglectIfMeshIsFlawed ) const {
     // Instantiate random number generator
     std::random_device rd;
     std::mt19937 gen(rd());
     std::uniform_real_distribution<> drandon(1, 100);
 
     // Make copy of lower and upper bound.
+    const BoundingBoxType cell_bounds = std::make_pair(rLowerBound, rUpperBound);
     auto lower_bound = rLowerBound;
     auto upper_bound = rUpperBound;
 
@@ -171,7 +207,7 @@ TrimmedDomainPtrType BRepOperator::pGetTrimmedDomain(const PointType& rLowerBoun
     bool switch_plane_orientation = false;
     IndexType iteration = 1UL;
     while( iteration < 15){
-        auto p_new_mesh = pClipTriangleMesh(lower_bound, upper_bound);
+        auto p_new_mesh = pClipTriangleMesh(CellIndex, cell_bounds, lower_bound, upper_bound);
         if( p_new_mesh->NumOfTriangles() > 0) {
             auto p_trimmed_domain = MakeUnique<TrimmedDomain>(std::move(p_new_mesh), lower_bound, upper_bound, this, MinNumberOfBoundaryTriangles, switch_plane_orientation);
             const auto& r_trimmed_domain_mesh = p_trimmed_domain->GetTriangleMesh();
@@ -217,11 +253,15 @@ TrimmedDomainPtrType BRepOperator::pGetTrimmedDomain(const PointType& rLowerBoun
 }
 
 
+Unique<std::vector<IndexType>> BRepOperator::GetIntersectedTriangleIds(const PointType& rLowerBound, const PointType& rUpperBound ) const {
+    const double snap_tolerance = 0.1*RelativeSnapTolerance(rUpperBound, rLowerBound);
+    return mGeometryQuery.GetIntersectedTriangleIds(rLowerBound, rUpperBound, snap_tolerance);
+}
+
 Unique<TriangleMeshInterface> BRepOperator::pClipTriangleMesh(
         const PointType& rLowerBound, const PointType& rUpperBound ) const {
 
-    const double snap_tolerance = 0.1*RelativeSnapTolerance(rUpperBound, rLowerBound);
-    auto p_intersected_triangle_ids = mGeometryQuery.GetIntersectedTriangleIds(rLowerBound, rUpperBound, snap_tolerance);
+    auto p_intersected_triangle_ids = GetIntersectedTriangleIds(rLowerBound, rUpperBound);
     auto p_triangle_mesh = MakeUnique<TriangleMesh>();
     p_triangle_mesh->Reserve( 2*p_intersected_triangle_ids->size() );
     p_triangle_mesh->ReserveEdgesOnPlane( p_intersected_triangle_ids->size() );
@@ -241,6 +281,16 @@ Unique<TriangleMeshInterface> BRepOperator::pClipTriangleMesh(
     return p_triangle_mesh;
 }
 
+Unique<TriangleMeshInterface> BRepOperator::pClipTriangleMesh(IndexType CellIndex, const BoundingBoxType& rCellBounds,
+        const PointType& rLowerBound, const PointType& rUpperBound ) const {
+    if( CellIndex != ClippedMeshCache::NoCellIndex ){
+        auto p_triangle_mesh = mClippedMeshCache.pGetClippedMesh(CellIndex, rCellBounds, rLowerBound, rUpperBound);
+        if( p_triangle_mesh ){
+            return p_triangle_mesh;
+        }
+    }
+    return pClipTriangleMesh(rLowerBound, rUpperBound);
+}
 
 Unique<TriangleMeshInterface> BRepOperator::pClipTriangleMeshUnique(const PointType& rLowerBound, const PointType& rUpperBound ) const {
     const PointType offset{30*ZEROTOL, 30*ZEROTOL, 30*ZEROTOL};
@@ -270,93 +320,3 @@ Unique<TriangleMeshInterface> BRepOperator::pClipTriangleMeshUnique(const PointT
 }
 
 } // End namespace queso
-
-// Winding numbers algorithm: It actually works!!!
-
-// QuESo_INFO << "Done" << std::endl;
-// QuESo_INFO << "Tree timer: " << tree_timer << std::endl;
-// QuESo_INFO << "ray timer: " << ray_timer << std::endl;
-// return MakeUnique<std::vector<bool>>(rr);
-// for( int triangle_id = 0; triangle_id < rTriangleMesh.NumOfTriangles(); ++triangle_id ){
-//     const auto& p1 = rTriangleMesh.P1(triangle_id);
-//     const auto& p2 = rTriangleMesh.P2(triangle_id);
-//     const auto& p3 = rTriangleMesh.P3(triangle_id);
-
-//     IndexType count = 0;
-//     for( const auto& point : rPoints){
-//     //const auto point = rPoints[0];
-//         PointType a{p1[0] - point[0], p1[1] - point[1], p1[2] - point[2]};
-//         PointType b{p2[0] - point[0], p2[1] - point[1], p2[2] - point[2]};
-//         PointType c{p3[0] - point[0], p3[1] - point[1], p3[2] - point[2]};
-
-//         // Compute determinant of:
-//         // [a0 b0 c0]
-//         // [a1 b1 c1]
-//         // [a2 b2 c2]
-//         const long double omega =  a[0] * (b[1]*c[2] - b[2]*c[1])
-//                                   -b[0] * (a[1]*c[2] - a[2]*c[1])
-//                                   +c[0] * (a[1]*b[2] - a[2]*b[1]);
-
-
-//         const long double anorm = std::sqrt(a[0]*a[0]+a[1]*a[1]+a[2]*a[2]);
-//         const long double bnorm = std::sqrt(b[0]*b[0]+b[1]*b[1]+b[2]*b[2]);
-//         const long double cnorm = std::sqrt(c[0]*c[0]+c[1]*c[1]+c[2]*c[2]);
-
-//         long double k = anorm*bnorm*cnorm;
-
-//         k += cnorm * ( a[0]*b[0] + a[1]*b[1] + a[2]*b[2]);
-//         k += anorm * ( b[0]*c[0] + b[1]*c[1] + b[2]*c[2]);
-//         k += bnorm * ( a[0]*c[0] + a[1]*c[1] + a[2]*c[2]);
-
-//         ret[count] += std::atan2(omega,k);
-//         count++;
-//     }
-
-// }
-
-// Unique<std::vector<bool>> p_result = MakeUnique<std::vector<bool>>(rPoints.size(), false);
-// auto& r_result = *p_result;
-// for( int i = 0; i < ret.size(); ++i ){
-//     if( ret[i] >= (2.0*My_PI-EPS2) ) // Due to limited precision of double small treshhold (EPS2) is required.
-//         r_result[i] = true;
-// }
-
-// return std::move(p_result);
-
-// def is_inside_turbo(triangles, X):
-// 	# Compute euclidean norm along axis 1
-// 	def anorm2(X):
-// 		return numpy.sqrt(numpy.sum(X ** 2, axis = 1))
-
-
-
-// 	# Compute 3x3 determinant along axis 1
-// 	def adet(X, Y, Z):
-// 		ret  = numpy.multiply(numpy.multiply(X[:,0], Y[:,1]), Z[:,2])
-// 		ret += numpy.multiply(numpy.multiply(Y[:,0], Z[:,1]), X[:,2])
-// 		ret += numpy.multiply(numpy.multiply(Z[:,0], X[:,1]), Y[:,2])
-// 		ret -= numpy.multiply(numpy.multiply(Z[:,0], Y[:,1]), X[:,2])
-// 		ret -= numpy.multiply(numpy.multiply(Y[:,0], X[:,1]), Z[:,2])
-// 		ret -= numpy.multiply(numpy.multiply(X[:,0], Z[:,1]), Y[:,2])
-// 		return ret
-
-
-
-// 	# One generalized winding number per input vertex
-// 	ret = numpy.zeros(X.shape[0], dtype = X.dtype)
-
-// 	# Accumulate generalized winding number for each triangle
-// 	for U, V, W in triangles:
-// 		A, B, C = U - X, V - X, W - X
-// 		omega = adet(A, B, C)
-
-// 		a, b, c = anorm2(A), anorm2(B), anorm2(C)
-// 		k  = a * b * c
-// 		k += c * numpy.sum(numpy.multiply(A, B), axis = 1)
-// 		k += a * numpy.sum(numpy.multiply(B, C), axis = 1)
-// 		k += b * numpy.sum(numpy.multiply(C, A), axis = 1)
-
-// 		ret += numpy.arctan2(omega, k)
-
-// 	# Job done
-// 	return ret >= 2 * numpy.pi
\ No newline at end of file
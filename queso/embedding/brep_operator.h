@@ -16,6 +16,8 @@
 
 //// STL includes
 #include <memory>
+#include <mutex>
+#include <limits>
 //// Project includes
 #include "queso/containers/triangle_mesh.hpp"
 #include "queso/containers/element.hpp"
@@ -24,6 +26,8 @@
 #include "queso/embedding/trimmed_domain.h"
 #include "queso/embedding/geometry_query.h"
 #include "queso/embedding/clipper.h"
+#include "queso/embedding/clipped_mesh_cache.h"
+#include "queso/embedding/fast_winding_number.h"
 #include "queso/io/io_utilities.h"
 
 namespace queso {
@@ -46,6 +50,8 @@ public:
     typedef Unique<TrimmedDomain> TrimmedDomainPtrType;
     typedef std::vector<IntersectionStateType> StatusVectorType;
 
+    static constexpr IndexType NoSlabDirection = std::numeric_limits<IndexType>::max();
+
     ///@}
     ///@name Life Cycle
     ///@{
@@ -55,8 +61,19 @@ public:
     ///@param rTriangleMesh
     ///@param Closed Must be true, if mesh is closed.
     BRepOperator(const TriangleMeshInterface& rTriangleMesh, bool Closed=true)
-        : mTriangleMesh(rTriangleMesh), mGeometryQuery(rTriangleMesh, Closed)
+        : mTriangleMesh(rTriangleMesh), mGeometryQuery(rTriangleMesh, Closed), mClippedMeshCache(rTriangleMesh, mGeometryQuery)
+    {
+    }
+
+    /// Constructor
+    ///@brief Builds AABB tree for given mesh. Mesh must be closed.
+    ///       The method used by IsInside() is taken from GeneralSettings::inside_test_method.
+    ///@param rTriangleMesh
+    ///@param rSettings
+    BRepOperator(const TriangleMeshInterface& rTriangleMesh, const Settings& rSettings)
+        : BRepOperator(rTriangleMesh)
     {
+        mInsideTestMethod = rSettings[MainSettings::general_settings].GetValue<InsideTestMethod>(GeneralSettings::inside_test_method);
     }
 
     ///@}
@@ -64,10 +81,17 @@ public:
     ///@{
 
     ///@brief Returns true if point is inside TriangleMesh.
+    ///       Uses either ray tracing or the generalized winding number (see: GeneralSettings::inside_test_method).
     ///@param rPoint
     ///@return bool
     bool IsInside(const PointType& rPoint) const;
 
+    ///@brief Returns generalized winding number of rPoint w.r.t. TriangleMesh. ~1 inside, ~0 outside.
+    ///       Evaluated hierarchically via the AABB tree (see: FastWindingNumber). Dipoles are precomputed on first call.
+    ///@param rPoint
+    ///@return double
+    double WindingNumber(const PointType& rPoint) const;
+
     ///@brief Returns intersections state of element.
     ///@tparam TElementType
     ///@note Calls: GetIntersectionState(const PointType& rLowerBound,  const PointType& rUpperBound, double Tolerance = SNAPTOL)
@@ -106,6 +130,17 @@ public:
     TrimmedDomainPtrType pGetTrimmedDomain(const PointType& rLowerBound, const PointType& rUpperBound,
         double MinElementVolumeRatio, IndexType MinNumberOfBoundaryTriangles, bool NeglectIfMeshIsFlawed = true ) const;
 
+    /// @brief Returns ptr to trimmed domain of the cell with index CellIndex. Same as above, but the clipped meshes are drawn from the
+    ///        ClippedMeshCache, which is shared with the element classification (see: pGetElementClassifications()).
+    /// @param CellIndex Index of cell -> see: GridIndexer.
+    /// @param rLowerBound Lower bound of AABB (cell).
+    /// @param rUpperBound Upper bound of AABB (cell).
+    /// @param MinElementVolumeRatio Below this ratio elements are not considered.
+    /// @param MinNumberOfBoundaryTriangles Min number of triangles in the closed surface mesh.
+    /// @return TrimmedDomainPtrType (Unique)
+    TrimmedDomainPtrType pGetTrimmedDomain(IndexType CellIndex, const PointType& rLowerBound, const PointType& rUpperBound,
+        double MinElementVolumeRatio, IndexType MinNumberOfBoundaryTriangles, bool NeglectIfMeshIsFlawed = true ) const;
+
     ///@brief Clips triangle mesh by AABB.
     ///       Will NOT keep triangles that are categorized to be on one of the six planes of AABB.
     ///       This is a requirement for the intersection algorithm (see: TrimemdDomain and TrimmedDomainOnPlane).
@@ -115,6 +150,17 @@ public:
     ///@return Unique<TriangleMeshInterface>. Clipped mesh.
     Unique<TriangleMeshInterface> pClipTriangleMesh(const PointType& rLowerBound, const PointType& rUpperBound ) const;
 
+    ///@brief Clips triangle mesh by AABB, which is a slightly offset/perturbed version of the cell with index CellIndex.
+    ///       The clipped mesh is derived from the ClippedMeshCache. Only triangles close to the boundary of the cell are clipped again.
+    ///       Falls back to pClipTriangleMesh(rLowerBound, rUpperBound), if AABB deviates too much from the cell or CellIndex is ClippedMeshCache::NoCellIndex.
+    ///@param CellIndex Index of cell -> see: GridIndexer.
+    ///@param rCellBounds Unperturbed bounds of cell.
+    ///@param rLowerBound Lower bound of AABB.
+    ///@param rUpperBound Upper bound of AABB.
+    ///@return Unique<TriangleMeshInterface>. Clipped mesh.
+    Unique<TriangleMeshInterface> pClipTriangleMesh(IndexType CellIndex, const BoundingBoxType& rCellBounds,
+        const PointType& rLowerBound, const PointType& rUpperBound ) const;
+
     /// @brief Returns true, if AABB is intersected by at least one triangle.
     /// @param rLowerBound of AABB.
     /// @param rUpperBound of AABB.
@@ -132,6 +178,16 @@ public:
     /// @return bool
     bool OnBoundedSideOfClippedSection( const PointType& rPoint, const PointType& rLowerBound, const PointType& rUpperBound ) const;
 
+    /// @brief Same as above, but the clipped mesh is derived from the ClippedMeshCache.
+    /// @param rPoint Query Point.
+    /// @param CellIndex Index of cell -> see: GridIndexer.
+    /// @param rCellBounds Unperturbed bounds of cell.
+    /// @param rLowerBound of AABB (slightly offset cell).
+    /// @param rUpperBound of AABB (slightly offset cell).
+    /// @return bool
+    bool OnBoundedSideOfClippedSection( const PointType& rPoint, IndexType CellIndex, const BoundingBoxType& rCellBounds,
+        const PointType& rLowerBound, const PointType& rUpperBound ) const;
+
     ///@brief ProtoType: Clips triangle mesh by AABB. This function keeps triangles that are categorized on the planes of AABB.
     ///       However, to avoid that triangles are assigned twice to both adjacent AABB's, they are only assigned to the positive planes (+x, +y, +z).
     ///       This is a requirement for the application of boundary conditions.
@@ -141,15 +197,81 @@ public:
     ///@param rUpperBound Upper bound of AABB.
     ///@return Unique<TriangleMeshInterface>. Clipped mesh.
     Unique<TriangleMeshInterface> pClipTriangleMeshUnique(const PointType& rLowerBound, const PointType& rUpperBound ) const;
+
+    ///@brief Returns ids of all triangles that intersect the given AABB. Same triangles as used by pClipTriangleMesh().
+    ///@param rLowerBound Lower bound of AABB.
+    ///@param rUpperBound Upper bound of AABB.
+    ///@return Unique<std::vector<IndexType>>. Ids are sorted in ascending order.
+    Unique<std::vector<IndexType>> GetIntersectedTriangleIds(const PointType& rLowerBound, const PointType& rUpperBound ) const;
+
+    ///@}
+    ///@name Get member variables
+    ///@{
+
+    /// @brief Returns triangle mesh.
+    /// @return const TriangleMeshInterface&
+    const TriangleMeshInterface& GetTriangleMesh() const {
+        return mTriangleMesh;
+    }
+
+    /// @brief Returns cache of clipped meshes.
+    /// @return const ClippedMeshCache&
+    const ClippedMeshCache& GetClippedMeshCache() const {
+        return mClippedMeshCache;
+    }
+
+    /// @brief Returns method that is used by IsInside().
+    /// @return InsideTestMethod
+    InsideTestMethod GetInsideTestMethod() const {
+        return mInsideTestMethod;
+    }
+
+    /// @brief Restricts the rays of IsInside() to planes orthogonal to the given direction.
+    ///        Required, if rTriangleMesh only contains the triangles of a slab, which is orthogonal to Direction
+    ///        (see: SlabPartitioner). Rays within the plane of the query point only hit triangles of this slab.
+    /// @param Direction 0:x, 1:y, 2:z.
+    void SetSlabDirection(IndexType Direction) {
+        QuESo_ERROR_IF(Direction > 2) << "Direction must be 0, 1, or 2.\n";
+        QuESo_ERROR_IF(mInsideTestMethod != InsideTestMethod::ray_tracing) << "Slabs require inside_test_method: 'ray_tracing'.\n";
+        mSlabDirection = Direction;
+    }
+
     ///@}
 
 private:
 
+    ///@name Private Operations
+    ///@{
+
+    /// @brief Returns true if rPoint lies on bounded side of rClippedMesh. See: OnBoundedSideOfClippedSection().
+    /// @param rPoint Query Point.
+    /// @param rClippedMesh Mesh clipped by AABB.
+    /// @param rLowerBound of AABB.
+    /// @param rUpperBound of AABB.
+    /// @return bool
+    bool OnBoundedSideOfClippedMesh( const PointType& rPoint, const TriangleMeshInterface& rClippedMesh,
+        const PointType& rLowerBound, const PointType& rUpperBound ) const;
+
+    ///@brief Returns true if point is inside TriangleMesh. Casts random rays until 5 are successful. The majority decides.
+    ///@param rPoint
+    ///@return bool
+    bool IsInsideRayTracing(const PointType& rPoint) const;
+
+    ///@brief Returns winding number evaluator. Constructed on first call (thread-safe).
+    ///@return const FastWindingNumber&
+    const FastWindingNumber& GetFastWindingNumber() const;
+
+    ///@}
     ///@name Private Members
     ///@{
 
     const TriangleMeshInterface& mTriangleMesh;
     GeometryQuery mGeometryQuery;
+    mutable ClippedMeshCache mClippedMeshCache;
+    InsideTestMethod mInsideTestMethod = InsideTestMethod::ray_tracing;
+    IndexType mSlabDirection = NoSlabDirection;
+    mutable Unique<FastWindingNumber> mpFastWindingNumber = nullptr;
+    mutable std::once_flag mFastWindingNumberFlag;
 
     ///@}
 }; // End BRepOperator class
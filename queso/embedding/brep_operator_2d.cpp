@@ -0,0 +1,278 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+//// STL includes
+#include <cmath>
+#include <algorithm>
+#include <stack>
+//// Project includes
+#include "queso/embedding/brep_operator_2d.h"
+#include "queso/embedding/clipper.h"
+#include "queso/containers/grid_indexer.hpp"
+
+namespace queso {
+
+typedef BRepOperator2D::PolylineVectorType PolylineVectorType;
+typedef BRepOperator2D::StatusVectorType StatusVectorType;
+
+BRepOperator2D::BRepOperator2D(const PolylineVectorType& rPolylines, bool Closed) : mPolylines(), mClosed(Closed) {
+    mPolylines.reserve(rPolylines.size());
+    for( const auto& r_polyline : rPolylines ){
+        PolylineType polyline(r_polyline);
+        // Remove closing vertex, if it is given explicitly.
+        if( mClosed && polyline.size() > 1 ){
+            const auto& r_first = polyline.front();
+            const auto& r_last = polyline.back();
+            if( std::abs(r_first[0]-r_last[0]) < ZEROTOL && std::abs(r_first[1]-r_last[1]) < ZEROTOL ){
+                polyline.pop_back();
+            }
+        }
+        QuESo_ERROR_IF( mClosed && polyline.size() < 3 ) << "Closed polyline must contain at least three vertices.\n";
+        QuESo_ERROR_IF( polyline.size() < 2 ) << "Polyline must contain at least two vertices.\n";
+        mPolylines.push_back(std::move(polyline));
+    }
+}
+
+int BRepOperator2D::WindingNumber(const PointType& rPoint, const PolylineVectorType& rPolylines) {
+    // See: D. Sunday, Practical Geometry Algorithms, Chapter 4 (Inclusion of a Point in a Polygon).
+    int winding_number = 0;
+    for( const auto& r_polyline : rPolylines ){
+        const IndexType num_vertices = r_polyline.size();
+        for( IndexType i = 0; i < num_vertices; ++i ){
+            const auto& r_a = r_polyline[i];
+            const auto& r_b = r_polyline[(i+1) % num_vertices];
+            const double is_left = (r_b[0] - r_a[0])*(rPoint[1] - r_a[1]) - (rPoint[0] - r_a[0])*(r_b[1] - r_a[1]);
+            if( r_a[1] <= rPoint[1] ){
+                if( r_b[1] > rPoint[1] && is_left > 0.0 ){ // Upward crossing.
+                    ++winding_number;
+                }
+            } else if( r_b[1] <= rPoint[1] && is_left < 0.0 ){ // Downward crossing.
+                --winding_number;
+            }
+        }
+    }
+    return winding_number;
+}
+
+double BRepOperator2D::Area(const PolylineVectorType& rPolylines) {
+    double area = 0.0;
+    for( const auto& r_polyline : rPolylines ){
+        const IndexType num_vertices = r_polyline.size();
+        for( IndexType i = 0; i < num_vertices; ++i ){
+            const auto& r_a = r_polyline[i];
+            const auto& r_b = r_polyline[(i+1) % num_vertices];
+            area += r_a[0]*r_b[1] - r_b[0]*r_a[1];
+        }
+    }
+    return 0.5*area;
+}
+
+double BRepOperator2D::Length() const {
+    double length = 0.0;
+    for( IndexType i = 0; i < mPolylines.size(); ++i ){
+        const auto& r_polyline = mPolylines[i];
+        for( IndexType j = 0; j < NumberOfSegments(i); ++j ){
+            const auto& r_a = r_polyline[j];
+            const auto& r_b = r_polyline[(j+1) % r_polyline.size()];
+            length += std::sqrt( (r_b[0]-r_a[0])*(r_b[0]-r_a[0]) + (r_b[1]-r_a[1])*(r_b[1]-r_a[1]) );
+        }
+    }
+    return length;
+}
+
+IndexType BRepOperator2D::NumberOfSegments() const {
+    IndexType num_segments = 0;
+    for( IndexType i = 0; i < mPolylines.size(); ++i ){
+        num_segments += NumberOfSegments(i);
+    }
+    return num_segments;
+}
+
+BoundingBoxType BRepOperator2D::GetBoundingBox() const {
+    BoundingBoxType bounding_box{ {MAXD, MAXD, MAXD}, {LOWESTD, LOWESTD, LOWESTD} };
+    for( const auto& r_polyline : mPolylines ){
+        for( const auto& r_point : r_polyline ){
+            for( IndexType dir = 0; dir < 3; ++dir ){
+                bounding_box.first[dir] = std::min(bounding_box.first[dir], r_point[dir]);
+                bounding_box.second[dir] = std::max(bounding_box.second[dir], r_point[dir]);
+            }
+        }
+    }
+    return bounding_box;
+}
+
+bool BRepOperator2D::SegmentIntersectsRectangle(const PointType& rA, const PointType& rB, const PointType& rLowerBound, const PointType& rUpperBound) {
+    // Separating axis test: Axes of the rectangle.
+    for( IndexType dir = 0; dir < 2; ++dir ){
+        if( std::max(rA[dir], rB[dir]) < rLowerBound[dir] || std::min(rA[dir], rB[dir]) > rUpperBound[dir] ){
+            return false;
+        }
+    }
+    // Normal of the segment: All corners must not lie strictly on the same side.
+    const double dx = rB[0] - rA[0];
+    const double dy = rB[1] - rA[1];
+    bool has_positive = false;
+    bool has_negative = false;
+    for( IndexType i = 0; i < 4; ++i ){
+        const double x = (i%2) ? rUpperBound[0] : rLowerBound[0];
+        const double y = (i/2) ? rUpperBound[1] : rLowerBound[1];
+        const double side = dx*(y - rA[1]) - dy*(x - rA[0]);
+        has_positive |= (side >= 0.0);
+        has_negative |= (side <= 0.0);
+    }
+    return has_positive && has_negative;
+}
+
+bool BRepOperator2D::IsTrimmed(const PointType& rLowerBound, const PointType& rUpperBound, double Tolerance) const {
+    const double tolerance = RelativeSnapTolerance(rLowerBound, rUpperBound, Tolerance);
+    const PointType lower_bound{rLowerBound[0]-tolerance, rLowerBound[1]-tolerance, rLowerBound[2]};
+    const PointType upper_bound{rUpperBound[0]+tolerance, rUpperBound[1]+tolerance, rUpperBound[2]};
+    for( IndexType i = 0; i < mPolylines.size(); ++i ){
+        const auto& r_polyline = mPolylines[i];
+        for( IndexType j = 0; j < NumberOfSegments(i); ++j ){
+            if( SegmentIntersectsRectangle(r_polyline[j], r_polyline[(j+1) % r_polyline.size()], lower_bound, upper_bound) ){
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+Unique<StatusVectorType> BRepOperator2D::pGetElementClassifications(const Settings& rSettings) const {
+    const auto& r_grid_settings = rSettings[MainSettings::background_grid_settings];
+    const auto& r_lower_bound = r_grid_settings.GetValue<PointType>(BackgroundGridSettings::lower_bound_xyz);
+    const auto& r_upper_bound = r_grid_settings.GetValue<PointType>(BackgroundGridSettings::upper_bound_xyz);
+    const auto& r_number_of_elements = r_grid_settings.GetValue<Vector3i>(BackgroundGridSettings::number_of_elements);
+    QuESo_ERROR_IF( r_number_of_elements[2] != 1 ) << "BRepOperator2D requires a single layer of elements in z-direction.\n";
+
+    const GridIndexer grid_indexer(rSettings);
+    const IndexType num_elements = grid_indexer.NumberOfElements();
+    const std::array<double, 2> delta{ (r_upper_bound[0] - r_lower_bound[0]) / static_cast<double>(r_number_of_elements[0]),
+                                       (r_upper_bound[1] - r_lower_bound[1]) / static_cast<double>(r_number_of_elements[1]) };
+    const double tolerance = RelativeSnapTolerance(grid_indexer.GetBoundingBoxXYZFromIndex(0).first,
+                                                   grid_indexer.GetBoundingBoxXYZFromIndex(0).second, SNAPTOL);
+
+    auto p_states = MakeUnique<StatusVectorType>(num_elements, IntersectionState::outside);
+    std::vector<bool> is_visited(num_elements, false);
+
+    // Mark all cells that are touched by a segment as trimmed. Only cells within the bounding box of each segment are tested.
+    auto get_cell_range = [&](double Min, double Max, IndexType Dir){
+        const double upper = static_cast<double>(r_number_of_elements[Dir]-1);
+        const double first = std::floor((Min - tolerance - r_lower_bound[Dir]) / delta[Dir]);
+        const double last = std::floor((Max + tolerance - r_lower_bound[Dir]) / delta[Dir]);
+        return std::make_pair( static_cast<IndexType>(std::max(0.0, std::min(first, upper))),
+                               static_cast<IndexType>(std::max(0.0, std::min(last, upper))) );
+    };
+    for( IndexType i = 0; i < mPolylines.size(); ++i ){
+        const auto& r_polyline = mPolylines[i];
+        for( IndexType j = 0; j < NumberOfSegments(i); ++j ){
+            const auto& r_a = r_polyline[j];
+            const auto& r_b = r_polyline[(j+1) % r_polyline.size()];
+            const auto range_x = get_cell_range(std::min(r_a[0], r_b[0]), std::max(r_a[0], r_b[0]), 0);
+            const auto range_y = get_cell_range(std::min(r_a[1], r_b[1]), std::max(r_a[1], r_b[1]), 1);
+            for( IndexType index_x = range_x.first; index_x <= range_x.second; ++index_x ){
+                for( IndexType index_y = range_y.first; index_y <= range_y.second; ++index_y ){
+                    const IndexType index = grid_indexer.GetVectorIndexFromMatrixIndices(index_x, index_y, 0);
+                    if( is_visited[index] ){
+                        continue;
+                    }
+                    const auto bounding_box = grid_indexer.GetBoundingBoxXYZFromIndex(index);
+                    const PointType lower_bound{bounding_box.first[0]-tolerance, bounding_box.first[1]-tolerance, bounding_box.first[2]};
+                    const PointType upper_bound{bounding_box.second[0]+tolerance, bounding_box.second[1]+tolerance, bounding_box.second[2]};
+                    if( SegmentIntersectsRectangle(r_a, r_b, lower_bound, upper_bound) ){
+                        (*p_states)[index] = IntersectionState::trimmed;
+                        is_visited[index] = true;
+                    }
+                }
+            }
+        }
+    }
+
+    // Flood fill: Group connected cells, which are not trimmed. Each group is either fully inside or fully outside.
+    std::stack<IndexType> index_stack{};
+    std::vector<IndexType> group{};
+    for( IndexType start_index = 0; start_index < num_elements; ++start_index ){
+        if( is_visited[start_index] ){
+            continue;
+        }
+        group.clear();
+        index_stack.push(start_index);
+        is_visited[start_index] = true;
+        while( !index_stack.empty() ){
+            const IndexType index = index_stack.top();
+            index_stack.pop();
+            group.push_back(index);
+            for( IndexType direction = 0; direction < 4; ++direction ){
+                const auto next_index = grid_indexer.GetNextIndex(index, direction);
+                if( next_index.second == GridIndexer::IndexInfo::middle && !is_visited[next_index.first] ){
+                    is_visited[next_index.first] = true;
+                    index_stack.push(next_index.first);
+                }
+            }
+        }
+        const auto bounding_box = grid_indexer.GetBoundingBoxXYZFromIndex(start_index);
+        const PointType center{ 0.5*(bounding_box.first[0]+bounding_box.second[0]), 0.5*(bounding_box.first[1]+bounding_box.second[1]), 0.0 };
+        const IntersectionState state = IsInside(center) ? IntersectionState::inside : IntersectionState::outside;
+        for( const IndexType index : group ){
+            (*p_states)[index] = state;
+        }
+    }
+
+    return p_states;
+}
+
+Unique<PolylineVectorType> BRepOperator2D::pGetTrimmedDomain(const PointType& rLowerBound, const PointType& rUpperBound, double MinElementAreaRatio) const {
+    auto p_loops = MakeUnique<PolylineVectorType>();
+    for( const auto& r_polyline : mPolylines ){
+        auto loop = Clipper::ClipPolygon(r_polyline, rLowerBound, rUpperBound);
+        if( loop.size() > 2 ){
+            p_loops->push_back(std::move(loop));
+        }
+    }
+
+    const double element_area = (rUpperBound[0] - rLowerBound[0])*(rUpperBound[1] - rLowerBound[1]);
+    if( p_loops->empty() || Area(*p_loops) < MinElementAreaRatio*element_area ){
+        return nullptr;
+    }
+    return p_loops;
+}
+
+Unique<TriangleMeshInterface> BRepOperator2D::pGetExtrudedMesh(double LowerZ, double UpperZ) const {
+    auto p_mesh = MakeUnique<TriangleMesh>();
+    p_mesh->Reserve(2*NumberOfSegments());
+    for( IndexType i = 0; i < mPolylines.size(); ++i ){
+        const auto& r_polyline = mPolylines[i];
+        for( IndexType j = 0; j < NumberOfSegments(i); ++j ){
+            const auto& r_a = r_polyline[j];
+            const auto& r_b = r_polyline[(j+1) % r_polyline.size()];
+            const double dx = r_b[0] - r_a[0];
+            const double dy = r_b[1] - r_a[1];
+            const double length = std::sqrt(dx*dx + dy*dy);
+            if( length < ZEROTOL ){
+                continue;
+            }
+            const IndexType id = p_mesh->AddVertex({r_a[0], r_a[1], LowerZ});
+            p_mesh->AddVertex({r_b[0], r_b[1], LowerZ});
+            p_mesh->AddVertex({r_a[0], r_a[1], UpperZ});
+            p_mesh->AddVertex({r_b[0], r_b[1], UpperZ});
+            const PointType normal{dy/length, -dx/length, 0.0};
+            p_mesh->AddTriangle({id, id+1, id+3});
+            p_mesh->AddNormal(normal);
+            p_mesh->AddTriangle({id, id+3, id+2});
+            p_mesh->AddNormal(normal);
+        }
+    }
+    return p_mesh;
+}
+
+} // End namespace queso
@@ -0,0 +1,169 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#ifndef BREP_OPERATOR_2D_INCLUDE_H
+#define BREP_OPERATOR_2D_INCLUDE_H
+
+//// STL includes
+#include <vector>
+//// Project includes
+#include "queso/includes/define.hpp"
+#include "queso/includes/settings.hpp"
+#include "queso/containers/triangle_mesh.hpp"
+
+namespace queso {
+
+///@name QuESo Classes
+///@{
+
+/**
+ * @class  BRepOperator2D
+ * @author Manuel Messmer
+ * @brief  Planar counterpart of BRepOperator. Provides geometrical operations for domains in the xy-plane, which are bounded by polylines.
+ * @details The z-components of all points are ignored. If the polylines bound a domain, they must be closed (the last vertex is connected to the first)
+ *          and oriented consistently: Outer boundaries counter-clockwise, holes clockwise. Hence, the domain is always on the left-hand side.
+ *          Points are classified via the winding number. Elements are classified via a 2D flood fill (see: pGetElementClassifications()).
+ *          Trimmed domains are represented by their clipped boundary loops (see: pGetTrimmedDomain() and Clipper::ClipPolygon()).
+*/
+class BRepOperator2D {
+
+public:
+    ///@name Type Definitions
+    ///@{
+
+    typedef std::vector<PointType> PolylineType;
+    typedef std::vector<PolylineType> PolylineVectorType;
+    typedef std::vector<IntersectionStateType> StatusVectorType;
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// @brief Constructor.
+    /// @param rPolylines
+    /// @param Closed If true, each polyline is closed, i.e. the last vertex is connected to the first vertex. Must be true, if a domain is bounded.
+    BRepOperator2D(const PolylineVectorType& rPolylines, bool Closed=true);
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+    ///@brief Returns true if point is inside the domain (winding number is non-zero).
+    ///@param rPoint
+    ///@return bool
+    bool IsInside(const PointType& rPoint) const {
+        return WindingNumber(rPoint, mPolylines) != 0;
+    }
+
+    ///@brief Returns the winding number of rPoint with respect to closed polylines (z-components are ignored).
+    ///       Degenerate edges, which are traversed in both directions, cancel.
+    ///@param rPoint
+    ///@param rPolylines
+    ///@return int
+    static int WindingNumber(const PointType& rPoint, const PolylineVectorType& rPolylines);
+
+    ///@brief Returns the signed area enclosed by closed polylines (shoelace formula). Positive for counter-clockwise polylines.
+    ///@param rPolylines
+    ///@return double
+    static double Area(const PolylineVectorType& rPolylines);
+
+    ///@brief Returns the area of the domain.
+    ///@return double
+    double Area() const {
+        return Area(mPolylines);
+    }
+
+    ///@brief Returns the total length of all polylines.
+    ///@return double
+    double Length() const;
+
+    ///@brief Returns the number of line segments of all polylines.
+    ///@return IndexType
+    IndexType NumberOfSegments() const;
+
+    ///@brief Returns the bounding box of all polylines.
+    ///@return BoundingBoxType
+    BoundingBoxType GetBoundingBox() const;
+
+    ///@brief Returns true, if the rectangle given by the x- and y-components of the AABB is intersected or touched by at least one segment.
+    ///@param rLowerBound of AABB.
+    ///@param rUpperBound of AABB.
+    ///@param Tolerance Enlarges the rectangle.
+    ///@return bool
+    bool IsTrimmed(const PointType& rLowerBound, const PointType& rUpperBound, double Tolerance = SNAPTOL) const;
+
+    ///@brief Returns a ptr to a vector that holds the states of each element. Vector is ordered according to index -> see: GridIndexer.
+    ///       Cells that are touched by the polylines are marked as trimmed. All remaining cells are grouped via a 2D flood fill (4-neighborhood)
+    ///       on the background grid. Each group is classified by a single inside test.
+    ///@param rSettings Background grid must contain a single layer of elements in z-direction.
+    ///@return Unique<StatusVectorType>
+    Unique<StatusVectorType> pGetElementClassifications(const Settings& rSettings) const;
+
+    ///@brief Returns the trimmed domain of the rectangle given by the x- and y-components of the AABB as closed boundary loops.
+    ///       The loops keep the orientation of the polylines (see: Clipper::ClipPolygon()).
+    ///@param rLowerBound Lower bound of AABB.
+    ///@param rUpperBound Upper bound of AABB.
+    ///@param MinElementAreaRatio Below this ratio elements are not considered.
+    ///@return Unique<PolylineVectorType>. nullptr, if the area of the trimmed domain is too small.
+    Unique<PolylineVectorType> pGetTrimmedDomain(const PointType& rLowerBound, const PointType& rUpperBound, double MinElementAreaRatio) const;
+
+    ///@brief Returns the polylines extruded in z-direction from LowerZ to UpperZ as triangle mesh (two triangles per segment).
+    ///       For closed, counter-clockwise polylines, the normals point outwards. The area of the mesh is Length()*(UpperZ-LowerZ).
+    ///@param LowerZ
+    ///@param UpperZ
+    ///@return Unique<TriangleMeshInterface>
+    Unique<TriangleMeshInterface> pGetExtrudedMesh(double LowerZ, double UpperZ) const;
+
+    ///@brief Returns the polylines.
+    ///@return const PolylineVectorType&
+    const PolylineVectorType& GetPolylines() const {
+        return mPolylines;
+    }
+
+    ///@}
+
+private:
+
+    ///@name Private Operations
+    ///@{
+
+    ///@brief Returns true, if the segment from rA to rB intersects the rectangle (z-components are ignored).
+    ///@param rA
+    ///@param rB
+    ///@param rLowerBound
+    ///@param rUpperBound
+    ///@return bool
+    static bool SegmentIntersectsRectangle(const PointType& rA, const PointType& rB, const PointType& rLowerBound, const PointType& rUpperBound);
+
+    ///@brief Returns number of segments of i-th polyline.
+    ///@param i
+    ///@return IndexType
+    IndexType NumberOfSegments(IndexType i) const {
+        const IndexType num_vertices = mPolylines[i].size();
+        return mClosed ? num_vertices : ( (num_vertices > 0) ? num_vertices-1 : 0 );
+    }
+
+    ///@}
+    ///@name Private Members
+    ///@{
+
+    PolylineVectorType mPolylines;
+    bool mClosed;
+
+    ///@}
+}; // End BRepOperator2D class
+///@} End QuESo classes
+
+} // End namespace queso
+
+#endif // BREP_OPERATOR_2D_INCLUDE_H
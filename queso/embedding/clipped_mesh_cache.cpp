@@ -0,0 +1,200 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+//// Project includes
+#include "queso/embedding/clipped_mesh_cache.h"
+#include "queso/embedding/clipper.h"
+
+namespace queso {
+
+Unique<TriangleMeshInterface> ClippedMeshCache::pGetClippedMesh(IndexType CellIndex, const BoundingBoxType& rCellBounds,
+        const PointType& rLowerBound, const PointType& rUpperBound) {
+
+    // Look up entry. Note that the entry is shared, such that it can be used after the lock is released.
+    EntryPtrType p_entry = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto it = mEntries.find(CellIndex);
+        if( it != mEntries.end() ){
+            p_entry = it->second.first;
+            // Mark as most recently used.
+            mLruList.splice(mLruList.begin(), mLruList, it->second.second);
+            ++mNumberOfHits;
+        }
+    }
+
+    if( !p_entry ){
+        // Create entry outside of lock.
+        p_entry = pCreateEntry(rCellBounds);
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        ++mNumberOfMisses;
+        auto it = mEntries.find(CellIndex);
+        if( it == mEntries.end() ){
+            const IndexType num_triangles = p_entry->triangle_ids.size();
+            if( num_triangles <= mMaxNumberOfTriangles ){
+                // Evict least recently used entries.
+                while( mNumberOfTriangles + num_triangles > mMaxNumberOfTriangles ){
+                    auto it_last = mEntries.find(mLruList.back());
+                    mNumberOfTriangles -= it_last->second.first->triangle_ids.size();
+                    mEntries.erase(it_last);
+                    mLruList.pop_back();
+                }
+                mLruList.push_front(CellIndex);
+                mEntries.insert( std::make_pair(CellIndex, std::make_pair(p_entry, mLruList.begin())) );
+                mNumberOfTriangles += num_triangles;
+            }
+        } else {
+            // Entry was created concurrently by another thread.
+            p_entry = it->second.first;
+        }
+    }
+
+    const Entry& r_entry = *p_entry;
+    if( !IsCovered(r_entry, rLowerBound, rUpperBound) ){
+        return nullptr;
+    }
+
+    // Same tolerance as in BRepOperator::pClipTriangleMesh().
+    const double snap_tolerance = 0.1*RelativeSnapTolerance(rUpperBound, rLowerBound);
+    AABB_primitive aabb(rLowerBound, rUpperBound);
+
+    const IndexType num_candidates = r_entry.triangle_ids.size();
+    auto p_triangle_mesh = MakeUnique<TriangleMesh>();
+    p_triangle_mesh->Reserve( 2*num_candidates );
+    p_triangle_mesh->ReserveEdgesOnPlane( num_candidates );
+    const auto& r_interior_mesh = r_entry.interior_mesh;
+    for( IndexType i = 0; i < num_candidates; ++i ){
+        const IndexType interior_position = r_entry.interior_positions[i];
+        if( interior_position != NoCellIndex ){
+            // Triangle is strictly inside. Clipped triangle is independent of the actual AABB.
+            const IndexType num_v = p_triangle_mesh->NumOfVertices();
+            p_triangle_mesh->AddVertex( r_interior_mesh.P1(interior_position) );
+            p_triangle_mesh->AddVertex( r_interior_mesh.P2(interior_position) );
+            p_triangle_mesh->AddVertex( r_interior_mesh.P3(interior_position) );
+            p_triangle_mesh->AddTriangle( {num_v+0, num_v+1, num_v+2} );
+            p_triangle_mesh->AddNormal( r_interior_mesh.Normal(interior_position) );
+        } else {
+            // Triangle is close to boundary of cell. Must be clipped again.
+            const IndexType triangle_id = r_entry.triangle_ids[i];
+            const auto& P1 = mTriangleMesh.P1(triangle_id);
+            const auto& P2 = mTriangleMesh.P2(triangle_id);
+            const auto& P3 = mTriangleMesh.P3(triangle_id);
+            if( aabb.intersect(P1, P2, P3, snap_tolerance) ){
+                const auto& normal = mTriangleMesh.Normal(triangle_id);
+                auto p_polygon = Clipper::ClipTriangle(P1, P2, P3, normal, rLowerBound, rUpperBound );
+                if( p_polygon ){
+                    p_polygon->AddToTriangleMesh(*p_triangle_mesh.get());
+                }
+            }
+        }
+    }
+    if( p_triangle_mesh->NumOfTriangles() > 0){
+        p_triangle_mesh->Check();
+    }
+    return p_triangle_mesh;
+}
+
+ClippedMeshCache::EntryPtrType ClippedMeshCache::pCreateEntry(const BoundingBoxType& rCellBounds) const {
+    const auto& r_lower_bound = rCellBounds.first;
+    const auto& r_upper_bound = rCellBounds.second;
+
+    auto p_entry = std::make_shared<Entry>();
+    p_entry->cell_bounds = rCellBounds;
+    // Margin must cover all offsets/perturbations that are applied in FloodFill and BRepOperator::pGetTrimmedDomain().
+    const double margin = 1e5*RelativeSnapTolerance(r_lower_bound, r_upper_bound);
+    p_entry->margin = margin;
+
+    const PointType enlarged_lower_bound = Math::Subtract(r_lower_bound, {margin, margin, margin});
+    const PointType enlarged_upper_bound = Math::Add(r_upper_bound, {margin, margin, margin});
+
+    // Get all triangles that touch the enlarged cell (no tolerance -> conservative).
+    auto p_triangle_ids = mGeometryQuery.GetIntersectedTriangleIds(enlarged_lower_bound, enlarged_upper_bound, 0.0);
+    p_entry->triangle_ids = std::move(*p_triangle_ids);
+    const IndexType num_triangles = p_entry->triangle_ids.size();
+    p_entry->interior_positions.resize(num_triangles, NoCellIndex);
+    p_entry->interior_mesh.Reserve(num_triangles);
+
+    // Triangles further away than 2*margin from the cell boundaries are not touched by any admissible AABB.
+    const PointType inner_lower_bound = Math::Add(r_lower_bound, {2.0*margin, 2.0*margin, 2.0*margin});
+    const PointType inner_upper_bound = Math::Subtract(r_upper_bound, {2.0*margin, 2.0*margin, 2.0*margin});
+    auto is_strictly_inside = [&inner_lower_bound, &inner_upper_bound](const PointType& rPoint) -> bool {
+        for( IndexType dim = 0; dim < 3; ++dim ){
+            if( rPoint[dim] <= inner_lower_bound[dim] || rPoint[dim] >= inner_upper_bound[dim] ){
+                return false;
+            }
+        }
+        return true;
+    };
+
+    auto& r_interior_mesh = p_entry->interior_mesh;
+    for( IndexType i = 0; i < num_triangles; ++i ){
+        const IndexType triangle_id = p_entry->triangle_ids[i];
+        const auto& P1 = mTriangleMesh.P1(triangle_id);
+        const auto& P2 = mTriangleMesh.P2(triangle_id);
+        const auto& P3 = mTriangleMesh.P3(triangle_id);
+        if( is_strictly_inside(P1) && is_strictly_inside(P2) && is_strictly_inside(P3) ){
+            const auto& normal = mTriangleMesh.Normal(triangle_id);
+            auto p_polygon = Clipper::ClipTriangle(P1, P2, P3, normal, r_lower_bound, r_upper_bound );
+            // Only store polygons that are not modified by the clipping operation.
+            if( p_polygon && p_polygon->NumVertices() == 3 ){
+                p_entry->interior_positions[i] = r_interior_mesh.NumOfTriangles();
+                p_polygon->AddToTriangleMesh(r_interior_mesh);
+            }
+        }
+    }
+
+    return p_entry;
+}
+
+bool ClippedMeshCache::IsCovered(const Entry& rEntry, const PointType& rLowerBound, const PointType& rUpperBound) {
+    const auto& r_cell_lower_bound = rEntry.cell_bounds.first;
+    const auto& r_cell_upper_bound = rEntry.cell_bounds.second;
+    const double margin = rEntry.margin;
+    for( IndexType dim = 0; dim < 3; ++dim ){
+        if( std::abs(rLowerBound[dim] - r_cell_lower_bound[dim]) > margin
+                || std::abs(rUpperBound[dim] - r_cell_upper_bound[dim]) > margin ){
+            return false;
+        }
+    }
+    return true;
+}
+
+void ClippedMeshCache::Clear() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mEntries.clear();
+    mLruList.clear();
+    mNumberOfTriangles = 0;
+}
+
+IndexType ClippedMeshCache::NumberOfEntries() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mEntries.size();
+}
+
+IndexType ClippedMeshCache::NumberOfTriangles() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mNumberOfTriangles;
+}
+
+IndexType ClippedMeshCache::NumberOfHits() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mNumberOfHits;
+}
+
+IndexType ClippedMeshCache::NumberOfMisses() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mNumberOfMisses;
+}
+
+} // End namespace queso
@@ -0,0 +1,152 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#ifndef CLIPPED_MESH_CACHE_INCLUDE_H
+#define CLIPPED_MESH_CACHE_INCLUDE_H
+
+//// STL includes
+#include <list>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+//// Project includes
+#include "queso/includes/define.hpp"
+#include "queso/containers/triangle_mesh.hpp"
+#include "queso/embedding/geometry_query.h"
+
+namespace queso {
+
+///@name QuESo Classes
+///@{
+
+/**
+ * @class  ClippedMeshCache
+ * @author Manuel Messmer
+ * @brief  Thread-safe, bounded cache of clipped triangle subsets of background cells.
+ * @details For each cell (identified by its index) the triangles of a slightly enlarged box are stored once.
+ *          Triangles that are located strictly inside the cell are stored already clipped. Only the remaining boundary triangles
+ *          are re-clipped, if the mesh is requested for a slightly offset/perturbed box of the same cell (see: FloodFill and pGetTrimmedDomain()).
+ *          The result is identical to BRepOperator::pClipTriangleMesh(). Least recently used cells are evicted once the
+ *          total number of stored triangles exceeds the given limit.
+*/
+class ClippedMeshCache {
+
+public:
+    ///@name Type Definitions
+    ///@{
+
+    static constexpr IndexType NoCellIndex = std::numeric_limits<IndexType>::max();
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// @brief Constructor.
+    /// @param rTriangleMesh Triangle mesh to be clipped.
+    /// @param rGeometryQuery Geometry query (AABB tree) of rTriangleMesh.
+    /// @param MaxNumberOfTriangles Upper bound of the number of triangles that are kept in the cache.
+    ClippedMeshCache(const TriangleMeshInterface& rTriangleMesh, const GeometryQuery& rGeometryQuery, IndexType MaxNumberOfTriangles = 1000000UL)
+        : mTriangleMesh(rTriangleMesh), mGeometryQuery(rGeometryQuery), mMaxNumberOfTriangles(MaxNumberOfTriangles)
+    {
+    }
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+    /// @brief Returns triangle mesh clipped by AABB (rLowerBound, rUpperBound). AABB must be a slightly offset/perturbed version of the cell rCellBounds.
+    ///        Returns nullptr, if AABB deviates too much from rCellBounds. In this case, the mesh must be clipped directly (see: BRepOperator::pClipTriangleMesh()).
+    /// @param CellIndex Index of cell. Used as key.
+    /// @param rCellBounds Bounds of the unperturbed cell.
+    /// @param rLowerBound Lower bound of AABB.
+    /// @param rUpperBound Upper bound of AABB.
+    /// @return Unique<TriangleMeshInterface>. Clipped mesh.
+    Unique<TriangleMeshInterface> pGetClippedMesh(IndexType CellIndex, const BoundingBoxType& rCellBounds,
+        const PointType& rLowerBound, const PointType& rUpperBound);
+
+    /// @brief Removes all entries.
+    void Clear();
+
+    /// @brief Returns number of cells that are currently stored.
+    /// @return IndexType.
+    IndexType NumberOfEntries() const;
+
+    /// @brief Returns number of triangles that are currently stored.
+    /// @return IndexType.
+    IndexType NumberOfTriangles() const;
+
+    /// @brief Returns number of requests that were served from an existing entry.
+    /// @return IndexType.
+    IndexType NumberOfHits() const;
+
+    /// @brief Returns number of requests that required a new entry.
+    /// @return IndexType.
+    IndexType NumberOfMisses() const;
+
+    ///@}
+
+private:
+
+    ///@name Private Type Definitions
+    ///@{
+
+    /// Holds the triangles of an enlarged cell.
+    struct Entry {
+        BoundingBoxType cell_bounds;
+        double margin;
+        // Ids of all triangles that intersect the enlarged cell. Ordered as returned from the AABB tree.
+        std::vector<IndexType> triangle_ids;
+        // Position of each triangle in interior_mesh or NoCellIndex, if triangle must be re-clipped.
+        std::vector<IndexType> interior_positions;
+        // Already clipped triangles that are located strictly inside the cell.
+        TriangleMesh interior_mesh;
+    };
+
+    typedef std::shared_ptr<const Entry> EntryPtrType;
+    typedef std::list<IndexType> LruListType;
+    typedef std::unordered_map<IndexType, std::pair<EntryPtrType, LruListType::iterator>> EntryMapType;
+
+    ///@}
+    ///@name Private Operations
+    ///@{
+
+    /// @brief Creates new entry for the given cell.
+    EntryPtrType pCreateEntry(const BoundingBoxType& rCellBounds) const;
+
+    /// @brief Returns true, if AABB can be served from rEntry.
+    static bool IsCovered(const Entry& rEntry, const PointType& rLowerBound, const PointType& rUpperBound);
+
+    ///@}
+    ///@name Private Members
+    ///@{
+
+    const TriangleMeshInterface& mTriangleMesh;
+    const GeometryQuery& mGeometryQuery;
+    const IndexType mMaxNumberOfTriangles;
+
+    mutable std::mutex mMutex;
+    EntryMapType mEntries;
+    LruListType mLruList;
+    IndexType mNumberOfTriangles = 0;
+    IndexType mNumberOfHits = 0;
+    IndexType mNumberOfMisses = 0;
+
+    ///@}
+}; // End ClippedMeshCache class
+///@} // End QuESo classes
+
+} // End namespace queso
+
+#endif // CLIPPED_MESH_CACHE_INCLUDE_H
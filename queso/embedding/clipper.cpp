@@ -82,6 +82,48 @@ Unique<PolygonType> Clipper::ClipTriangle(const PointType& rV1, const PointType&
 
 }
 
+std::vector<PointType> Clipper::ClipPolygon(const std::vector<PointType>& rPolygon, const PointType& rLowerBound, const PointType& rUpperBound){
+    std::vector<PointType> current_poly(rPolygon);
+    std::vector<PointType> prev_poly{};
+    prev_poly.reserve(rPolygon.size());
+
+    // Sutherland-Hodgman: Same as ClipPolygonByPlane(), but only the planes [-x, x, -y, y] are considered.
+    for( IndexType plane_index = 0; plane_index < 4 && current_poly.size() > 0; ++plane_index ){
+        const double plane_position = (plane_index%2UL) ? rUpperBound[plane_index/2UL] : rLowerBound[plane_index/2UL];
+        Plane plane(plane_index, plane_position);
+        prev_poly.swap(current_poly);
+        current_poly.clear();
+
+        const PointType* a = &prev_poly.back();
+        IndexType a_side = ClassifyPointToPlane(*a, plane);
+        for( const auto& b : prev_poly ){
+            const IndexType b_side = ClassifyPointToPlane(b, plane);
+            if( b_side == IN_FRONT_OF_PLANE ){
+                if( a_side == BEHIND_PLANE ){
+                    current_poly.push_back( FindIntersectionPointOnPlane(*a, b, plane) );
+                }
+            }
+            else if( b_side == ON_PLANE ){
+                if( a_side == BEHIND_PLANE ){
+                    current_poly.push_back(b);
+                }
+            }
+            else { // BEHIND_PLANE
+                if( a_side == IN_FRONT_OF_PLANE ){
+                    current_poly.push_back( FindIntersectionPointOnPlane(*a, b, plane) );
+                } else if( a_side == ON_PLANE ){
+                    current_poly.push_back(*a);
+                }
+                current_poly.push_back(b);
+            }
+            a = &b;
+            a_side = b_side;
+        }
+    }
+
+    return current_poly;
+}
+
 void Clipper::ClipPolygonByPlane(const PolygonType* pPrevPoly,
                          PolygonType* pCurrentPoly,
                          const Plane& rPlane) {
@@ -18,6 +18,7 @@
 #include <cstddef>
 #include <array>
 #include <algorithm>
+#include <vector>
 //// Project includes
 #include "queso/includes/define.hpp"
 #include "queso/embedding/polygon.h"
@@ -60,6 +61,16 @@ public:
     static Unique<PolygonType> ClipTriangle(const PointType& rV1, const PointType& rV2, const PointType& rV3,
                  const PointType& rNormal, const PointType& rLowerBound, const PointType& rUpperBound);
 
+    ///@brief Clips closed planar polygon (xy-plane) by the rectangle given by the x- and y-components of the AABB.
+    ///       The z-components are ignored. The orientation of the polygon is kept. The polygon may be non-convex. In this case, the result
+    ///       might contain degenerate edges on the boundary of the rectangle, which are traversed in both directions. Hence, they cancel
+    ///       in all boundary (line) integrals and in the winding number.
+    ///@param rPolygon Vertices of polygon. Last vertex is connected to the first vertex.
+    ///@param rLowerBound Lower bound of AABB.
+    ///@param rUpperBound Upper bound of AABB.
+    ///@return std::vector<PointType>. Empty, if polygon is fully outside of rectangle.
+    static std::vector<PointType> ClipPolygon(const std::vector<PointType>& rPolygon, const PointType& rLowerBound, const PointType& rUpperBound);
+
     ///@}
 
 private:
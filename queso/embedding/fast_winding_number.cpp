@@ -0,0 +1,132 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+//// STL includes
+#include <cmath>
+#include <algorithm>
+//// Project includes
+#include "queso/embedding/fast_winding_number.h"
+#include "queso/utilities/math_utilities.hpp"
+
+namespace queso {
+
+FastWindingNumber::FastWindingNumber(const TriangleMeshInterface& rTriangleMesh, const AABB_tree& rTree, double Beta)
+    : mTriangleMesh(rTriangleMesh), mTree(rTree), mBeta(Beta)
+{
+    const IndexType num_nodes = mTree.Nodes().size();
+    mCenters.resize(num_nodes, {0.0, 0.0, 0.0});
+    mWeightedNormals.resize(num_nodes, {0.0, 0.0, 0.0});
+    mRadii.resize(num_nodes, 0.0);
+    mAreas.resize(num_nodes, 0.0);
+
+    if( mTriangleMesh.NumOfTriangles() > 0 ){
+        ComputeDipole(mTree.Root());
+    }
+}
+
+void FastWindingNumber::ComputeDipole(IndexType NodeIndex) {
+    const auto& r_node = mTree.Nodes()[NodeIndex];
+    if( r_node.isLeaf() ){
+        const IndexType triangle_id = r_node.particle;
+        const auto& p1 = mTriangleMesh.P1(triangle_id);
+        const auto& p2 = mTriangleMesh.P2(triangle_id);
+        const auto& p3 = mTriangleMesh.P3(triangle_id);
+
+        // Area weighted normal: 0.5 * (p2-p1)x(p3-p1). Consistent with vertex ordering.
+        mWeightedNormals[NodeIndex] = Math::Mult(0.5, Math::Cross(Math::Subtract(p2, p1), Math::Subtract(p3, p1)));
+        mAreas[NodeIndex] = Math::Norm(mWeightedNormals[NodeIndex]);
+        const PointType center{ (p1[0]+p2[0]+p3[0])/3.0, (p1[1]+p2[1]+p3[1])/3.0, (p1[2]+p2[2]+p3[2])/3.0 };
+        mCenters[NodeIndex] = center;
+        mRadii[NodeIndex] = std::max( { Math::Norm(Math::Subtract(p1, center)),
+                                        Math::Norm(Math::Subtract(p2, center)),
+                                        Math::Norm(Math::Subtract(p3, center)) } );
+        return;
+    }
+
+    const IndexType left = r_node.left;
+    const IndexType right = r_node.right;
+    ComputeDipole(left);
+    ComputeDipole(right);
+
+    // Weighted normal is the sum of the children.
+    mWeightedNormals[NodeIndex] = Math::Add(mWeightedNormals[left], mWeightedNormals[right]);
+
+    // Center is the area-weighted mean of the children.
+    const double area_left = mAreas[left];
+    const double area_right = mAreas[right];
+    const double area_total = area_left + area_right;
+    mAreas[NodeIndex] = area_total;
+    PointType center = (area_total > ZEROTOL) ?
+        Math::Divide( Math::Add( Math::Mult(area_left, mCenters[left]), Math::Mult(area_right, mCenters[right]) ), area_total) :
+        Math::AddAndMult(0.5, mCenters[left], mCenters[right]);
+    mCenters[NodeIndex] = center;
+
+    // Radius encloses the spheres of both children.
+    mRadii[NodeIndex] = std::max( Math::Norm(Math::Subtract(mCenters[left], center)) + mRadii[left],
+                                  Math::Norm(Math::Subtract(mCenters[right], center)) + mRadii[right] );
+}
+
+double FastWindingNumber::WindingNumber(const PointType& rPoint) const {
+    if( mTriangleMesh.NumOfTriangles() == 0 ){
+        return 0.0;
+    }
+
+    const auto& r_nodes = mTree.Nodes();
+    std::vector<IndexType> stack;
+    stack.reserve(256);
+    stack.push_back(mTree.Root());
+
+    double solid_angle = 0.0;
+    while( stack.size() > 0 ){
+        const IndexType node_index = stack.back();
+        stack.pop_back();
+
+        const auto& r_node = r_nodes[node_index];
+        if( r_node.isLeaf() ){
+            const IndexType triangle_id = r_node.particle;
+            solid_angle += SolidAngle(rPoint, mTriangleMesh.P1(triangle_id), mTriangleMesh.P2(triangle_id), mTriangleMesh.P3(triangle_id));
+            continue;
+        }
+
+        const PointType distance_vector = Math::Subtract(mCenters[node_index], rPoint);
+        const double distance = Math::Norm(distance_vector);
+        if( distance > mBeta*mRadii[node_index] ){
+            // Far field: Dipole approximation.
+            solid_angle += Math::Dot(distance_vector, mWeightedNormals[node_index]) / (distance*distance*distance);
+        } else {
+            stack.push_back(r_node.left);
+            stack.push_back(r_node.right);
+        }
+    }
+
+    const double pi = 4.0*std::atan(1.0);
+    return solid_angle / (4.0*pi);
+}
+
+double FastWindingNumber::SolidAngle(const PointType& rPoint, const PointType& rP1, const PointType& rP2, const PointType& rP3) {
+    const PointType a = Math::Subtract(rP1, rPoint);
+    const PointType b = Math::Subtract(rP2, rPoint);
+    const PointType c = Math::Subtract(rP3, rPoint);
+
+    const double a_norm = Math::Norm(a);
+    const double b_norm = Math::Norm(b);
+    const double c_norm = Math::Norm(c);
+
+    // Determinant of [a b c].
+    const double det = Math::Dot(a, Math::Cross(b, c));
+    const double denominator = a_norm*b_norm*c_norm + Math::Dot(a, b)*c_norm + Math::Dot(b, c)*a_norm + Math::Dot(c, a)*b_norm;
+
+    return 2.0*std::atan2(det, denominator);
+}
+
+} // End namespace queso
@@ -0,0 +1,106 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#ifndef FAST_WINDING_NUMBER_INCLUDE_H
+#define FAST_WINDING_NUMBER_INCLUDE_H
+
+//// STL includes
+#include <vector>
+//// Project includes
+#include "queso/includes/define.hpp"
+#include "queso/containers/triangle_mesh_interface.hpp"
+#include "queso/embedding/aabb_tree.h"
+
+namespace queso {
+
+///@name QuESo Classes
+///@{
+
+/**
+ * @class  FastWindingNumber
+ * @author Manuel Messmer
+ * @brief  Hierarchical (Barnes-Hut) evaluation of the generalized winding number of a triangle mesh.
+ * @details Traverses the AABB tree of the triangle mesh. Nodes that are sufficiently far away from the query point
+ *          are approximated by a dipole (area-weighted normal located at the area-weighted centroid). All other triangles are evaluated
+ *          exactly via their solid angle (Van Oosterom and Strackee). The dipoles are precomputed once in the constructor.
+ *          The winding number is ~1 inside and ~0 outside of the mesh. Small gaps and self-overlaps only perturb the result locally.
+ *          See: Barill et al. (2018), Fast winding numbers for soups and clouds.
+*/
+class FastWindingNumber {
+
+public:
+    ///@name Life Cycle
+    ///@{
+
+    /// @brief Constructor. Precomputes dipoles of all tree nodes.
+    /// @param rTriangleMesh
+    /// @param rTree AABB tree of rTriangleMesh.
+    /// @param Beta Accuracy parameter. Nodes are approximated, if distance > Beta * radius of node.
+    FastWindingNumber(const TriangleMeshInterface& rTriangleMesh, const AABB_tree& rTree, double Beta = 2.0);
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+    /// @brief Returns generalized winding number of rPoint.
+    /// @param rPoint Query point.
+    /// @return double.
+    double WindingNumber(const PointType& rPoint) const;
+
+    /// @brief Returns true, if winding number of rPoint is larger than 0.5.
+    /// @param rPoint Query point.
+    /// @return bool.
+    bool IsInside(const PointType& rPoint) const {
+        return WindingNumber(rPoint) > 0.5;
+    }
+
+    /// @brief Returns solid angle of triangle (rP1, rP2, rP3) as seen from rPoint.
+    /// @param rPoint Query point.
+    /// @param rP1 Vertex 1 of triangle.
+    /// @param rP2 Vertex 2 of triangle.
+    /// @param rP3 Vertex 3 of triangle.
+    /// @return double.
+    static double SolidAngle(const PointType& rPoint, const PointType& rP1, const PointType& rP2, const PointType& rP3);
+
+    ///@}
+
+private:
+
+    ///@name Private Operations
+    ///@{
+
+    /// @brief Computes dipole of the node (recursive).
+    /// @param NodeIndex
+    void ComputeDipole(IndexType NodeIndex);
+
+    ///@}
+    ///@name Private Members
+    ///@{
+
+    const TriangleMeshInterface& mTriangleMesh;
+    const AABB_tree& mTree;
+    double mBeta;
+
+    // Dipole data of each node. Ordered according to AABB_tree::Nodes().
+    std::vector<PointType> mCenters;
+    std::vector<PointType> mWeightedNormals;
+    std::vector<double> mRadii;
+    std::vector<double> mAreas;
+
+    ///@}
+}; // End FastWindingNumber class
+///@} // End QuESo classes
+
+} // End namespace queso
+
+#endif // FAST_WINDING_NUMBER_INCLUDE_H
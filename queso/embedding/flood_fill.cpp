@@ -43,29 +43,8 @@ Unique<StatusVectorType> FloodFill::ClassifyElements(GroupSetVectorType& rGroups
     StatusVectorType states(total_num_elements);
     std::fill(states.begin(), states.end(), IntersectionState::outside );
 
-    // Get max num elements. Partition will happen along side with max_elements.
-    IndexType max_num_elements_per_dir = std::max<IndexType>( std::max<IndexType>(
-            mNumberOfElements[0], mNumberOfElements[1] ), mNumberOfElements[2] );
-
-    // Direction along we apply partition.
-    IndexType partition_index = 0;
-    std::array<IndexType, 2> directions;
-    if( mNumberOfElements[0] == max_num_elements_per_dir ){
-        partition_index = 0;
-        directions[0] = 0; // +x
-        directions[1] = 1; // -x
-    } else if ( mNumberOfElements[1] == max_num_elements_per_dir ) {
-        partition_index = 1;
-        directions[0] = 2; // +y
-        directions[1] = 3; // -y
-    } else if ( mNumberOfElements[2] == max_num_elements_per_dir ) {
-        partition_index = 2;
-        directions[0] = 4; // +z
-        directions[1] = 5; // -z
-    }
-
     // Partition domain in "num_threads" partitions along the direction with 'max_num_elements_per_dir';
-    std::vector<PartitionBoxType> partitions;
+    const IndexType partition_index = GetPartitionDirection();
     IndexType num_threads = 1;
     #pragma omp parallel
     {
@@ -74,50 +53,89 @@ Unique<StatusVectorType> FloodFill::ClassifyElements(GroupSetVectorType& rGroups
 
     const IndexType partition_size = std::max<IndexType>( static_cast<IndexType>(std::ceil( static_cast<double>(mNumberOfElements[partition_index]) /
         static_cast<double>(num_threads) ) ), 1);
+    const PartitionBoxVectorType partitions = GetPartitions(partition_size);
+
+    // Start filling.
+    GroupSetVectorType groups;
+    PartitionedFill(groups, partitions, states);
+
+    // Merge groups from all partitions.
+    BoundaryIndicesVectorType boundary_indices;
+    ComputeGroupBoundaries(groups, 0, partition_index, partitions, boundary_indices);
+    ClassifyGroups(groups, boundary_indices, rGroupsOutput, states);
+
+    return MakeUnique<StatusVectorType>(states);
+}
 
+IndexType FloodFill::GetPartitionDirection() const {
+    // Get max num elements. Partition will happen along side with max_elements.
+    IndexType max_num_elements_per_dir = std::max<IndexType>( std::max<IndexType>(
+            mNumberOfElements[0], mNumberOfElements[1] ), mNumberOfElements[2] );
+
+    if( mNumberOfElements[0] == max_num_elements_per_dir ){
+        return 0;
+    } else if ( mNumberOfElements[1] == max_num_elements_per_dir ) {
+        return 1;
+    }
+    return 2;
+}
+
+FloodFill::PartitionBoxVectorType FloodFill::GetPartitions(IndexType NumLayers) const {
+    QuESo_ERROR_IF(NumLayers == 0) << "Number of layers per partition must be larger than zero.\n";
+    const IndexType partition_index = GetPartitionDirection();
+
+    PartitionBoxVectorType partitions;
     Vector3i partition_lower_bound{0, 0, 0};
     Vector3i partition_upper_bound{mNumberOfElements[0]-1, mNumberOfElements[1]-1, mNumberOfElements[2]-1};
-    for( IndexType i = 0; i < num_threads; ++i ){
-        if( partition_size*i < mNumberOfElements[partition_index] ){
-            partition_lower_bound[partition_index] = partition_size*i;
-            partition_upper_bound[partition_index] = std::min<IndexType>(partition_size*(i+1), mNumberOfElements[partition_index])-1;
-            partitions.push_back( std::make_pair(partition_lower_bound,  partition_upper_bound) );
-        }
+    for( IndexType i = 0; NumLayers*i < mNumberOfElements[partition_index]; ++i ){
+        partition_lower_bound[partition_index] = NumLayers*i;
+        partition_upper_bound[partition_index] = std::min<IndexType>(NumLayers*(i+1), mNumberOfElements[partition_index])-1;
+        partitions.push_back( std::make_pair(partition_lower_bound,  partition_upper_bound) );
     }
+    return partitions;
+}
 
-    // const IndexType partition_size = std::max<IndexType>( static_cast<IndexType>(std::ceil( static_cast<double>(mNumberOfElements[partition_index]-1) /
-    //     static_cast<double>(num_threads) ) ), 1);
-
-    // Vector3i partition_lower_bound{0, 0, 0};
-    // Vector3i partition_upper_bound{mNumberOfElements[0]-1, mNumberOfElements[1]-1, mNumberOfElements[2]-1};
-    // for( IndexType i = 0; i < num_threads; ++i ){
-    //     if( partition_size*i < mNumberOfElements[partition_index] ){
-    //         partition_lower_bound[partition_index] = partition_size*i;
-    //         partition_upper_bound[partition_index] = std::min<IndexType>(partition_size*(i+1), mNumberOfElements[partition_index]-1);
-    //         partitions.push_back( std::make_pair(partition_lower_bound,  partition_upper_bound) );
-    //     }
-    // }
+void FloodFill::FillPartition(IndexType PartitionIndex, const PartitionBoxVectorType& rPartitions, GroupSetVectorType& rGroups,
+        BoundaryIndicesVectorType& rBoundaryIndices, StatusVectorType& rStates) const {
+    const IndexType total_num_elements = mNumberOfElements[0]*mNumberOfElements[1]*mNumberOfElements[2];
+    BoolVectorType visited(total_num_elements, false);
+    const IndexType first_group_index = rGroups.size();
+
+    const auto& partition = rPartitions[PartitionIndex];
+    for( IndexType i = partition.first[0]; i <= partition.second[0]; ++i ){
+        for( IndexType j = partition.first[1]; j <= partition.second[1]; ++j ) {
+            for( IndexType k = partition.first[2]; k <= partition.second[2]; ++k ) {
+                const IndexType index = mGridIndexer.GetVectorIndexFromMatrixIndices(i, j, k);
+                if( !visited[index] ) { // Unvisited
+                    GroupSetType new_group; // Tuple: get<0> -> partition_index, get<1> -> index_set, get<2> -> is_inside_count.
+                    std::get<0>(new_group) = PartitionIndex; // Partition index
+                    Fill(index, new_group, partition, rStates, visited);
+                    if( std::get<1>(new_group).size() > 0 ){
+                        rGroups.push_back(new_group);
+                    }
+                }
+            }
+        }
+    }
 
-    // Start filling.
-    GroupSetVectorType groups;
-    PartitionedFill(groups, partitions, states);
+    ComputeGroupBoundaries(rGroups, first_group_index, GetPartitionDirection(), rPartitions, rBoundaryIndices);
+}
 
-    // Merge groups from all partitions.
-    MergeGroups( groups, rGroupsOutput, partition_index, partitions, states );
+void FloodFill::ClassifyGroups(GroupSetVectorType& rGroups, const BoundaryIndicesVectorType& rBoundaryIndices, GroupSetVectorType& rMergedGroups,
+        StatusVectorType& rStates) const {
+    MergeGroups( rGroups, rMergedGroups, rBoundaryIndices, GetPartitionDirection(), rStates );
 
     // Mark states
-    for( auto& r_group : rGroupsOutput ){
+    for( auto& r_group : rMergedGroups ){
         int inside_count = std::get<2>(r_group);
         auto state = (inside_count > 0) ? IntersectionState::inside : IntersectionState::outside;
         for( auto group_it = std::get<1>(r_group).begin(); group_it !=  std::get<1>(r_group).end(); ++group_it){
-            states[*group_it] = state;
+            rStates[*group_it] = state;
         }
     }
-
-    return MakeUnique<StatusVectorType>(states);
 }
 
-void FloodFill::PartitionedFill(GroupSetVectorType& rGroupSetVector, PartitionBoxVectorType& rPartitions, StatusVectorType& rStates) const {
+void FloodFill::PartitionedFill(GroupSetVectorType& rGroupSetVector, const PartitionBoxVectorType& rPartitions, StatusVectorType& rStates) const {
     // Loop through current partition
      const IndexType total_num_elements = mNumberOfElements[0]*mNumberOfElements[1]*mNumberOfElements[2];
     BoolVectorType visited(total_num_elements, false);
@@ -220,8 +238,8 @@ int FloodFill::Move(IndexType Index, IndexType Direction, GroupSetType& rGroupSe
     return next_index;
 }
 
-void FloodFill::MergeGroups(GroupSetVectorType& rGroups, GroupSetVectorType& rMergedGroup,
-        IndexType PartitionDir, PartitionBoxVectorType& rPartitions, StatusVectorType& rStates) const {
+void FloodFill::ComputeGroupBoundaries(GroupSetVectorType& rGroups, IndexType FirstGroupIndex, IndexType PartitionDir,
+        const PartitionBoxVectorType& rPartitions, BoundaryIndicesVectorType& rBoundaryIndices) const {
 
     const IndexType num_groups = rGroups.size();
 
@@ -234,20 +252,20 @@ void FloodFill::MergeGroups(GroupSetVectorType& rGroups, GroupSetVectorType& rMe
         std::make_pair( static_cast<int>(mNumberOfElements[PartitionDir]+1),  -1 ) );
 
     // We compute the indices of all element are located on the boundary of a group.
-    BoundaryIndicesVectorType group_boundary_indices(num_groups);
-    for( IndexType i = 0; i < num_groups; ++i){
-        group_boundary_indices[i].resize(2);
+    rBoundaryIndices.resize(num_groups);
+    for( IndexType i = FirstGroupIndex; i < num_groups; ++i){
+        rBoundaryIndices[i].resize(2);
     }
 
     #pragma omp parallel for
-    for( int group_index = 0; group_index < static_cast<int>(num_groups);  ++group_index){
+    for( int group_index = static_cast<int>(FirstGroupIndex); group_index < static_cast<int>(num_groups);  ++group_index){
         auto& group_set = rGroups[group_index];
         // Tuple: get<0> -> partition_index, get<1> -> index_set, get<2> -> is_inside_count.
         const auto& index_set = std::get<1>(group_set);
         const auto partition_index = std::get<0>(group_set);
 
         auto& group_bounding_box = group_bounding_boxes[group_index];
-        auto& boundary_indices = group_boundary_indices[group_index];
+        auto& boundary_indices = rBoundaryIndices[group_index];
 
         // Loop over elements in active group.
         for(auto& index : index_set ){
@@ -303,12 +321,18 @@ void FloodFill::MergeGroups(GroupSetVectorType& rGroups, GroupSetVectorType& rMe
         }
 
     }
+}
+
+void FloodFill::MergeGroups(GroupSetVectorType& rGroups, GroupSetVectorType& rMergedGroup, const BoundaryIndicesVectorType& rBoundaryIndices,
+        IndexType PartitionDir, StatusVectorType& rStates) const {
+
+    const IndexType num_groups = rGroups.size();
 
     // Run group fill. Must be single-thread.
     BoolVectorType visited(num_groups, false);
     for( IndexType group_index = 0; group_index < num_groups; ++group_index){
         if( !visited[group_index] ){
-            GroupFill(group_index, rGroups, rMergedGroup, group_boundary_indices, PartitionDir, rStates, visited);
+            GroupFill(group_index, rGroups, rMergedGroup, rBoundaryIndices, PartitionDir, rStates, visited);
         }
     }
 
@@ -379,7 +403,11 @@ int FloodFill::GetIsInsideCount( IndexType Index, IndexType NextIndex, const Poi
     const auto box_next = mGridIndexer.GetBoundingBoxXYZFromIndex(NextIndex);
     const PointType center_box = Math::AddAndMult(0.5, box_current.first, box_current.second);
 
-    if( mpBrepOperator->OnBoundedSideOfClippedSection(center_box, Math::Add(box_next.first, rLowerOffset) , Math::Add(box_next.second, rUpperOffset) ) ) {
+    if( mInsideTestMethod == InsideTestMethod::winding_number ){
+        return ( mpBrepOperator->WindingNumber(center_box) > 0.5 ) ? 1 : -1;
+    }
+
+    if( mpBrepOperator->OnBoundedSideOfClippedSection(center_box, NextIndex, box_next, Math::Add(box_next.first, rLowerOffset) , Math::Add(box_next.second, rUpperOffset) ) ) {
         return 1;
     } else {
         return -1;
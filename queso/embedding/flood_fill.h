@@ -61,7 +61,8 @@ public:
     /// @param rSettings
     FloodFill(const BRepOperator* pBrepOperator, const Settings& rSettings) :
         mpBrepOperator(pBrepOperator), mGridIndexer(rSettings),
-        mNumberOfElements( rSettings[MainSettings::background_grid_settings].GetValue<Vector3i>(BackgroundGridSettings::number_of_elements) )
+        mNumberOfElements( rSettings[MainSettings::background_grid_settings].GetValue<Vector3i>(BackgroundGridSettings::number_of_elements) ),
+        mInsideTestMethod( rSettings[MainSettings::general_settings].GetValue<InsideTestMethod>(GeneralSettings::inside_test_method) )
     {
 
         const auto& r_lower_bound = rSettings[MainSettings::background_grid_settings].GetValue<PointType>(BackgroundGridSettings::lower_bound_xyz);
@@ -82,6 +83,36 @@ public:
     /// @return Unique<StatusVectorType>.
     Unique<StatusVectorType> ClassifyElements() const;
 
+    /// @brief Returns the direction along which the background grid is partitioned (direction with the most elements).
+    /// @return IndexType 0:x, 1:y, 2:z.
+    IndexType GetPartitionDirection() const;
+
+    /// @brief Partitions the background grid into stripes along GetPartitionDirection(). Each stripe contains (at most) NumLayers element layers.
+    /// @param NumLayers
+    /// @return PartitionBoxVectorType
+    PartitionBoxVectorType GetPartitions(IndexType NumLayers) const;
+
+    /// @brief Fills a single partition and computes the boundary indices of the new groups (see: MergeGroups()).
+    ///        Only queries the BRepOperator for elements in the given partition and its direct neighbours. Hence, the background grid can be
+    ///        classified partition by partition, even if the BRepOperator only holds the triangles of the current partition (see: SlabPartitioner).
+    ///        Call ClassifyGroups() after all partitions are filled.
+    /// @param PartitionIndex Index of partition in rPartitions.
+    /// @param rPartitions All partitions (see: GetPartitions()).
+    /// @param[out] rGroups New groups are appended.
+    /// @param[out] rBoundaryIndices Boundary indices of new groups are appended.
+    /// @param[out] rStates Global classification vector. Trimmed elements are marked.
+    void FillPartition(IndexType PartitionIndex, const PartitionBoxVectorType& rPartitions, GroupSetVectorType& rGroups,
+        BoundaryIndicesVectorType& rBoundaryIndices, StatusVectorType& rStates) const;
+
+    /// @brief Merges the groups of all partitions and marks all non-trimmed elements as inside or outside.
+    ///        Does not query the BRepOperator.
+    /// @param rGroups Contains all groups from all partitions.
+    /// @param rBoundaryIndices Boundary indices of all groups.
+    /// @param[out] rMergedGroups Output vector of groups.
+    /// @param[out] rStates Global classification vector.
+    void ClassifyGroups(GroupSetVectorType& rGroups, const BoundaryIndicesVectorType& rBoundaryIndices, GroupSetVectorType& rMergedGroups,
+        StatusVectorType& rStates) const;
+
 protected:
 
     ///@}
@@ -109,7 +140,7 @@ private:
     /// @param rGroupSetVector Vector to group sets: see GroupSetVectorType.
     /// @param rPartitions Vector of partitions.
     /// @param rStates Global classification vector (enum: Inside / outside or trimmed).
-    void PartitionedFill(GroupSetVectorType& rGroupSetVector, PartitionBoxVectorType& rPartitions, StatusVectorType& rStates) const;
+    void PartitionedFill(GroupSetVectorType& rGroupSetVector, const PartitionBoxVectorType& rPartitions, StatusVectorType& rStates) const;
 
     /// @brief Starts flood fill from 'Index' over given partition and adds found elements to 'rGroupSet'.
     ///        Marks trimmed elements in global vector: rStates.
@@ -135,15 +166,24 @@ private:
     int Move(IndexType Index, IndexType Direction, GroupSetType& rGroupSet,
         const PartitionBoxType& rPartition, StatusVectorType& rStates, BoolVectorType& rVisited ) const;
 
+    /// @brief Computes the indices of all elements that are located on the lower and upper boundary (along PartitionDir) of the groups
+    ///        rGroups[FirstGroupIndex:]. Also adds the GetIsInsideCount() of all elements at the partition boundaries to the respective group.
+    /// @param rGroups Contains all groups from all partitiones.
+    /// @param FirstGroupIndex Index of first group to be processed.
+    /// @param PartitionDir Direction along the partition was performed. Direction with "n_element_max".
+    /// @param rPartitions Vector with all partitions.
+    /// @param [out] rBoundaryIndices Boundary indices of all groups. Is resized to the size of rGroups.
+    void ComputeGroupBoundaries(GroupSetVectorType& rGroups, IndexType FirstGroupIndex, IndexType PartitionDir,
+        const PartitionBoxVectorType& rPartitions, BoundaryIndicesVectorType& rBoundaryIndices) const;
+
     /// @brief Merge groups that emerged from PartitionedFill.
     /// @param rGroups Contains all groups from all partitiones.
     /// @param [out] rMergedGroups Output vector of groups.
+    /// @param rBoundaryIndices Boundary indices of all groups (see: ComputeGroupBoundaries()).
     /// @param PartitionDir Direction along the partition was performed. Direction with "n_element_max".
-    /// @param rPartitions Vector with all partitions.
     /// @param rStates Global classification vector.
-    void MergeGroups(GroupSetVectorType& rGroups, GroupSetVectorType& rMergedGroups, IndexType PartitionDir,
-        PartitionBoxVectorType& rPartitions, StatusVectorType& rStates) const;
-
+    void MergeGroups(GroupSetVectorType& rGroups, GroupSetVectorType& rMergedGroups, const BoundaryIndicesVectorType& rBoundaryIndices,
+        IndexType PartitionDir, StatusVectorType& rStates) const;
 
     /// @brief Run flood fill to merge groups starting at 'GroupIndex'.
     /// @param GroupIndex Starting point.
@@ -159,6 +199,7 @@ private:
     /// @brief Performs a local ray tracing of two adjacent elements. On that is part of a new group and its trimmed neighbour.
     ///        We up to 10 rays, from the center of the first element towards the intersected triangles of the cut element. Based on the orientation of each triangle
     ///        the ray indicates inside or outside. The majoriy decides about the classification of the tested element. Returns +1 if inside and -1 if outside.
+    ///        If GeneralSettings::inside_test_method is winding_number, the winding number of the center of the first element is evaluated instead.
     /// @param Index
     /// @param NextIndex
     /// @param rLowerOffset
@@ -184,6 +225,7 @@ private:
 
     // The following parameters are global values, w.r.t. to the background mesh.
     const Vector3i mNumberOfElements;
+    const InsideTestMethod mInsideTestMethod;
     PointType mDelta;
 
 }; // End class FloodFill
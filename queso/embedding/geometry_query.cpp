@@ -11,8 +11,11 @@
 //
 //  Authors:    Manuel Messmer
 
+//// STL includes
+#include <algorithm>
 //// Project includes
 #include "queso/embedding/geometry_query.h"
+#include "queso/utilities/cpu_dispatch.h"
 
 namespace queso {
 
@@ -33,15 +36,12 @@ namespace queso {
         auto result = mTree.Query(aabb);
 
         const double snap_tolerance = RelativeSnapTolerance(rLowerBound, rUpperBound, Tolerance);
-        for( auto r : result){
-            const auto& p1 = mTriangleMesh.P1(r);
-            const auto& p2 = mTriangleMesh.P2(r);
-            const auto& p3 = mTriangleMesh.P3(r);
-            if( aabb.intersect(p1, p2, p3, snap_tolerance) ){
-                return true;
-            }
-        }
-        return false;
+        std::vector<double> vertices;
+        GatherVertices(result, vertices);
+        std::vector<std::uint8_t> is_intersected(result.size());
+        aabb.intersect(vertices.data(), result.size(), snap_tolerance, is_intersected.data());
+
+        return std::any_of(is_intersected.begin(), is_intersected.end(), [](std::uint8_t Value){ return Value != 0; });
     }
 
     Unique<std::vector<IndexType>> GeometryQuery::GetIntersectedTriangleIds(
@@ -51,18 +51,20 @@ namespace queso {
         AABB_primitive aabb(rLowerBound, rUpperBound);
         auto potential_intersections = mTree.Query(aabb);
 
+        // Perform actual intersection tests (batched).
+        std::vector<double> vertices;
+        GatherVertices(potential_intersections, vertices);
+        std::vector<std::uint8_t> is_intersected(potential_intersections.size());
+        aabb.intersect(vertices.data(), potential_intersections.size(), Tolerance, is_intersected.data());
+
         auto intersected_triangle_ids = MakeUnique<std::vector<IndexType>>();
         intersected_triangle_ids->reserve(potential_intersections.size());
-        for( auto triangle_id : potential_intersections){
-            const auto& p1 = mTriangleMesh.P1(triangle_id);
-            const auto& p2 = mTriangleMesh.P2(triangle_id);
-            const auto& p3 = mTriangleMesh.P3(triangle_id);
-
-            // Perform actual intersection test.
-            if( aabb.intersect(p1, p2, p3, Tolerance) ){
-                intersected_triangle_ids->push_back(triangle_id);
+        for( IndexType i = 0; i < potential_intersections.size(); ++i ){
+            if( is_intersected[i] ){
+                intersected_triangle_ids->push_back(potential_intersections[i]);
             }
         }
+        std::sort(intersected_triangle_ids->begin(), intersected_triangle_ids->end());
 
         return intersected_triangle_ids;
     }
@@ -71,26 +73,30 @@ namespace queso {
         double min_distance = MAXD;
         bool is_inside = false;
         auto potential_intersections = mTree.Query(rRay);
-        for( auto r : potential_intersections){
-            const auto& p1 = mTriangleMesh.P1(r);
-            const auto& p2 = mTriangleMesh.P2(r);
-            const auto& p3 = mTriangleMesh.P3(r);
-            double t, u, v;
-            bool back_facing, parallel;
-            if( rRay.intersect(p1, p2, p3, t, u, v, back_facing, parallel) ) {
-                if( !parallel ){
-                    double sum_u_v = u+v;
-                    if( t < ZEROTOL ){ // origin lies on boundary
-                        return std::make_pair(false, true);
-                    }
-                    // Ray shoots through boundary.
-                    if( u < 0.0+ZEROTOL || v < 0.0+ZEROTOL || sum_u_v > 1.0-ZEROTOL ){
-                        return std::make_pair(false, false);
-                    }
-                    if( t < min_distance ){
-                        is_inside = back_facing;
-                        min_distance = t;
-                    }
+
+        // Perform actual intersection tests (batched).
+        const IndexType num_triangles = potential_intersections.size();
+        std::vector<double> vertices;
+        GatherVertices(potential_intersections, vertices);
+        std::vector<double> t(num_triangles), u(num_triangles), v(num_triangles);
+        std::vector<std::uint8_t> flags(num_triangles);
+        rRay.intersect(vertices.data(), num_triangles, t.data(), u.data(), v.data(), flags.data());
+
+        for( IndexType i = 0; i < num_triangles; ++i ){
+            const bool parallel = flags[i] & CpuDispatch::Parallel;
+            if( (flags[i] & CpuDispatch::Intersected) && !parallel ) {
+                const bool back_facing = flags[i] & CpuDispatch::BackFacing;
+                double sum_u_v = u[i]+v[i];
+                if( t[i] < ZEROTOL ){ // origin lies on boundary
+                    return std::make_pair(false, true);
+                }
+                // Ray shoots through boundary.
+                if( u[i] < 0.0+ZEROTOL || v[i] < 0.0+ZEROTOL || sum_u_v > 1.0-ZEROTOL ){
+                    return std::make_pair(false, false);
+                }
+                if( t[i] < min_distance ){
+                    is_inside = back_facing;
+                    min_distance = t[i];
                 }
             }
         }
@@ -101,26 +107,33 @@ namespace queso {
     std::pair<bool, bool> GeometryQuery::IsInsideClosed( const Ray_AABB_primitive& rRay ) const {
         // Get potential ray intersections from AABB tree.
         auto potential_intersections = mTree.Query(rRay);
+
+        // Only test for actual intersection, if area is not zero.
+        potential_intersections.erase( std::remove_if(potential_intersections.begin(), potential_intersections.end(),
+            [this](IndexType TriangleId){ return mTriangleMesh.Area(TriangleId) <= 100.0*ZEROTOL; }), potential_intersections.end() );
+
+        // Perform actual intersection tests (batched).
+        const IndexType num_triangles = potential_intersections.size();
+        std::vector<double> vertices;
+        GatherVertices(potential_intersections, vertices);
+        std::vector<double> t(num_triangles), u(num_triangles), v(num_triangles);
+        std::vector<std::uint8_t> flags(num_triangles);
+        rRay.intersect(vertices.data(), num_triangles, t.data(), u.data(), v.data(), flags.data());
+
         IndexType intersection_count = 0;
-        for( auto r : potential_intersections){
-            const auto& p1 = mTriangleMesh.P1(r);
-            const auto& p2 = mTriangleMesh.P2(r);
-            const auto& p3 = mTriangleMesh.P3(r);
-            double t, u, v;
-            bool back_facing, parallel;
-            // Test for actual intersection, if area is area is not zero.
-            if( mTriangleMesh.Area(r) > 100.0*ZEROTOL
-                    && rRay.intersect(p1, p2, p3, t, u, v, back_facing, parallel) ) {
+        for( IndexType i = 0; i < num_triangles; ++i ){
+            if( flags[i] & CpuDispatch::Intersected ) {
                 intersection_count++;
-                const double sum_u_v = u+v;
-                if( t < ZEROTOL ){ // Origin lies on boundary
+                // Triangle is parallel to ray. Note: t, u, v are not valid in this case.
+                if( flags[i] & CpuDispatch::Parallel ){
+                    return std::make_pair(false, false);
+                }
+                const double sum_u_v = u[i]+v[i];
+                if( t[i] < ZEROTOL ){ // Origin lies on boundary
                     return std::make_pair(false, true);
                 }
                 // Ray shoots through boundary of triangle.
-                if( u < 0.0+ZEROTOL || v < 0.0+ZEROTOL || sum_u_v > 1.0-ZEROTOL ){
-                    return std::make_pair(false, false);
-                }
-                if( parallel ){ // Triangle is parallel to ray.
+                if( u[i] < 0.0+ZEROTOL || v[i] < 0.0+ZEROTOL || sum_u_v > 1.0-ZEROTOL ){
                     return std::make_pair(false, false);
                 }
             }
@@ -132,4 +145,37 @@ namespace queso {
         }
     }
 
+    double GeometryQuery::DistanceToFirstIntersection( const Ray_AABB_primitive& rRay, double MinDistance ) const {
+        auto potential_intersections = mTree.Query(rRay);
+
+        // Perform actual intersection tests (batched).
+        const IndexType num_triangles = potential_intersections.size();
+        std::vector<double> vertices;
+        GatherVertices(potential_intersections, vertices);
+        std::vector<double> t(num_triangles), u(num_triangles), v(num_triangles);
+        std::vector<std::uint8_t> flags(num_triangles);
+        rRay.intersect(vertices.data(), num_triangles, t.data(), u.data(), v.data(), flags.data());
+
+        double min_distance = MAXD;
+        for( IndexType i = 0; i < num_triangles; ++i ){
+            // Note: t is not valid for parallel triangles.
+            if( (flags[i] & CpuDispatch::Intersected) && !(flags[i] & CpuDispatch::Parallel) && t[i] >= MinDistance ){
+                min_distance = std::min(min_distance, t[i]);
+            }
+        }
+        return min_distance;
+    }
+
+    void GeometryQuery::GatherVertices( const std::vector<IndexType>& rTriangleIds, std::vector<double>& rVertices ) const {
+        rVertices.resize(9*rTriangleIds.size());
+        double* p_vertices = rVertices.data();
+        for( auto triangle_id : rTriangleIds ){
+            for( const auto* p_point : {&mTriangleMesh.P1(triangle_id), &mTriangleMesh.P2(triangle_id), &mTriangleMesh.P3(triangle_id)} ){
+                *(p_vertices++) = (*p_point)[0];
+                *(p_vertices++) = (*p_point)[1];
+                *(p_vertices++) = (*p_point)[2];
+            }
+        }
+    }
+
 } // End queso namespace
\ No newline at end of file
@@ -70,12 +70,29 @@ public:
     bool DoIntersect(const PointType& rLowerBound, const PointType& rUpperBound, double Tolerance ) const;
 
     /// @brief Returns a vector of ids of all triangles that intersect with the AABB.
+    ///        Ids are sorted in ascending order. Hence, the result does not depend on the structure of the AABB tree.
     /// @param rLowerBound of AABB.
     /// @param rUpperBound of AABB.
     /// @param Tolerance Reduces size of AABB.
     /// @return Unique<std::vector<IndexType>>
     Unique<std::vector<IndexType>> GetIntersectedTriangleIds(const PointType& rLowerBound, const PointType& rUpperBound, double Tolerance ) const;
 
+    /// @brief Returns the distance from the origin of the ray to the closest intersected triangle (only in positive direction of the ray).
+    /// @param rRay Ray. The direction must be normalized to obtain the Euclidean distance.
+    /// @param MinDistance Intersections closer than MinDistance are ignored (e.g., the triangle the ray is started from).
+    /// @return double. MAXD, if no triangle is intersected.
+    double DistanceToFirstIntersection( const Ray_AABB_primitive& rRay, double MinDistance ) const;
+
+    ///@}
+    ///@name Get member variables
+    ///@{
+
+    /// @brief Returns AABB tree of triangle mesh.
+    /// @return const AABB_tree&
+    const AABB_tree& GetAABBTree() const {
+        return mTree;
+    }
+
 private:
     ///@}
     ///@name Private Operations
@@ -91,6 +108,11 @@ private:
     /// @return std::pair<bool, bool> first-is_inside second-test_successful
     std::pair<bool, bool> IsInsideOpen( const Ray_AABB_primitive& rRay ) const;
 
+    /// @brief Copies vertices of the given triangles into a contiguous buffer (9 values per triangle), as required by the batched intersection tests.
+    /// @param rTriangleIds
+    /// @param[out] rVertices
+    void GatherVertices( const std::vector<IndexType>& rTriangleIds, std::vector<double>& rVertices ) const;
+
     ///@}
     ///@name Private Members
     ///@{
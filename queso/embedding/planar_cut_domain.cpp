@@ -0,0 +1,262 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+//// STL includes
+#include <cmath>
+#include <algorithm>
+//// Project includes
+#include "queso/embedding/planar_cut_domain.h"
+#include "queso/utilities/math_utilities.hpp"
+#include "queso/utilities/mesh_utilities.h"
+
+namespace queso {
+
+typedef PlanarCutDomain::Plane Plane;
+typedef std::vector<PointType> PolygonType;
+
+namespace {
+
+/// @brief Clips convex polygon against half space: rPlane.normal*x <= rPlane.offset (Sutherland-Hodgman).
+void ClipPolygon(PolygonType& rPolygon, const Plane& rPlane, double Tolerance) {
+    const IndexType num_vertices = rPolygon.size();
+    PolygonType clipped_polygon{};
+    clipped_polygon.reserve(num_vertices+1);
+    for( IndexType i = 0; i < num_vertices; ++i ){
+        const PointType& r_p = rPolygon[i];
+        const PointType& r_q = rPolygon[(i+1) % num_vertices];
+        const double distance_p = Math::Dot(rPlane.normal, r_p) - rPlane.offset;
+        const double distance_q = Math::Dot(rPlane.normal, r_q) - rPlane.offset;
+        if( distance_p <= Tolerance ){
+            clipped_polygon.push_back(r_p);
+        }
+        if( (distance_p < -Tolerance && distance_q > Tolerance) || (distance_p > Tolerance && distance_q < -Tolerance) ){
+            const double t = distance_p / (distance_p - distance_q);
+            clipped_polygon.push_back( Math::Add(r_p, Math::Mult(t, Math::Subtract(r_q, r_p))) );
+        }
+    }
+    // Remove (almost) duplicate vertices.
+    PolygonType unique_polygon{};
+    unique_polygon.reserve(clipped_polygon.size());
+    for( const auto& r_vertex : clipped_polygon ){
+        if( unique_polygon.empty() || Math::Norm(Math::Subtract(r_vertex, unique_polygon.back())) > Tolerance ){
+            unique_polygon.push_back(r_vertex);
+        }
+    }
+    while( unique_polygon.size() > 1 && Math::Norm(Math::Subtract(unique_polygon.front(), unique_polygon.back())) <= Tolerance ){
+        unique_polygon.pop_back();
+    }
+    rPolygon = std::move(unique_polygon);
+}
+
+} // End anonymous namespace
+
+Unique<PlanarCutDomain> PlanarCutDomain::pCreate(const TriangleMeshInterface& rTriangleMesh, const PointType& rLowerBound, const PointType& rUpperBound,
+                                                 IndexType MaxNumPlanes, double Tolerance) {
+    if( rTriangleMesh.NumOfTriangles() == 0 || MaxNumPlanes == 0 ){
+        return nullptr;
+    }
+
+    std::vector<Plane> planes{};
+    if( !DetectPlanes(rTriangleMesh, rLowerBound, rUpperBound, MaxNumPlanes, planes) ){
+        return nullptr;
+    }
+
+    // Bounding planes: Faces of AABB (-x, x, -y, y, -z, z) and cut planes.
+    std::vector<Plane> bounding_planes{};
+    bounding_planes.reserve(6+planes.size());
+    for( IndexType dir = 0; dir < 3; ++dir ){
+        PointType normal{0.0, 0.0, 0.0};
+        normal[dir] = -1.0;
+        bounding_planes.push_back( {normal, -rLowerBound[dir]} );
+        normal[dir] = 1.0;
+        bounding_planes.push_back( {normal, rUpperBound[dir]} );
+    }
+    bounding_planes.insert(bounding_planes.end(), planes.begin(), planes.end());
+
+    Unique<PlanarCutDomain> p_domain(new PlanarCutDomain());
+    p_domain->mPlanes = std::move(planes);
+    p_domain->ConstructPolytope(bounding_planes, rLowerBound, rUpperBound);
+
+    // Only accept polytope, if it represents the same domain. This rejects non-convex domains.
+    const double reference_volume = MeshUtilities::Volume(rTriangleMesh);
+    if( p_domain->mTetrahedra.empty() || std::abs(p_domain->mVolume - reference_volume) > Tolerance*reference_volume ){
+        return nullptr;
+    }
+
+    return p_domain;
+}
+
+double PlanarCutDomain::Volume(const TetrahedronType& rTetrahedron) {
+    const PointType a = Math::Subtract(rTetrahedron[1], rTetrahedron[0]);
+    const PointType b = Math::Subtract(rTetrahedron[2], rTetrahedron[0]);
+    const PointType c = Math::Subtract(rTetrahedron[3], rTetrahedron[0]);
+    return Math::Dot(Math::Cross(a, b), c) / 6.0;
+}
+
+bool PlanarCutDomain::DetectPlanes(const TriangleMeshInterface& rTriangleMesh, const PointType& rLowerBound, const PointType& rUpperBound,
+                                   IndexType MaxNumPlanes, std::vector<Plane>& rPlanes) {
+    const double tolerance_aabb = RelativeSnapTolerance(rLowerBound, rUpperBound, 1e-10);
+    const double tolerance_plane = RelativeSnapTolerance(rLowerBound, rUpperBound, 1e-6);
+    const double tolerance_angle = 1e-6;
+
+    // Each plane is seeded by the first triangle. Final plane is the area-weighted average of all triangles on the plane.
+    std::vector<Plane> seeds{};
+    std::vector<PointType> weighted_normals{};
+    std::vector<PointType> weighted_centroids{};
+    std::vector<double> areas{};
+
+    const IndexType num_triangles = rTriangleMesh.NumOfTriangles();
+    for( IndexType triangle_id = 0; triangle_id < num_triangles; ++triangle_id ){
+        const std::array<const PointType*, 3> vertices = {&rTriangleMesh.P1(triangle_id), &rTriangleMesh.P2(triangle_id), &rTriangleMesh.P3(triangle_id)};
+
+        // Skip triangles on faces of AABB.
+        bool is_on_aabb = false;
+        for( IndexType dir = 0; dir < 3 && !is_on_aabb; ++dir ){
+            bool on_lower = true;
+            bool on_upper = true;
+            for( const auto p_vertex : vertices ){
+                on_lower &= std::abs((*p_vertex)[dir] - rLowerBound[dir]) <= tolerance_aabb;
+                on_upper &= std::abs((*p_vertex)[dir] - rUpperBound[dir]) <= tolerance_aabb;
+            }
+            is_on_aabb = on_lower || on_upper;
+        }
+        const double area = rTriangleMesh.Area(triangle_id);
+        if( is_on_aabb || !(area > 0.0) ){
+            continue;
+        }
+
+        const PointType& r_normal = rTriangleMesh.Normal(triangle_id);
+        const PointType centroid = Math::Mult(1.0/3.0, Math::Add(Math::Add(*vertices[0], *vertices[1]), *vertices[2]));
+
+        IndexType plane_index = seeds.size();
+        for( IndexType i = 0; i < seeds.size(); ++i ){
+            if( Math::Dot(seeds[i].normal, r_normal) < 1.0 - tolerance_angle ){
+                continue;
+            }
+            bool is_on_plane = true;
+            for( const auto p_vertex : vertices ){
+                is_on_plane &= std::abs(Math::Dot(seeds[i].normal, *p_vertex) - seeds[i].offset) <= tolerance_plane;
+            }
+            if( is_on_plane ){
+                plane_index = i;
+                break;
+            }
+        }
+
+        if( plane_index == seeds.size() ){
+            if( seeds.size() == MaxNumPlanes ){
+                return false;
+            }
+            seeds.push_back( {r_normal, Math::Dot(r_normal, centroid)} );
+            weighted_normals.push_back( {0.0, 0.0, 0.0} );
+            weighted_centroids.push_back( {0.0, 0.0, 0.0} );
+            areas.push_back(0.0);
+        }
+        Math::AddSelf(weighted_normals[plane_index], Math::Mult(area, r_normal));
+        Math::AddSelf(weighted_centroids[plane_index], Math::Mult(area, centroid));
+        areas[plane_index] += area;
+    }
+
+    rPlanes.clear();
+    for( IndexType i = 0; i < seeds.size(); ++i ){
+        const PointType normal = Math::Divide(weighted_normals[i], Math::Norm(weighted_normals[i]));
+        const PointType centroid = Math::Divide(weighted_centroids[i], areas[i]);
+        rPlanes.push_back( {normal, Math::Dot(normal, centroid)} );
+    }
+
+    return !rPlanes.empty();
+}
+
+void PlanarCutDomain::ConstructPolytope(const std::vector<Plane>& rPlanes, const PointType& rLowerBound, const PointType& rUpperBound) {
+    const PointType center = Math::Mult(0.5, Math::Add(rLowerBound, rUpperBound));
+    const double diagonal = Math::Norm(Math::Subtract(rUpperBound, rLowerBound));
+    const double tolerance = RelativeSnapTolerance(rLowerBound, rUpperBound, 1e-10);
+    const double min_area = ZEROTOL*diagonal*diagonal;
+
+    // Faces of polytope: Each bounding plane is clipped against all other half spaces.
+    std::vector<std::pair<PolygonType, PointType>> faces{};
+    PointType apex{0.0, 0.0, 0.0};
+    IndexType num_vertices = 0;
+    for( IndexType i = 0; i < rPlanes.size(); ++i ){
+        const PointType& r_normal = rPlanes[i].normal;
+
+        // Orthonormal basis (u, v, normal). Initial polygon is a large square, which covers the AABB.
+        IndexType min_dir = 0;
+        for( IndexType dir = 1; dir < 3; ++dir ){
+            if( std::abs(r_normal[dir]) < std::abs(r_normal[min_dir]) ){
+                min_dir = dir;
+            }
+        }
+        PointType axis{0.0, 0.0, 0.0};
+        axis[min_dir] = 1.0;
+        PointType u = Math::Cross(r_normal, axis);
+        Math::DivideSelf(u, Math::Norm(u));
+        const PointType v = Math::Cross(r_normal, u);
+        const PointType origin = Math::Subtract(center, Math::Mult(Math::Dot(r_normal, center) - rPlanes[i].offset, r_normal));
+        const double radius = 2.0*diagonal;
+        // Counterclockwise w.r.t. r_normal, since u x v = r_normal.
+        PolygonType polygon{ Math::Add(origin, Math::Mult(radius, Math::Subtract(Math::Mult(-1.0, u), v))),
+                             Math::Add(origin, Math::Mult(radius, Math::Subtract(u, v))),
+                             Math::Add(origin, Math::Mult(radius, Math::Add(u, v))),
+                             Math::Add(origin, Math::Mult(radius, Math::Subtract(v, u))) };
+
+        for( IndexType j = 0; j < rPlanes.size() && polygon.size() >= 3; ++j ){
+            if( i != j ){
+                ClipPolygon(polygon, rPlanes[j], tolerance);
+            }
+        }
+        if( polygon.size() < 3 ){
+            continue;
+        }
+
+        // Skip degenerated faces.
+        PointType area_vector{0.0, 0.0, 0.0};
+        for( IndexType k = 1; k+1 < polygon.size(); ++k ){
+            Math::AddSelf(area_vector, Math::Cross(Math::Subtract(polygon[k], polygon[0]), Math::Subtract(polygon[k+1], polygon[0])));
+        }
+        if( 0.5*Math::Dot(area_vector, r_normal) <= min_area ){
+            continue;
+        }
+
+        for( const auto& r_vertex : polygon ){
+            Math::AddSelf(apex, r_vertex);
+            ++num_vertices;
+        }
+        faces.push_back( std::make_pair(std::move(polygon), r_normal) );
+    }
+    if( num_vertices == 0 ){
+        return;
+    }
+    Math::DivideSelf(apex, static_cast<double>(num_vertices));
+
+    // Fan triangulation of each face. Each triangle forms a tetrahedron together with the apex.
+    for( const auto& r_face : faces ){
+        const auto& r_polygon = r_face.first;
+        for( IndexType k = 1; k+1 < r_polygon.size(); ++k ){
+            const IndexType id_0 = mTriangleMesh.AddVertex(r_polygon[0]);
+            const IndexType id_1 = mTriangleMesh.AddVertex(r_polygon[k]);
+            const IndexType id_2 = mTriangleMesh.AddVertex(r_polygon[k+1]);
+            mTriangleMesh.AddTriangle({id_0, id_1, id_2});
+            mTriangleMesh.AddNormal(r_face.second);
+
+            const TetrahedronType tetrahedron{apex, r_polygon[0], r_polygon[k], r_polygon[k+1]};
+            const double volume = Volume(tetrahedron);
+            if( volume > ZEROTOL*diagonal*diagonal*diagonal ){
+                mTetrahedra.push_back(tetrahedron);
+                mVolume += volume;
+            }
+        }
+    }
+}
+
+} // End namespace queso
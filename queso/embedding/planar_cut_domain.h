@@ -0,0 +1,144 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#ifndef PLANAR_CUT_DOMAIN_INCLUDE_H
+#define PLANAR_CUT_DOMAIN_INCLUDE_H
+
+//// STL includes
+#include <vector>
+#include <array>
+//// Project includes
+#include "queso/includes/define.hpp"
+#include "queso/containers/triangle_mesh.hpp"
+
+namespace queso {
+
+///@name QuESo Classes
+///@{
+
+/**
+ * @class  PlanarCutDomain
+ * @author Manuel Messmer
+ * @brief  Explicit representation of a trimmed domain that is the intersection of the AABB of an element with a few half spaces,
+ *         e.g., cells cut by a single planar facet, or by a few facets of a convex (locally) solid.
+ * @details The cut planes are detected from the closed boundary mesh of the trimmed domain (see: TrimmedDomain::GetTriangleMesh()).
+ *          The resulting convex polytope is constructed by clipping each bounding plane against all other half spaces.
+ *          Its faces are triangulated, and the polytope is decomposed into tetrahedra (apex: mean of all vertices).
+ *          The decomposition is only accepted, if the volume of the polytope matches the volume enclosed by the given boundary mesh.
+ *          Hence, non-convex (e.g. notched) domains are rejected.
+**/
+class PlanarCutDomain {
+public:
+    ///@name Type Definitions
+    ///@{
+
+    typedef std::array<PointType, 4> TetrahedronType;
+    typedef std::vector<TetrahedronType> TetrahedronVectorType;
+
+    /// Plane: Normal (pointing outwards) and offset. Points on plane fulfill: Normal*x = Offset.
+    struct Plane {
+        PointType normal;
+        double offset;
+    };
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// @brief Returns planar cut domain, if the trimmed domain bounded by rTriangleMesh is the intersection of the AABB with
+    ///        at most MaxNumPlanes half spaces. Otherwise, returns nullptr.
+    /// @param rTriangleMesh Closed boundary mesh of trimmed domain.
+    /// @param rLowerBound Lower bound of AABB.
+    /// @param rUpperBound Upper bound of AABB.
+    /// @param MaxNumPlanes Maximum number of cut planes.
+    /// @param Tolerance Admissible relative deviation between the volume of the polytope and the volume enclosed by rTriangleMesh.
+    /// @return Unique<PlanarCutDomain>
+    static Unique<PlanarCutDomain> pCreate(const TriangleMeshInterface& rTriangleMesh, const PointType& rLowerBound, const PointType& rUpperBound,
+                                           IndexType MaxNumPlanes, double Tolerance);
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+    /// @brief Returns cut planes (AABB faces are not included).
+    /// @return const std::vector<Plane>&
+    const std::vector<Plane>& GetPlanes() const {
+        return mPlanes;
+    }
+
+    /// @brief Returns triangulated boundary of the polytope. Normals point outwards.
+    /// @return const TriangleMesh&
+    const TriangleMesh& GetTriangleMesh() const {
+        return mTriangleMesh;
+    }
+
+    /// @brief Returns decomposition of polytope into positively oriented tetrahedra.
+    /// @return const TetrahedronVectorType&
+    const TetrahedronVectorType& GetTetrahedra() const {
+        return mTetrahedra;
+    }
+
+    /// @brief Returns volume of polytope (sum over all tetrahedra).
+    /// @return double
+    double Volume() const {
+        return mVolume;
+    }
+
+    /// @brief Returns volume of tetrahedron. Positive, if (v1-v0, v2-v0, v3-v0) is right-handed.
+    /// @param rTetrahedron
+    /// @return double
+    static double Volume(const TetrahedronType& rTetrahedron);
+
+    ///@}
+private:
+    ///@name Private Life Cycle
+    ///@{
+
+    PlanarCutDomain() = default;
+
+    ///@}
+    ///@name Private Operations
+    ///@{
+
+    /// @brief Detects cut planes of rTriangleMesh. Triangles on the faces of the AABB are ignored.
+    /// @param rTriangleMesh
+    /// @param rLowerBound
+    /// @param rUpperBound
+    /// @param MaxNumPlanes
+    /// @param[out] rPlanes
+    /// @return bool False, if more than MaxNumPlanes planes are found.
+    static bool DetectPlanes(const TriangleMeshInterface& rTriangleMesh, const PointType& rLowerBound, const PointType& rUpperBound,
+                             IndexType MaxNumPlanes, std::vector<Plane>& rPlanes);
+
+    /// @brief Constructs boundary mesh and tetrahedra of the intersection of all half spaces given by rPlanes.
+    /// @param rPlanes All bounding planes (including faces of AABB).
+    /// @param rLowerBound
+    /// @param rUpperBound
+    void ConstructPolytope(const std::vector<Plane>& rPlanes, const PointType& rLowerBound, const PointType& rUpperBound);
+
+    ///@}
+    ///@name Private Members
+    ///@{
+
+    std::vector<Plane> mPlanes{};
+    TriangleMesh mTriangleMesh{};
+    TetrahedronVectorType mTetrahedra{};
+    double mVolume = 0.0;
+
+    ///@}
+}; // End class PlanarCutDomain
+///@} // End QuESo classes
+
+} // End namespace queso
+
+#endif // PLANAR_CUT_DOMAIN_INCLUDE_H
@@ -14,6 +14,7 @@
 //// Project includes
 #include "queso/embedding/ray_aabb_primitive.h"
 #include "queso/utilities/math_utilities.hpp"
+#include "queso/utilities/cpu_dispatch.h"
 
 namespace queso {
 
@@ -229,6 +230,11 @@ bool Ray_AABB_primitive::intersect( const Vector3d &v0, const Vector3d &v1, cons
     return true;
 }
 
+void Ray_AABB_primitive::intersect( const double* pVertices, IndexType NumTriangles,
+                double* pT, double* pU, double* pV, std::uint8_t* pFlags ) const {
+    CpuDispatch::IntersectRayTriangles(mOrigin, mDirection, pVertices, NumTriangles, pT, pU, pV, pFlags);
+}
+
 bool Ray_AABB_primitive::is_parallel( const Vector3d &v0, const Vector3d &v1, const Vector3d &v2, double Tolerance) const {
     // Substraction: v1-v0 and v2-v0
     Vector3d v0v1 = Math::Subtract( v1, v0 );
@@ -93,6 +93,17 @@ public:
     bool intersect( const Vector3d &v0, const Vector3d &v1, const Vector3d &v2,
                     double &t, double &u, double &v, bool& BackFacing, bool& Parallel) const;
 
+    ///@brief Tests a batch of triangles for intersection with ray. Same as intersect(v0, v1, v2, t, u, v, BackFacing, Parallel) for each triangle.
+    ///@details Uses the best instruction set supported by the CPU (see CpuDispatch). t, u, v are only valid for intersected, non-parallel triangles.
+    ///@param pVertices 9 values per triangle: (v0, v1, v2).
+    ///@param NumTriangles
+    ///@param[out] pT Distances to intersection. Size: NumTriangles.
+    ///@param[out] pU Parametric coordinates 1. Size: NumTriangles.
+    ///@param[out] pV Parametric coordinates 2. Size: NumTriangles.
+    ///@param[out] pFlags Combination of CpuDispatch::Intersected, CpuDispatch::BackFacing and CpuDispatch::Parallel. Size: NumTriangles.
+    void intersect( const double* pVertices, IndexType NumTriangles,
+                    double* pT, double* pU, double* pV, std::uint8_t* pFlags ) const;
+
     ///@brief Returns true if triangle is parallel to ray.
     ///@param v0 Triangle Vertex 1
     ///@param v1 Triangle Vertex 2
@@ -24,9 +24,12 @@
 namespace queso {
 
 bool TrimmedDomain::IsInsideTrimmedDomain(const PointType& rPoint) const {
+    if( mpBrepOperatorGlobal && mpBrepOperatorGlobal->GetInsideTestMethod() == InsideTestMethod::winding_number ){
+        return mpBrepOperatorGlobal->WindingNumber(rPoint) > 0.5;
+    }
     bool success = true;
     const bool val = IsInsideTrimmedDomain(rPoint, success);
-    if( success ){
+    if( success || !mpBrepOperatorGlobal ){
         return val;
     }
     return mpBrepOperatorGlobal->IsInside(rPoint); // This test is more costly, but also more precise.
@@ -94,6 +94,19 @@ public:
         }
     }
 
+    /// @brief Constructor for trimmed domain, whose closed boundary mesh is already known (e.g. restored from a checkpoint).
+    ///        No global BRepOperator is available. Hence, inside tests are only performed on the given boundary mesh.
+    /// @param pBoundaryMesh Closed triangle mesh of trimmed domain (see: GetTriangleMesh()).
+    /// @param rLowerBound Lower bound of trimmed domain.
+    /// @param rUpperBound Upper bound of trimmed domain.
+    TrimmedDomain(TriangleMeshPtrType pBoundaryMesh, const PointType& rLowerBound, const PointType& rUpperBound)
+        : mpTriangleMesh(std::move(pBoundaryMesh)), mLowerBound(rLowerBound), mUpperBound(rUpperBound), mpBrepOperatorGlobal(nullptr),
+          mpClippedMesh(mpTriangleMesh->Clone()), mGeometryQuery(*mpClippedMesh, false)
+    {
+        // Set relative snap tolerance.
+        mSnapTolerance = RelativeSnapTolerance(mLowerBound, mUpperBound);
+    }
+
     ///@}
     ///@name Operations
     ///@{
@@ -101,6 +114,7 @@ public:
     ///@brief Returns true if point is inside TrimmedDomain. Very fast test. First point is checked against clipped section.
     ///       (see: IsInsideTrimmedDomain(const PointType& rPoint, bool& rSuccess))
     ///       If this test is not successful, a global test is performed using the BRepOperator.
+    ///       If the BRepOperator uses InsideTestMethod::winding_number, the global winding number is evaluated directly.
     ///@param rPoint
     ///@return bool
     bool IsInsideTrimmedDomain(const PointType& rPoint) const;
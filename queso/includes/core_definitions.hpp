@@ -121,6 +121,49 @@ inline std::ostream& operator<<(std::ostream& rOs, GridTypeType Enum) {
     }
 }
 
+enum class InsideTestMethod {ray_tracing, winding_number};
+typedef InsideTestMethod InsideTestMethodType;
+inline std::ostream& operator<<(std::ostream& rOs, InsideTestMethodType Enum) {
+    switch(Enum) {
+        case InsideTestMethod::ray_tracing:
+            return (rOs << "ray_tracing");
+        case InsideTestMethod::winding_number:
+            return (rOs << "winding_number");
+        default:
+            return rOs;
+    }
+}
+
+enum class NNLSSolver {lawson_hanson, scaled_lawson_hanson, active_set_cholesky};
+typedef NNLSSolver NNLSSolverType;
+inline std::ostream& operator<<(std::ostream& rOs, NNLSSolverType Enum) {
+    switch(Enum) {
+        case NNLSSolver::lawson_hanson:
+            return (rOs << "lawson_hanson");
+        case NNLSSolver::scaled_lawson_hanson:
+            return (rOs << "scaled_lawson_hanson");
+        case NNLSSolver::active_set_cholesky:
+            return (rOs << "active_set_cholesky");
+        default:
+            return rOs;
+    }
+}
+
+enum class InstructionSet {scalar, avx2, avx512};
+typedef InstructionSet InstructionSetType;
+inline std::ostream& operator<<(std::ostream& rOs, InstructionSetType Enum) {
+    switch(Enum) {
+        case InstructionSet::scalar:
+            return (rOs << "scalar");
+        case InstructionSet::avx2:
+            return (rOs << "avx2");
+        case InstructionSet::avx512:
+            return (rOs << "avx512");
+        default:
+            return rOs;
+    }
+}
+
 // QuESo Factories
 inline BoundingBoxType MakeBox( PointType rL, PointType rR ){
     return std::make_pair(rL, rR);
@@ -0,0 +1,160 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#ifndef DIAGNOSTICS_INCLUDE_HPP
+#define DIAGNOSTICS_INCLUDE_HPP
+
+//// STL includes
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <iterator>
+//// Project includes
+#include "queso/includes/define.hpp"
+
+namespace queso {
+
+///@name QuESo Classes
+///@{
+
+/// Kinds of diagnostic events.
+enum class DiagnosticKind {
+    moment_fitting_residual_not_achieved, ///< Targeted residual is not achieved. Value: Achieved residual.
+    element_neglected_after_moment_fitting ///< Residual is too high. Element is neglected. Value: Achieved residual.
+};
+
+/// Number of different DiagnosticKinds.
+constexpr IndexType NumberOfDiagnosticKinds = 2;
+
+/// Structured diagnostic event of one element.
+struct DiagnosticEvent {
+    IndexType element_id;
+    DiagnosticKind kind;
+    double value;
+};
+
+/**
+ * @class  Diagnostics
+ * @author Manuel Messmer
+ * @brief  Collects diagnostic events (e.g. warnings) of parallel loops without synchronous I/O.
+ * @details Each thread records its events into a local BufferType. After the loop, each buffer is merged once via Merge().
+ *          Summaries (counts and worst cases) are available via NumberOfEvents() and GetWorstEvents().
+ * @see    EmbeddedModel::ComputeElements().
+**/
+class Diagnostics {
+
+public:
+    ///@name Type Definitions
+    ///@{
+
+    typedef std::vector<DiagnosticEvent> BufferType;
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+    /// @brief Records new event into rBuffer. Thread-safe, if each thread owns its buffer.
+    /// @param rBuffer Thread local buffer.
+    /// @param ElementId
+    /// @param Kind
+    /// @param Value
+    static void Record(BufferType& rBuffer, IndexType ElementId, DiagnosticKind Kind, double Value) {
+        rBuffer.push_back( DiagnosticEvent{ElementId, Kind, Value} );
+    }
+
+    /// @brief Moves all events of rBuffer into this container. Is not thread-safe.
+    ///        Events are kept sorted by kind and element id, such that the result does not depend on the scheduling of threads.
+    /// @param rBuffer Is empty afterwards.
+    void Merge(BufferType& rBuffer) {
+        const IndexType num_events = mEvents.size();
+        std::move(rBuffer.begin(), rBuffer.end(), std::back_inserter(mEvents));
+        rBuffer.clear();
+        std::sort(mEvents.begin()+num_events, mEvents.end(), Less);
+        std::inplace_merge(mEvents.begin(), mEvents.begin()+num_events, mEvents.end(), Less);
+    }
+
+    /// @brief Removes all events.
+    void Clear() {
+        mEvents.clear();
+    }
+
+    /// @brief Returns all events (sorted by kind and element id).
+    /// @return const BufferType&
+    const BufferType& GetEvents() const {
+        return mEvents;
+    }
+
+    /// @brief Returns total number of events.
+    /// @return IndexType
+    IndexType NumberOfEvents() const {
+        return mEvents.size();
+    }
+
+    /// @brief Returns number of events of given kind.
+    /// @param Kind
+    /// @return IndexType
+    IndexType NumberOfEvents(DiagnosticKind Kind) const {
+        const auto range = GetRange(Kind);
+        return std::distance(range.first, range.second);
+    }
+
+    /// @brief Returns events of given kind with the largest values in descending order.
+    /// @param Kind
+    /// @param MaxNumberOfEvents
+    /// @return BufferType
+    BufferType GetWorstEvents(DiagnosticKind Kind, IndexType MaxNumberOfEvents) const {
+        const auto range = GetRange(Kind);
+        BufferType events(range.first, range.second);
+        const IndexType num_events = std::min<IndexType>(MaxNumberOfEvents, events.size());
+        std::partial_sort(events.begin(), events.begin()+num_events, events.end(),
+            [](const DiagnosticEvent& rLeft, const DiagnosticEvent& rRight){ return rLeft.value > rRight.value; });
+        events.resize(num_events);
+        return events;
+    }
+
+    /// @brief Returns name of given kind.
+    /// @param Kind
+    /// @return const char*
+    static const char* GetKindName(DiagnosticKind Kind) {
+        static const std::array<const char*, NumberOfDiagnosticKinds> names = {
+            "moment_fitting_residual_not_achieved", "element_neglected_after_moment_fitting"};
+        return names[static_cast<IndexType>(Kind)];
+    }
+
+    ///@}
+private:
+    ///@name Private Operations
+    ///@{
+
+    static bool Less(const DiagnosticEvent& rLeft, const DiagnosticEvent& rRight) {
+        return (rLeft.kind < rRight.kind) || (rLeft.kind == rRight.kind && rLeft.element_id < rRight.element_id);
+    }
+
+    std::pair<BufferType::const_iterator, BufferType::const_iterator> GetRange(DiagnosticKind Kind) const {
+        return std::equal_range(mEvents.begin(), mEvents.end(), DiagnosticEvent{0, Kind, 0.0},
+            [](const DiagnosticEvent& rLeft, const DiagnosticEvent& rRight){ return rLeft.kind < rRight.kind; });
+    }
+
+    ///@}
+    ///@name Private Members
+    ///@{
+
+    BufferType mEvents;
+
+    ///@}
+}; // End class Diagnostics
+///@} // End QuESo classes
+
+} // End namespace queso
+
+#endif // DIAGNOSTICS_INCLUDE_HPP
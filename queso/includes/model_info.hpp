@@ -22,12 +22,13 @@ namespace queso {
 /// Definition of ModelInfo keys
 enum class RootInfo {main_info=DictStarts::start_subdicts};
 enum class MainInfo {
-    embedded_geometry_info=DictStarts::start_subdicts, quadrature_info, background_grid_info, elapsed_time_info,
-    conditions_infos_list=DictStarts::start_lists};
+    embedded_geometry_info=DictStarts::start_subdicts, quadrature_info, background_grid_info, elapsed_time_info, system_info, auto_tuning_info, verification_info,
+    grid_planning_info, diagnostics_info, conditions_infos_list=DictStarts::start_lists};
 enum class EmbeddedGeometryInfo {
-    is_closed=DictStarts::start_values, volume};
+    is_closed=DictStarts::start_values, volume, num_triangles, num_input_triangles, decimation_deviation};
 enum class QuadratureInfo {
-    represented_volume=DictStarts::start_values, percentage_of_geometry_volume, tot_num_points, num_of_points_per_full_element, num_of_points_per_trimmed_element};
+    represented_volume=DictStarts::start_values, percentage_of_geometry_volume, tot_num_points, num_of_points_per_full_element, num_of_points_per_trimmed_element,
+    num_planar_cut_elements};
 enum class BackgroundGridInfo {
     num_active_elements=DictStarts::start_values, num_trimmed_elements, num_full_elements, num_inactive_elements};
 enum class ConditionInfo {
@@ -38,14 +39,41 @@ enum class ElapsedTimeInfo {
     volume_time_info=DictStarts::start_subdicts, conditions_time_info, write_files_time_info,
     };
 enum class VolumeTimeInfo {
-    total=DictStarts::start_values, classification_of_elements, computation_of_intersections, solution_of_moment_fitting_eqs, construction_of_ggq_rules};
+    total=DictStarts::start_values, classification_of_elements, computation_of_intersections, solution_of_moment_fitting_eqs, construction_of_ggq_rules, auto_tuning,
+    verification_of_quadrature_rules, grid_planning, construction_of_coarse_grid_levels};
 enum class ConditionsTimeInfo {
     total=DictStarts::start_values};
 enum class WriteFilesTimeInfo {
     total=DictStarts::start_values};
+enum class SystemInfo {
+    instruction_set=DictStarts::start_values};
+enum class AutoTuningInfo {
+    min_num_boundary_triangles=DictStarts::start_values, init_point_distribution_factor, max_octree_refinement_level,
+    num_sampled_elements, num_candidates, volume_error, speedup};
+enum class VerificationInfo {
+    test_polynomial_order=DictStarts::start_values, num_verified_elements, num_skipped_elements, max_moment_error, mean_moment_error,
+    surface_area, represented_surface_area, percentage_of_surface_area,
+    moment_error_histogram=DictStarts::start_lists, worst_elements_list};
+enum class MomentErrorHistogramInfo {
+    lower_bound=DictStarts::start_values, upper_bound, num_elements};
+enum class WorstElementInfo {
+    element_id=DictStarts::start_values, moment_error};
+enum class GridPlanningInfo {
+    proposed_number_of_elements=DictStarts::start_values, min_feature_size, median_feature_size, predicted_num_trimmed_elements,
+    predicted_volume_error, predicted_runtime, target_met, num_sampled_elements,
+    candidates_list=DictStarts::start_lists};
+enum class GridPlanningCandidateInfo {
+    number_of_elements=DictStarts::start_values, num_trimmed_elements, is_extrapolated, volume_error, runtime};
+enum class DiagnosticsInfo {
+    num_events=DictStarts::start_values,
+    events_summary_list=DictStarts::start_lists};
+enum class DiagnosticsSummaryInfo {
+    kind=DictStarts::start_values, num_events, max_value, worst_element_id};
 
 typedef Dictionary<RootInfo, MainInfo, EmbeddedGeometryInfo, QuadratureInfo, BackgroundGridInfo, ConditionInfo,
-    ElapsedTimeInfo, VolumeTimeInfo, ConditionsTimeInfo, WriteFilesTimeInfo> ModelInfoBaseType;
+    ElapsedTimeInfo, VolumeTimeInfo, ConditionsTimeInfo, WriteFilesTimeInfo, SystemInfo, AutoTuningInfo,
+    VerificationInfo, MomentErrorHistogramInfo, WorstElementInfo, GridPlanningInfo, GridPlanningCandidateInfo, DiagnosticsInfo,
+    DiagnosticsSummaryInfo> ModelInfoBaseType;
 
 ///@name QuESo Classes
 ///@{
@@ -82,7 +110,10 @@ public:
         auto& r_embedded_geometry_info = AddEmptySubDictionary(MainInfo::embedded_geometry_info, Str("embedded_geometry_info"));
         r_embedded_geometry_info.AddValues(std::make_tuple(
             std::make_tuple(EmbeddedGeometryInfo::is_closed, Str("is_closed"), false, DontSet ),
-            std::make_tuple(EmbeddedGeometryInfo::volume, Str("volume"), 0.0, DontSet )
+            std::make_tuple(EmbeddedGeometryInfo::volume, Str("volume"), 0.0, DontSet ),
+            std::make_tuple(EmbeddedGeometryInfo::num_triangles, Str("num_triangles"), IndexType(0), DontSet ),
+            std::make_tuple(EmbeddedGeometryInfo::num_input_triangles, Str("num_input_triangles"), IndexType(0), DontSet ),
+            std::make_tuple(EmbeddedGeometryInfo::decimation_deviation, Str("decimation_deviation"), 0.0, DontSet )
         ));
 
         /// QuadratureRuleInfo
@@ -92,7 +123,8 @@ public:
             std::make_tuple(QuadratureInfo::percentage_of_geometry_volume, Str("percentage_of_geometry_volume"), 0.0, DontSet),
             std::make_tuple(QuadratureInfo::tot_num_points, Str("tot_num_points"), IndexType(0), DontSet ),
             std::make_tuple(QuadratureInfo::num_of_points_per_full_element, Str("num_of_points_per_full_element"), 0.0, DontSet ),
-            std::make_tuple(QuadratureInfo::num_of_points_per_trimmed_element, Str("num_of_points_per_trimmed_element"), 0.0, DontSet )
+            std::make_tuple(QuadratureInfo::num_of_points_per_trimmed_element, Str("num_of_points_per_trimmed_element"), 0.0, DontSet ),
+            std::make_tuple(QuadratureInfo::num_planar_cut_elements, Str("num_planar_cut_elements"), IndexType(0), DontSet )
         ));
 
         /// BackgroundGridInfo
@@ -116,7 +148,11 @@ public:
             std::make_tuple(VolumeTimeInfo::classification_of_elements, Str("classification_of_elements"), 0.0, Set ),
             std::make_tuple(VolumeTimeInfo::computation_of_intersections, Str("computation_of_intersections"), 0.0, Set ),
             std::make_tuple(VolumeTimeInfo::solution_of_moment_fitting_eqs, Str("solution_of_moment_fitting_eqs"), 0.0, Set),
-            std::make_tuple(VolumeTimeInfo::construction_of_ggq_rules, Str("construction_of_ggq_rules"), 0.0, Set)
+            std::make_tuple(VolumeTimeInfo::construction_of_ggq_rules, Str("construction_of_ggq_rules"), 0.0, Set),
+            std::make_tuple(VolumeTimeInfo::auto_tuning, Str("auto_tuning"), 0.0, Set),
+            std::make_tuple(VolumeTimeInfo::verification_of_quadrature_rules, Str("verification_of_quadrature_rules"), 0.0, Set),
+            std::make_tuple(VolumeTimeInfo::grid_planning, Str("grid_planning"), 0.0, Set),
+            std::make_tuple(VolumeTimeInfo::construction_of_coarse_grid_levels, Str("construction_of_coarse_grid_levels"), 0.0, Set)
         ));
 
         auto& r_conditions_time_info = r_elapsed_time_info.AddEmptySubDictionary(ElapsedTimeInfo::conditions_time_info, Str("conditions_time_info"));
@@ -129,6 +165,60 @@ public:
             std::make_tuple(WriteFilesTimeInfo::total, Str("total"), 0.0, Set )
         ));
 
+        /// SystemInfo
+        auto& r_system_info = AddEmptySubDictionary(MainInfo::system_info, Str("system_info"));
+        r_system_info.AddValues(std::make_tuple(
+            std::make_tuple(SystemInfo::instruction_set, Str("instruction_set"), Str(""), DontSet )
+        ));
+
+        /// AutoTuningInfo
+        auto& r_auto_tuning_info = AddEmptySubDictionary(MainInfo::auto_tuning_info, Str("auto_tuning_info"));
+        r_auto_tuning_info.AddValues(std::make_tuple(
+            std::make_tuple(AutoTuningInfo::min_num_boundary_triangles, Str("min_num_boundary_triangles"), IndexType(0), DontSet ),
+            std::make_tuple(AutoTuningInfo::init_point_distribution_factor, Str("init_point_distribution_factor"), IndexType(0), DontSet ),
+            std::make_tuple(AutoTuningInfo::max_octree_refinement_level, Str("max_octree_refinement_level"), IndexType(0), DontSet ),
+            std::make_tuple(AutoTuningInfo::num_sampled_elements, Str("num_sampled_elements"), IndexType(0), DontSet ),
+            std::make_tuple(AutoTuningInfo::num_candidates, Str("num_candidates"), IndexType(0), DontSet ),
+            std::make_tuple(AutoTuningInfo::volume_error, Str("volume_error"), 0.0, DontSet ),
+            std::make_tuple(AutoTuningInfo::speedup, Str("speedup"), 0.0, DontSet )
+        ));
+
+        /// VerificationInfo
+        auto& r_verification_info = AddEmptySubDictionary(MainInfo::verification_info, Str("verification_info"));
+        r_verification_info.AddValues(std::make_tuple(
+            std::make_tuple(VerificationInfo::test_polynomial_order, Str("test_polynomial_order"), Vector3i{0, 0, 0}, DontSet ),
+            std::make_tuple(VerificationInfo::num_verified_elements, Str("num_verified_elements"), IndexType(0), DontSet ),
+            std::make_tuple(VerificationInfo::num_skipped_elements, Str("num_skipped_elements"), IndexType(0), DontSet ),
+            std::make_tuple(VerificationInfo::max_moment_error, Str("max_moment_error"), 0.0, DontSet ),
+            std::make_tuple(VerificationInfo::mean_moment_error, Str("mean_moment_error"), 0.0, DontSet ),
+            std::make_tuple(VerificationInfo::surface_area, Str("surface_area"), 0.0, DontSet ),
+            std::make_tuple(VerificationInfo::represented_surface_area, Str("represented_surface_area"), 0.0, DontSet ),
+            std::make_tuple(VerificationInfo::percentage_of_surface_area, Str("percentage_of_surface_area"), 0.0, DontSet )
+        ));
+        r_verification_info.AddEmptyList(VerificationInfo::moment_error_histogram, Str("moment_error_histogram"));
+        r_verification_info.AddEmptyList(VerificationInfo::worst_elements_list, Str("worst_elements_list"));
+
+        /// GridPlanningInfo
+        auto& r_grid_planning_info = AddEmptySubDictionary(MainInfo::grid_planning_info, Str("grid_planning_info"));
+        r_grid_planning_info.AddValues(std::make_tuple(
+            std::make_tuple(GridPlanningInfo::proposed_number_of_elements, Str("proposed_number_of_elements"), Vector3i{0, 0, 0}, DontSet ),
+            std::make_tuple(GridPlanningInfo::min_feature_size, Str("min_feature_size"), 0.0, DontSet ),
+            std::make_tuple(GridPlanningInfo::median_feature_size, Str("median_feature_size"), 0.0, DontSet ),
+            std::make_tuple(GridPlanningInfo::predicted_num_trimmed_elements, Str("predicted_num_trimmed_elements"), IndexType(0), DontSet ),
+            std::make_tuple(GridPlanningInfo::predicted_volume_error, Str("predicted_volume_error"), 0.0, DontSet ),
+            std::make_tuple(GridPlanningInfo::predicted_runtime, Str("predicted_runtime"), 0.0, DontSet ),
+            std::make_tuple(GridPlanningInfo::target_met, Str("target_met"), false, DontSet ),
+            std::make_tuple(GridPlanningInfo::num_sampled_elements, Str("num_sampled_elements"), IndexType(0), DontSet )
+        ));
+        r_grid_planning_info.AddEmptyList(GridPlanningInfo::candidates_list, Str("candidates_list"));
+
+        /// DiagnosticsInfo
+        auto& r_diagnostics_info = AddEmptySubDictionary(MainInfo::diagnostics_info, Str("diagnostics_info"));
+        r_diagnostics_info.AddValues(std::make_tuple(
+            std::make_tuple(DiagnosticsInfo::num_events, Str("num_events"), IndexType(0), Set )
+        ));
+        r_diagnostics_info.AddEmptyList(DiagnosticsInfo::events_summary_list, Str("events_summary_list"));
+
         /// ConditionInfos
         AddEmptyList(MainInfo::conditions_infos_list, Str("conditions_infos_list"));
     }
@@ -152,6 +242,68 @@ public:
         return r_new_condition_info;
     }
 
+    /// @brief Creates new bin of the moment error histogram (see: EmbeddedModel::VerifyQuadratureRules()).
+    /// @return ModelInfoBaseType& Reference to dictionary that contains the bin.
+    ModelInfoBaseType& CreateNewMomentErrorHistogramInfo() {
+        bool DontSet = false; // Given values are only dummy values used to deduced the associated type.
+
+        auto& r_histogram = (*this)[MainInfo::verification_info].GetListObject(VerificationInfo::moment_error_histogram);
+        auto& r_new_bin = r_histogram.AddListItem(std::make_tuple(
+            std::make_tuple(MomentErrorHistogramInfo::lower_bound, Str("lower_bound"), 0.0, DontSet ),
+            std::make_tuple(MomentErrorHistogramInfo::upper_bound, Str("upper_bound"), 0.0, DontSet ),
+            std::make_tuple(MomentErrorHistogramInfo::num_elements, Str("num_elements"), IndexType(0), DontSet )
+        ));
+
+        return r_new_bin;
+    }
+
+    /// @brief Creates new entry of the list of elements with the largest moment errors (see: EmbeddedModel::VerifyQuadratureRules()).
+    /// @return ModelInfoBaseType& Reference to dictionary that contains the entry.
+    ModelInfoBaseType& CreateNewWorstElementInfo() {
+        bool DontSet = false; // Given values are only dummy values used to deduced the associated type.
+
+        auto& r_worst_elements = (*this)[MainInfo::verification_info].GetListObject(VerificationInfo::worst_elements_list);
+        auto& r_new_element_info = r_worst_elements.AddListItem(std::make_tuple(
+            std::make_tuple(WorstElementInfo::element_id, Str("element_id"), IndexType(0), DontSet ),
+            std::make_tuple(WorstElementInfo::moment_error, Str("moment_error"), 0.0, DontSet )
+        ));
+
+        return r_new_element_info;
+    }
+
+    /// @brief Creates new entry of the list of evaluated grid candidates (see: BackgroundGridPlanner).
+    /// @return ModelInfoBaseType& Reference to dictionary that contains the entry.
+    ModelInfoBaseType& CreateNewGridPlanningCandidateInfo() {
+        bool DontSet = false; // Given values are only dummy values used to deduced the associated type.
+
+        auto& r_candidates = (*this)[MainInfo::grid_planning_info].GetListObject(GridPlanningInfo::candidates_list);
+        auto& r_new_candidate_info = r_candidates.AddListItem(std::make_tuple(
+            std::make_tuple(GridPlanningCandidateInfo::number_of_elements, Str("number_of_elements"), Vector3i{0, 0, 0}, DontSet ),
+            std::make_tuple(GridPlanningCandidateInfo::num_trimmed_elements, Str("num_trimmed_elements"), IndexType(0), DontSet ),
+            std::make_tuple(GridPlanningCandidateInfo::is_extrapolated, Str("is_extrapolated"), false, DontSet ),
+            std::make_tuple(GridPlanningCandidateInfo::volume_error, Str("volume_error"), 0.0, DontSet ),
+            std::make_tuple(GridPlanningCandidateInfo::runtime, Str("runtime"), 0.0, DontSet )
+        ));
+
+        return r_new_candidate_info;
+    }
+
+    /// @brief Creates new entry of the summary of diagnostic events (one entry per DiagnosticKind, see: Diagnostics).
+    /// @return ModelInfoBaseType& Reference to dictionary that contains the entry.
+    ModelInfoBaseType& CreateNewDiagnosticsSummaryInfo() {
+        bool DontSet = false; // Given values are only dummy values used to deduced the associated type.
+
+        auto& r_summary = (*this)[MainInfo::diagnostics_info].GetListObject(DiagnosticsInfo::events_summary_list);
+        auto& r_new_summary_info = r_summary.AddListItem(std::make_tuple(
+            std::make_tuple(DiagnosticsSummaryInfo::kind, Str("kind"), Str(""), DontSet ),
+            std::make_tuple(DiagnosticsSummaryInfo::num_events, Str("num_events"), IndexType(0), DontSet ),
+            std::make_tuple(DiagnosticsSummaryInfo::max_value, Str("max_value"), 0.0, DontSet ),
+            std::make_tuple(DiagnosticsSummaryInfo::worst_element_id, Str("worst_element_id"), IndexType(0), DontSet )
+        ));
+
+        return r_new_summary_info;
+    }
+
 private:
 
     /// Hide the following functions
@@ -22,18 +22,23 @@
 namespace queso {
 
 /// Definition of dictionary keys
-// IMPORTANT: If key is added here, it must also be added to add_settings_to_python.cpp and to json_import.py.
+// Note: Keys are looked up by their names in JsonReader and in Python. Hence, new keys only need to be added here.
 
 enum class Root {main_settings=DictStarts::start_subdicts};
 enum class MainSettings {
     general_settings=DictStarts::start_subdicts, background_grid_settings, trimmed_quadrature_rule_settings, non_trimmed_quadrature_rule_settings,
     conditions_settings_list=DictStarts::start_lists };
 enum class GeneralSettings {
-    input_filename=DictStarts::start_values, output_directory_name, echo_level, write_output_to_file};
+    input_filename=DictStarts::start_values, output_directory_name, echo_level, write_output_to_file, inside_test_method,
+    checkpoint_filename, checkpoint_interval, checkpoint_trimmed_domains, out_of_core_slab_thickness, out_of_core_directory,
+    mesh_decimation_tolerance, surface_only};
 enum class BackgroundGridSettings {
-    grid_type=DictStarts::start_values, lower_bound_xyz, upper_bound_xyz, lower_bound_uvw, upper_bound_uvw, polynomial_order, number_of_elements};
+    grid_type=DictStarts::start_values, lower_bound_xyz, upper_bound_xyz, lower_bound_uvw, upper_bound_uvw, polynomial_order, number_of_elements,
+    grid_planning, grid_planning_volume_error, grid_planning_runtime_budget, number_of_grid_levels};
 enum class TrimmedQuadratureRuleSettings {
-    moment_fitting_residual=DictStarts::start_values, min_element_volume_ratio, min_num_boundary_triangles, neglect_elements_if_stl_is_flawed };
+    moment_fitting_residual=DictStarts::start_values, min_element_volume_ratio, min_num_boundary_triangles, neglect_elements_if_stl_is_flawed, nnls_solver,
+    init_point_distribution_factor, max_octree_refinement_level, auto_tuning, auto_tuning_sample_size, auto_tuning_volume_error, max_num_cut_planes,
+    verify_quadrature_rules, compute_shape_sensitivities };
 enum class NonTrimmedQuadratureRuleSettings {
     integration_method=DictStarts::start_values};
 enum class ConditionSettings {
@@ -78,7 +83,15 @@ public:
             std::make_tuple(GeneralSettings::input_filename, Str("input_filename"), Str("dummy"), DontSet ),
             std::make_tuple(GeneralSettings::output_directory_name, Str("output_directory_name"), Str("queso_output"), Set ),
             std::make_tuple(GeneralSettings::echo_level, Str("echo_level"), IndexType(1), Set),
-            std::make_tuple(GeneralSettings::write_output_to_file, Str("write_output_to_file"), true, Set)
+            std::make_tuple(GeneralSettings::write_output_to_file, Str("write_output_to_file"), true, Set),
+            std::make_tuple(GeneralSettings::inside_test_method, Str("inside_test_method"), InsideTestMethod::ray_tracing, Set),
+            std::make_tuple(GeneralSettings::checkpoint_filename, Str("checkpoint_filename"), Str(""), Set),
+            std::make_tuple(GeneralSettings::checkpoint_interval, Str("checkpoint_interval"), 60.0, Set),
+            std::make_tuple(GeneralSettings::checkpoint_trimmed_domains, Str("checkpoint_trimmed_domains"), false, Set),
+            std::make_tuple(GeneralSettings::out_of_core_slab_thickness, Str("out_of_core_slab_thickness"), IndexType(0), Set),
+            std::make_tuple(GeneralSettings::out_of_core_directory, Str("out_of_core_directory"), Str(""), Set),
+            std::make_tuple(GeneralSettings::mesh_decimation_tolerance, Str("mesh_decimation_tolerance"), 0.0, Set),
+            std::make_tuple(GeneralSettings::surface_only, Str("surface_only"), false, Set)
 
         ));
 
@@ -91,7 +104,11 @@ public:
             std::make_tuple(BackgroundGridSettings::lower_bound_uvw, Str("lower_bound_uvw"), PointType{0.0, 0.0, 0.0}, DontSet  ),
             std::make_tuple(BackgroundGridSettings::upper_bound_uvw, Str("upper_bound_uvw"), PointType{0.0, 0.0, 0.0}, DontSet  ),
             std::make_tuple(BackgroundGridSettings::polynomial_order, Str("polynomial_order"), Vector3i{0, 0, 0}, DontSet ),
-            std::make_tuple(BackgroundGridSettings::number_of_elements, Str("number_of_elements"), Vector3i{0, 0, 0}, DontSet )
+            std::make_tuple(BackgroundGridSettings::number_of_elements, Str("number_of_elements"), Vector3i{0, 0, 0}, DontSet ),
+            std::make_tuple(BackgroundGridSettings::grid_planning, Str("grid_planning"), false, Set ),
+            std::make_tuple(BackgroundGridSettings::grid_planning_volume_error, Str("grid_planning_volume_error"), 1.0e-4, Set ),
+            std::make_tuple(BackgroundGridSettings::grid_planning_runtime_budget, Str("grid_planning_runtime_budget"), 0.0, Set ),
+            std::make_tuple(BackgroundGridSettings::number_of_grid_levels, Str("number_of_grid_levels"), IndexType(1), Set )
         ));
 
         /// TrimmedQuadratureRuleSettings
@@ -100,7 +117,16 @@ public:
             std::make_tuple(TrimmedQuadratureRuleSettings::moment_fitting_residual, Str("moment_fitting_residual"), 1.0e-10, Set ),
             std::make_tuple(TrimmedQuadratureRuleSettings::min_element_volume_ratio, Str("min_element_volume_ratio"), 1.0e-3, Set  ),
             std::make_tuple(TrimmedQuadratureRuleSettings::min_num_boundary_triangles, Str("min_num_boundary_triangles"), IndexType(100), Set  ),
-            std::make_tuple(TrimmedQuadratureRuleSettings::neglect_elements_if_stl_is_flawed, Str("neglect_elements_if_stl_is_flawed"), true, Set  )
+            std::make_tuple(TrimmedQuadratureRuleSettings::neglect_elements_if_stl_is_flawed, Str("neglect_elements_if_stl_is_flawed"), true, Set  ),
+            std::make_tuple(TrimmedQuadratureRuleSettings::nnls_solver, Str("nnls_solver"), NNLSSolver::lawson_hanson, Set  ),
+            std::make_tuple(TrimmedQuadratureRuleSettings::init_point_distribution_factor, Str("init_point_distribution_factor"), IndexType(1), Set  ),
+            std::make_tuple(TrimmedQuadratureRuleSettings::max_octree_refinement_level, Str("max_octree_refinement_level"), IndexType(4), Set  ),
+            std::make_tuple(TrimmedQuadratureRuleSettings::auto_tuning, Str("auto_tuning"), false, Set  ),
+            std::make_tuple(TrimmedQuadratureRuleSettings::auto_tuning_sample_size, Str("auto_tuning_sample_size"), IndexType(16), Set  ),
+            std::make_tuple(TrimmedQuadratureRuleSettings::auto_tuning_volume_error, Str("auto_tuning_volume_error"), 1.0e-6, Set  ),
+            std::make_tuple(TrimmedQuadratureRuleSettings::max_num_cut_planes, Str("max_num_cut_planes"), IndexType(0), Set  ),
+            std::make_tuple(TrimmedQuadratureRuleSettings::verify_quadrature_rules, Str("verify_quadrature_rules"), false, Set  ),
+            std::make_tuple(TrimmedQuadratureRuleSettings::compute_shape_sensitivities, Str("compute_shape_sensitivities"), false, Set  )
         ));
 
         /// NonTrimmedQuadratureRuleSettings
@@ -157,6 +183,9 @@ public:
         }
 
         const IndexType echo_level = (*this)[MainSettings::general_settings].GetValue<IndexType>(GeneralSettings::echo_level);
+        const double checkpoint_interval = (*this)[MainSettings::general_settings].GetValue<double>(GeneralSettings::checkpoint_interval);
+        QuESo_ERROR_IF(checkpoint_interval <= 0.0) << "Invalid Input. The 'checkpoint_interval' must be larger than zero. \n";
+
         // Orders
         const Vector3i order = (*this)[MainSettings::background_grid_settings].GetValue<Vector3i>(BackgroundGridSettings::polynomial_order);
 
@@ -193,6 +222,16 @@ public:
 
         QuESo_ERROR_IF(ggq_rule_ise_used && min_order < 2) << "Generalized Gauss Quadrature (GGQ) rules are only applicable to B-Spline meshes with at least p=2.\n";
 
+        // Check if coarse grid levels are feasible.
+        const IndexType number_of_grid_levels = (*this)[MainSettings::background_grid_settings].GetValue<IndexType>(BackgroundGridSettings::number_of_grid_levels);
+        QuESo_ERROR_IF(number_of_grid_levels < 1) << "Invalid Input. The 'number_of_grid_levels' must be at least one.\n";
+        QuESo_ERROR_IF(ggq_rule_ise_used && number_of_grid_levels > 1) << "Generalized Gauss Quadrature (GGQ) rules can not be used in combination with 'number_of_grid_levels' > 1.\n";
+        for( IndexType dir = 0; dir < 3; ++dir ){
+            const IndexType factor = (num_elements[dir] > 1) ? (static_cast<IndexType>(1) << (number_of_grid_levels-1)) : 1;
+            QuESo_ERROR_IF(num_elements[dir] % factor != 0) << "Invalid Input. Each entry of 'number_of_elements' (if larger than one) must be divisible by "
+                << "2^('number_of_grid_levels'-1) = " << factor << ".\n";
+        }
+
         return *this;
     }
 
@@ -0,0 +1,231 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+//// STL includes
+#include <chrono>
+//// Project includes
+#include "queso/io/checkpoint.h"
+
+namespace queso {
+
+namespace {
+    // Identifies QuESo checkpoint files.
+    const char CheckpointMagic[8] = {'Q', 'u', 'E', 'S', 'o', 'C', 'K', 'P'};
+} // End anonymous namespace
+
+///////////////////////
+///// Checkpoint //////
+///////////////////////
+
+std::uint64_t Checkpoint::Hash(const char* pData, std::size_t Size, std::uint64_t Seed) {
+    std::uint64_t hash = Seed;
+    for( std::size_t i = 0; i < Size; ++i ){
+        hash ^= static_cast<std::uint64_t>(static_cast<unsigned char>(pData[i]));
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+std::uint64_t Checkpoint::Hash(const std::string& rString, std::uint64_t Seed) {
+    return Hash(rString.data(), rString.size(), Seed);
+}
+
+std::uint64_t Checkpoint::Hash(const TriangleMeshInterface& rTriangleMesh, std::uint64_t Seed) {
+    BufferType buffer{};
+    WriteMesh(buffer, rTriangleMesh);
+    return Hash(buffer.data(), buffer.size(), Seed);
+}
+
+void Checkpoint::WriteMesh(BufferType& rBuffer, const TriangleMeshInterface& rTriangleMesh) {
+    const auto& r_vertices = rTriangleMesh.GetVertices();
+    const auto& r_triangles = rTriangleMesh.GetTriangles();
+    const IndexType num_triangles = rTriangleMesh.NumOfTriangles();
+    rBuffer.reserve(rBuffer.size() + 2*sizeof(std::uint64_t) + r_vertices.size()*sizeof(Vector3d)
+        + num_triangles*(sizeof(Vector3d) + 3*sizeof(std::uint64_t)) );
+
+    Write(rBuffer, static_cast<std::uint64_t>(r_vertices.size()));
+    for( const auto& r_vertex : r_vertices ){
+        Write(rBuffer, r_vertex);
+    }
+    Write(rBuffer, static_cast<std::uint64_t>(num_triangles));
+    for( IndexType triangle_id = 0; triangle_id < num_triangles; ++triangle_id ){
+        const auto& r_triangle = r_triangles[triangle_id];
+        Write(rBuffer, static_cast<std::uint64_t>(r_triangle[0]));
+        Write(rBuffer, static_cast<std::uint64_t>(r_triangle[1]));
+        Write(rBuffer, static_cast<std::uint64_t>(r_triangle[2]));
+        Write(rBuffer, rTriangleMesh.Normal(triangle_id));
+    }
+}
+
+Unique<TriangleMeshInterface> Checkpoint::pReadMesh(const BufferType& rBuffer, std::size_t& rPosition) {
+    auto p_triangle_mesh = MakeUnique<TriangleMesh>();
+
+    const IndexType num_vertices = Read<std::uint64_t>(rBuffer, rPosition);
+    QuESo_ERROR_IF( rPosition + num_vertices*sizeof(Vector3d) > rBuffer.size() ) << "Checkpoint record is corrupted.\n";
+    p_triangle_mesh->Reserve(num_vertices);
+    for( IndexType i = 0; i < num_vertices; ++i ){
+        p_triangle_mesh->AddVertex( Read<Vector3d>(rBuffer, rPosition) );
+    }
+    const IndexType num_triangles = Read<std::uint64_t>(rBuffer, rPosition);
+    for( IndexType i = 0; i < num_triangles; ++i ){
+        const IndexType v1 = Read<std::uint64_t>(rBuffer, rPosition);
+        const IndexType v2 = Read<std::uint64_t>(rBuffer, rPosition);
+        const IndexType v3 = Read<std::uint64_t>(rBuffer, rPosition);
+        QuESo_ERROR_IF( v1 >= num_vertices || v2 >= num_vertices || v3 >= num_vertices ) << "Checkpoint record is corrupted.\n";
+        p_triangle_mesh->AddTriangle( {v1, v2, v3} );
+        p_triangle_mesh->AddNormal( Read<Vector3d>(rBuffer, rPosition) );
+    }
+
+    return p_triangle_mesh;
+}
+
+void Checkpoint::WriteHeader(std::ofstream& rStream, std::uint64_t Hash) {
+    const std::uint32_t version = Version;
+    rStream.write(CheckpointMagic, sizeof(CheckpointMagic));
+    rStream.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    rStream.write(reinterpret_cast<const char*>(&Hash), sizeof(Hash));
+}
+
+void Checkpoint::WriteRecord(std::ofstream& rStream, const Record& rRecord) {
+    const std::uint8_t type = static_cast<std::uint8_t>(rRecord.type);
+    const std::uint64_t size = rRecord.data.size();
+    const std::uint64_t checksum = Hash(rRecord.data.data(), rRecord.data.size());
+    rStream.write(reinterpret_cast<const char*>(&type), sizeof(type));
+    rStream.write(reinterpret_cast<const char*>(&rRecord.key), sizeof(rRecord.key));
+    rStream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    rStream.write(rRecord.data.data(), size);
+    rStream.write(reinterpret_cast<const char*>(&checksum), sizeof(checksum));
+}
+
+Checkpoint::RecordVectorType Checkpoint::ReadRecords(const std::string& rFilename, std::uint64_t Hash) {
+    RecordVectorType records{};
+
+    std::ifstream file(rFilename, std::ios::binary);
+    if( !file.is_open() ){
+        return records;
+    }
+
+    // Check header.
+    char magic[sizeof(CheckpointMagic)];
+    std::uint32_t version = 0;
+    std::uint64_t hash = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&hash), sizeof(hash));
+    if( !file.good() || std::memcmp(magic, CheckpointMagic, sizeof(magic)) != 0 || version != Version || hash != Hash ){
+        return records;
+    }
+
+    // Determine file size to detect truncated records before allocating memory.
+    const std::streampos begin_records = file.tellg();
+    file.seekg(0, std::ios::end);
+    const std::streampos end_of_file = file.tellg();
+    file.seekg(begin_records);
+
+    while( true ){
+        std::uint8_t type = 0;
+        std::uint64_t key = 0;
+        std::uint64_t size = 0;
+        file.read(reinterpret_cast<char*>(&type), sizeof(type));
+        file.read(reinterpret_cast<char*>(&key), sizeof(key));
+        file.read(reinterpret_cast<char*>(&size), sizeof(size));
+        if( !file.good() ){
+            break;
+        }
+        const std::streamoff remaining = end_of_file - file.tellg();
+        if( static_cast<std::uint64_t>(remaining) < size + sizeof(std::uint64_t) ){
+            break; // Incomplete record.
+        }
+        Record record{static_cast<RecordType>(type), key, BufferType(size)};
+        std::uint64_t checksum = 0;
+        file.read(record.data.data(), size);
+        file.read(reinterpret_cast<char*>(&checksum), sizeof(checksum));
+        if( !file.good() || checksum != Checkpoint::Hash(record.data.data(), record.data.size()) ){
+            break; // Corrupted record.
+        }
+        records.push_back(std::move(record));
+    }
+
+    return records;
+}
+
+/////////////////////////////
+///// CheckpointWriter //////
+/////////////////////////////
+
+CheckpointWriter::CheckpointWriter(const std::string& rFilename, std::uint64_t Hash, double Interval)
+    : mFile(rFilename, std::ios::out | std::ios::binary | std::ios::trunc), mInterval(Interval)
+{
+    QuESo_ERROR_IF( !mFile.is_open() ) << "Could not open checkpoint file: " << rFilename << ".\n";
+    Checkpoint::WriteHeader(mFile, Hash);
+    mFile.flush();
+    mThread = std::thread(&CheckpointWriter::Run, this);
+}
+
+CheckpointWriter::~CheckpointWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mConditionVariable.notify_one();
+    mThread.join();
+}
+
+void CheckpointWriter::AddRecord(Checkpoint::RecordType Type, std::uint64_t Key, Checkpoint::BufferType& rData) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mPendingRecords.push_back( Checkpoint::Record{Type, Key, std::move(rData)} );
+    ++mNumberOfAddedRecords;
+}
+
+void CheckpointWriter::Flush() {
+    std::unique_lock<std::mutex> lock(mMutex);
+    const IndexType target = mNumberOfAddedRecords;
+    mFlushRequested = true;
+    mConditionVariable.notify_one();
+    mFlushedConditionVariable.wait(lock, [this, target](){ return mNumberOfWrittenRecords >= target; });
+}
+
+IndexType CheckpointWriter::NumberOfWrittenRecords() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mNumberOfWrittenRecords;
+}
+
+void CheckpointWriter::Run() {
+    const auto interval = std::chrono::duration<double>(mInterval);
+    Checkpoint::RecordVectorType records{};
+    std::unique_lock<std::mutex> lock(mMutex);
+    while( true ){
+        mConditionVariable.wait_for(lock, interval, [this](){ return mStop || mFlushRequested; });
+        const bool stop = mStop;
+        mFlushRequested = false;
+        records.swap(mPendingRecords);
+
+        // Write records without holding the lock. Worker threads can continue to add records.
+        lock.unlock();
+        for( const auto& r_record : records ){
+            Checkpoint::WriteRecord(mFile, r_record);
+        }
+        mFile.flush();
+        const IndexType num_written = records.size();
+        records.clear();
+        lock.lock();
+
+        mNumberOfWrittenRecords += num_written;
+        mFlushedConditionVariable.notify_all();
+        if( stop && mPendingRecords.empty() ){
+            break;
+        }
+    }
+}
+
+} // End namespace queso
@@ -0,0 +1,228 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#ifndef CHECKPOINT_INCLUDE_H
+#define CHECKPOINT_INCLUDE_H
+
+//// STL includes
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <type_traits>
+//// Project includes
+#include "queso/includes/define.hpp"
+#include "queso/containers/triangle_mesh.hpp"
+
+namespace queso {
+
+///@name QuESo Classes
+///@{
+
+/**
+ * @class  Checkpoint
+ * @author Manuel Messmer
+ * @brief  Provides the binary format of QuESo checkpoint files.
+ * @details A checkpoint file consists of a header (magic string, version, model hash) followed by an append-only list of records.
+ *          Each record stores its type, a key, the size of its payload, the payload itself, and a checksum of the payload.
+ *          Records of a partially written tail (e.g. if the job was killed) fail the size/checksum test and are neglected.
+ *          Numbers are stored in native byte order. Hence, checkpoint files are not portable between different architectures.
+ * @see    CheckpointWriter.
+**/
+class Checkpoint {
+public:
+    ///@name Type Definitions
+    ///@{
+
+    typedef std::vector<char> BufferType;
+
+    enum class RecordType : std::uint8_t { element = 1, condition = 2, classification = 3 };
+
+    struct Record {
+        RecordType type;
+        std::uint64_t key;
+        BufferType data;
+    };
+    typedef std::vector<Record> RecordVectorType;
+
+    ///@}
+    ///@name Static Members
+    ///@{
+
+    static constexpr std::uint32_t Version = 1;
+    static constexpr std::uint64_t HashSeed = 14695981039346656037ULL;
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+    /// @brief Returns FNV-1a hash of given data.
+    /// @param pData
+    /// @param Size Size of data in bytes.
+    /// @param Seed Previous hash value. Allows to combine multiple hashes.
+    /// @return std::uint64_t
+    static std::uint64_t Hash(const char* pData, std::size_t Size, std::uint64_t Seed = HashSeed);
+
+    /// @brief Returns FNV-1a hash of given string.
+    /// @param rString
+    /// @param Seed Previous hash value. Allows to combine multiple hashes.
+    /// @return std::uint64_t
+    static std::uint64_t Hash(const std::string& rString, std::uint64_t Seed = HashSeed);
+
+    /// @brief Returns FNV-1a hash of the vertices and triangles of rTriangleMesh.
+    /// @param rTriangleMesh
+    /// @param Seed Previous hash value. Allows to combine multiple hashes.
+    /// @return std::uint64_t
+    static std::uint64_t Hash(const TriangleMeshInterface& rTriangleMesh, std::uint64_t Seed = HashSeed);
+
+    /// @brief Appends rValue to rBuffer. Only trivially copyable types are supported.
+    /// @tparam TType
+    /// @param rBuffer
+    /// @param rValue
+    template<typename TType>
+    static void Write(BufferType& rBuffer, const TType& rValue) {
+        static_assert(std::is_trivially_copyable<TType>::value, "Checkpoint::Write :: Type must be trivially copyable.");
+        const char* p_value = reinterpret_cast<const char*>(&rValue);
+        rBuffer.insert(rBuffer.end(), p_value, p_value + sizeof(TType));
+    }
+
+    /// @brief Reads value from rBuffer at rPosition. rPosition is moved behind the value.
+    /// @tparam TType
+    /// @param rBuffer
+    /// @param[out] rPosition
+    /// @return TType
+    template<typename TType>
+    static TType Read(const BufferType& rBuffer, std::size_t& rPosition) {
+        static_assert(std::is_trivially_copyable<TType>::value, "Checkpoint::Read :: Type must be trivially copyable.");
+        QuESo_ERROR_IF( rPosition + sizeof(TType) > rBuffer.size() ) << "Checkpoint record is corrupted.\n";
+        TType value;
+        std::memcpy(&value, rBuffer.data() + rPosition, sizeof(TType));
+        rPosition += sizeof(TType);
+        return value;
+    }
+
+    /// @brief Appends vertices, triangles and normals of rTriangleMesh to rBuffer.
+    /// @param rBuffer
+    /// @param rTriangleMesh
+    static void WriteMesh(BufferType& rBuffer, const TriangleMeshInterface& rTriangleMesh);
+
+    /// @brief Reads triangle mesh from rBuffer at rPosition. rPosition is moved behind the mesh.
+    /// @param rBuffer
+    /// @param[out] rPosition
+    /// @return Unique<TriangleMeshInterface>
+    static Unique<TriangleMeshInterface> pReadMesh(const BufferType& rBuffer, std::size_t& rPosition);
+
+    /// @brief Writes header of checkpoint file.
+    /// @param rStream
+    /// @param Hash Hash of all inputs that affect the stored records.
+    static void WriteHeader(std::ofstream& rStream, std::uint64_t Hash);
+
+    /// @brief Writes a single record.
+    /// @param rStream
+    /// @param rRecord
+    static void WriteRecord(std::ofstream& rStream, const Record& rRecord);
+
+    /// @brief Reads all valid records from checkpoint file. Returns an empty vector, if the file does not exist,
+    ///        or if the version or Hash does not match. Reading stops at the first incomplete or corrupted record.
+    /// @param rFilename
+    /// @param Hash Expected hash.
+    /// @return RecordVectorType
+    static RecordVectorType ReadRecords(const std::string& rFilename, std::uint64_t Hash);
+
+    ///@}
+}; // End class Checkpoint
+
+/**
+ * @class  CheckpointWriter
+ * @author Manuel Messmer
+ * @brief  Writes checkpoint records on a background thread.
+ * @details Worker threads only move serialized records into a pending queue (AddRecord()). The background thread wakes up periodically
+ *          (every 'Interval' seconds), takes all pending records, and appends them to the checkpoint file outside of the lock.
+ *          Hence, worker threads are never stalled by file I/O. The file is (re-)created in the constructor.
+ * @see    Checkpoint.
+**/
+class CheckpointWriter {
+public:
+    ///@name Life Cycle
+    ///@{
+
+    /// @brief Constructor. Creates file, writes header and starts background thread.
+    /// @param rFilename
+    /// @param Hash Hash of all inputs that affect the stored records.
+    /// @param Interval Time between two writes in seconds.
+    CheckpointWriter(const std::string& rFilename, std::uint64_t Hash, double Interval);
+
+    /// @brief Destructor. Writes all pending records and joins background thread.
+    ~CheckpointWriter();
+
+    /// Copy Constructor
+    CheckpointWriter(const CheckpointWriter &rOther) = delete;
+    /// Copy Assignement
+    CheckpointWriter& operator= (const CheckpointWriter &rOther) = delete;
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+    /// @brief Adds record to the pending queue. Thread-safe. rData is moved.
+    /// @param Type
+    /// @param Key
+    /// @param rData
+    void AddRecord(Checkpoint::RecordType Type, std::uint64_t Key, Checkpoint::BufferType& rData);
+
+    /// @brief Blocks until all records added so far are written and flushed to file.
+    void Flush();
+
+    /// @brief Returns number of records written to file so far.
+    /// @return IndexType
+    IndexType NumberOfWrittenRecords() const;
+
+    ///@}
+
+private:
+
+    ///@name Private Operations
+    ///@{
+
+    /// @brief Main loop of background thread.
+    void Run();
+
+    ///@}
+    ///@name Private Members
+    ///@{
+
+    std::ofstream mFile;
+    double mInterval;
+
+    mutable std::mutex mMutex;
+    std::condition_variable mConditionVariable;
+    std::condition_variable mFlushedConditionVariable;
+    Checkpoint::RecordVectorType mPendingRecords;
+    IndexType mNumberOfAddedRecords = 0;
+    IndexType mNumberOfWrittenRecords = 0;
+    bool mFlushRequested = false;
+    bool mStop = false;
+
+    std::thread mThread;
+
+    ///@}
+}; // End class CheckpointWriter
+///@} // End QuESo classes
+
+} // End namespace queso
+
+#endif // CHECKPOINT_INCLUDE_H
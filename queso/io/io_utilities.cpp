@@ -13,6 +13,8 @@
 
 //// STL includes
 #include <map>
+#include <sstream>
+#include <iomanip>
 //// Project includes
 #include "queso/io/io_utilities.h"
 
@@ -177,6 +179,72 @@ void IO::WriteMeshToVTK(const TriangleMeshInterface& rTriangleMesh,
     file.close();
 }
 
+void IO::ForEachTriangleInSTL(const std::string& rFilename,
+                              const std::function<void(const std::array<PointType, 3>&)>& rFunction){
+    std::array<PointType, 3> vertices;
+    if( STLIsInASCIIFormat(rFilename) ) {
+        std::ifstream file(rFilename);
+        QuESo_ERROR_IF( !file.is_open() ) << "Could not open file: " << rFilename << std::endl;
+
+        std::string message;
+        IndexType vertex_count = 0;
+        while( std::getline(file, message) ) {
+            std::stringstream ss(message);
+            std::string token;
+            ss >> token;
+            if( token == "vertex" ) {
+                for( IndexType j = 0; j < 3; ++j ){
+                    ss >> token;
+                    // Truncate to single precision (see: ReadMeshFromSTL_Ascii()).
+                    vertices[vertex_count][j] = static_cast<double>(static_cast<float>(std::stod(token)));
+                }
+                if( ++vertex_count == 3 ){
+                    rFunction(vertices);
+                    vertex_count = 0;
+                }
+            }
+        }
+    } else {
+        std::ifstream file(rFilename, std::ios::binary);
+        QuESo_ERROR_IF( !file.is_open() ) << "Could not open file: " << rFilename << std::endl;
+
+        // Ignore the first 80 chars of the header
+        char header[80];
+        QuESo_ERROR_IF( !file.read(header, 80) ) << "File " << rFilename << " is empty.\n";
+
+        unsigned int num_triangles;
+        QuESo_ERROR_IF( !file.read(reinterpret_cast<char*>(&num_triangles), sizeof(num_triangles)) ) << "Couldnt read number of triangles. \n";
+
+        // Normal (ignored), 3 vertices, attribute byte count.
+        float values[12];
+        char attribute[2];
+        for( IndexType i = 0; i < num_triangles; ++i ){
+            QuESo_ERROR_IF( !file.read(reinterpret_cast<char*>(values), sizeof(values)) || !file.read(attribute, sizeof(attribute)) )
+                << "Couldnt read triangle coordinates. \n";
+            for( IndexType j = 0; j < 3; ++j ){
+                vertices[j] = {values[3+3*j], values[4+3*j], values[5+3*j]};
+            }
+            rFunction(vertices);
+        }
+    }
+}
+
+void IO::WriteDiagnosticsToJSON(const Diagnostics& rDiagnostics, const std::string& rFilename){
+    std::ofstream file(rFilename, std::ios::out);
+    QuESo_ERROR_IF( !file.is_open() ) << "Could not create/open file: " << rFilename << ".\n";
+
+    file << "{\n    \"events\" : [";
+    const auto& r_events = rDiagnostics.GetEvents();
+    file << std::setprecision(10);
+    for( IndexType i = 0; i < r_events.size(); ++i ){
+        const auto& r_event = r_events[i];
+        file << ((i > 0) ? ",\n" : "\n") << "        { \"element_id\" : " << r_event.element_id << ", \"kind\" : \""
+             << Diagnostics::GetKindName(r_event.kind) << "\", \"value\" : " << r_event.value << " }";
+    }
+    file << ((r_events.size() > 0) ? "\n    ]\n}\n" : "]\n}\n");
+    file.close();
+}
+
 ////// Private member functions //////
 
 bool IO::STLIsInASCIIFormat(const std::string& rFilename) {
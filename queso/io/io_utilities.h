@@ -16,10 +16,12 @@
 
 //// STL includes
 #include <fstream>
+#include <functional>
 //// Project includes
 #include "queso/containers/background_grid.hpp"
 #include "queso/containers/triangle_mesh.hpp"
 #include "queso/containers/boundary_integration_point.hpp"
+#include "queso/includes/diagnostics.hpp"
 
 namespace queso {
 
@@ -59,6 +61,13 @@ public:
     static void ReadMeshFromSTL(TriangleMeshInterface& rTriangleMesh,
                                 const std::string& rFilename);
 
+    /// @brief Streams the triangles of an STL file one by one to rFunction (in the order of the file).
+    ///        In contrast to ReadMeshFromSTL(), the mesh is never stored as a whole. Vertices are truncated to single precision.
+    /// @param rFilename
+    /// @param rFunction Called for each triangle with its three vertices.
+    static void ForEachTriangleInSTL(const std::string& rFilename,
+                                     const std::function<void(const std::array<PointType, 3>&)>& rFunction);
+
     ///@brief Write dictionary to JSON file.
     ///@tparam TDictType
     ///@param rDictionary
@@ -74,6 +83,11 @@ public:
         }
     }
 
+    /// @brief Writes all events of rDiagnostics to JSON file (one object per event: element_id, kind, value).
+    /// @param rDiagnostics
+    /// @param rFilename
+    static void WriteDiagnosticsToJSON(const Diagnostics& rDiagnostics, const std::string& rFilename);
+
     /// @brief Write triangle mesh associated to given condition to STL-file.
     /// @tparam TElementType
     /// @param rCondition
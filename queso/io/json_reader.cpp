@@ -0,0 +1,356 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+//// STL includes
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <cctype>
+//// Project includes
+#include "queso/io/json_reader.h"
+
+namespace queso {
+
+namespace {
+
+/**
+ * @class  SettingsParser
+ * @brief  Recursive descent JSON parser, which directly writes all values into the given Settings.
+ * @see    JsonReader.
+**/
+class SettingsParser {
+public:
+    /// Constructor
+    SettingsParser(const std::string& rJsonString, Settings& rSettings) :
+        mrJsonString(rJsonString), mrSettings(rSettings)
+    {
+    }
+
+    /// @brief Parses the root object.
+    void Parse() {
+        SkipWhitespace();
+        ParseObject(mrSettings);
+        SkipWhitespace();
+        QuESo_ERROR_IF(mPosition < mrJsonString.size()) << ErrorPrefix() << "Unexpected characters after the root object.\n";
+    }
+
+private:
+    /// Number as read from file. IsNonNegativeInteger is true, if neither sign, fraction nor exponent is given.
+    struct Number {
+        double Value;
+        IndexType IntegerValue;
+        bool IsNonNegativeInteger;
+    };
+
+    /// @brief Parses object and writes all values into rDictionary.
+    void ParseObject(SettingsBaseType& rDictionary) {
+        Expect('{');
+        SkipWhitespace();
+        if( Peek() == '}' ){
+            ++mPosition;
+            return;
+        }
+        while( true ){
+            SkipWhitespace();
+            const std::string key = ParseString();
+            SkipWhitespace();
+            Expect(':');
+            SkipWhitespace();
+            ParseValue(rDictionary, key);
+            SkipWhitespace();
+            const char c = Next();
+            if( c == '}' ){
+                return;
+            }
+            QuESo_ERROR_IF(c != ',') << ErrorPrefix() << "Expected ',' or '}'.\n";
+        }
+    }
+
+    /// @brief Parses value and writes it to rKey of rDictionary.
+    void ParseValue(SettingsBaseType& rDictionary, const std::string& rKey) {
+        const char c = Peek();
+        if( c == '{' ){
+            ParseObject(rDictionary[rKey]);
+        } else if( c == '[' ){
+            ParseArray(rDictionary, rKey);
+        } else if( c == '"' ){
+            SetString(rDictionary, rKey, ParseString());
+        } else if( c == 't' || c == 'f' ){
+            rDictionary.SetValue(rKey, ParseBool());
+        } else if( c == '-' || std::isdigit(static_cast<unsigned char>(c)) ){
+            const Number number = ParseNumber();
+            if( number.IsNonNegativeInteger ){
+                rDictionary.SetValueWithAmbiguousType(rKey, number.IntegerValue); // Allows cast to double.
+            } else {
+                rDictionary.SetValue(rKey, number.Value);
+            }
+        } else {
+            QuESo_ERROR << ErrorPrefix() << "Invalid value for key: '" << rKey << "'.\n";
+        }
+    }
+
+    /// @brief Parses array. Arrays of objects are list items. Arrays of numbers are PointType or Vector3i.
+    void ParseArray(SettingsBaseType& rDictionary, const std::string& rKey) {
+        Expect('[');
+        SkipWhitespace();
+        if( Peek() == '{' || Peek() == ']' ){
+            // Just called to check key, and throw an error if necessary.
+            const auto& r_list = rDictionary.GetList(rKey);
+            QuESo_ERROR_IF( &r_list != &mrSettings.GetList(MainSettings::conditions_settings_list) ) << ErrorPrefix()
+                << "Lists of objects are only supported for 'conditions_settings_list'.\n";
+            if( Peek() == ']' ){
+                ++mPosition;
+                return;
+            }
+            while( true ){
+                SkipWhitespace();
+                ParseObject(mrSettings.CreateNewConditionSettings());
+                SkipWhitespace();
+                const char c = Next();
+                if( c == ']' ){
+                    return;
+                }
+                QuESo_ERROR_IF(c != ',') << ErrorPrefix() << "Expected ',' or ']'.\n";
+            }
+        }
+
+        std::vector<Number> numbers;
+        while( true ){
+            SkipWhitespace();
+            numbers.push_back(ParseNumber());
+            SkipWhitespace();
+            const char c = Next();
+            if( c == ']' ){
+                break;
+            }
+            QuESo_ERROR_IF(c != ',') << ErrorPrefix() << "Expected ',' or ']'.\n";
+        }
+        QuESo_ERROR_IF(numbers.size() != 3) << ErrorPrefix() << "For key: '" << rKey << "' - Expected an array of three numbers.\n";
+
+        const bool is_integer_array = std::all_of(numbers.begin(), numbers.end(),
+            [](const Number& rNumber){ return rNumber.IsNonNegativeInteger; });
+        if( is_integer_array ){
+            const Vector3i value{numbers[0].IntegerValue, numbers[1].IntegerValue, numbers[2].IntegerValue};
+            rDictionary.SetValueWithAmbiguousType(rKey, value); // Allows cast to PointType.
+        } else {
+            const PointType value{numbers[0].Value, numbers[1].Value, numbers[2].Value};
+            rDictionary.SetValue(rKey, value);
+        }
+    }
+
+    /// @brief Sets string value. Converts string to enum, if required.
+    void SetString(SettingsBaseType& rDictionary, const std::string& rKey, const std::string& rValue) {
+        if( rValue == "Not Set." ){
+            return;
+        }
+        if( rKey == "integration_method" ){
+            rDictionary.SetValue(rKey, GetEnum(rValue, {IntegrationMethod::gauss, IntegrationMethod::gauss_reduced_1, IntegrationMethod::gauss_reduced_2,
+                IntegrationMethod::ggq_optimal, IntegrationMethod::ggq_reduced_1, IntegrationMethod::ggq_reduced_2}));
+        } else if( rKey == "grid_type" ){
+            rDictionary.SetValue(rKey, GetEnum(rValue, {GridType::b_spline_grid, GridType::hexahedral_fe_grid}));
+        } else if( rKey == "inside_test_method" ){
+            rDictionary.SetValue(rKey, GetEnum(rValue, {InsideTestMethod::ray_tracing, InsideTestMethod::winding_number}));
+        } else if( rKey == "nnls_solver" ){
+            rDictionary.SetValue(rKey, GetEnum(rValue, {NNLSSolver::lawson_hanson, NNLSSolver::scaled_lawson_hanson, NNLSSolver::active_set_cholesky}));
+        } else {
+            rDictionary.SetValue(rKey, rValue);
+        }
+    }
+
+    /// @brief Returns enum, whose name (see: operator<< in core_definitions.hpp) matches rValue.
+    template<typename TEnumType>
+    TEnumType GetEnum(const std::string& rValue, std::initializer_list<TEnumType> Options) const {
+        std::stringstream possible_options;
+        possible_options << '[';
+        for( const auto option : Options ){
+            std::stringstream name;
+            name << option;
+            if( name.str() == rValue ){
+                return option;
+            }
+            possible_options << ((possible_options.tellp() > 1) ? ", '" : "'") << name.str() << '\'';
+        }
+        possible_options << ']';
+        QuESo_ERROR << "JsonReader :: Given parameter (" << rValue << ") not available. Possible options: " << possible_options.str() << '\n';
+    }
+
+    /// @brief Parses string. Supports all JSON escape sequences.
+    std::string ParseString() {
+        Expect('"');
+        std::string value;
+        while( true ){
+            const char c = Next();
+            if( c == '"' ){
+                return value;
+            }
+            if( c != '\\' ){
+                QuESo_ERROR_IF(c == '\n') << ErrorPrefix() << "Unterminated string.\n";
+                value.push_back(c);
+                continue;
+            }
+            const char escaped = Next();
+            switch( escaped ){
+                case '"': value.push_back('"'); break;
+                case '\\': value.push_back('\\'); break;
+                case '/': value.push_back('/'); break;
+                case 'b': value.push_back('\b'); break;
+                case 'f': value.push_back('\f'); break;
+                case 'n': value.push_back('\n'); break;
+                case 'r': value.push_back('\r'); break;
+                case 't': value.push_back('\t'); break;
+                case 'u': AppendUtf8(value, ParseHex()); break;
+                default: QuESo_ERROR << ErrorPrefix() << "Invalid escape sequence.\n";
+            }
+        }
+    }
+
+    /// @brief Parses the four hex digits of an \u escape sequence.
+    unsigned int ParseHex() {
+        QuESo_ERROR_IF(mPosition + 4 > mrJsonString.size()) << ErrorPrefix() << "Invalid unicode escape sequence.\n";
+        const std::string digits = mrJsonString.substr(mPosition, 4);
+        QuESo_ERROR_IF( !std::all_of(digits.begin(), digits.end(), [](char c){ return std::isxdigit(static_cast<unsigned char>(c)); }) )
+            << ErrorPrefix() << "Invalid unicode escape sequence.\n";
+        mPosition += 4;
+        return static_cast<unsigned int>(std::strtoul(digits.c_str(), nullptr, 16));
+    }
+
+    /// @brief Appends code point (basic multilingual plane) as UTF-8.
+    static void AppendUtf8(std::string& rValue, unsigned int CodePoint) {
+        if( CodePoint < 0x80 ){
+            rValue.push_back(static_cast<char>(CodePoint));
+        } else if( CodePoint < 0x800 ){
+            rValue.push_back(static_cast<char>(0xC0 | (CodePoint >> 6)));
+            rValue.push_back(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+        } else {
+            rValue.push_back(static_cast<char>(0xE0 | (CodePoint >> 12)));
+            rValue.push_back(static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F)));
+            rValue.push_back(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+        }
+    }
+
+    /// @brief Parses 'true' or 'false'.
+    bool ParseBool() {
+        if( mrJsonString.compare(mPosition, 4, "true") == 0 ){
+            mPosition += 4;
+            return true;
+        }
+        if( mrJsonString.compare(mPosition, 5, "false") == 0 ){
+            mPosition += 5;
+            return false;
+        }
+        QuESo_ERROR << ErrorPrefix() << "Invalid literal.\n";
+    }
+
+    /// @brief Parses number according to JSON grammar.
+    Number ParseNumber() {
+        const IndexType begin = mPosition;
+        bool is_integer = true;
+        if( Peek() == '-' ){
+            ++mPosition;
+        }
+        QuESo_ERROR_IF( !std::isdigit(static_cast<unsigned char>(Peek())) ) << ErrorPrefix() << "Expected a number.\n";
+        while( std::isdigit(static_cast<unsigned char>(Peek())) ){
+            ++mPosition;
+        }
+        if( Peek() == '.' ){
+            is_integer = false;
+            ++mPosition;
+            QuESo_ERROR_IF( !std::isdigit(static_cast<unsigned char>(Peek())) ) << ErrorPrefix() << "Expected digits after decimal point.\n";
+            while( std::isdigit(static_cast<unsigned char>(Peek())) ){
+                ++mPosition;
+            }
+        }
+        if( Peek() == 'e' || Peek() == 'E' ){
+            is_integer = false;
+            ++mPosition;
+            if( Peek() == '+' || Peek() == '-' ){
+                ++mPosition;
+            }
+            QuESo_ERROR_IF( !std::isdigit(static_cast<unsigned char>(Peek())) ) << ErrorPrefix() << "Expected digits in exponent.\n";
+            while( std::isdigit(static_cast<unsigned char>(Peek())) ){
+                ++mPosition;
+            }
+        }
+        const std::string token = mrJsonString.substr(begin, mPosition - begin);
+        Number number{ std::strtod(token.c_str(), nullptr), 0, false };
+        if( is_integer && token[0] != '-' ){
+            number.IntegerValue = static_cast<IndexType>(std::strtoull(token.c_str(), nullptr, 10));
+            number.IsNonNegativeInteger = true;
+        }
+        return number;
+    }
+
+    /// @brief Skips whitespace.
+    void SkipWhitespace() {
+        while( mPosition < mrJsonString.size() && std::isspace(static_cast<unsigned char>(mrJsonString[mPosition])) ){
+            ++mPosition;
+        }
+    }
+
+    /// @brief Returns current character without consuming it. Returns '\0' at the end of the string.
+    char Peek() const {
+        return (mPosition < mrJsonString.size()) ? mrJsonString[mPosition] : '\0';
+    }
+
+    /// @brief Returns current character and moves to the next one.
+    char Next() {
+        QuESo_ERROR_IF(mPosition >= mrJsonString.size()) << ErrorPrefix() << "Unexpected end of input.\n";
+        return mrJsonString[mPosition++];
+    }
+
+    /// @brief Consumes current character. Throws, if it does not match Expected.
+    void Expect(char Expected) {
+        QuESo_ERROR_IF(Peek() != Expected) << ErrorPrefix() << "Expected '" << Expected << "'.\n";
+        ++mPosition;
+    }
+
+    /// @brief Returns error prefix including the current line and column.
+    std::string ErrorPrefix() const {
+        const IndexType end = std::min<IndexType>(mPosition, mrJsonString.size());
+        IndexType line = 1;
+        IndexType column = 1;
+        for( IndexType i = 0; i < end; ++i ){
+            if( mrJsonString[i] == '\n' ){
+                ++line;
+                column = 1;
+            } else {
+                ++column;
+            }
+        }
+        return "JsonReader :: Invalid JSON (line " + std::to_string(line) + ", column " + std::to_string(column) + ") :: ";
+    }
+
+    const std::string& mrJsonString;
+    Settings& mrSettings;
+    IndexType mPosition = 0;
+};
+
+} // End anonymous namespace
+
+Settings JsonReader::ReadSettings(const std::string& rFilename) {
+    std::ifstream file(rFilename);
+    QuESo_ERROR_IF( !file.is_open() ) << "JsonReader :: Could not open file: " << rFilename << ".\n";
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return ReadSettingsFromString(buffer.str());
+}
+
+Settings JsonReader::ReadSettingsFromString(const std::string& rJsonString) {
+    Settings settings;
+    SettingsParser(rJsonString, settings).Parse();
+    return settings;
+}
+
+} // End namespace queso
@@ -0,0 +1,63 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#ifndef JSON_READER_INCLUDE_H
+#define JSON_READER_INCLUDE_H
+
+//// STL includes
+#include <string>
+//// Project includes
+#include "queso/includes/settings.hpp"
+
+namespace queso {
+
+///@name QuESo Classes
+///@{
+
+/**
+ * @class  JsonReader
+ * @author Manuel Messmer
+ * @brief  Reads Settings from JSON files (e.g. QuESoSettings.json) without requiring Python.
+ * @details The keys are not hard-coded here. All keys are looked up by their names in the Settings dictionary.
+ *          Hence, new keys in settings.hpp are supported automatically and unknown keys raise the errors of Dictionary.
+ *          Values are converted as follows:
+ *          - Objects:                 Subdictionaries.
+ *          - Arrays of objects:       List items (e.g. 'conditions_settings_list'), see Settings::CreateNewConditionSettings().
+ *          - Arrays of three numbers: Vector3i, if all numbers are non-negative integers (cast to PointType, if required). PointType otherwise.
+ *          - Integers:                IndexType (cast to double, if required). Negative integers are treated as double.
+ *          - Strings:                 Enums for 'integration_method', 'grid_type', 'inside_test_method' and 'nnls_solver'. Values of "Not Set." are ignored.
+ *          Duplicate keys are allowed. The last value is used.
+ * @see    IO::WriteDictionaryToJSON() writes Settings in the same format.
+**/
+class JsonReader {
+public:
+    ///@name Operations
+    ///@{
+
+    /// @brief Reads settings from JSON file.
+    /// @param rFilename
+    /// @return Settings
+    static Settings ReadSettings(const std::string& rFilename);
+
+    /// @brief Reads settings from JSON string.
+    /// @param rJsonString
+    /// @return Settings
+    static Settings ReadSettingsFromString(const std::string& rJsonString);
+
+    ///@}
+}; // End class JsonReader
+///@} // End QuESo classes
+
+} // End namespace queso
+
+#endif // JSON_READER_INCLUDE_H
@@ -0,0 +1,182 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+//// STL includes
+#include <fstream>
+#include <random>
+#include <cmath>
+//// Project includes
+#include "queso/io/slab_partitioner.h"
+#include "queso/io/io_utilities.h"
+#include "queso/utilities/math_utilities.hpp"
+
+namespace queso {
+
+namespace {
+// Number of triangles that are buffered per slab, before they are written to file.
+constexpr IndexType SlabBufferSize = 1024;
+} // End anonymous namespace
+
+SlabPartitioner::SlabPartitioner(const std::string& rFilename, const Settings& rSettings) {
+    const auto& r_general_settings = rSettings[MainSettings::general_settings];
+    const IndexType slab_thickness = r_general_settings.GetValue<IndexType>(GeneralSettings::out_of_core_slab_thickness);
+    QuESo_ERROR_IF(slab_thickness == 0) << "'out_of_core_slab_thickness' must be larger than zero.\n";
+
+    // Slabs coincide with the partitions of the flood fill.
+    FloodFill flood_fill(nullptr, rSettings);
+    mDirection = flood_fill.GetPartitionDirection();
+    mPartitions = flood_fill.GetPartitions(slab_thickness);
+
+    // Create unique directory.
+    const auto& r_directory = r_general_settings.GetValue<std::string>(GeneralSettings::out_of_core_directory);
+    const std::filesystem::path parent_directory = r_directory.empty() ? std::filesystem::temp_directory_path() : std::filesystem::path(r_directory);
+    std::filesystem::create_directories(parent_directory);
+    std::random_device rd;
+    do {
+        mDirectory = parent_directory / ("queso_slabs_" + std::to_string(rd()));
+    } while( !std::filesystem::create_directory(mDirectory) );
+
+    // Write empty files. Number of triangles is patched at the end.
+    const IndexType num_slabs = mPartitions.size();
+    mSlabBuffers.resize(num_slabs);
+    mSlabNumberOfTriangles.resize(num_slabs, 0);
+    for( IndexType slab_index = 0; slab_index < num_slabs; ++slab_index ){
+        std::ofstream file(GetSlabFilename(slab_index), std::ios::out | std::ios::binary);
+        QuESo_ERROR_IF( !file.is_open() ) << "Could not open file: " << GetSlabFilename(slab_index) << ".\n";
+        file << "FileType: Binary                                                                ";
+        const unsigned int num_triangles = 0;
+        file.write(reinterpret_cast<const char*>(&num_triangles), sizeof(num_triangles));
+    }
+
+    // Grid spacing along slab direction.
+    const auto& r_grid_settings = rSettings[MainSettings::background_grid_settings];
+    const double lower_bound = r_grid_settings.GetValue<PointType>(BackgroundGridSettings::lower_bound_xyz)[mDirection];
+    const double upper_bound = r_grid_settings.GetValue<PointType>(BackgroundGridSettings::upper_bound_xyz)[mDirection];
+    const IndexType num_elements = r_grid_settings.GetValue<Vector3i>(BackgroundGridSettings::number_of_elements)[mDirection];
+    const double delta = (upper_bound - lower_bound) / static_cast<double>(num_elements);
+    const double slab_delta = delta*static_cast<double>(slab_thickness);
+    // Neighbours are queried with slightly enlarged boxes. Hence, the halo must be slightly larger than one element layer.
+    const double halo = 1.1*delta;
+
+    // Stream input file.
+    IO::ForEachTriangleInSTL(rFilename, [&](const std::array<PointType, 3>& rVertices){
+        const auto& p1 = rVertices[0];
+        const auto& p2 = rVertices[1];
+        const auto& p3 = rVertices[2];
+
+        // Accumulate volume and closedness (see: MeshUtilities::EstimateQuality()).
+        // One point rule is exact for linear integrands.
+        const PointType cross = Math::Cross( Math::Subtract(p2, p1), Math::Subtract(p3, p1) );
+        const double area = 0.5*Math::Norm(cross);
+        if( area > ZEROTOL ){
+            const PointType normal = TriangleMeshInterface::Normal(p1, p2, p3);
+            const PointType center = { (p1[0]+p2[0]+p3[0])/3.0, (p1[1]+p2[1]+p3[1])/3.0, (p1[2]+p2[2]+p3[2])/3.0 };
+            mTotalArea += area;
+            for( IndexType i = 0; i < 3; ++i ){
+                mDirectionalAreas[i] += area*normal[i];
+                mDirectionalVolumes[i] += area*normal[i]*center[i];
+            }
+        }
+        for( const auto& r_vertex : rVertices ){
+            for( IndexType i = 0; i < 3; ++i ){
+                mBoundingBox.first[i] = std::min(mBoundingBox.first[i], r_vertex[i]);
+                mBoundingBox.second[i] = std::max(mBoundingBox.second[i], r_vertex[i]);
+            }
+        }
+        ++mNumberOfTriangles;
+
+        // Find all slabs (including halo) that are touched by the triangle.
+        const double min_value = std::min({p1[mDirection], p2[mDirection], p3[mDirection]});
+        const double max_value = std::max({p1[mDirection], p2[mDirection], p3[mDirection]});
+        const int first_candidate = std::max(static_cast<int>(std::floor((min_value - halo - lower_bound) / slab_delta)) - 1, 0);
+        const int last_candidate = std::min(static_cast<int>(std::floor((max_value + halo - lower_bound) / slab_delta)) + 1, static_cast<int>(num_slabs)-1);
+        for( int slab_index = first_candidate; slab_index <= last_candidate; ++slab_index ){
+            const auto& r_partition = mPartitions[slab_index];
+            const double slab_lower_bound = lower_bound + delta*static_cast<double>(r_partition.first[mDirection]) - halo;
+            const double slab_upper_bound = lower_bound + delta*static_cast<double>(r_partition.second[mDirection]+1) + halo;
+            if( max_value >= slab_lower_bound && min_value <= slab_upper_bound ){
+                auto& r_buffer = mSlabBuffers[slab_index];
+                const PointType normal = TriangleMeshInterface::Normal(p1, p2, p3);
+                for( IndexType i = 0; i < 3; ++i ){
+                    r_buffer.push_back(static_cast<float>(normal[i]));
+                }
+                for( const auto& r_vertex : rVertices ){
+                    for( IndexType i = 0; i < 3; ++i ){
+                        r_buffer.push_back(static_cast<float>(r_vertex[i]));
+                    }
+                }
+                ++mSlabNumberOfTriangles[slab_index];
+                if( r_buffer.size() >= 12*SlabBufferSize ){
+                    FlushSlab(slab_index);
+                }
+            }
+        }
+    });
+
+    // Flush remaining triangles and patch number of triangles.
+    for( IndexType slab_index = 0; slab_index < num_slabs; ++slab_index ){
+        FlushSlab(slab_index);
+        std::fstream file(GetSlabFilename(slab_index), std::ios::in | std::ios::out | std::ios::binary);
+        QuESo_ERROR_IF( !file.is_open() ) << "Could not open file: " << GetSlabFilename(slab_index) << ".\n";
+        file.seekp(80);
+        const unsigned int num_triangles = static_cast<unsigned int>(mSlabNumberOfTriangles[slab_index]);
+        file.write(reinterpret_cast<const char*>(&num_triangles), sizeof(num_triangles));
+    }
+}
+
+SlabPartitioner::~SlabPartitioner() {
+    std::error_code error_code;
+    std::filesystem::remove_all(mDirectory, error_code);
+}
+
+void SlabPartitioner::ReadSlab(IndexType SlabIndex, TriangleMesh& rTriangleMesh) const {
+    QuESo_ERROR_IF(SlabIndex >= NumberOfSlabs()) << "Slab index is out of range.\n";
+    rTriangleMesh.Clear();
+    if( mSlabNumberOfTriangles[SlabIndex] > 0 ){
+        IO::ReadMeshFromSTL(rTriangleMesh, GetSlabFilename(SlabIndex));
+    }
+}
+
+double SlabPartitioner::Volume() const {
+    return std::abs(1.0/3.0*(mDirectionalVolumes[0] + mDirectionalVolumes[1] + mDirectionalVolumes[2]));
+}
+
+double SlabPartitioner::EstimateQuality() const {
+    const double total_volume = Volume();
+    double max_error = Math::Norm(mDirectionalAreas) / std::abs(mTotalArea);
+    for( IndexType i = 0; i < 3; ++i ){
+        max_error = std::max(max_error, std::abs(mDirectionalVolumes[i] - total_volume) / total_volume);
+    }
+    return max_error;
+}
+
+std::string SlabPartitioner::GetSlabFilename(IndexType SlabIndex) const {
+    return (mDirectory / ("slab_" + std::to_string(SlabIndex) + ".stl")).string();
+}
+
+void SlabPartitioner::FlushSlab(IndexType SlabIndex) {
+    auto& r_buffer = mSlabBuffers[SlabIndex];
+    if( r_buffer.empty() ){
+        return;
+    }
+    std::ofstream file(GetSlabFilename(SlabIndex), std::ios::out | std::ios::binary | std::ios::app);
+    QuESo_ERROR_IF( !file.is_open() ) << "Could not open file: " << GetSlabFilename(SlabIndex) << ".\n";
+    const char attribute[2] = {0, 0};
+    for( IndexType i = 0; i < r_buffer.size(); i += 12 ){
+        file.write(reinterpret_cast<const char*>(&r_buffer[i]), 12*sizeof(float));
+        file.write(attribute, sizeof(attribute));
+    }
+    r_buffer.clear();
+}
+
+} // End namespace queso
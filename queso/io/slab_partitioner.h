@@ -0,0 +1,158 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#ifndef SLAB_PARTITIONER_INCLUDE_H
+#define SLAB_PARTITIONER_INCLUDE_H
+
+//// STL includes
+#include <string>
+#include <vector>
+#include <filesystem>
+//// Project includes
+#include "queso/includes/define.hpp"
+#include "queso/includes/settings.hpp"
+#include "queso/containers/triangle_mesh.hpp"
+#include "queso/embedding/flood_fill.h"
+
+namespace queso {
+
+///@name QuESo Classes
+///@{
+
+/**
+ * @class  SlabPartitioner
+ * @author Manuel Messmer
+ * @brief  Splits an STL file into slabs of the background grid without loading the whole mesh into memory.
+ * @details The background grid is partitioned into slabs of 'out_of_core_slab_thickness' element layers along FloodFill::GetPartitionDirection().
+ *          The input file is streamed once. Each triangle is appended (in the order of the input file) to a binary STL file of each slab that
+ *          it touches. Each slab is enlarged by a halo of slightly more than one element layer on both sides, since the classification of the
+ *          elements of a slab queries their direct neighbours (see: FloodFill::FillPartition()).
+ *          The slab files are stored in a unique subdirectory of 'out_of_core_directory' (default: temporary directory) and are removed on destruction.
+ *          Volume and closedness of the input mesh are accumulated while streaming (see: MeshUtilities::Volume() and MeshUtilities::EstimateQuality()).
+**/
+class SlabPartitioner {
+public:
+    ///@name Type Definitions
+    ///@{
+
+    typedef FloodFill::PartitionBoxVectorType PartitionBoxVectorType;
+
+    ///@}
+    ///@name Life Cycle
+    ///@{
+
+    /// @brief Constructor. Streams rFilename into the slab files.
+    /// @param rFilename Input STL file.
+    /// @param rSettings
+    SlabPartitioner(const std::string& rFilename, const Settings& rSettings);
+
+    /// @brief Destructor. Removes all slab files.
+    ~SlabPartitioner();
+
+    /// Copy Constructor
+    SlabPartitioner(const SlabPartitioner &rOther) = delete;
+    /// Copy Assignement
+    SlabPartitioner& operator= (const SlabPartitioner &rOther) = delete;
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+    /// @brief Reads the triangles of the given slab (including its halo).
+    /// @param SlabIndex
+    /// @param[out] rTriangleMesh
+    void ReadSlab(IndexType SlabIndex, TriangleMesh& rTriangleMesh) const;
+
+    /// @brief Returns number of slabs.
+    /// @return IndexType
+    IndexType NumberOfSlabs() const {
+        return mPartitions.size();
+    }
+
+    /// @brief Returns the direction along which the grid is sliced (see: FloodFill::GetPartitionDirection()).
+    /// @return IndexType 0:x, 1:y, 2:z.
+    IndexType GetDirection() const {
+        return mDirection;
+    }
+
+    /// @brief Returns the element ranges of all slabs (without halo). Can directly be passed to FloodFill::FillPartition().
+    /// @return const PartitionBoxVectorType&
+    const PartitionBoxVectorType& GetPartitions() const {
+        return mPartitions;
+    }
+
+    /// @brief Returns number of triangles in input file.
+    /// @return IndexType
+    IndexType NumberOfTriangles() const {
+        return mNumberOfTriangles;
+    }
+
+    /// @brief Returns number of triangles stored in the given slab.
+    /// @param SlabIndex
+    /// @return IndexType
+    IndexType NumberOfTriangles(IndexType SlabIndex) const {
+        return mSlabNumberOfTriangles[SlabIndex];
+    }
+
+    /// @brief Returns volume enclosed by the input mesh.
+    /// @return double
+    double Volume() const;
+
+    /// @brief Returns an estimate of the closedness of the input mesh. Zero, if mesh is closed (see: MeshUtilities::EstimateQuality()).
+    /// @return double
+    double EstimateQuality() const;
+
+    /// @brief Returns bounding box of the input mesh.
+    /// @return const BoundingBoxType&
+    const BoundingBoxType& GetBoundingBox() const {
+        return mBoundingBox;
+    }
+
+    ///@}
+private:
+    ///@name Private Operations
+    ///@{
+
+    /// @brief Returns filename of the given slab.
+    /// @param SlabIndex
+    /// @return std::string
+    std::string GetSlabFilename(IndexType SlabIndex) const;
+
+    /// @brief Appends buffered triangles of the given slab to its file and clears the buffer.
+    /// @param SlabIndex
+    void FlushSlab(IndexType SlabIndex);
+
+    ///@}
+    ///@name Private Members
+    ///@{
+
+    IndexType mDirection;
+    PartitionBoxVectorType mPartitions;
+    std::filesystem::path mDirectory;
+
+    std::vector<std::vector<float>> mSlabBuffers;
+    std::vector<IndexType> mSlabNumberOfTriangles;
+    IndexType mNumberOfTriangles = 0;
+
+    PointType mDirectionalVolumes{0.0, 0.0, 0.0};
+    PointType mDirectionalAreas{0.0, 0.0, 0.0};
+    double mTotalArea = 0.0;
+    BoundingBoxType mBoundingBox{ {MAXD, MAXD, MAXD}, {LOWESTD, LOWESTD, LOWESTD} };
+
+    ///@}
+}; // End class SlabPartitioner
+///@} // End QuESo classes
+
+} // End namespace queso
+
+#endif // SLAB_PARTITIONER_INCLUDE_H
@@ -11,12 +11,15 @@
 //
 //  Authors:    Manuel Messmer
 
+/// External includes
+#include <pybind11/numpy.h>
 /// Project inlcudes
 #include "queso/python/define_python.hpp"
 #include "queso/python/add_containers_to_python.h"
 // To export
 #include "queso/containers/triangle_mesh.hpp"
 #include "queso/containers/background_grid.hpp"
+#include "queso/containers/face_adjacency.hpp"
 #include "queso/containers/condition.hpp"
 #include "queso/quadrature/integration_points_1d/integration_points_factory_1d.h"
 #include "queso/embedded_model.h"
@@ -58,6 +61,39 @@ namespace Python {
 
 namespace py = pybind11;
 
+/// @brief Returns read-only numpy array that references the data of rVector (no copy). Base is kept alive by the array.
+/// @note Strides are given explicitly, since the element size of the numpy dtype is not reliably available in all numpy versions.
+template<typename TValueType>
+py::array_t<TValueType> AsReadOnlyArray(const std::vector<TValueType>& rVector, py::handle Base, IndexType NumberOfColumns=1) {
+    const py::ssize_t item_size = static_cast<py::ssize_t>(sizeof(TValueType));
+    const py::ssize_t num_rows = static_cast<py::ssize_t>(rVector.size()/NumberOfColumns);
+    py::array_t<TValueType> array;
+    if( NumberOfColumns == 1 ){
+        array = py::array_t<TValueType>({num_rows}, {item_size}, rVector.data(), Base);
+    } else {
+        const py::ssize_t num_cols = static_cast<py::ssize_t>(NumberOfColumns);
+        array = py::array_t<TValueType>({num_rows, num_cols}, {num_cols*item_size, item_size}, rVector.data(), Base);
+    }
+    py::detail::array_proxy(array.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+    return array;
+}
+
+/// @brief Converts a python list of polylines (each a list of points with two or three components) into BRepOperator2D::PolylineVectorType.
+BRepOperator2D::PolylineVectorType PolylinesFromList(const py::list& rPolylines) {
+    BRepOperator2D::PolylineVectorType polylines{};
+    polylines.reserve(rPolylines.size());
+    for( const auto& r_polyline : rPolylines ){
+        BRepOperator2D::PolylineType polyline{};
+        for( const auto& r_point : r_polyline.cast<py::list>() ){
+            const auto coordinates = r_point.cast<std::vector<double>>();
+            QuESo_ERROR_IF( coordinates.size() < 2 || coordinates.size() > 3 ) << "Points of polylines must have two or three components.\n";
+            polyline.push_back( {coordinates[0], coordinates[1], (coordinates.size() == 3) ? coordinates[2] : 0.0} );
+        }
+        polylines.push_back(std::move(polyline));
+    }
+    return polylines;
+}
+
 void AddContainersToPython(pybind11::module& m) {
 
     /// Export PointType
@@ -147,6 +183,20 @@ void AddContainersToPython(pybind11::module& m) {
             return TriangleMesh::Normal( PointType(rV1), PointType(rV2), PointType(rV3)); })
     ;
 
+    /// Export ShapeSensitivities. Arrays are exported as numpy arrays without copy.
+    py::class_<ShapeSensitivities, Unique<ShapeSensitivities>>(m, "ShapeSensitivities")
+        .def("NumberOfVertices", &ShapeSensitivities::NumberOfVertices)
+        .def("NumberOfPoints", &ShapeSensitivities::NumberOfPoints)
+        .def("Derivative", &ShapeSensitivities::Derivative)
+        .def_property_readonly("vertex_ids", [](py::object self){
+            return AsReadOnlyArray(self.cast<const ShapeSensitivities&>().VertexIds(), self); })
+        // Shape: (NumberOfVertices, NumberOfPoints, 3).
+        .def_property_readonly("derivatives", [](py::object self){
+            const auto& r_shape_sensitivities = self.cast<const ShapeSensitivities&>();
+            return AsReadOnlyArray(r_shape_sensitivities.Derivatives(), self, 3).attr("reshape")(
+                r_shape_sensitivities.NumberOfVertices(), r_shape_sensitivities.NumberOfPoints(), 3); })
+    ;
+
     /// Export Element
     py::class_<ElementType, Unique<ElementType>>(m,"Element")
         .def("GetIntegrationPoints",  static_cast< const IntegrationPointVectorType& (ElementType::*)() const>(&ElementType::GetIntegrationPoints)
@@ -160,6 +210,8 @@ void AddContainersToPython(pybind11::module& m) {
         })
         .def("ID", &ElementType::GetId)
         .def("IsTrimmed", &ElementType::IsTrimmed)
+        .def("HasShapeSensitivities", &ElementType::HasShapeSensitivities)
+        .def("GetShapeSensitivities", &ElementType::GetShapeSensitivities, py::return_value_policy::reference_internal)
     ;
 
     // Export Element Vector
@@ -171,6 +223,33 @@ void AddContainersToPython(pybind11::module& m) {
         }, py::keep_alive<0, 1>() )
     ;
 
+    /// Export FaceAdjacency. All arrays are exported as numpy arrays without copy.
+    /// The arrays reference the data of the FaceAdjacency object and keep it alive.
+    py::class_<FaceAdjacency, Unique<FaceAdjacency>>(m, "FaceAdjacency")
+        .def("NumberOfRows", &FaceAdjacency::NumberOfRows)
+        .def("NumberOfEntries", &FaceAdjacency::NumberOfEntries)
+        .def("NumberOfFacePoints", &FaceAdjacency::NumberOfFacePoints)
+        .def("HasFacePoints", &FaceAdjacency::HasFacePoints)
+        .def_property_readonly("offsets", [](py::object self){
+            return AsReadOnlyArray(self.cast<const FaceAdjacency&>().Offsets(), self); })
+        .def_property_readonly("element_ids", [](py::object self){
+            return AsReadOnlyArray(self.cast<const FaceAdjacency&>().ElementIds(), self); })
+        .def_property_readonly("neighbour_ids", [](py::object self){
+            return AsReadOnlyArray(self.cast<const FaceAdjacency&>().NeighbourIds(), self); })
+        .def_property_readonly("directions", [](py::object self){
+            return AsReadOnlyArray(self.cast<const FaceAdjacency&>().Directions(), self); })
+        .def_property_readonly("flags", [](py::object self){
+            return AsReadOnlyArray(self.cast<const FaceAdjacency&>().GetFlags(), self); })
+        .def_property_readonly("face_point_offsets", [](py::object self){
+            return AsReadOnlyArray(self.cast<const FaceAdjacency&>().FacePointOffsets(), self); })
+        .def_property_readonly("face_points", [](py::object self){
+            return AsReadOnlyArray(self.cast<const FaceAdjacency&>().FacePoints(), self, 3); })
+        .def_property_readonly("face_weights", [](py::object self){
+            return AsReadOnlyArray(self.cast<const FaceAdjacency&>().FaceWeights(), self); })
+        .def_property_readonly_static("element_is_trimmed", [](py::object){ return static_cast<int>(FaceAdjacency::element_is_trimmed); })
+        .def_property_readonly_static("neighbour_is_trimmed", [](py::object){ return static_cast<int>(FaceAdjacency::neighbour_is_trimmed); })
+    ;
+
     /// Export BackgroundGrid
     py::class_<BackgroundGrid<ElementType>, Unique<BackgroundGrid<ElementType>>>(m, "BackgroundGrid")
         .def(py::init<const Settings&>())
@@ -178,6 +257,8 @@ void AddContainersToPython(pybind11::module& m) {
         .def("NumberOfActiveElements", &BackgroundGrid<ElementType>::NumberOfActiveElements)
         .def("GetConditions", &BackgroundGrid<ElementType>::GetConditions, py::return_value_policy::reference_internal)
         .def("NumberOfConditions", &BackgroundGrid<ElementType>::NumberOfConditions)
+        .def("ComputeFaceAdjacency", &BackgroundGrid<ElementType>::ComputeFaceAdjacency,
+            py::arg("OnlyGhostFaces")=false, py::arg("ComputeFacePoints")=false, py::arg("FaceOrder")=1, py::return_value_policy::move)
     ;
 
     /// Export Condition Segment
@@ -230,8 +311,18 @@ void AddContainersToPython(pybind11::module& m) {
     py::class_<EmbeddedModel>(m,"EmbeddedModel")
         .def(py::init<const Settings&>())
         .def("CreateAllFromSettings", &EmbeddedModel::CreateAllFromSettings)
+        .def("CreateVolume2D", [](EmbeddedModel& self, const py::list& rPolylines){
+            self.CreateVolume2D( PolylinesFromList(rPolylines) );
+        })
+        .def("CreateCondition2D", [](EmbeddedModel& self, const py::list& rPolylines, const SettingsBaseType& rConditionSettings){
+            self.CreateCondition2D( PolylinesFromList(rPolylines), rConditionSettings );
+        })
         .def("GetElements", &EmbeddedModel::GetElements, py::return_value_policy::reference_internal)
         .def("GetConditions", &EmbeddedModel::GetConditions, py::return_value_policy::reference_internal )
+        .def("GetBackgroundGrid", static_cast<const EmbeddedModel::BackgroundGridType& (EmbeddedModel::*)() const>(&EmbeddedModel::GetBackgroundGrid), py::return_value_policy::reference_internal)
+        .def("GetBackgroundGrid", static_cast<const EmbeddedModel::BackgroundGridType& (EmbeddedModel::*)(IndexType) const>(&EmbeddedModel::GetBackgroundGrid), py::return_value_policy::reference_internal)
+        .def("NumberOfGridLevels", &EmbeddedModel::NumberOfGridLevels)
+        .def_static("PlanBackgroundGrid", static_cast<ModelInfo (*)(const Settings&)>(&EmbeddedModel::PlanBackgroundGrid), py::return_value_policy::move)
         .def("GetSettings", &EmbeddedModel::GetSettings, py::return_value_policy::reference_internal)
         .def("GetModelInfo", &EmbeddedModel::GetModelInfo, py::return_value_policy::reference_internal)
     ;
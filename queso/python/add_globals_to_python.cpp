@@ -40,6 +40,19 @@ void AddGlobalsToPython(pybind11::module& m) {
         .value("hexahedral_fe_grid", GridType::hexahedral_fe_grid)
     ;
 
+    /// Export enum InsideTestMethod
+    py::enum_<InsideTestMethod>(m, "InsideTestMethod")
+        .value("ray_tracing", InsideTestMethod::ray_tracing)
+        .value("winding_number", InsideTestMethod::winding_number)
+    ;
+
+    /// Export enum NNLSSolver
+    py::enum_<NNLSSolver>(m, "NNLSSolver")
+        .value("lawson_hanson", NNLSSolver::lawson_hanson)
+        .value("scaled_lawson_hanson", NNLSSolver::scaled_lawson_hanson)
+        .value("active_set_cholesky", NNLSSolver::active_set_cholesky)
+    ;
+
 } // End AddGlobalsToPython
 
 } // End namespace Python
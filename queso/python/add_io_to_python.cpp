@@ -16,6 +16,7 @@
 #include "queso/python/add_io_to_python.h"
 // To export
 #include "queso/io/io_utilities.h"
+#include "queso/io/json_reader.h"
 
 namespace queso {
 namespace Python {
@@ -30,6 +31,7 @@ void AddIoToPython(pybind11::module& m) {
     /// Export MeshUtilites
     py::class_<IO>(m,"IO")
         .def_static("ReadMeshFromSTL", &IO::ReadMeshFromSTL)
+        .def_static("ReadSettingsFromJSON", &JsonReader::ReadSettings)
         .def_static("WriteSettingsToJSON", &(*pWriteSettingsToJSON))
         .def_static("WriteModelInfoToJSON", &(*pWriteModelInfoToJSON))
     ;
@@ -58,6 +58,10 @@ void DictionaryBinderHelper(py::class_<TDictType>& binder) {
         rDictionary.SetValue(rKeyName, rValue); });
     binder.def("SetValue", [](TDictType& rDictionary, const std::string& rKeyName, const GridTypeType& rValue){
         rDictionary.SetValue(rKeyName, rValue); });
+    binder.def("SetValue", [](TDictType& rDictionary, const std::string& rKeyName, const InsideTestMethodType& rValue){
+        rDictionary.SetValue(rKeyName, rValue); });
+    binder.def("SetValue", [](TDictType& rDictionary, const std::string& rKeyName, const NNLSSolverType& rValue){
+        rDictionary.SetValue(rKeyName, rValue); });
 
     /// GetValue
     binder.def("GetDoubleVector", [](TDictType& rDictionary, const std::string& rKeyName) -> PointType {
@@ -76,6 +80,10 @@ void DictionaryBinderHelper(py::class_<TDictType>& binder) {
         return rDictionary.template GetValue<IntegrationMethodType>(rKeyName); });
     binder.def("GetGridType", [](const TDictType& rDictionary, const std::string& rKeyName ) -> GridTypeType {
         return rDictionary.template GetValue<GridTypeType>(rKeyName); });
+    binder.def("GetInsideTestMethod", [](const TDictType& rDictionary, const std::string& rKeyName ) -> InsideTestMethodType {
+        return rDictionary.template GetValue<InsideTestMethodType>(rKeyName); });
+    binder.def("GetNNLSSolver", [](const TDictType& rDictionary, const std::string& rKeyName ) -> NNLSSolverType {
+        return rDictionary.template GetValue<NNLSSolverType>(rKeyName); });
 }
 
 } // End Python
@@ -56,6 +56,29 @@ class PyQuESo:
         """
         return self.embedded_model.GetModelInfo()
 
+    def PlanBackgroundGrid(self, apply=True):
+        """ Proposes 'number_of_elements' without running the actual computation.
+            If apply is True, the proposal is written to the settings and used by Run().
+            Returns model info dictionary (see: 'grid_planning_info').
+        """
+        model_info = QuESo_App.EmbeddedModel.PlanBackgroundGrid(self.settings)
+        if apply:
+            number_of_elements = model_info["grid_planning_info"].GetIntVector("proposed_number_of_elements")
+            self.settings["background_grid_settings"].SetValue("number_of_elements", number_of_elements)
+        return model_info
+
+    def GetBackgroundGrid(self, level=0):
+        """ Returns background grid of given level. Level 0 is the finest grid.
+            Coarse levels are only available, if 'number_of_grid_levels' > 1.
+        """
+        return self.embedded_model.GetBackgroundGrid(level)
+
+    def GetFaceAdjacency(self, only_ghost_faces=False, compute_face_points=False, face_order=1):
+        """ Returns face-adjacency of active elements in CSR format.
+            All arrays (e.g. offsets, neighbour_ids, flags) are numpy arrays that reference the C++ data (no copy).
+        """
+        return self.embedded_model.GetBackgroundGrid().ComputeFaceAdjacency(only_ghost_faces, compute_face_points, face_order)
+
     def GetBSplineVolume(self, knot_vector_type):
         return BSplineVolume(self.settings, knot_vector_type)
 
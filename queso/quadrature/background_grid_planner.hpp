@@ -0,0 +1,363 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#ifndef BACKGROUND_GRID_PLANNER_INCLUDE_HPP
+#define BACKGROUND_GRID_PLANNER_INCLUDE_HPP
+
+//// STL includes
+#include <omp.h>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+//// Project includes
+#include "queso/includes/settings.hpp"
+#include "queso/includes/model_info.hpp"
+#include "queso/includes/timer.hpp"
+#include "queso/containers/grid_indexer.hpp"
+#include "queso/embedding/brep_operator.h"
+#include "queso/embedding/geometry_query.h"
+#include "queso/quadrature/trimmed_element_tuner.hpp"
+#include "queso/utilities/mesh_utilities.h"
+
+namespace queso {
+
+///@name QuESo Classes
+///@{
+
+/**
+ * @class  BackgroundGridPlanner
+ * @author Manuel Messmer
+ * @brief  Proposes the number of elements of the background grid before the actual computation.
+ * @details The planner proceeds as follows:
+ *          1. Local feature size: Rays are cast from the centroids of a sample of triangles along the inward and outward normal.
+ *             The distance to the first hit measures the local wall thickness and the local gap width (e.g. small holes).
+ *             'min_feature_size' is the area-weighted 5% quantile of the minimum of both distances.
+ *          2. Candidates: Uniform element sizes h are sampled geometrically from half of the largest extent of the grid down to
+ *             min_feature_size/2 (number of cells doubles from one candidate to the next).
+ *          3. Cost model: For each candidate, the number of trimmed cells is obtained from the element classification, if the grid
+ *             contains at most 'MaxClassifiedCells' cells. For finer grids, it is extrapolated from the finest classified candidate
+ *             (the number of trimmed cells scales with h^-2). The trimmed-element pipeline is run on a sample of trimmed cells
+ *             (cells containing the centroids of the sampled triangles, see: QuadratureTrimmedElementTuner::RunPipeline()).
+ *             The predicted runtime is: (num_trimmed * time_per_trimmed_cell) / num_threads + time_of_classification.
+ *             The predicted volume error (relative to the volume of the geometry) is: num_trimmed * mean_sampled_volume_error / volume.
+ *             Cells neglected by the pipeline contribute 'min_element_volume_ratio' times the cell volume.
+ *          4. Selection: The coarsest candidate that resolves min_feature_size (h <= min_feature_size), meets 'grid_planning_volume_error'
+ *             and stays within 'grid_planning_runtime_budget' (if > 0) is selected. If no candidate meets all targets, the finest candidate
+ *             within the runtime budget is selected (the coarsest, if none is within the budget).
+ *          All predictions are estimates and depend on measured run times.
+ * @tparam TElementType
+**/
+template<typename TElementType>
+class BackgroundGridPlanner {
+public:
+    ///@name Type Definitions
+    ///@{
+    typedef TElementType ElementType;
+    typedef QuadratureTrimmedElementTuner<ElementType> TunerType;
+
+    /// @brief Evaluated grid candidate.
+    struct Candidate {
+        Vector3i number_of_elements;
+        IndexType num_trimmed_elements = 0;
+        bool is_extrapolated = false;   // True, if num_trimmed_elements is extrapolated (grid is not classified).
+        double volume_error = 0.0;      // Predicted relative volume error.
+        double runtime = 0.0;           // Predicted runtime in seconds.
+    };
+
+    /// @brief Result of Plan().
+    struct PlanningResult {
+        std::vector<Candidate> candidates;
+        IndexType selected = 0;
+        bool target_met = false;
+        double min_feature_size = 0.0;
+        double median_feature_size = 0.0;
+        IndexType num_sampled_elements = 0;
+    };
+
+    /// Number of triangles used to estimate the local feature size.
+    static constexpr IndexType NumFeatureSamples = 2000;
+    /// Max. number of cells of classified candidates. Finer candidates are extrapolated.
+    static constexpr IndexType MaxClassifiedCells = 1000000;
+    /// Max. number of candidates.
+    static constexpr IndexType MaxNumCandidates = 24;
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+    /// @brief Estimates the local feature size (see class description).
+    /// @param rTriangleMesh Must be closed.
+    /// @param NumSamples Number of sampled triangles.
+    /// @return std::pair<double, double> Area-weighted 5% quantile and median of the local feature size.
+    static std::pair<double, double> EstimateLocalFeatureSize(const TriangleMeshInterface& rTriangleMesh, IndexType NumSamples) {
+        const IndexType num_triangles = rTriangleMesh.NumOfTriangles();
+        QuESo_ERROR_IF(num_triangles == 0) << "Triangle mesh is empty.\n";
+        const GeometryQuery geometry_query(rTriangleMesh, true);
+
+        const auto bounding_box = MeshUtilities::BoundingBox(rTriangleMesh);
+        const double offset = 1e-8 * Math::Norm( Math::Subtract(bounding_box.second, bounding_box.first) );
+
+        const IndexType num_samples = std::min(NumSamples, num_triangles);
+        std::vector<std::pair<double, double>> feature_sizes(num_samples); // {size, area}
+        #pragma omp parallel for
+        for( int i = 0; i < static_cast<int>(num_samples); ++i ){
+            const IndexType triangle_id = (static_cast<IndexType>(i)*num_triangles) / num_samples;
+            const PointType center = rTriangleMesh.Center(triangle_id);
+            PointType normal = rTriangleMesh.Normal(triangle_id);
+            // Avoid zero components (slab tests of the ray).
+            for( IndexType k = 0; k < 3; ++k ){
+                if( std::abs(normal[k]) < 1e-10 ){
+                    normal[k] = 1e-10;
+                }
+            }
+            const PointType inward{-normal[0], -normal[1], -normal[2]};
+            const Ray_AABB_primitive ray_in( Math::Add(center, Math::Mult(offset, inward)), inward);
+            const Ray_AABB_primitive ray_out( Math::Add(center, Math::Mult(offset, normal)), normal);
+            const double thickness = geometry_query.DistanceToFirstIntersection(ray_in, 0.0) + offset;
+            const double gap = geometry_query.DistanceToFirstIntersection(ray_out, 0.0) + offset;
+            feature_sizes[i] = std::make_pair(std::min(thickness, gap), rTriangleMesh.Area(triangle_id));
+        }
+
+        std::sort(feature_sizes.begin(), feature_sizes.end());
+        double total_area = 0.0;
+        for( const auto& r_value : feature_sizes ){
+            total_area += r_value.second;
+        }
+        double min_feature_size = MAXD;
+        double median_feature_size = MAXD;
+        double area = 0.0;
+        for( const auto& r_value : feature_sizes ){
+            area += r_value.second;
+            if( min_feature_size == MAXD && area >= 0.05*total_area ){
+                min_feature_size = r_value.first;
+            }
+            if( area >= 0.5*total_area ){
+                median_feature_size = r_value.first;
+                break;
+            }
+        }
+        return std::make_pair(min_feature_size, median_feature_size);
+    }
+
+    /// @brief Returns the number of elements for the given uniform element size h.
+    /// @param rSettings
+    /// @param ElementSize
+    /// @return Vector3i
+    static Vector3i GetNumberOfElements(const Settings& rSettings, double ElementSize) {
+        const auto& r_grid_settings = rSettings[MainSettings::background_grid_settings];
+        const auto delta = Math::Subtract( r_grid_settings.GetValue<PointType>(BackgroundGridSettings::upper_bound_xyz),
+                                           r_grid_settings.GetValue<PointType>(BackgroundGridSettings::lower_bound_xyz) );
+        Vector3i number_of_elements;
+        for( IndexType k = 0; k < 3; ++k ){
+            number_of_elements[k] = std::max<IndexType>(1, static_cast<IndexType>(std::ceil(std::abs(delta[k]) / ElementSize - 1e-10)));
+        }
+        return number_of_elements;
+    }
+
+    /// @brief Evaluates the grid candidates and proposes the number of elements (see class description).
+    /// @param rTriangleMesh Must be closed.
+    /// @param rSettings Background grid bounds, polynomial order and trimmed quadrature rule settings are used. 'number_of_elements' is ignored.
+    /// @return PlanningResult
+    static PlanningResult Plan(const TriangleMeshInterface& rTriangleMesh, const Settings& rSettings) {
+        const auto& r_grid_settings = rSettings[MainSettings::background_grid_settings];
+        const auto& r_trimmed_settings = rSettings[MainSettings::trimmed_quadrature_rule_settings];
+        const double volume_error_target = r_grid_settings.GetValue<double>(BackgroundGridSettings::grid_planning_volume_error);
+        const double runtime_budget = r_grid_settings.GetValue<double>(BackgroundGridSettings::grid_planning_runtime_budget);
+        const double min_vol_element_ratio = std::max<double>(r_trimmed_settings.GetValue<double>(TrimmedQuadratureRuleSettings::min_element_volume_ratio), 1e-10);
+        const IndexType sample_size = std::max<IndexType>(r_trimmed_settings.GetValue<IndexType>(TrimmedQuadratureRuleSettings::auto_tuning_sample_size), 1);
+        const auto parameters = TunerType::GetParameters(rSettings);
+        const double num_threads = static_cast<double>(omp_get_max_threads());
+
+        PlanningResult result{};
+        const auto [min_feature_size, median_feature_size] = EstimateLocalFeatureSize(rTriangleMesh, NumFeatureSamples);
+        result.min_feature_size = min_feature_size;
+        result.median_feature_size = median_feature_size;
+
+        const double volume = std::abs(MeshUtilities::Volume(rTriangleMesh));
+        QuESo_ERROR_IF(volume < ZEROTOL) << "Volume of triangle mesh is zero.\n";
+
+        // Candidate element sizes.
+        const auto delta = Math::Subtract( r_grid_settings.GetValue<PointType>(BackgroundGridSettings::upper_bound_xyz),
+                                           r_grid_settings.GetValue<PointType>(BackgroundGridSettings::lower_bound_xyz) );
+        const double max_extent = std::max({std::abs(delta[0]), std::abs(delta[1]), std::abs(delta[2])});
+        const double h_max = 0.5*max_extent;
+        const double h_min = std::min(0.5*min_feature_size, h_max);
+        double ratio = std::pow(2.0, -1.0/3.0); // Doubles the number of cells.
+        const double num_steps = std::log(h_min/h_max) / std::log(ratio);
+        if( num_steps > static_cast<double>(MaxNumCandidates-1) ){
+            ratio = std::pow(h_min/h_max, 1.0/static_cast<double>(MaxNumCandidates-1));
+        }
+
+        // Sampled triangles. Their centroids determine the sampled trimmed cells.
+        const IndexType num_triangles = rTriangleMesh.NumOfTriangles();
+        const IndexType num_samples = std::min(sample_size, num_triangles);
+        result.num_sampled_elements = num_samples;
+
+        // Reference for extrapolation: {num_trimmed, cell_size^2, classification time per cell}.
+        double ref_num_trimmed = 0.0;
+        double ref_cell_area = 0.0;
+        double ref_classification_time_per_cell = 0.0;
+
+        std::vector<Vector3i> evaluated{};
+        for( double h = h_max; h >= h_min*(1.0-1e-10) && evaluated.size() < MaxNumCandidates; h *= ratio ){
+            const Vector3i number_of_elements = GetNumberOfElements(rSettings, h);
+            if( std::find(evaluated.begin(), evaluated.end(), number_of_elements) != evaluated.end() ){
+                continue;
+            }
+            evaluated.push_back(number_of_elements);
+
+            Settings candidate_settings = rSettings;
+            candidate_settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::number_of_elements, number_of_elements);
+            const GridIndexer grid_indexer(candidate_settings);
+            const double num_cells = static_cast<double>(number_of_elements[0]*number_of_elements[1]*number_of_elements[2]);
+            const auto cell_box = grid_indexer.GetBoundingBoxXYZFromIndex(0);
+            const PointType cell_delta = Math::Subtract(cell_box.second, cell_box.first);
+            const double cell_volume = cell_delta[0]*cell_delta[1]*cell_delta[2];
+            const double cell_area = std::pow(cell_volume, 2.0/3.0);
+
+            // Each candidate requires its own BRepOperator, since the clipped meshes are cached per cell index.
+            BRepOperator brep_operator(rTriangleMesh, candidate_settings);
+
+            Candidate candidate{};
+            candidate.number_of_elements = number_of_elements;
+            double classification_time = 0.0;
+            if( num_cells <= static_cast<double>(MaxClassifiedCells) ){
+                Timer timer{};
+                const auto p_classifications = brep_operator.pGetElementClassifications(candidate_settings);
+                classification_time = timer.Measure();
+                candidate.num_trimmed_elements = std::count(p_classifications->begin(), p_classifications->end(), IntersectionState::trimmed);
+                ref_num_trimmed = static_cast<double>(candidate.num_trimmed_elements);
+                ref_cell_area = cell_area;
+                ref_classification_time_per_cell = classification_time / num_cells;
+            } else {
+                candidate.is_extrapolated = true;
+                candidate.num_trimmed_elements = static_cast<IndexType>(std::ceil(ref_num_trimmed * ref_cell_area / cell_area));
+                classification_time = ref_classification_time_per_cell * num_cells;
+            }
+
+            // Run pipeline on sampled trimmed cells.
+            double pipeline_time = 0.0;
+            double volume_error = 0.0;
+            #pragma omp parallel for reduction(+ : pipeline_time, volume_error) schedule(dynamic)
+            for( int i = 0; i < static_cast<int>(num_samples); ++i ){
+                const IndexType triangle_id = (static_cast<IndexType>(i)*num_triangles) / num_samples;
+                const IndexType cell_index = GetCellIndex(grid_indexer, candidate_settings, rTriangleMesh.Center(triangle_id));
+                Timer timer{};
+                double cell_volume_quadrature = 0.0;
+                double cell_volume_reference = -1.0;
+                TunerType::RunPipeline(brep_operator, grid_indexer, cell_index, parameters, candidate_settings,
+                    cell_volume_quadrature, cell_volume_reference);
+                pipeline_time += timer.Measure();
+                if( cell_volume_reference >= 0.0 ){
+                    volume_error += std::abs(cell_volume_quadrature - cell_volume_reference);
+                } else {
+                    volume_error += min_vol_element_ratio*cell_volume;
+                }
+            }
+            const double num_trimmed = static_cast<double>(candidate.num_trimmed_elements);
+            candidate.volume_error = (num_samples > 0) ? num_trimmed * (volume_error / num_samples) / volume : 0.0;
+            candidate.runtime = (num_samples > 0) ? num_trimmed * (pipeline_time / num_samples) / num_threads : 0.0;
+            candidate.runtime += classification_time;
+            result.candidates.push_back(candidate);
+
+            // Finer candidates are more expensive.
+            if( runtime_budget > 0.0 && candidate.runtime > runtime_budget ){
+                break;
+            }
+        }
+
+        // Select candidate.
+        const IndexType num_candidates = result.candidates.size();
+        const auto is_within_budget = [runtime_budget](const Candidate& rCandidate){
+            return runtime_budget <= 0.0 || rCandidate.runtime <= runtime_budget;
+        };
+        bool found = false;
+        for( IndexType i = 0; i < num_candidates && !found; ++i ){
+            const auto& r_candidate = result.candidates[i];
+            const double h = max_extent / static_cast<double>(*std::max_element(r_candidate.number_of_elements.begin(),
+                                                                                r_candidate.number_of_elements.end()));
+            if( h <= min_feature_size && r_candidate.volume_error <= volume_error_target && is_within_budget(r_candidate) ){
+                result.selected = i;
+                found = true;
+            }
+        }
+        if( !found ){
+            result.selected = 0;
+            for( IndexType i = 0; i < num_candidates; ++i ){
+                if( is_within_budget(result.candidates[i]) ){
+                    result.selected = i;
+                }
+            }
+        }
+        result.target_met = found;
+
+        return result;
+    }
+
+    /// @brief Writes rResult to rModelInfo (grid_planning_info).
+    /// @param rResult
+    /// @param[out] rModelInfo
+    static void AddToModelInfo(const PlanningResult& rResult, ModelInfo& rModelInfo) {
+        auto& r_info = rModelInfo[MainInfo::grid_planning_info];
+        r_info.SetValue(GridPlanningInfo::min_feature_size, rResult.min_feature_size);
+        r_info.SetValue(GridPlanningInfo::median_feature_size, rResult.median_feature_size);
+        r_info.SetValue(GridPlanningInfo::target_met, rResult.target_met);
+        r_info.SetValue(GridPlanningInfo::num_sampled_elements, rResult.num_sampled_elements);
+        if( !rResult.candidates.empty() ){
+            const auto& r_selected = rResult.candidates[rResult.selected];
+            r_info.SetValue(GridPlanningInfo::proposed_number_of_elements, r_selected.number_of_elements);
+            r_info.SetValue(GridPlanningInfo::predicted_num_trimmed_elements, r_selected.num_trimmed_elements);
+            r_info.SetValue(GridPlanningInfo::predicted_volume_error, r_selected.volume_error);
+            r_info.SetValue(GridPlanningInfo::predicted_runtime, r_selected.runtime);
+        }
+        for( const auto& r_candidate : rResult.candidates ){
+            auto& r_candidate_info = rModelInfo.CreateNewGridPlanningCandidateInfo();
+            r_candidate_info.SetValue(GridPlanningCandidateInfo::number_of_elements, r_candidate.number_of_elements);
+            r_candidate_info.SetValue(GridPlanningCandidateInfo::num_trimmed_elements, r_candidate.num_trimmed_elements);
+            r_candidate_info.SetValue(GridPlanningCandidateInfo::is_extrapolated, r_candidate.is_extrapolated);
+            r_candidate_info.SetValue(GridPlanningCandidateInfo::volume_error, r_candidate.volume_error);
+            r_candidate_info.SetValue(GridPlanningCandidateInfo::runtime, r_candidate.runtime);
+        }
+    }
+
+    ///@}
+private:
+    ///@name Private Operations
+    ///@{
+
+    /// @brief Returns index of the cell that contains rPoint.
+    /// @param rGridIndexer
+    /// @param rSettings
+    /// @param rPoint
+    /// @return IndexType
+    static IndexType GetCellIndex(const GridIndexer& rGridIndexer, const Settings& rSettings, const PointType& rPoint) {
+        const auto& r_grid_settings = rSettings[MainSettings::background_grid_settings];
+        const auto& r_lower_bound = r_grid_settings.GetValue<PointType>(BackgroundGridSettings::lower_bound_xyz);
+        const auto& r_upper_bound = r_grid_settings.GetValue<PointType>(BackgroundGridSettings::upper_bound_xyz);
+        const auto& r_number_of_elements = r_grid_settings.GetValue<Vector3i>(BackgroundGridSettings::number_of_elements);
+        Vector3i indices;
+        for( IndexType k = 0; k < 3; ++k ){
+            const double relative = (rPoint[k] - r_lower_bound[k]) / (r_upper_bound[k] - r_lower_bound[k]);
+            const double index = std::floor(relative * static_cast<double>(r_number_of_elements[k]));
+            indices[k] = static_cast<IndexType>( std::clamp(index, 0.0, static_cast<double>(r_number_of_elements[k]-1)) );
+        }
+        return rGridIndexer.GetVectorIndexFromMatrixIndices(indices);
+    }
+
+    ///@}
+}; // End class BackgroundGridPlanner
+///@} // End QuESo classes
+
+} // End namespace queso
+
+#endif // BACKGROUND_GRID_PLANNER_INCLUDE_HPP
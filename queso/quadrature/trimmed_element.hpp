@@ -19,11 +19,18 @@
 #include <array>
 #include <variant>
 #include <numeric>
+#include <algorithm>
 //// Project includes
 #include "queso/embedding/octree.h"
+#include "queso/embedding/planar_cut_domain.h"
+#include "queso/embedding/clipper.h"
+#include "queso/embedding/brep_operator_2d.h"
 #include "queso/containers/element.hpp"
 #include "queso/containers/boundary_integration_point.hpp"
 #include "queso/utilities/polynomial_utilities.hpp"
+#include "queso/utilities/cpu_dispatch.h"
+#include "queso/quadrature/single_element.hpp"
+#include "queso/quadrature/integration_points_1d/integration_points_factory_1d.h"
 #include "queso/solvers/nnls.h"
 
 namespace queso {
@@ -64,8 +71,12 @@ public:
     ///@param rElement
     ///@param rIntegrationOrder
     ///@param Residual Targeted residual
-    ///@param EchoLevel Default: 0
-    static double AssembleIPs(ElementType& rElement, const Vector3i& rIntegrationOrder, double Residual, IndexType EchoLevel=0) {
+    ///@param Solver NNLS solver used for the moment fitting equation. Default: lawson_hanson.
+    ///@param InitPointDistributionFactor Initial set contains at least InitPointDistributionFactor*(p+1)^3 points. Default: 1.
+    ///@param MaxOctreeRefinementLevel Maximum level of the uniform octree refinement (see: DistributeIntegrationPoints()). Default: 4.
+    ///@return double Achieved residual. Might be larger than Residual. The caller is responsible for reporting (see: Diagnostics).
+    static double AssembleIPs(ElementType& rElement, const Vector3i& rIntegrationOrder, double Residual,
+                              NNLSSolverType Solver=NNLSSolver::lawson_hanson, IndexType InitPointDistributionFactor=1, IndexType MaxOctreeRefinementLevel=4) {
         // Get boundary integration points.
         const auto p_trimmed_domain = rElement.pGetTrimmedDomain();
         const auto p_boundary_ips = p_trimmed_domain->template pGetBoundaryIps<typename TElementType::BoundaryIntegrationPointType>();
@@ -85,7 +96,7 @@ public:
         // Start point elimination.
         double residual = MAXD;
         SizeType iteration = 0UL;
-        SizeType point_distribution_factor = 1;
+        SizeType point_distribution_factor = std::max<IndexType>(InitPointDistributionFactor, 1);
         IntegrationPointVectorType integration_points{};
 
         const IndexType max_iteration = (Math::Max(rIntegrationOrder) == 2) ? 4UL : 3UL;
@@ -94,7 +105,7 @@ public:
 
             // Distribute intial points via an octree.
             const SizeType min_num_points = (rIntegrationOrder[0]+1)*(rIntegrationOrder[1]+1)*(rIntegrationOrder[2]+1)*(point_distribution_factor);
-            DistributeIntegrationPoints(integration_points, octree, min_num_points, rIntegrationOrder);
+            DistributeIntegrationPoints(integration_points, octree, min_num_points, rIntegrationOrder, MaxOctreeRefinementLevel);
 
             // If no point is contained in integration_points -> exit.
             if( integration_points.size() == 0 ){
@@ -108,7 +119,7 @@ public:
             old_integration_points.clear();
 
             // Run point elimination.
-            residual = PointElimination(constant_terms, integration_points, rElement, rIntegrationOrder, Residual);
+            residual = PointElimination(constant_terms, integration_points, rElement, rIntegrationOrder, Residual, Solver);
 
             // If residual is very high, remove all points. Note, elements without points will be neglected.
             if( residual > 1e-2 ) {
@@ -121,17 +132,290 @@ public:
             iteration++;
         }
 
-        if( residual > Residual && EchoLevel > 2){
-            QuESo_INFO << "Warning :: Moment Fitting :: Targeted residual (" << Residual << ") is not achieved for element id: " << rElement.GetId() << ". Residual: " << residual << ".\n";
-            //if( rParam.EchoLevel() > 3 ) {
-            // const std::string filename = "queso_output/residual_not_achieved_id_" + std::to_string(rElement.GetId()) + ".stl";
-            // IO::WriteMeshToSTL(p_trimmed_domain->GetTriangleMesh(), filename.c_str(), true);
-            //}
+        return residual;
+    }
+
+    ///@brief Creates integration points for trimmed domains, which are the intersection of the element with a few half spaces
+    ///       (e.g. cells cut by a single planar facet). See: PlanarCutDomain.
+    ///@details Fast path of AssembleIPs(). Neither an octree (inside tests) nor the refined boundary mesh of the trimmed domain is required:
+    ///         1. Constant terms are integrated exactly over the faces of the polytope (collapsed Gauss rules on the fan triangles).
+    ///         2. Initial points are obtained by mapping a tensor Gauss rule onto each tetrahedron of the polytope (collapsed coordinates).
+    ///            Hence, all points are inside the domain and have positive weights.
+    ///         3. Points are reduced with the same point elimination algorithm as in AssembleIPs().
+    ///@param rElement
+    ///@param rIntegrationOrder
+    ///@param Residual Targeted residual. Also used as admissible relative deviation of the volume of the polytope.
+    ///@param MaxNumPlanes Maximum number of cut planes.
+    ///@param Solver NNLS solver used for the moment fitting equation. Default: lawson_hanson.
+    ///@return double Achieved residual. MAXD, if the trimmed domain is not a planar cut domain. If the targeted residual is not achieved,
+    ///               all integration points of rElement are removed (Use AssembleIPs() as fallback).
+    static double AssembleIPsPlanarCut(ElementType& rElement, const Vector3i& rIntegrationOrder, double Residual, IndexType MaxNumPlanes,
+                                       NNLSSolverType Solver=NNLSSolver::lawson_hanson) {
+        const auto p_trimmed_domain = rElement.pGetTrimmedDomain();
+        const auto& r_bounds_xyz = rElement.GetBoundsXYZ();
+        const auto p_planar_cut_domain = PlanarCutDomain::pCreate(p_trimmed_domain->GetTriangleMesh(), r_bounds_xyz.first, r_bounds_xyz.second,
+                                                                  MaxNumPlanes, Residual);
+        if( !p_planar_cut_domain ){
+            return MAXD;
+        }
+
+        // Integrand of the constant terms is a polynomial of degree (p_u+p_v+p_w+1) on each face.
+        // Collapsed Gauss rules with n points per direction are exact up to degree 2n-2.
+        const IndexType face_degree = rIntegrationOrder[0] + rIntegrationOrder[1] + rIntegrationOrder[2] + 1;
+        const auto& r_face_ips = IntegrationPointFactory1D::GetGauss((face_degree+1)/2, IntegrationMethod::gauss);
+        const auto& r_face_mesh = p_planar_cut_domain->GetTriangleMesh();
+        auto p_boundary_ips = MakeUnique<BoundaryIPsVectorType>();
+        p_boundary_ips->reserve(r_face_mesh.NumOfTriangles()*r_face_ips.size()*r_face_ips.size());
+        for( IndexType triangle_id = 0; triangle_id < r_face_mesh.NumOfTriangles(); ++triangle_id ){
+            const auto& r_p1 = r_face_mesh.P1(triangle_id);
+            const auto edge_1 = Math::Subtract(r_face_mesh.P2(triangle_id), r_p1);
+            const auto edge_2 = Math::Subtract(r_face_mesh.P3(triangle_id), r_face_mesh.P2(triangle_id));
+            const double double_area = 2.0*r_face_mesh.Area(triangle_id);
+            for( const auto& r_s : r_face_ips ){
+                for( const auto& r_t : r_face_ips ){
+                    const PointType point = Math::Add(r_p1, Math::Add(Math::Mult(r_s[0], edge_1), Math::Mult(r_s[0]*r_t[0], edge_2)));
+                    const double weight = r_s[1]*r_t[1]*r_s[0]*double_area;
+                    p_boundary_ips->push_back( BoundaryIntegrationPointType(point[0], point[1], point[2], weight, r_face_mesh.Normal(triangle_id)) );
+                }
+            }
+        }
+        VectorType constant_terms{};
+        ComputeConstantTerms(constant_terms, p_boundary_ips, rElement, rIntegrationOrder);
+
+        // Initial points: Tensor Gauss rule mapped onto each tetrahedron via collapsed coordinates:
+        // x = x_0 + u*(x_1-x_0) + u*v*(x_2-x_1) + u*v*w*(x_3-x_2), with det(J) = 6*V*u^2*v.
+        const auto& r_volume_ips = IntegrationPointFactory1D::GetGauss(Math::Max(rIntegrationOrder), IntegrationMethod::gauss);
+        const double det_j = rElement.DetJ();
+        const auto& r_tetrahedra = p_planar_cut_domain->GetTetrahedra();
+        IntegrationPointVectorType integration_points{};
+        integration_points.reserve(r_tetrahedra.size()*r_volume_ips.size()*r_volume_ips.size()*r_volume_ips.size());
+        for( const auto& r_tetrahedron : r_tetrahedra ){
+            const double six_volume = 6.0*PlanarCutDomain::Volume(r_tetrahedron);
+            const auto edge_1 = Math::Subtract(r_tetrahedron[1], r_tetrahedron[0]);
+            const auto edge_2 = Math::Subtract(r_tetrahedron[2], r_tetrahedron[1]);
+            const auto edge_3 = Math::Subtract(r_tetrahedron[3], r_tetrahedron[2]);
+            for( const auto& r_u : r_volume_ips ){
+                for( const auto& r_v : r_volume_ips ){
+                    for( const auto& r_w : r_volume_ips ){
+                        const double u = r_u[0];
+                        const double uv = u*r_v[0];
+                        const double uvw = uv*r_w[0];
+                        const PointType point_global = Math::Add(r_tetrahedron[0],
+                            Math::Add(Math::Mult(u, edge_1), Math::Add(Math::Mult(uv, edge_2), Math::Mult(uvw, edge_3))));
+                        const PointType point = rElement.PointFromGlobalToParam(point_global);
+                        const double weight = r_u[1]*r_v[1]*r_w[1]*six_volume*u*uv / det_j;
+                        integration_points.push_back( IntegrationPointType(point[0], point[1], point[2], weight) );
+                    }
+                }
+            }
+        }
+
+        // Run point elimination.
+        rElement.GetIntegrationPoints().clear();
+        const double residual = PointElimination(constant_terms, integration_points, rElement, rIntegrationOrder, Residual, Solver);
+        if( residual > Residual ){
+            rElement.GetIntegrationPoints().clear();
+        }
+
+        return residual;
+    }
+
+    ///@brief Creates integration points for planar trimmed domains (see: BRepOperator2D). The trimmed domain is the prism that is spanned by
+    ///       the boundary loops in the xy-plane and the z-range of the element. Hence, all moments are constant in z-direction and
+    ///       rIntegrationOrder[2] is ignored.
+    ///@details Planar form of AssembleIPs():
+    ///         1. Constant terms are computed via line integrals along the boundary loops (see: ComputeConstantTerms2D()).
+    ///         2. Initial points are the Gauss points of a uniform subdivision of the element, which are inside the boundary loops.
+    ///         3. Points are reduced with the same point elimination algorithm as in AssembleIPs().
+    ///         All points are located at the center of the element in z-direction.
+    ///@param rElement
+    ///@param rBoundaryLoops Closed boundary loops of the trimmed domain (see: BRepOperator2D::pGetTrimmedDomain()).
+    ///@param rIntegrationOrder
+    ///@param Residual Targeted residual
+    ///@param Solver NNLS solver used for the moment fitting equation. Default: lawson_hanson.
+    ///@param InitPointDistributionFactor Initial set contains at least InitPointDistributionFactor*(p+1)^2 points. Default: 1.
+    ///@param MaxRefinementLevel Maximum level of the uniform subdivision (see: DistributeIntegrationPoints2D()). Default: 4.
+    ///@return double Achieved residual. Might be larger than Residual. The caller is responsible for reporting (see: Diagnostics).
+    static double AssembleIPs2D(ElementType& rElement, const BRepOperator2D::PolylineVectorType& rBoundaryLoops, const Vector3i& rIntegrationOrder,
+                                double Residual, NNLSSolverType Solver=NNLSSolver::lawson_hanson, IndexType InitPointDistributionFactor=1, IndexType MaxRefinementLevel=4) {
+        const Vector3i integration_order{rIntegrationOrder[0], rIntegrationOrder[1], 0};
+
+        // Get constant terms.
+        VectorType constant_terms{};
+        ComputeConstantTerms2D(constant_terms, rBoundaryLoops, rElement, integration_order);
+
+        // Start point elimination.
+        double residual = MAXD;
+        SizeType iteration = 0UL;
+        SizeType point_distribution_factor = std::max<IndexType>(InitPointDistributionFactor, 1);
+        IntegrationPointVectorType integration_points{};
+
+        const IndexType max_iteration = (Math::Max(integration_order) == 2) ? 4UL : 3UL;
+        // If residual can not be statisfied, try with more points in initial set.
+        while( residual > Residual && iteration < max_iteration){
+
+            // Distribute intial points on a uniform subdivision of the element.
+            const SizeType min_num_points = (integration_order[0]+1)*(integration_order[1]+1)*(point_distribution_factor);
+            DistributeIntegrationPoints2D(integration_points, rBoundaryLoops, rElement, min_num_points, integration_order, MaxRefinementLevel);
+
+            // If no point is contained in integration_points -> exit.
+            if( integration_points.size() == 0 ){
+                rElement.GetIntegrationPoints().clear();
+                return 1;
+            }
+
+            // Also add old, moment fitted points to new set. 'old_integration_points' only contains points with weights > 0.0;
+            auto& old_integration_points = rElement.GetIntegrationPoints();
+            integration_points.insert(integration_points.end(), old_integration_points.begin(), old_integration_points.end() );
+            old_integration_points.clear();
+
+            // Run point elimination.
+            residual = PointElimination(constant_terms, integration_points, rElement, integration_order, Residual, Solver);
+
+            // If residual is very high, remove all points. Note, elements without points will be neglected.
+            if( residual > 1e-2 ) {
+                rElement.GetIntegrationPoints().clear();
+            }
+
+            // Update variables.
+            point_distribution_factor *= 2;
+            iteration++;
+        }
+
+        return residual;
+    }
+
+    ///@brief Creates integration points for a trimmed element from the quadrature rules of its children (hierarchical moment aggregation).
+    ///       The children subdivide rElement, e.g., on the next finer level of a multigrid hierarchy. Since the constant terms are additive,
+    ///       they are obtained by integrating the Legendre polynomials of rElement with the quadrature rules of the children. Hence, no
+    ///       geometrical operations are required.
+    ///@details 1. Collects the points of all children: Moment fitted points of trimmed children, Gauss points (p+1) of non-trimmed children.
+    ///         2. Computes constant terms from these points (see: ComputeConstantTerms()).
+    ///         3. Reduces the collected points with the same point elimination algorithm as in AssembleIPs().
+    ///@param rElement
+    ///@param rChildren Active children of rElement. Inactive children do not contribute.
+    ///@param rIntegrationOrder Must not be larger than the order of the quadrature rules of the trimmed children.
+    ///@param Residual Targeted residual
+    ///@param Solver NNLS solver used for the moment fitting equation. Default: lawson_hanson.
+    ///@return double Achieved residual. Might be larger than Residual.
+    static double AssembleIPsFromChildren(ElementType& rElement, const std::vector<const ElementType*>& rChildren, const Vector3i& rIntegrationOrder,
+                                          double Residual, NNLSSolverType Solver=NNLSSolver::lawson_hanson) {
+        // Collect points of children in the parametric space of rElement. Weights are given in physical space.
+        auto p_integration_points = MakeUnique<IntegrationPointVectorType>();
+        IntegrationPointVectorType child_points{};
+        for( const auto p_child : rChildren ){
+            if( p_child->IsTrimmed() ){
+                child_points = p_child->GetIntegrationPoints();
+            } else {
+                const auto& r_bounds_uvw = p_child->GetBoundsUVW();
+                QuadratureSingleElement<ElementType>::AssembleIPs(child_points, r_bounds_uvw.first, r_bounds_uvw.second, rIntegrationOrder);
+            }
+            const double det_j = p_child->DetJ();
+            for( auto& r_point : child_points ){
+                const PointType point_param = rElement.PointFromGlobalToParam( p_child->PointFromParamToGlobal(r_point.data()) );
+                p_integration_points->push_back( IntegrationPointType(point_param, r_point.Weight()*det_j) );
+            }
+        }
+
+        // If no point is contained in integration_points -> exit.
+        rElement.GetIntegrationPoints().clear();
+        if( p_integration_points->size() == 0 ){
+            return 1;
+        }
+
+        // Get constant terms.
+        VectorType constant_terms{};
+        ComputeConstantTerms(constant_terms, p_integration_points, rElement, rIntegrationOrder);
+
+        // Run point elimination.
+        const double residual = PointElimination(constant_terms, *p_integration_points, rElement, rIntegrationOrder, Residual, Solver);
+
+        // If residual is very high, remove all points. Note, elements without points will be neglected.
+        if( residual > 1e-2 ) {
+            rElement.GetIntegrationPoints().clear();
         }
 
         return residual;
     }
 
+    ///@brief Verifies the final quadrature rule of a trimmed element. Integrates the Legendre polynomials up to rTestOrder with the integration points
+    ///       of rElement and compares the results to the reference moments obtained from the boundary integration points of the trimmed domain
+    ///       (see: ComputeConstantTerms()). Typically, rTestOrder is chosen one order higher than the order of the quadrature rule.
+    ///@param rElement Trimmed element. Trimmed domain must be set.
+    ///@param rTestOrder Order of test polynomials.
+    ///@return double Relative error ||m_quad - m_ref||_L2 / ||m_ref||_L2.
+    static double ComputeMomentError(const ElementType& rElement, const Vector3i& rTestOrder) {
+        // Reference moments via divergence theorem.
+        const auto p_boundary_ips = rElement.pGetTrimmedDomain()->template pGetBoundaryIps<BoundaryIntegrationPointType>();
+        VectorType reference_moments{};
+        ComputeConstantTerms(reference_moments, p_boundary_ips, rElement, rTestOrder);
+
+        // Moments integrated by the quadrature rule.
+        const auto p_integration_points = MakeUnique<IntegrationPointVectorType>(rElement.GetIntegrationPoints());
+        VectorType moments{};
+        ComputeConstantTerms(moments, p_integration_points, rElement, rTestOrder);
+
+        // Weights are divided by det_jacobian (see: MomentFitting()).
+        const double jacobian = rElement.DetJ();
+        double squared_error = 0.0;
+        double squared_norm = 0.0;
+        for( IndexType i = 0; i < reference_moments.size(); ++i ){
+            const double difference = moments[i]*jacobian - reference_moments[i];
+            squared_error += difference*difference;
+            squared_norm += reference_moments[i]*reference_moments[i];
+        }
+
+        return (squared_norm > 0.0) ? std::sqrt(squared_error / squared_norm) : std::sqrt(squared_error);
+    }
+
+    ///@brief Computes the derivatives of the integration weights of rElement with respect to the vertex positions of rTriangleMesh and
+    ///       stores them in rElement (see: ShapeSensitivities). Must be called after AssembleIPs() or AssembleIPsPlanarCut().
+    ///@details The points are kept fixed. The weights solve the moment fitting equation A*w = b in the least-squares sense on the active set
+    ///         (all points with positive weights). Hence, the implicit derivative reads: dw = (A^T*A)^-1 * A^T * db.
+    ///         The derivatives db of the constant terms are given by ComputeConstantTermSensitivities().
+    ///@param rElement Trimmed element.
+    ///@param rIntegrationOrder
+    ///@param rTriangleMesh Triangle mesh of the embedded geometry.
+    ///@param rTriangleIds Ids of all triangles that intersect rElement.
+    static void ComputeShapeSensitivities(ElementType& rElement, const Vector3i& rIntegrationOrder, const TriangleMeshInterface& rTriangleMesh,
+                                          const std::vector<IndexType>& rTriangleIds) {
+        const auto& r_points = rElement.GetIntegrationPoints();
+        const IndexType num_points = r_points.size();
+
+        std::vector<IndexType> vertex_ids{};
+        VectorType constant_term_derivatives{};
+        ComputeConstantTermSensitivities(vertex_ids, constant_term_derivatives, rElement, rIntegrationOrder, rTriangleMesh, rTriangleIds);
+        const IndexType num_vertices = vertex_ids.size();
+
+        std::vector<double> derivatives(num_vertices*num_points*3, 0.0);
+        if( num_points > 0 && num_vertices > 0 ){
+            NNLS::MatrixType fitting_matrix{};
+            AssembleMomentFittingMatrix(fitting_matrix, r_points, rElement, rIntegrationOrder);
+            const IndexType number_of_functions = fitting_matrix.size() / num_points;
+            std::vector<double> L{};
+            FactorizeNormalMatrix(fitting_matrix, num_points, L);
+
+            // Weights are divided by det_jacobian (see: MomentFitting()).
+            const double jacobian = rElement.DetJ();
+            VectorType rhs(num_points);
+            for( IndexType i = 0; i < num_vertices; ++i ){
+                for( IndexType dir = 0; dir < 3; ++dir ){
+                    const auto db_begin = constant_term_derivatives.begin() + (i*3 + dir)*number_of_functions;
+                    for( IndexType j = 0; j < num_points; ++j ){
+                        rhs[j] = std::inner_product(db_begin, db_begin+number_of_functions, fitting_matrix.begin()+j*number_of_functions, 0.0);
+                    }
+                    SolveNormalEquations(L, num_points, rhs);
+                    for( IndexType j = 0; j < num_points; ++j ){
+                        derivatives[(i*num_points + j)*3 + dir] = rhs[j] / jacobian;
+                    }
+                }
+            }
+        }
+
+        auto p_shape_sensitivities = MakeUnique<ShapeSensitivities>(std::move(vertex_ids), std::move(derivatives), num_points);
+        rElement.pSetShapeSensitivities(p_shape_sensitivities);
+    }
+
     ///@}
 protected:
     ///@name Protected Operations
@@ -144,12 +428,14 @@ protected:
     /// @param rOctree
     /// @param MinNumPoints Minimum Number of Points
     /// @param rIntegrationOrder Order of Gauss quadrature.
-    static void DistributeIntegrationPoints(IntegrationPointVectorType& rIntegrationPoint, Octree<TrimmedDomain>& rOctree, SizeType MinNumPoints, const Vector3i& rIntegrationOrder) {
+    /// @param MaxOctreeRefinementLevel Uniform refinement is capped at this level. At most MaxOctreeRefinementLevel+1 refinement steps are performed. Default: 4.
+    static void DistributeIntegrationPoints(IntegrationPointVectorType& rIntegrationPoint, Octree<TrimmedDomain>& rOctree, SizeType MinNumPoints, const Vector3i& rIntegrationOrder,
+                                            IndexType MaxOctreeRefinementLevel=4) {
         IndexType refinemen_level = rOctree.MaxRefinementLevel()+1;
-        const IndexType max_iteration = 5UL;
+        const IndexType max_iteration = MaxOctreeRefinementLevel+1;
         IndexType iteration = 0UL;
         while( rIntegrationPoint.size() < MinNumPoints && iteration < max_iteration){
-            rOctree.Refine(std::min<IndexType>(refinemen_level, 4UL), refinemen_level);
+            rOctree.Refine(std::min<IndexType>(refinemen_level, MaxOctreeRefinementLevel), refinemen_level);
             rIntegrationPoint.clear();
             rOctree.template AddIntegrationPoints<TElementType>(rIntegrationPoint, rIntegrationOrder);
             refinemen_level++;
@@ -157,6 +443,118 @@ protected:
         }
     }
 
+    /// @brief Distributes points within a planar trimmed domain. The element is uniformly subdivided in x- and y-direction. In each cell, Gauss points
+    ///        according to rIntegrationOrder are generated. Only points inside rBoundaryLoops are considered. The subdivision is refined, until at least
+    ///        MinNumPoints are found.
+    /// @param[out] rIntegrationPoint
+    /// @param rBoundaryLoops
+    /// @param rElement
+    /// @param MinNumPoints Minimum Number of Points
+    /// @param rIntegrationOrder Order of Gauss quadrature.
+    /// @param MaxRefinementLevel At most 2^MaxRefinementLevel cells per direction are used.
+    static void DistributeIntegrationPoints2D(IntegrationPointVectorType& rIntegrationPoint, const BRepOperator2D::PolylineVectorType& rBoundaryLoops,
+                                              const ElementType& rElement, SizeType MinNumPoints, const Vector3i& rIntegrationOrder, IndexType MaxRefinementLevel=4) {
+        const auto& r_bounds_xyz = rElement.GetBoundsXYZ();
+        const auto& r_ip_list_u = IntegrationPointFactory1D::GetGauss(rIntegrationOrder[0], IntegrationMethod::gauss);
+        const auto& r_ip_list_v = IntegrationPointFactory1D::GetGauss(rIntegrationOrder[1], IntegrationMethod::gauss);
+        const double z = 0.5*(r_bounds_xyz.first[2] + r_bounds_xyz.second[2]);
+        const double det_j = rElement.DetJ();
+
+        const IndexType max_num_cells = static_cast<IndexType>(1) << MaxRefinementLevel;
+        for( IndexType num_cells = 1; num_cells <= max_num_cells; num_cells *= 2 ){
+            rIntegrationPoint.clear();
+            const double delta_x = (r_bounds_xyz.second[0] - r_bounds_xyz.first[0]) / static_cast<double>(num_cells);
+            const double delta_y = (r_bounds_xyz.second[1] - r_bounds_xyz.first[1]) / static_cast<double>(num_cells);
+            const double volume = delta_x*delta_y*(r_bounds_xyz.second[2] - r_bounds_xyz.first[2]);
+            for( IndexType i = 0; i < num_cells; ++i ){
+                for( IndexType j = 0; j < num_cells; ++j ){
+                    for( const auto& r_u : r_ip_list_u ){
+                        for( const auto& r_v : r_ip_list_v ){
+                            const PointType point_global{ r_bounds_xyz.first[0] + (static_cast<double>(i) + r_u[0])*delta_x,
+                                                          r_bounds_xyz.first[1] + (static_cast<double>(j) + r_v[0])*delta_y, z };
+                            if( BRepOperator2D::WindingNumber(point_global, rBoundaryLoops) != 0 ){
+                                const PointType point = rElement.PointFromGlobalToParam(point_global);
+                                rIntegrationPoint.push_back( IntegrationPointType(point[0], point[1], point[2], r_u[1]*r_v[1]*volume/det_j) );
+                            }
+                        }
+                    }
+                }
+            }
+            if( rIntegrationPoint.size() >= MinNumPoints ){
+                break;
+            }
+        }
+    }
+
+    /// @brief Computes constant terms of moment fitting equation for planar trimmed domains via line integrals along rBoundaryLoops.
+    ///        Green's theorem: int_A f dA = 1/2 * int_C (F_x*n_x + F_y*n_y) ds with dF_x/dx = dF_y/dy = f. For each segment of the loops: n*ds = (dy, -dx)*dt.
+    ///        The result is multiplied by the integral in z-direction, which is constant, since only the zeroth order is considered in z-direction.
+    /// @param[out] rConstantTerms
+    /// @param rBoundaryLoops Closed, consistently oriented loops (see: BRepOperator2D).
+    /// @param rElement
+    /// @param rIntegrationOrder rIntegrationOrder[2] must be zero.
+    static void ComputeConstantTerms2D(VectorType& rConstantTerms, const BRepOperator2D::PolylineVectorType& rBoundaryLoops, const ElementType& rElement,
+                                       const Vector3i& rIntegrationOrder) {
+        QuESo_ASSERT( rIntegrationOrder[2] == 0, "Integration order in z-direction must be zero." );
+        // Constant terms / moments are evaluated in physical space.
+        const auto bounds_xyz = rElement.GetBoundsXYZ();
+        const PointType& a = bounds_xyz.first;
+        const PointType& b = bounds_xyz.second;
+
+        const IndexType order_u = rIntegrationOrder[0];
+        const IndexType order_v = rIntegrationOrder[1];
+        const IndexType number_of_functions = (order_u + 1) * (order_v + 1);
+
+        // Resize constant terms.
+        rConstantTerms.resize(number_of_functions, false);
+        std::fill( rConstantTerms.begin(),rConstantTerms.end(), 0.0);
+
+        // The integrand is a polynomial of degree (p_u+p_v+1) along each segment. Gauss rules with n points are exact up to degree 2n-1.
+        const auto& r_line_ips = IntegrationPointFactory1D::GetGauss((order_u+order_v+1)/2, IntegrationMethod::gauss);
+        const double z = 0.5*(a[2] + b[2]);
+        std::vector<PointType> points{};
+        std::vector<PointType> weighted_normals{};
+        for( const auto& r_loop : rBoundaryLoops ){
+            const IndexType num_vertices = r_loop.size();
+            for( IndexType i = 0; i < num_vertices; ++i ){
+                const auto& r_p1 = r_loop[i];
+                const auto& r_p2 = r_loop[(i+1) % num_vertices];
+                const double dx = r_p2[0] - r_p1[0];
+                const double dy = r_p2[1] - r_p1[1];
+                for( const auto& r_t : r_line_ips ){
+                    points.push_back( {r_p1[0] + r_t[0]*dx, r_p1[1] + r_t[0]*dy, z} );
+                    weighted_normals.push_back( {r_t[1]*dy, -r_t[1]*dx, 0.0} );
+                }
+            }
+        }
+
+        // Note: The evaluation of polynomials is expensive. Therefore, precompute and store values
+        // for f_x and f_x_int at all points.
+        const IndexType number_of_points = points.size();
+        std::array<std::vector<double>, 3> f_x_values;
+        std::array<std::vector<double>, 3> f_x_int_values;
+        EvaluateLegendreTables(points.begin(), number_of_points, a, b, rIntegrationOrder, f_x_values, &f_x_int_values);
+
+        // Loop over all boundary integration points.
+        const double thickness = b[2] - a[2];
+        for( IndexType i = 0; i < number_of_points; ++i ){
+            const auto& r_normal = weighted_normals[i];
+            const double weight = 0.5*thickness*f_x_values[2][i];
+            IndexType row_index = 0;
+            for( IndexType i_x = 0; i_x <= order_u; ++i_x){
+                const double f_x_x = f_x_values[0][i_x*number_of_points + i];
+                const double f_x_int_x = f_x_int_values[0][i_x*number_of_points + i];
+                for( IndexType i_y = 0; i_y <= order_v; ++i_y ){
+                    const double f_x_y = f_x_values[1][i_y*number_of_points + i];
+                    const double f_x_int_y = f_x_int_values[1][i_y*number_of_points + i];
+                    const double integrand = r_normal[0]*f_x_int_x*f_x_y + r_normal[1]*f_x_x*f_x_int_y;
+                    rConstantTerms[row_index] += integrand * weight;
+                    row_index++;
+                }
+            }
+        }
+    }
+
     /// @brief Computes constant terms of moment fitting equation via volume integration points.
     /// @param[out] rConstantTerms
     /// @param pIntegrationPoints (Unique<T>)
@@ -178,22 +576,27 @@ protected:
         rConstantTerms.resize(number_of_functions, false);
         std::fill( rConstantTerms.begin(),rConstantTerms.end(), 0.0);
 
-        // Loop over all boundary integration points.
+        // Note: The evaluation of polynomials is expensive. Therefore, precompute and store values for all points.
+        const IndexType number_of_points = pIntegrationPoints->size();
+        std::array<std::vector<double>, 3> f_x_values;
+        EvaluateLegendreTables(pIntegrationPoints->begin(), number_of_points, a, b, rIntegrationOrder, f_x_values);
+
+        // Loop over all integration points.
         IndexType row_index = 0UL;
         const auto begin_points_it = pIntegrationPoints->begin();
-        for( IndexType i = 0; i < pIntegrationPoints->size(); ++i ){
+        for( IndexType i = 0; i < number_of_points; ++i ){
             // Get iterator
             auto point_it = (begin_points_it + i);
             // For all functions
             row_index = 0;
             const double weight = point_it->Weight();
             for( IndexType i_x = 0; i_x <= order_u*ffactor; ++i_x){
+                const double f_x_x = f_x_values[0][i_x*number_of_points + i];
                 for( IndexType i_y = 0; i_y <= order_v*ffactor; ++i_y ){
+                    const double f_x_y = f_x_values[1][i_y*number_of_points + i];
                     for( IndexType i_z = 0; i_z <= order_w*ffactor; ++i_z){
                         // Assemble RHS
-                        const double value = Polynomial::f_x(point_it->X(), i_x, a[0], b[0])
-                            * Polynomial::f_x(point_it->Y(), i_y, a[1], b[1])
-                            * Polynomial::f_x(point_it->Z(), i_z, a[2], b[2]);
+                        const double value = f_x_x * f_x_y * f_x_values[2][i_z*number_of_points + i];
                         rConstantTerms[row_index] += value * weight;
                         row_index++;
                     }
@@ -227,54 +630,37 @@ protected:
         rConstantTerms.resize(number_of_functions, false);
         std::fill( rConstantTerms.begin(),rConstantTerms.end(), 0.0);
 
-        /// Initialize containers for f_x and f_x_int
-        // X-direction
-        std::vector<double> f_x_x(order_u*ffactor+1);
-        std::vector<double> f_x_int_x(order_u*ffactor+1);
-        // Y-direction
-        std::vector<double> f_x_y(order_v*ffactor+1);
-        std::vector<double> f_x_int_y(order_v*ffactor+1);
-        // Z-direction
-        std::vector<double> f_x_z(order_w*ffactor+1);
-        std::vector<double> f_x_int_z(order_w*ffactor+1);
+        // Note: The evaluation of polynomials is expensive. Therefore, precompute and store values
+        // for f_x and f_x_int at all points.
+        const IndexType number_of_points = pBoundaryIPs->size();
+        std::array<std::vector<double>, 3> f_x_values;
+        std::array<std::vector<double>, 3> f_x_int_values;
+        EvaluateLegendreTables(pBoundaryIPs->begin(), number_of_points, a, b, rIntegrationOrder, f_x_values, &f_x_int_values);
 
         // Loop over all boundary integration points.
         IndexType row_index = 0;
         const auto begin_points_it_ptr = pBoundaryIPs->begin();
-        for( IndexType i = 0; i < pBoundaryIPs->size(); ++i ){
-            // Note: The evaluation of polynomials is expensive. Therefore, precompute and store values
-            // for f_x_x and f_x_int at each point.
+        for( IndexType i = 0; i < number_of_points; ++i ){
             auto point_it = (begin_points_it_ptr + i);
             const auto& normal = point_it->Normal();
-            PointType point = point_it->data();
-
-            // X-Direction
-            for( IndexType i_x = 0; i_x <= order_u*ffactor; ++i_x){
-                f_x_x[i_x] = Polynomial::f_x(point[0], i_x, a[0], b[0]);
-                f_x_int_x[i_x] = Polynomial::f_x_int(point[0], i_x, a[0], b[0]);
-            }
-            // Y-Direction
-            for( IndexType i_y = 0; i_y <= order_v*ffactor; ++i_y){
-                f_x_y[i_y] = Polynomial::f_x(point[1], i_y, a[1], b[1]);
-                f_x_int_y[i_y] = Polynomial::f_x_int(point[1], i_y, a[1], b[1]);
-            }
-            // Z-Direction
-            for( IndexType i_z = 0; i_z <= order_w*ffactor; ++i_z){
-                f_x_z[i_z] = Polynomial::f_x(point[2], i_z, a[2], b[2]);
-                f_x_int_z[i_z] = Polynomial::f_x_int(point[2], i_z, a[2], b[2]);
-            }
 
             // Assembly RHS
             row_index = 0;
             const double weight = 1.0/3.0*point_it->Weight();
             for( IndexType i_x = 0; i_x <= order_u*ffactor; ++i_x){
+                const double f_x_x = f_x_values[0][i_x*number_of_points + i];
+                const double f_x_int_x = f_x_int_values[0][i_x*number_of_points + i];
                 for( IndexType i_y = 0; i_y <= order_v*ffactor; ++i_y ){
+                    const double f_x_y = f_x_values[1][i_y*number_of_points + i];
+                    const double f_x_int_y = f_x_int_values[1][i_y*number_of_points + i];
                     for( IndexType i_z = 0; i_z <= order_w*ffactor; ++i_z){
+                        const double f_x_z = f_x_values[2][i_z*number_of_points + i];
+                        const double f_x_int_z = f_x_int_values[2][i_z*number_of_points + i];
                         // Compute normal for each face/triangle.
                         PointType value;
-                        value[0] = f_x_int_x[i_x]*f_x_y[i_y]*f_x_z[i_z];
-                        value[1] = f_x_x[i_x]*f_x_int_y[i_y]*f_x_z[i_z];
-                        value[2] = f_x_x[i_x]*f_x_y[i_y]*f_x_int_z[i_z];
+                        value[0] = f_x_int_x*f_x_y*f_x_z;
+                        value[1] = f_x_x*f_x_int_y*f_x_z;
+                        value[2] = f_x_x*f_x_y*f_x_int_z;
 
                         double integrand = normal[0]*value[0] + normal[1]*value[1] + normal[2]*value[2];
                         rConstantTerms[row_index] += integrand * weight;
@@ -285,19 +671,124 @@ protected:
         }
     }
 
-    /// @brief Set-Up and solve moment fitting equation. Solve the moment fitting equation for the weights of the integration points.
-    ///        Computed weights are directly assigned to rIntegrationPoint.
-    /// @param rConstantTerms
-    /// @param[out] rIntegrationPoint
+    /// @brief Computes the derivatives of the constant terms (see: ComputeConstantTerms()) with respect to the vertex positions of rTriangleMesh.
+    ///        Since b_k = int_Omega f_k dV, the shape derivative reads: db_k/dx_v = int_Gamma f_k * N_v * n dA, where Gamma is the part of the
+    ///        surface within the element and N_v is the linear hat function of vertex v. The triangles are clipped by the element and the integrand
+    ///        is integrated exactly with collapsed Gauss rules on the clipped polygons.
+    /// @param[out] rVertexIds Ids of all vertices of the triangles in rTriangleIds (sorted in ascending order).
+    /// @param[out] rDerivatives db_k/dx_(v,d) is stored at rDerivatives[(i*3 + d)*number_of_functions + k], with rVertexIds[i] = v.
     /// @param rElement
     /// @param rIntegrationOrder
-    /// @return double Relative residual ||ax -b||_L2 / ||b||_L2
-    static double MomentFitting(const VectorType& rConstantTerms, IntegrationPointVectorType& rIntegrationPoint, const ElementType& rElement, const Vector3i& rIntegrationOrder) {
+    /// @param rTriangleMesh Triangle mesh of the embedded geometry.
+    /// @param rTriangleIds Ids of all triangles that intersect rElement.
+    static void ComputeConstantTermSensitivities(std::vector<IndexType>& rVertexIds, VectorType& rDerivatives, const ElementType& rElement,
+            const Vector3i& rIntegrationOrder, const TriangleMeshInterface& rTriangleMesh, const std::vector<IndexType>& rTriangleIds) {
+        // Constant terms / moments are evaluated in physical space.
+        const auto& r_bounds_xyz = rElement.GetBoundsXYZ();
+        const PointType& a = r_bounds_xyz.first;
+        const PointType& b = r_bounds_xyz.second;
+
+        const IndexType order_u = rIntegrationOrder[0];
+        const IndexType order_v = rIntegrationOrder[1];
+        const IndexType order_w = rIntegrationOrder[2];
+        const IndexType number_of_functions = (order_u + 1) * (order_v + 1) * (order_w + 1);
+
+        rVertexIds.clear();
+        rVertexIds.reserve(3*rTriangleIds.size());
+        for( const IndexType triangle_id : rTriangleIds ){
+            const auto& r_vertex_ids = rTriangleMesh.VertexIds(triangle_id);
+            rVertexIds.insert(rVertexIds.end(), r_vertex_ids.begin(), r_vertex_ids.end());
+        }
+        std::sort(rVertexIds.begin(), rVertexIds.end());
+        rVertexIds.erase(std::unique(rVertexIds.begin(), rVertexIds.end()), rVertexIds.end());
+        rDerivatives.assign(rVertexIds.size()*3*number_of_functions, 0.0);
+
+        // Integrand f_k*N_v is a polynomial of degree (p_u+p_v+p_w+1) on each triangle (see: AssembleIPsPlanarCut()).
+        const IndexType face_degree = order_u + order_v + order_w + 1;
+        const auto& r_face_ips = IntegrationPointFactory1D::GetGauss((face_degree+1)/2, IntegrationMethod::gauss);
+
+        std::vector<PointType> points{};
+        std::vector<PointType> weighted_hat_functions{};
+        std::array<std::vector<double>, 3> f_x_values;
+        std::vector<double> integrals(3*number_of_functions);
+        for( const IndexType triangle_id : rTriangleIds ){
+            const auto& r_p1 = rTriangleMesh.P1(triangle_id);
+            const auto& r_p2 = rTriangleMesh.P2(triangle_id);
+            const auto& r_p3 = rTriangleMesh.P3(triangle_id);
+            const auto& r_normal = rTriangleMesh.Normal(triangle_id);
+            const auto orthogonal = Math::Cross(Math::Subtract(r_p2, r_p1), Math::Subtract(r_p3, r_p1));
+            const double double_area_2 = Math::Dot(orthogonal, orthogonal);
+            if( double_area_2 <= 0.0 ){
+                continue;
+            }
+            auto p_polygon = Clipper::ClipTriangle(r_p1, r_p2, r_p3, r_normal, a, b);
+            if( !p_polygon ){
+                continue;
+            }
+
+            // Points on the fan triangles of the (convex) polygon. Hat functions are the barycentric coordinates w.r.t. the original triangle.
+            points.clear();
+            weighted_hat_functions.clear();
+            const auto& r_q0 = p_polygon->GetVertex(0).first;
+            for( IndexType j = 1; j+1 < p_polygon->NumVertices(); ++j ){
+                const auto edge_1 = Math::Subtract(p_polygon->GetVertex(j).first, r_q0);
+                const auto edge_2 = Math::Subtract(p_polygon->GetVertex(j+1).first, p_polygon->GetVertex(j).first);
+                const double fan_double_area = Math::Norm(Math::Cross(edge_1, edge_2));
+                for( const auto& r_s : r_face_ips ){
+                    for( const auto& r_t : r_face_ips ){
+                        const PointType point = Math::Add(r_q0, Math::Add(Math::Mult(r_s[0], edge_1), Math::Mult(r_s[0]*r_t[0], edge_2)));
+                        const double weight = r_s[1]*r_t[1]*r_s[0]*fan_double_area;
+                        const double n_1 = Math::Dot(Math::Cross(Math::Subtract(r_p2, point), Math::Subtract(r_p3, point)), orthogonal) / double_area_2;
+                        const double n_2 = Math::Dot(Math::Cross(Math::Subtract(r_p3, point), Math::Subtract(r_p1, point)), orthogonal) / double_area_2;
+                        points.push_back(point);
+                        weighted_hat_functions.push_back( PointType{weight*n_1, weight*n_2, weight*(1.0-n_1-n_2)} );
+                    }
+                }
+            }
 
-        PointType a = rElement.GetBoundsUVW().first;
-        PointType b = rElement.GetBoundsUVW().second;
+            // integrals[l*number_of_functions + k] = int f_k * N_l dA, with l = local vertex index of triangle.
+            const IndexType number_of_points = points.size();
+            EvaluateLegendreTables(points.begin(), number_of_points, a, b, rIntegrationOrder, f_x_values);
+            std::fill(integrals.begin(), integrals.end(), 0.0);
+            for( IndexType i = 0; i < number_of_points; ++i ){
+                IndexType row_index = 0;
+                for( IndexType i_x = 0; i_x <= order_u; ++i_x){
+                    const double f_x_x = f_x_values[0][i_x*number_of_points + i];
+                    for( IndexType i_y = 0; i_y <= order_v; ++i_y ){
+                        const double f_x_xy = f_x_x*f_x_values[1][i_y*number_of_points + i];
+                        for( IndexType i_z = 0; i_z <= order_w; ++i_z){
+                            const double value = f_x_xy*f_x_values[2][i_z*number_of_points + i];
+                            for( IndexType l = 0; l < 3; ++l ){
+                                integrals[l*number_of_functions + row_index] += value*weighted_hat_functions[i][l];
+                            }
+                            row_index++;
+                        }
+                    }
+                }
+            }
 
-        double jacobian = rElement.DetJ();
+            // Scatter to vertices. The normal is constant on each triangle.
+            const auto& r_vertex_ids = rTriangleMesh.VertexIds(triangle_id);
+            for( IndexType l = 0; l < 3; ++l ){
+                const IndexType i = std::lower_bound(rVertexIds.begin(), rVertexIds.end(), r_vertex_ids[l]) - rVertexIds.begin();
+                for( IndexType dir = 0; dir < 3; ++dir ){
+                    auto derivative_it = rDerivatives.begin() + (i*3 + dir)*number_of_functions;
+                    for( IndexType k = 0; k < number_of_functions; ++k ){
+                        *(derivative_it + k) += r_normal[dir]*integrals[l*number_of_functions + k];
+                    }
+                }
+            }
+        }
+    }
+
+    /// @brief Assembles moment fitting matrix. Matrix is serialized: Column first. Each column corresponds to one integration point.
+    /// @param[out] rFittingMatrix
+    /// @param rIntegrationPoint
+    /// @param rElement
+    /// @param rIntegrationOrder
+    static void AssembleMomentFittingMatrix(NNLS::MatrixType& rFittingMatrix, const IntegrationPointVectorType& rIntegrationPoint, const ElementType& rElement, const Vector3i& rIntegrationOrder) {
+        const PointType& a = rElement.GetBoundsUVW().first;
+        const PointType& b = rElement.GetBoundsUVW().second;
 
         const IndexType ffactor = 1;
         const IndexType order_u = rIntegrationOrder[0];
@@ -307,32 +798,66 @@ protected:
         const IndexType number_of_functions = (order_u*ffactor + 1) * (order_v*ffactor+1) * (order_w*ffactor + 1);
         const IndexType number_reduced_points = rIntegrationPoint.size();
 
-        const double l2_norm_ct = std::sqrt( std::inner_product(rConstantTerms.begin(), rConstantTerms.end(), rConstantTerms.begin(), 0.0) );
+        std::array<std::vector<double>, 3> f_x_values;
+        EvaluateLegendreTables(rIntegrationPoint.begin(), number_reduced_points, a, b, rIntegrationOrder, f_x_values);
 
-        /// Assemble moment fitting matrix.
-        NNLS::MatrixType fitting_matrix(number_of_functions * number_reduced_points, 0.0);
-        const auto points_it_begin = rIntegrationPoint.begin();
-        for( IndexType column_index = 0; column_index < number_reduced_points; ++column_index ){
-            auto point_it = points_it_begin + column_index;
-            IndexType row_index = 0;
-            for( IndexType i_x = 0; i_x <= order_u*ffactor; ++i_x){
-                for( IndexType i_y = 0; i_y <= order_v*ffactor; ++i_y ){
-                    for( IndexType i_z = 0; i_z <= order_w*ffactor; ++i_z){
-                        const double value = Polynomial::f_x(point_it->X(), i_x, a[0], b[0])
-                                        * Polynomial::f_x(point_it->Y(), i_y, a[1], b[1])
-                                        * Polynomial::f_x(point_it->Z(), i_z, a[2], b[2]);
-                        // Matrix is serialized: Column first.
-                        fitting_matrix[column_index*number_of_functions + row_index] = value;
-                        row_index++;
-                    }
-                }
+        // Matrix is serialized: Column first.
+        rFittingMatrix.resize(number_of_functions * number_reduced_points);
+        CpuDispatch::AssembleMomentMatrix(f_x_values[0].data(), f_x_values[1].data(), f_x_values[2].data(), number_reduced_points,
+            Vector3i{order_u*ffactor, order_v*ffactor, order_w*ffactor}, rFittingMatrix.data());
+    }
+
+    /// @brief Evaluates Legendre polynomials (and optionally their integrals) of order 0 to rOrder at all points in each space direction.
+    ///        Values are stored order-major: rValues[dir][order*NumPoints + point].
+    /// @tparam TPointIteratorType Iterator to IntegrationPoint or BoundaryIntegrationPoint.
+    /// @param Begin
+    /// @param NumPoints
+    /// @param rA Lower bound of polynomials.
+    /// @param rB Upper bound of polynomials.
+    /// @param rOrder
+    /// @param[out] rValues
+    /// @param[out] pIntegralValues Optional. If given, integrals are evaluated as well.
+    template<typename TPointIteratorType>
+    static void EvaluateLegendreTables(TPointIteratorType Begin, IndexType NumPoints, const PointType& rA, const PointType& rB, const Vector3i& rOrder,
+                                       std::array<std::vector<double>, 3>& rValues, std::array<std::vector<double>, 3>* pIntegralValues = nullptr) {
+        std::vector<double> coordinates(NumPoints);
+        for( IndexType dir = 0; dir < 3; ++dir ){
+            for( IndexType i = 0; i < NumPoints; ++i ){
+                coordinates[i] = (Begin + i)->data()[dir];
+            }
+            rValues[dir].resize((rOrder[dir]+1)*NumPoints);
+            CpuDispatch::EvaluateLegendre(coordinates.data(), NumPoints, rOrder[dir], rA[dir], rB[dir], rValues[dir].data());
+            if( pIntegralValues ){
+                (*pIntegralValues)[dir].resize((rOrder[dir]+1)*NumPoints);
+                CpuDispatch::EvaluateLegendreIntegral(coordinates.data(), NumPoints, rOrder[dir], rA[dir], rB[dir], (*pIntegralValues)[dir].data());
             }
         }
+    }
+
+    /// @brief Set-Up and solve moment fitting equation. Solve the moment fitting equation for the weights of the integration points.
+    ///        Computed weights are directly assigned to rIntegrationPoint.
+    /// @param rConstantTerms
+    /// @param[out] rIntegrationPoint
+    /// @param rElement
+    /// @param rIntegrationOrder
+    /// @param Solver NNLS solver. Default: lawson_hanson.
+    /// @return double Relative residual ||ax -b||_L2 / ||b||_L2
+    static double MomentFitting(const VectorType& rConstantTerms, IntegrationPointVectorType& rIntegrationPoint, const ElementType& rElement, const Vector3i& rIntegrationOrder,
+                                NNLSSolverType Solver=NNLSSolver::lawson_hanson) {
+
+        const double jacobian = rElement.DetJ();
+        const IndexType number_reduced_points = rIntegrationPoint.size();
+
+        const double l2_norm_ct = std::sqrt( std::inner_product(rConstantTerms.begin(), rConstantTerms.end(), rConstantTerms.begin(), 0.0) );
+
+        /// Assemble moment fitting matrix.
+        NNLS::MatrixType fitting_matrix{};
+        AssembleMomentFittingMatrix(fitting_matrix, rIntegrationPoint, rElement, rIntegrationOrder);
 
         // Solve non-negative Least-Square-Error problem.
         VectorType weights(number_reduced_points);
         VectorType tmp_constant_terms(rConstantTerms); // NNLS::solve does modify input. Therefore, copy is required.
-        const double rel_residual = NNLS::solve(fitting_matrix, tmp_constant_terms, weights) / l2_norm_ct;
+        const double rel_residual = NNLS::solve(fitting_matrix, tmp_constant_terms, weights, Solver) / l2_norm_ct;
 
         // Write computed weights onto integration points
         for( IndexType i = 0; i < number_reduced_points; ++i){
@@ -344,14 +869,132 @@ protected:
         return rel_residual;
     }
 
+    /// @brief Computes the Cholesky decomposition of the normal equations G = A^T*A = L*L^T of the moment fitting matrix A.
+    ///        A small diagonal shift guards against (almost) dependent points.
+    /// @param rFittingMatrix Moment fitting matrix (see: AssembleMomentFittingMatrix()).
+    /// @param NumPoints Number of columns of rFittingMatrix.
+    /// @param[out] rL Lower triangle (column first). Size: NumPoints*NumPoints.
+    static void FactorizeNormalMatrix(const NNLS::MatrixType& rFittingMatrix, IndexType NumPoints, std::vector<double>& rL) {
+        const IndexType k = NumPoints;
+        const IndexType m = rFittingMatrix.size() / k;
+
+        // Normal equations G = A^T*A (lower triangle, column first).
+        rL.assign(k*k, 0.0);
+        double trace = 0.0;
+        for( IndexType j = 0; j < k; ++j ){
+            for( IndexType i = j; i < k; ++i ){
+                rL[i + j*k] = std::inner_product(rFittingMatrix.begin()+i*m, rFittingMatrix.begin()+(i+1)*m, rFittingMatrix.begin()+j*m, 0.0);
+            }
+            trace += rL[j + j*k];
+        }
+        const double shift = 1e-14*trace/static_cast<double>(k);
+
+        // Cholesky decomposition: G = L*L^T.
+        for( IndexType j = 0; j < k; ++j ){
+            double diagonal = rL[j + j*k] + shift;
+            for( IndexType l = 0; l < j; ++l ){
+                diagonal -= rL[j + l*k]*rL[j + l*k];
+            }
+            diagonal = std::sqrt(std::max(diagonal, shift));
+            rL[j + j*k] = diagonal;
+            for( IndexType i = j+1; i < k; ++i ){
+                double value = rL[i + j*k];
+                for( IndexType l = 0; l < j; ++l ){
+                    value -= rL[i + l*k]*rL[j + l*k];
+                }
+                rL[i + j*k] = value / diagonal;
+            }
+        }
+    }
+
+    /// @brief Solves the normal equations L*L^T*x = rRhs (see: FactorizeNormalMatrix()).
+    /// @param rL Lower triangle (column first).
+    /// @param NumPoints Size of system.
+    /// @param[in,out] rRhs Right hand side. Is overwritten by the solution x.
+    static void SolveNormalEquations(const std::vector<double>& rL, IndexType NumPoints, VectorType& rRhs) {
+        const IndexType k = NumPoints;
+        // Forward substitution: L*y = rRhs.
+        for( IndexType i = 0; i < k; ++i ){
+            double value = rRhs[i];
+            for( IndexType l = 0; l < i; ++l ){
+                value -= rL[i + l*k]*rRhs[l];
+            }
+            rRhs[i] = value / rL[i + i*k];
+        }
+        // Backward substitution: L^T*x = y.
+        for( IndexType i = k; i-- > 0; ){
+            double value = rRhs[i];
+            for( IndexType l = i+1; l < k; ++l ){
+                value -= rL[l + i*k]*rRhs[l];
+            }
+            rRhs[i] = value / rL[i + i*k];
+        }
+    }
+
+    /// @brief Predicts the increase of the squared (absolute) residual ||ax -b||^2_L2, if a single point is removed from rIntegrationPoint.
+    ///        rIntegrationPoint must contain the weights of the current moment fitting solution. For all points with positive weights,
+    ///        the prediction is exact for the unconstrained least-squares problem: x_j^2 / (A^T*A)^-1_jj.
+    ///        Points with zero weight can be removed without any cost.
+    /// @param rIntegrationPoint
+    /// @param rElement
+    /// @param rIntegrationOrder
+    /// @return VectorType Predicted increase for each point.
+    static VectorType ComputeEliminationCosts(const IntegrationPointVectorType& rIntegrationPoint, const ElementType& rElement, const Vector3i& rIntegrationOrder) {
+        const double jacobian = rElement.DetJ();
+        const IndexType number_of_points = rIntegrationPoint.size();
+        VectorType costs(number_of_points, 0.0);
+
+        // Only points with positive weights are part of the current least-squares problem.
+        IntegrationPointVectorType passive_points{};
+        std::vector<IndexType> passive_indices{};
+        for( IndexType i = 0; i < number_of_points; ++i ){
+            if( rIntegrationPoint[i].Weight() > 0.0 ){
+                passive_points.push_back(rIntegrationPoint[i]);
+                passive_indices.push_back(i);
+            }
+        }
+        const IndexType k = passive_points.size();
+        if( k == 0 ){
+            return costs;
+        }
+
+        NNLS::MatrixType fitting_matrix{};
+        AssembleMomentFittingMatrix(fitting_matrix, passive_points, rElement, rIntegrationOrder);
+        std::vector<double> L{};
+        FactorizeNormalMatrix(fitting_matrix, k, L);
+
+        // (G^-1)_jj = ||L^-1 e_j||^2. Solve L*y = e_j for each j.
+        std::vector<double> y(k);
+        for( IndexType j = 0; j < k; ++j ){
+            double inverse_diagonal = 0.0;
+            for( IndexType i = j; i < k; ++i ){
+                double value = (i == j) ? 1.0 : 0.0;
+                for( IndexType l = j; l < i; ++l ){
+                    value -= L[i + l*k]*y[l];
+                }
+                y[i] = value / L[i + i*k];
+                inverse_diagonal += y[i]*y[i];
+            }
+            const double x_j = rIntegrationPoint[passive_indices[j]].Weight()*jacobian;
+            costs[passive_indices[j]] = x_j*x_j / inverse_diagonal;
+        }
+
+        return costs;
+    }
+
     /// @brief Start point elimination algorihtm. Final quadrature rule is stored in rElement.
+    ///        Points are ranked by their predicted residual increase (see: ComputeEliminationCosts()). In each iteration, the largest batch of
+    ///        points, whose predicted residual is still below the targeted residual, is removed at once. If the actual residual overshoots
+    ///        the target, the batch size is bisected. Hence, the number of moment fitting solves is O(log(#points)) instead of O(#points).
     /// @param rConstantTerms
     /// @param rIntegrationPoint
     /// @param rElement
     /// @param rIntegrationOrder
     /// @param Residual targeted residual
+    /// @param Solver NNLS solver. Default: lawson_hanson.
     /// @return double achieved residual
-    static double PointElimination(const VectorType& rConstantTerms, IntegrationPointVectorType& rIntegrationPoint, ElementType& rElement, const Vector3i& rIntegrationOrder, double Residual){
+    static double PointElimination(const VectorType& rConstantTerms, IntegrationPointVectorType& rIntegrationPoint, ElementType& rElement, const Vector3i& rIntegrationOrder, double Residual,
+                                   NNLSSolverType Solver=NNLSSolver::lawson_hanson){
         /// Initialize variables.
         const SizeType ffactor = 1;
         const SizeType order_u = rIntegrationOrder[0];
@@ -359,103 +1002,94 @@ protected:
         const SizeType order_w = rIntegrationOrder[2];
         const IndexType number_of_functions = (order_u*ffactor + 1) * (order_v*ffactor+1) * (order_w*ffactor + 1);
         const IndexType min_number_of_points = order_u*order_v*order_w;
-
         const double targeted_residual = Residual;
-        double global_residual = MIND;
-        double prev_residual = 0.0;
-        const SizeType maximum_iteration = 1000UL;
-        SizeType number_iterations = 0UL;
-        bool point_is_eliminated = false;
-        IntegrationPointVectorType prev_solution{};
-
-        // If any point is eliminated, we must run another moment fitting loop, to guarantee that the weights are correct.
-        // Also keep iterating, until targeted_residual is stepped over.
-        while( point_is_eliminated || (global_residual < targeted_residual && number_iterations < maximum_iteration) ){
-            point_is_eliminated = false;
-            global_residual = MomentFitting(rConstantTerms, rIntegrationPoint, rElement, rIntegrationOrder);
-            if( number_iterations == 0UL){
-                /// In first iteration, revome all points but #number_of_functions
-                // Sort integration points according to weight.
-                std::sort(rIntegrationPoint.begin(), rIntegrationPoint.end(), [](const IntegrationPointType& point_a, const IntegrationPointType& point_b) -> bool {
-                        return point_a.Weight() > point_b.Weight();
-                    });
-                // Only keep #number_of_functions integration points.
-                rIntegrationPoint.erase(rIntegrationPoint.begin()+number_of_functions, rIntegrationPoint.end());
-
-                // Additionally remove all points that are zero.
-                rIntegrationPoint.erase(std::remove_if(rIntegrationPoint.begin(), rIntegrationPoint.end(), [](const IntegrationPointType& point) {
-                    return point.Weight() < ZEROTOL; }), rIntegrationPoint.end());
-
-                // Stop if no points are left.
-                if( rIntegrationPoint.size() == 0 )
-                    break;
+        const double l2_norm_ct_2 = std::inner_product(rConstantTerms.begin(), rConstantTerms.end(), rConstantTerms.begin(), 0.0);
+
+        auto remove_zero_weights = [](IntegrationPointVectorType& rPoints){
+            rPoints.erase(std::remove_if(rPoints.begin(), rPoints.end(), [](const IntegrationPointType& point) {
+                return point.Weight() < ZEROTOL; }), rPoints.end());
+        };
+
+        /// In first iteration, remove all points but #number_of_functions
+        double residual = MomentFitting(rConstantTerms, rIntegrationPoint, rElement, rIntegrationOrder, Solver);
+        // Sort integration points according to weight.
+        std::sort(rIntegrationPoint.begin(), rIntegrationPoint.end(), [](const IntegrationPointType& point_a, const IntegrationPointType& point_b) -> bool {
+                return point_a.Weight() > point_b.Weight();
+            });
+        // Only keep #number_of_functions integration points.
+        if( rIntegrationPoint.size() > number_of_functions ){
+            rIntegrationPoint.erase(rIntegrationPoint.begin()+number_of_functions, rIntegrationPoint.end());
+        }
+        // Additionally remove all points that are zero.
+        remove_zero_weights(rIntegrationPoint);
 
-                point_is_eliminated = true;
-            }
-            else if( global_residual < targeted_residual && number_iterations < maximum_iteration){
-                // Store solution, in previous solution
-                prev_solution.clear();
-                prev_solution.insert(prev_solution.begin(), rIntegrationPoint.begin(), rIntegrationPoint.end());
-                prev_residual = global_residual;
-
-                // Find min and max weights.
-                auto min_value_it = rIntegrationPoint.begin();
-                double min_value = MAXD;
-                double max_value = LOWESTD;
-                const auto begin_it = rIntegrationPoint.begin();
-                for(IndexType i = 0; i < rIntegrationPoint.size(); i++){
-                    auto it = begin_it + i;
-                    if( it->Weight() < min_value ) {
-                        min_value_it = it;
-                        min_value = it->Weight();
-                    }
-                    if( it->Weight() > max_value ) {
-                        max_value = it->Weight();
-                    }
-                }
+        // Stop if no points are left.
+        if( rIntegrationPoint.size() > 0 ){
+            residual = MomentFitting(rConstantTerms, rIntegrationPoint, rElement, rIntegrationOrder, Solver);
+        }
 
-                // Remove points that are very small (< EPS1*max_value)
-                // However, always keep #min_number_of_points.
-                SizeType counter = 0;
-                for(IndexType i = 0; i < rIntegrationPoint.size(); i++){
-                    auto it = begin_it + i;
-                    // TODO: Fix this > 2..4
-                    if( it->Weight() < 1e-8*max_value && rIntegrationPoint.size() > min_number_of_points){
-                        rIntegrationPoint.erase(it);
-                        point_is_eliminated = true;
-                        counter++;
+        /// Eliminate batches of points, as long as targeted_residual is satisfied.
+        IntegrationPointVectorType candidate_points{};
+        std::vector<IndexType> ranking{};
+        while( residual < targeted_residual && rIntegrationPoint.size() > min_number_of_points ){
+            const IndexType number_of_points = rIntegrationPoint.size();
+            const VectorType costs = ComputeEliminationCosts(rIntegrationPoint, rElement, rIntegrationOrder);
+
+            // Rank points by predicted residual increase.
+            ranking.resize(number_of_points);
+            std::iota(ranking.begin(), ranking.end(), 0);
+            std::stable_sort(ranking.begin(), ranking.end(), [&costs](IndexType a, IndexType b) { return costs[a] < costs[b]; });
+
+            // Largest batch whose (accumulated) predicted residual satisfies the target. Always try at least one point.
+            const IndexType max_num_remove = number_of_points - min_number_of_points;
+            const double targeted_residual_2 = targeted_residual*targeted_residual*l2_norm_ct_2;
+            double predicted_residual_2 = residual*residual*l2_norm_ct_2;
+            IndexType num_remove = 0;
+            while( num_remove < max_num_remove && predicted_residual_2 + costs[ranking[num_remove]] < targeted_residual_2 ){
+                predicted_residual_2 += costs[ranking[num_remove]];
+                ++num_remove;
+            }
+            num_remove = std::max<IndexType>(num_remove, 1);
+
+            // Bisection fallback: If targeted residual is overshot, halve the batch size.
+            bool is_eliminated = false;
+            std::vector<bool> is_removed(number_of_points);
+            while( !is_eliminated ){
+                std::fill(is_removed.begin(), is_removed.end(), false);
+                for( IndexType i = 0; i < num_remove; ++i ){
+                    is_removed[ranking[i]] = true;
+                }
+                candidate_points.clear();
+                for( IndexType i = 0; i < number_of_points; ++i ){
+                    if( !is_removed[i] ){
+                        candidate_points.push_back(rIntegrationPoint[i]);
                     }
                 }
-                // If nothing was removed, remove at least one points.
-                if( counter == 0 && rIntegrationPoint.size() > min_number_of_points){
-                    rIntegrationPoint.erase(min_value_it);
-                    point_is_eliminated = true;
+                const double candidate_residual = MomentFitting(rConstantTerms, candidate_points, rElement, rIntegrationOrder, Solver);
+                if( candidate_residual < targeted_residual ){
+                    rIntegrationPoint.swap(candidate_points);
+                    residual = candidate_residual;
+                    is_eliminated = true;
                 }
-                // Leave loop in next iteration. Note if point_is_eliminated the moment fitting equation is solved again.
-                if( rIntegrationPoint.size() <= min_number_of_points ){ //&& !point_is_eliminated ){
-                    number_iterations = maximum_iteration + 10;
+                else if( num_remove == 1 ){
+                    break;
+                }
+                else {
+                    num_remove /= 2;
                 }
             }
-            number_iterations++;
+            // Leave loop, if not even a single point can be removed.
+            if( !is_eliminated ){
+                break;
+            }
         }
 
+        // Return current solution.
         auto& reduced_points = rElement.GetIntegrationPoints();
-        if( (global_residual >= targeted_residual && prev_solution.size() > 0) || number_iterations > maximum_iteration ) {
-            // Return previous solution.
-            reduced_points.insert(reduced_points.begin(), prev_solution.begin(), prev_solution.end());
-            reduced_points.erase(std::remove_if(reduced_points.begin(), reduced_points.end(), [](const IntegrationPointType& point) {
-                return point.Weight() < ZEROTOL; }), reduced_points.end());
+        reduced_points.insert(reduced_points.begin(), rIntegrationPoint.begin(), rIntegrationPoint.end());
+        remove_zero_weights(reduced_points);
 
-            return prev_residual;
-        }
-        else{
-            // Return current solution.
-            reduced_points.insert(reduced_points.begin(), rIntegrationPoint.begin(), rIntegrationPoint.end());
-            reduced_points.erase(std::remove_if(reduced_points.begin(), reduced_points.end(), [](const IntegrationPointType& point) {
-                return point.Weight() < ZEROTOL; }), reduced_points.end());
-
-            return global_residual;
-        }
+        return residual;
     }
 }; // End Class
 
@@ -0,0 +1,272 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#ifndef TRIMMED_ELEMENT_TUNER_INCLUDE_HPP
+#define TRIMMED_ELEMENT_TUNER_INCLUDE_HPP
+
+//// STL includes
+#include <vector>
+#include <random>
+#include <cmath>
+#include <algorithm>
+//// Project includes
+#include "queso/includes/settings.hpp"
+#include "queso/includes/timer.hpp"
+#include "queso/containers/grid_indexer.hpp"
+#include "queso/embedding/brep_operator.h"
+#include "queso/quadrature/trimmed_element.hpp"
+#include "queso/utilities/mesh_utilities.h"
+
+namespace queso {
+
+///@name QuESo Classes
+///@{
+
+/**
+ * @class  QuadratureTrimmedElementTuner
+ * @author Manuel Messmer
+ * @brief  Selects the parameters of the trimmed-element pipeline (see: QuadratureTrimmedElement) by sampling.
+ * @details The pipeline (construction of the trimmed domain and moment fitting) is run on a stratified random sample of the trimmed
+ *          cells for each candidate parameter set. The sample is stratified along the linear cell index, i.e., one cell is drawn from
+ *          each of 'auto_tuning_sample_size' consecutive chunks of the trimmed cells. The candidate set given by the settings serves as
+ *          baseline. A candidate is admissible if it
+ *          - achieves the targeted residual ('moment_fitting_residual') on at least as many sampled cells as the baseline, and
+ *          - reproduces the volume of each sampled cell up to 'auto_tuning_volume_error' (relative to the volume of the cell).
+ *          The reference volume of each cell is the volume enclosed by the boundary mesh of the baseline's trimmed domain.
+ *          The admissible candidate with the smallest accumulated run time is selected.
+ *          The sample is drawn with a fixed seed. However, the selection depends on measured run times.
+ * @tparam TElementType
+**/
+template<typename TElementType>
+class QuadratureTrimmedElementTuner {
+public:
+    ///@name Type Definitions
+    ///@{
+    typedef TElementType ElementType;
+
+    /// @brief Tunable parameters. Names correspond to the keys in TrimmedQuadratureRuleSettings.
+    struct Parameters {
+        IndexType min_num_boundary_triangles;
+        IndexType init_point_distribution_factor;
+        IndexType max_octree_refinement_level;
+
+        bool operator==(const Parameters& rOther) const {
+            return min_num_boundary_triangles == rOther.min_num_boundary_triangles
+                && init_point_distribution_factor == rOther.init_point_distribution_factor
+                && max_octree_refinement_level == rOther.max_octree_refinement_level;
+        }
+    };
+
+    /// @brief Result of Tune().
+    struct TuningResult {
+        Parameters parameters;              // Selected parameters.
+        IndexType num_sampled_elements = 0;
+        IndexType num_candidates = 0;
+        double volume_error = 0.0;          // Max. volume error of selected parameters over all sampled cells.
+        double speedup = 1.0;               // Run time of baseline / run time of selected parameters (on the sample).
+    };
+
+    ///@}
+    ///@name Operations
+    ///@{
+
+    /// @brief Returns parameters given in rSettings (trimmed_quadrature_rule_settings).
+    /// @param rSettings
+    /// @return Parameters
+    static Parameters GetParameters(const Settings& rSettings) {
+        const auto& r_trimmed_settings = rSettings[MainSettings::trimmed_quadrature_rule_settings];
+        return { r_trimmed_settings.GetValue<IndexType>(TrimmedQuadratureRuleSettings::min_num_boundary_triangles),
+                 r_trimmed_settings.GetValue<IndexType>(TrimmedQuadratureRuleSettings::init_point_distribution_factor),
+                 r_trimmed_settings.GetValue<IndexType>(TrimmedQuadratureRuleSettings::max_octree_refinement_level) };
+    }
+
+    /// @brief Returns candidate parameter sets. First candidate is the baseline (rBaseline).
+    /// @param rBaseline
+    /// @return std::vector<Parameters>
+    static std::vector<Parameters> GetCandidates(const Parameters& rBaseline) {
+        std::vector<Parameters> candidates{rBaseline};
+        const IndexType base_triangles = rBaseline.min_num_boundary_triangles;
+        for( IndexType num_triangles : {std::max<IndexType>(base_triangles/4, 1), std::max<IndexType>(base_triangles/2, 1), base_triangles} ){
+            for( IndexType factor : {IndexType(1), IndexType(2)} ){
+                for( IndexType level : {IndexType(3), IndexType(4)} ){
+                    const Parameters candidate{num_triangles, factor, level};
+                    if( std::find(candidates.begin(), candidates.end(), candidate) == candidates.end() ){
+                        candidates.push_back(candidate);
+                    }
+                }
+            }
+        }
+        return candidates;
+    }
+
+    /// @brief Draws a stratified random sample of rTrimmedCellIndices. One cell is drawn from each of NumSamples consecutive chunks.
+    ///        If rTrimmedCellIndices contains less than NumSamples cells, all cells are returned.
+    /// @param rTrimmedCellIndices Must be sorted.
+    /// @param NumSamples
+    /// @return std::vector<IndexType>
+    static std::vector<IndexType> DrawSample(const std::vector<IndexType>& rTrimmedCellIndices, IndexType NumSamples) {
+        const IndexType num_cells = rTrimmedCellIndices.size();
+        if( num_cells <= NumSamples ){
+            return rTrimmedCellIndices;
+        }
+        std::mt19937 generator(0);
+        std::vector<IndexType> sample{};
+        sample.reserve(NumSamples);
+        for( IndexType i = 0; i < NumSamples; ++i ){
+            const IndexType begin = (i*num_cells) / NumSamples;
+            const IndexType end = ((i+1)*num_cells) / NumSamples;
+            std::uniform_int_distribution<IndexType> distribution(begin, end-1);
+            sample.push_back(rTrimmedCellIndices[distribution(generator)]);
+        }
+        return sample;
+    }
+
+    /// @brief Runs the trimmed-element pipeline on a sample of the trimmed cells for all candidate parameter sets and returns the
+    ///        cheapest admissible set (see class description).
+    /// @param rBRepOperator
+    /// @param rGridIndexer
+    /// @param rTrimmedCellIndices Indices of all trimmed cells (sorted).
+    /// @param rSettings
+    /// @return TuningResult
+    static TuningResult Tune(const BRepOperator& rBRepOperator, const GridIndexer& rGridIndexer,
+                             const std::vector<IndexType>& rTrimmedCellIndices, const Settings& rSettings) {
+        const auto& r_trimmed_settings = rSettings[MainSettings::trimmed_quadrature_rule_settings];
+        const double residual_target = r_trimmed_settings.GetValue<double>(TrimmedQuadratureRuleSettings::moment_fitting_residual);
+        const double volume_error_target = r_trimmed_settings.GetValue<double>(TrimmedQuadratureRuleSettings::auto_tuning_volume_error);
+        const IndexType sample_size = std::max<IndexType>(r_trimmed_settings.GetValue<IndexType>(TrimmedQuadratureRuleSettings::auto_tuning_sample_size), 1);
+        const Parameters baseline = GetParameters(rSettings);
+
+        TuningResult result{};
+        result.parameters = baseline;
+
+        const auto sample = DrawSample(rTrimmedCellIndices, sample_size);
+        const auto candidates = GetCandidates(baseline);
+        result.num_sampled_elements = sample.size();
+        result.num_candidates = candidates.size();
+        if( sample.empty() ){
+            return result;
+        }
+
+        // Reference volumes are taken from the baseline. Cells that are neglected by the baseline are not considered.
+        const IndexType num_samples = sample.size();
+        std::vector<double> reference_volumes(num_samples, -1.0);
+        std::vector<double> cell_volumes(num_samples, 0.0);
+        std::vector<std::vector<double>> residuals(candidates.size(), std::vector<double>(num_samples, MAXD));
+        std::vector<std::vector<double>> volumes(candidates.size(), std::vector<double>(num_samples, 0.0));
+        std::vector<double> run_times(candidates.size(), 0.0);
+
+        for( IndexType i_candidate = 0; i_candidate < candidates.size(); ++i_candidate ){
+            double run_time = 0.0;
+            #pragma omp parallel for reduction(+ : run_time) schedule(dynamic)
+            for( int i = 0; i < static_cast<int>(num_samples); ++i ){
+                if( i_candidate > 0 && reference_volumes[i] < 0.0 ){
+                    continue;
+                }
+                Timer timer{};
+                double volume = 0.0;
+                double volume_reference = -1.0;
+                const double residual = RunPipeline(rBRepOperator, rGridIndexer, sample[i], candidates[i_candidate], rSettings, volume, volume_reference);
+                run_time += timer.Measure();
+                residuals[i_candidate][i] = residual;
+                volumes[i_candidate][i] = volume;
+                if( i_candidate == 0 ){
+                    reference_volumes[i] = volume_reference;
+                    const auto bounding_box = rGridIndexer.GetBoundingBoxXYZFromIndex(sample[i]);
+                    cell_volumes[i] = (bounding_box.second[0] - bounding_box.first[0])
+                        * (bounding_box.second[1] - bounding_box.first[1]) * (bounding_box.second[2] - bounding_box.first[2]);
+                }
+            }
+            run_times[i_candidate] = run_time;
+        }
+
+        // Select cheapest admissible candidate. The baseline is always admissible.
+        IndexType num_achieved_baseline = 0;
+        for( IndexType i = 0; i < num_samples; ++i ){
+            num_achieved_baseline += (reference_volumes[i] >= 0.0 && residuals[0][i] <= residual_target);
+        }
+        IndexType selected = 0;
+        double selected_volume_error = 0.0;
+        for( IndexType i_candidate = 0; i_candidate < candidates.size(); ++i_candidate ){
+            IndexType num_achieved = 0;
+            double volume_error = 0.0;
+            for( IndexType i = 0; i < num_samples; ++i ){
+                if( reference_volumes[i] < 0.0 ){
+                    continue;
+                }
+                num_achieved += (residuals[i_candidate][i] <= residual_target);
+                volume_error = std::max(volume_error, std::abs(volumes[i_candidate][i] - reference_volumes[i]) / cell_volumes[i]);
+            }
+            const bool is_admissible = (num_achieved >= num_achieved_baseline) && (volume_error <= volume_error_target);
+            if( i_candidate == 0 || (is_admissible && run_times[i_candidate] < run_times[selected]) ){
+                selected = i_candidate;
+                selected_volume_error = volume_error;
+            }
+        }
+
+        result.parameters = candidates[selected];
+        result.volume_error = selected_volume_error;
+        result.speedup = (run_times[selected] > 0.0) ? run_times[0] / run_times[selected] : 1.0;
+
+        return result;
+    }
+
+    /// @brief Runs trimmed-element pipeline for a single cell. Also used by BackgroundGridPlanner.
+    /// @param rBRepOperator
+    /// @param rGridIndexer
+    /// @param CellIndex
+    /// @param rParameters
+    /// @param rSettings
+    /// @param[out] rVolume Volume represented by the integration points.
+    /// @param[out] rReferenceVolume Volume enclosed by the boundary of the trimmed domain. -1.0 if trimmed domain is neglected.
+    /// @return double Residual of moment fitting.
+    static double RunPipeline(const BRepOperator& rBRepOperator, const GridIndexer& rGridIndexer, IndexType CellIndex, const Parameters& rParameters,
+                              const Settings& rSettings, double& rVolume, double& rReferenceVolume) {
+        const auto& r_trimmed_settings = rSettings[MainSettings::trimmed_quadrature_rule_settings];
+        const double min_vol_element_ratio = std::max<double>(r_trimmed_settings.GetValue<double>(TrimmedQuadratureRuleSettings::min_element_volume_ratio), 1e-10);
+        const bool neglect_elements_if_stl_is_flawed = r_trimmed_settings.GetValue<bool>(TrimmedQuadratureRuleSettings::neglect_elements_if_stl_is_flawed);
+        const double residual_target = r_trimmed_settings.GetValue<double>(TrimmedQuadratureRuleSettings::moment_fitting_residual);
+        const NNLSSolver nnls_solver = r_trimmed_settings.GetValue<NNLSSolver>(TrimmedQuadratureRuleSettings::nnls_solver);
+        const Vector3i polynomial_order = rSettings[MainSettings::background_grid_settings].GetValue<Vector3i>(BackgroundGridSettings::polynomial_order);
+
+        const auto bounding_box_xyz = rGridIndexer.GetBoundingBoxXYZFromIndex(CellIndex);
+        const auto bounding_box_uvw = rGridIndexer.GetBoundingBoxUVWFromIndex(CellIndex);
+
+        rVolume = 0.0;
+        rReferenceVolume = -1.0;
+        auto p_trimmed_domain = rBRepOperator.pGetTrimmedDomain(CellIndex, bounding_box_xyz.first, bounding_box_xyz.second,
+            min_vol_element_ratio, rParameters.min_num_boundary_triangles, neglect_elements_if_stl_is_flawed);
+        if( !p_trimmed_domain ){
+            return MAXD;
+        }
+        rReferenceVolume = MeshUtilities::Volume(p_trimmed_domain->GetTriangleMesh());
+
+        ElementType element(CellIndex+1, bounding_box_xyz, bounding_box_uvw);
+        element.SetIsTrimmed(true);
+        element.pSetTrimmedDomain(p_trimmed_domain);
+        const double residual = QuadratureTrimmedElement<ElementType>::AssembleIPs(element, polynomial_order, residual_target, nnls_solver,
+            rParameters.init_point_distribution_factor, rParameters.max_octree_refinement_level);
+
+        const double det_j = element.DetJ();
+        for( const auto& r_point : element.GetIntegrationPoints() ){
+            rVolume += r_point.Weight() * det_j;
+        }
+        return residual;
+    }
+
+    ///@}
+}; // End class QuadratureTrimmedElementTuner
+///@} // End QuESo classes
+
+} // End namespace queso
+
+#endif // TRIMMED_ELEMENT_TUNER_INCLUDE_HPP
@@ -0,0 +1,85 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+//// STL includes
+#include <iostream>
+#include <string>
+#include <filesystem>
+//// Project includes
+#include "queso/embedded_model.h"
+#include "queso/io/json_reader.h"
+
+/// Standalone QuESo executable. Runs EmbeddedModel::CreateAllFromSettings() for the given JSON settings file.
+/// Equivalent to PyQuESo(json_filename).Run(), but does not require Python.
+/// With '--plan', only the background grid is planned (see: EmbeddedModel::PlanBackgroundGrid()) and the proposal is printed.
+/// Usage: queso [--plan] [QuESoSettings.json]
+int main(int argc, char* argv[]) {
+    using namespace queso;
+
+    std::string json_filename = "QuESoSettings.json";
+    bool plan_only = false;
+    bool filename_given = false;
+    for( int i = 1; i < argc; ++i ){
+        const std::string argument = argv[i];
+        if( argument == "-h" || argument == "--help" ){
+            std::cout << "Usage: " << argv[0] << " [--plan] [QuESoSettings.json]\n"
+                      << "Computes the quadrature rules of all elements and conditions as specified in the given settings file (default: QuESoSettings.json).\n"
+                      << "  --plan  Only proposes 'number_of_elements' and predicts the number of trimmed elements and the runtime.\n";
+            return 0;
+        }
+        else if( argument == "--plan" ){
+            plan_only = true;
+        }
+        else if( !filename_given ){
+            json_filename = argument;
+            filename_given = true;
+        }
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--plan] [QuESoSettings.json]\n";
+            return 1;
+        }
+    }
+
+    try {
+        const Settings settings = JsonReader::ReadSettings(json_filename);
+
+        if( plan_only ){
+            const ModelInfo model_info = EmbeddedModel::PlanBackgroundGrid(settings);
+            const auto& r_info = model_info[MainInfo::grid_planning_info];
+            const auto& r_number_of_elements = r_info.GetValue<Vector3i>(GridPlanningInfo::proposed_number_of_elements);
+            std::cout << "number_of_elements: [" << r_number_of_elements[0] << ", " << r_number_of_elements[1] << ", " << r_number_of_elements[2] << "]\n"
+                      << "predicted_num_trimmed_elements: " << r_info.GetValue<IndexType>(GridPlanningInfo::predicted_num_trimmed_elements) << '\n'
+                      << "predicted_volume_error: " << r_info.GetValue<double>(GridPlanningInfo::predicted_volume_error) << '\n'
+                      << "predicted_runtime: " << r_info.GetValue<double>(GridPlanningInfo::predicted_runtime) << " sec\n"
+                      << "target_met: " << (r_info.GetValue<bool>(GridPlanningInfo::target_met) ? "true" : "false") << std::endl;
+            return 0;
+        }
+
+        // Clean output directory (see: PyQuESo).
+        const auto& r_general_settings = settings[MainSettings::general_settings];
+        if( r_general_settings.GetValue<bool>(GeneralSettings::write_output_to_file) ){
+            const std::filesystem::path output_directory = r_general_settings.GetValue<std::string>(GeneralSettings::output_directory_name);
+            std::filesystem::remove_all(output_directory);
+            std::filesystem::create_directories(output_directory);
+        }
+
+        EmbeddedModel embedded_model(settings);
+        embedded_model.CreateAllFromSettings();
+    }
+    catch( const std::exception& rException ){
+        std::cerr << rException.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -14,6 +14,7 @@
 //// STL includes
 #include <iostream>
 #include <algorithm>
+#include <cmath>
 //// External includes
 #include "nnls/nnls_impl.h"
 //// Project includes
@@ -62,5 +63,321 @@ double NNLS::solve(MatrixType& A, VectorType& B, VectorType& X) {
     return Rnorm;
 }
 
-} // End namespace queso
+double NNLS::solve(MatrixType& A, VectorType& B, VectorType& X, NNLSSolverType Solver) {
+    switch( Solver ) {
+        case NNLSSolver::lawson_hanson:
+            return solve(A, B, X);
+        case NNLSSolver::scaled_lawson_hanson:
+            return SolveScaledLawsonHanson(A, B, X);
+        case NNLSSolver::active_set_cholesky:
+            return SolveActiveSetCholesky(A, B, X);
+        default:
+            QuESo_ERROR << "NNLS solver type is not available.\n";
+    }
+    return 1e8;
+}
+
+void NNLS::ScaleColumns(MatrixType& A, IndexType NumRows, VectorType& rScaling) {
+    const IndexType n = (NumRows > 0) ? A.size()/NumRows : 0;
+    rScaling.resize(n);
+    for( IndexType j = 0; j < n; ++j ){
+        double* p_column = A.data() + j*NumRows;
+        double norm = 0.0;
+        for( IndexType i = 0; i < NumRows; ++i ){
+            norm += p_column[i]*p_column[i];
+        }
+        norm = std::sqrt(norm);
+        rScaling[j] = (norm > 0.0) ? 1.0/norm : 1.0;
+        for( IndexType i = 0; i < NumRows; ++i ){
+            p_column[i] *= rScaling[j];
+        }
+    }
+}
+
+double NNLS::SolveScaledLawsonHanson(MatrixType& A, VectorType& B, VectorType& X) {
+    // The residual ||A*diag(s)*y - b|| is invariant to the scaling. Only x = diag(s)*y must be recovered.
+    VectorType scaling;
+    ScaleColumns(A, B.size(), scaling);
+    const double residual = solve(A, B, X);
+    for( IndexType j = 0; j < X.size(); ++j ){
+        X[j] *= scaling[j];
+    }
+    return residual;
+}
+
+double NNLS::SolveActiveSetCholesky(MatrixType& A, VectorType& B, VectorType& X) {
+
+    // Get Dimension
+    const IndexType m = B.size();
+    const IndexType n = (m > 0) ? A.size()/m : 0;
+    X.assign(n, 0.0);
+    if( m == 0 || n == 0 ){
+        std::cerr << "THE DIMENSIONS OF THE PROBLEM ARE BAD. EITHER M .LE. 0 OR N .LE. 0." << std::endl;
+        return 1e8;
+    }
+
+    VectorType scaling;
+    ScaleColumns(A, m, scaling);
+    auto column = [&A, m](IndexType j) -> const double* { return A.data() + j*m; };
+    // Four independent partial sums allow the compiler to pipeline the reduction.
+    auto dot = [](const double* pA, const double* pB, IndexType Size) -> double {
+        double value_0 = 0.0, value_1 = 0.0, value_2 = 0.0, value_3 = 0.0;
+        IndexType i = 0;
+        for( ; i+3 < Size; i += 4 ){
+            value_0 += pA[i]*pB[i];
+            value_1 += pA[i+1]*pB[i+1];
+            value_2 += pA[i+2]*pB[i+2];
+            value_3 += pA[i+3]*pB[i+3];
+        }
+        for( ; i < Size; ++i ){
+            value_0 += pA[i]*pB[i];
+        }
+        return (value_0 + value_1) + (value_2 + value_3);
+    };
+
+    // Normal equations: G = A^T*A, c = A^T*b. Columns of G are only computed, once the corresponding column
+    // enters the passive set for the first time.
+    VectorType c(n);
+    for( IndexType j = 0; j < n; ++j ){
+        c[j] = dot(column(j), B.data(), m);
+    }
+    VectorType G(n*n);
+    std::vector<bool> has_gram_column(n, false);
+    auto gram_column = [&](IndexType j) -> const double* {
+        double* p_g = G.data() + j*n;
+        if( !has_gram_column[j] ){
+            // G[:,j] = A^T*a_j. Four columns of A are processed at once to reuse a_j.
+            const double* p_a_j = column(j);
+            IndexType i = 0;
+            for( ; i+3 < n; i += 4 ){
+                const double* p_a_0 = column(i);
+                const double* p_a_1 = column(i+1);
+                const double* p_a_2 = column(i+2);
+                const double* p_a_3 = column(i+3);
+                double value_0 = 0.0, value_1 = 0.0, value_2 = 0.0, value_3 = 0.0;
+                for( IndexType l = 0; l < m; ++l ){
+                    const double a_l = p_a_j[l];
+                    value_0 += p_a_0[l]*a_l;
+                    value_1 += p_a_1[l]*a_l;
+                    value_2 += p_a_2[l]*a_l;
+                    value_3 += p_a_3[l]*a_l;
+                }
+                p_g[i] = value_0;
+                p_g[i+1] = value_1;
+                p_g[i+2] = value_2;
+                p_g[i+3] = value_3;
+            }
+            for( ; i < n; ++i ){
+                p_g[i] = dot(column(i), p_a_j, m);
+            }
+            has_gram_column[j] = true;
+        }
+        return p_g;
+    };
+
+    // Cholesky factor of passive set: A_P^T*A_P = R^T*R, R is upper triangular. d = R^-T * c_P.
+    const IndexType capacity = std::min(m, n);
+    VectorType R(capacity*capacity);
+    VectorType d(capacity);
+    VectorType z(capacity);
+    VectorType u(capacity);
+    std::vector<IndexType> passive_set;
+    passive_set.reserve(capacity);
+    VectorType x_passive;
+    x_passive.reserve(capacity);
+
+    std::vector<bool> is_passive(n, false);
+    std::vector<bool> skip(n, false);
+    VectorType w(n);
+
+    // Solves R*z = rRhs.
+    auto back_substitution = [&R, &z, capacity](const VectorType& rRhs, IndexType k) {
+        for( IndexType ii = k; ii > 0; --ii ){
+            const IndexType i = ii-1;
+            double value = rRhs[i];
+            for( IndexType j = i+1; j < k; ++j ){
+                value -= R[i + j*capacity]*z[j];
+            }
+            z[i] = value / R[i + i*capacity];
+        }
+    };
+    // Solves R^T*rU = rRhs (in place).
+    auto forward_substitution = [&R, capacity, &dot](VectorType& rU, IndexType k) {
+        for( IndexType i = 0; i < k; ++i ){
+            rU[i] = (rU[i] - dot(R.data() + i*capacity, rU.data(), i)) / R[i + i*capacity];
+        }
+    };
 
+    // Removes column at Position from the Cholesky factor via Givens rotations (rank-1 downdate).
+    auto remove_column = [&](IndexType Position) {
+        const IndexType k = passive_set.size();
+        for( IndexType j = Position; j+1 < k; ++j ){
+            for( IndexType i = 0; i <= j+1; ++i ){
+                R[i + j*capacity] = R[i + (j+1)*capacity];
+            }
+        }
+        for( IndexType j = Position; j+1 < k; ++j ){
+            const double a = R[j + j*capacity];
+            const double b = R[j+1 + j*capacity];
+            const double r = std::hypot(a, b);
+            const double cos = a/r;
+            const double sin = b/r;
+            for( IndexType l = j; l+1 < k; ++l ){
+                const double r_1 = R[j + l*capacity];
+                const double r_2 = R[j+1 + l*capacity];
+                R[j + l*capacity] = cos*r_1 + sin*r_2;
+                R[j+1 + l*capacity] = -sin*r_1 + cos*r_2;
+            }
+            const double d_1 = d[j];
+            const double d_2 = d[j+1];
+            d[j] = cos*d_1 + sin*d_2;
+            d[j+1] = -sin*d_1 + cos*d_2;
+        }
+        is_passive[passive_set[Position]] = false;
+        passive_set.erase(passive_set.begin() + Position);
+        x_passive.erase(x_passive.begin() + Position);
+    };
+
+    const IndexType max_iteration = 3*n;
+    IndexType iteration = 0;
+    bool compute_gradient = true;
+    while( passive_set.size() < m ){
+        // Compute dual vector w = A^T*(b-A*x) = c - G*x.
+        if( compute_gradient ){
+            std::copy(c.begin(), c.end(), w.begin());
+            for( IndexType i = 0; i < passive_set.size(); ++i ){
+                const double* p_g = gram_column(passive_set[i]);
+                const double value = x_passive[i];
+                for( IndexType j = 0; j < n; ++j ){
+                    w[j] -= value*p_g[j];
+                }
+            }
+            std::fill(skip.begin(), skip.end(), false);
+            compute_gradient = false;
+        }
+
+        // Find index of largest w.
+        IndexType t = n;
+        double w_max = 0.0;
+        for( IndexType j = 0; j < n; ++j ){
+            if( !is_passive[j] && !skip[j] && w[j] > w_max ){
+                w_max = w[j];
+                t = j;
+            }
+        }
+        if( t == n ){
+            break;
+        }
+
+        // Append column t: Rank-1 update of R. Solve R^T*u = A_P^T*a_t, rho^2 = a_t^T*a_t - u^T*u.
+        const IndexType k = passive_set.size();
+        const double* p_g_t = gram_column(t);
+        for( IndexType i = 0; i < k; ++i ){
+            u[i] = p_g_t[passive_set[i]];
+        }
+        forward_substitution(u, k);
+        const double u_norm_2 = dot(u.data(), u.data(), k);
+        const double rho_2 = p_g_t[t] - u_norm_2;
+
+        // Column must be sufficiently independent. Note that rho^2 is subject to cancellation.
+        if( !(rho_2 > 1e-12*p_g_t[t]) ){
+            skip[t] = true;
+            continue;
+        }
+        const double rho = std::sqrt(rho_2);
+        // Proposed new value for x_t must be positive.
+        const double d_t = (c[t] - dot(u.data(), d.data(), k)) / rho;
+        if( !(d_t / rho > 0.0) ){
+            skip[t] = true;
+            continue;
+        }
+
+        for( IndexType i = 0; i < k; ++i ){
+            R[i + k*capacity] = u[i];
+        }
+        R[k + k*capacity] = rho;
+        d[k] = d_t;
+        passive_set.push_back(t);
+        x_passive.push_back(0.0);
+        is_passive[t] = true;
+
+        // Inner loop: Solve least-squares problem on passive set and keep x feasible.
+        while( iteration < max_iteration ){
+            ++iteration;
+            const IndexType num_passive = passive_set.size();
+            back_substitution(d, num_passive);
+
+            bool is_feasible = true;
+            double alpha = 2.0;
+            IndexType alpha_index = num_passive;
+            for( IndexType i = 0; i < num_passive; ++i ){
+                if( z[i] <= 0.0 ){
+                    is_feasible = false;
+                    const double value = x_passive[i] / (x_passive[i] - z[i]);
+                    if( value < alpha ){
+                        alpha = value;
+                        alpha_index = i;
+                    }
+                }
+            }
+            if( is_feasible ){
+                std::copy(z.begin(), z.begin()+num_passive, x_passive.begin());
+                break;
+            }
+
+            for( IndexType i = 0; i < num_passive; ++i ){
+                x_passive[i] += alpha*(z[i] - x_passive[i]);
+            }
+            x_passive[alpha_index] = 0.0;
+
+            // Move all non-positive entries to active set.
+            for( IndexType ii = num_passive; ii > 0; --ii ){
+                const IndexType i = ii-1;
+                if( x_passive[i] <= 0.0 ){
+                    remove_column(i);
+                }
+            }
+        }
+        compute_gradient = true;
+
+        if( iteration >= max_iteration ){
+            std::cerr << "ITERATION COUNT EXCEEDED.  MORE THAN 3*N ITERATIONS." << std::endl;
+            break;
+        }
+    }
+
+    // Refine passive solution (corrected semi-normal equations): x_P += (R^T*R)^-1 * A_P^T*(b - A_P*x_P).
+    VectorType residual(m);
+    auto compute_residual = [&]() {
+        std::copy(B.begin(), B.end(), residual.begin());
+        for( IndexType i = 0; i < passive_set.size(); ++i ){
+            const double* p_a = column(passive_set[i]);
+            const double value = x_passive[i];
+            for( IndexType l = 0; l < m; ++l ){
+                residual[l] -= value*p_a[l];
+            }
+        }
+    };
+    const IndexType num_passive = passive_set.size();
+    for( IndexType step = 0; step < 2; ++step ){
+        compute_residual();
+        for( IndexType i = 0; i < num_passive; ++i ){
+            u[i] = dot(column(passive_set[i]), residual.data(), m);
+        }
+        forward_substitution(u, num_passive);
+        back_substitution(u, num_passive);
+        for( IndexType i = 0; i < num_passive; ++i ){
+            x_passive[i] = std::max(x_passive[i] + z[i], 0.0);
+        }
+    }
+    compute_residual();
+
+    // Map back to unscaled variables.
+    for( IndexType i = 0; i < num_passive; ++i ){
+        X[passive_set[i]] = x_passive[i]*scaling[passive_set[i]];
+    }
+
+    return std::sqrt(dot(residual.data(), residual.data(), m));
+}
+
+} // End namespace queso
@@ -17,6 +17,8 @@
 
 //// STL includes
 #include <vector>
+//// Project includes
+#include "queso/includes/define.hpp"
 
 namespace queso {
 
@@ -26,7 +28,13 @@ namespace queso {
 
 /**
  * @class  NNLS solver
- * @brief  Wrapper to Non-Negative-Least-Squares-Solver (see: external_libaries/nnls/nnls_impl.h).
+ * @brief  Non-Negative-Least-Squares-Solver with interchangeable backends:
+ *         - lawson_hanson: Wrapper to external_libaries/nnls/nnls_impl.h.
+ *         - scaled_lawson_hanson: Same as lawson_hanson, but columns of A are equilibrated (unit L2-norm) before solving.
+ *         - active_set_cholesky: Active set method (Lawson-Hanson pivoting) on column-scaled normal equations. The Cholesky factor R
+ *           of the passive set (A_P^T*A_P = R^T*R) is updated by rank-1 modifications (append column/Givens downdate) instead of
+ *           applying Householder transformations to all columns of A. Columns of A^T*A are only computed when required.
+ *           The final solution is refined by the corrected semi-normal equations.
  * @author Manuel Messmer
 **/
 class NNLS {
@@ -51,6 +59,32 @@ public:
     /// @return Residuum (double)
     static double solve(MatrixType& A, VectorType& B, VectorType& X);
 
+    /// @brief  Solves ||Ax-b||_L2 as a non-negative least-squares problem with the given backend.
+    ///         For better performance A and B are not copied. However, this means they are non-const!!
+    /// @param A Matrix as vector form (Serialized matrix, column first)
+    /// @param b RHS
+    /// @param X Solution Vector
+    /// @param Solver Backend.
+    /// @return Residuum (double)
+    static double solve(MatrixType& A, VectorType& B, VectorType& X, NNLSSolverType Solver);
+
+    ///@}
+private:
+    ///@name Private Operations
+    ///@{
+
+    /// @brief Scales all columns of A to unit L2-norm. Zero columns are not scaled.
+    /// @param A Matrix as vector form (Serialized matrix, column first)
+    /// @param NumRows
+    /// @param[out] rScaling Scaling factors, such that A_scaled[:,j] = A[:,j]*rScaling[j].
+    static void ScaleColumns(MatrixType& A, IndexType NumRows, VectorType& rScaling);
+
+    /// @brief Solves NNLS via Lawson-Hanson with column scaling.
+    static double SolveScaledLawsonHanson(MatrixType& A, VectorType& B, VectorType& X);
+
+    /// @brief Solves NNLS via active set method with updated Cholesky factorization of column-scaled normal equations.
+    static double SolveActiveSetCholesky(MatrixType& A, VectorType& B, VectorType& X);
+
     ///@}
 
 }; // End Class NNLS
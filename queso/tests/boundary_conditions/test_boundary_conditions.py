@@ -87,5 +87,45 @@ class TestBoundaryConditions(QuESoTestCase):
         pyqueso.Run()
         self.check_values(pyqueso)
 
+    def test_face_adjacency(self):
+        pyqueso = PyQuESo("queso/tests/boundary_conditions/QuESoSettings1.json")
+        pyqueso.Run()
+        elements = pyqueso.GetElements()
+        trimmed = {element.ID() : element.IsTrimmed() for element in elements}
+
+        adjacency = pyqueso.GetFaceAdjacency(False, True, 1)
+        offsets = adjacency.offsets
+        neighbour_ids = adjacency.neighbour_ids
+        flags = adjacency.flags
+        # Arrays reference the C++ data and are read-only.
+        self.assertIsNotNone(offsets.base)
+        self.assertFalse(offsets.flags.writeable)
+        self.assertEqual(len(offsets), len(elements)+1)
+        self.assertEqual(offsets[-1], adjacency.NumberOfEntries())
+        self.assertEqual(len(adjacency.face_points), 4*adjacency.NumberOfEntries())
+        self.assertEqual(adjacency.face_points.shape[1], 3)
+
+        for i, element in enumerate(elements):
+            self.assertEqual(adjacency.element_ids[i], element.ID())
+            lower = element.LowerBoundXYZ()
+            upper = element.UpperBoundXYZ()
+            for j in range(offsets[i], offsets[i+1]):
+                neighbour_id = neighbour_ids[j]
+                self.assertEqual(bool(flags[j] & adjacency.element_is_trimmed), element.IsTrimmed())
+                self.assertEqual(bool(flags[j] & adjacency.neighbour_is_trimmed), trimmed[neighbour_id])
+                axis = adjacency.directions[j] // 2
+                begin, end = adjacency.face_point_offsets[j], adjacency.face_point_offsets[j+1]
+                face_area = 1.0
+                for k in range(3):
+                    if k != axis:
+                        face_area *= (upper[k] - lower[k])
+                self.assertAlmostEqual(sum(adjacency.face_weights[begin:end]), face_area, 10)
+
+        ghost_adjacency = pyqueso.GetFaceAdjacency(True)
+        self.assertFalse(ghost_adjacency.HasFacePoints())
+        self.assertTrue(all(ghost_adjacency.flags != 0))
+        num_ghost_faces = sum(1 for j in range(adjacency.NumberOfEntries()) if flags[j] != 0)
+        self.assertEqual(ghost_adjacency.NumberOfEntries(), num_ghost_faces)
+
 if __name__ == "__main__":
     unittest.main()
@@ -26,7 +26,9 @@ class QuadratureTrimmedElementTester : public QuadratureTrimmedElement<TElementT
 public:
     using QuadratureTrimmedElement<TElementType>::DistributeIntegrationPoints;
     using QuadratureTrimmedElement<TElementType>::ComputeConstantTerms;
+    using QuadratureTrimmedElement<TElementType>::ComputeConstantTermSensitivities;
     using QuadratureTrimmedElement<TElementType>::MomentFitting;
+    using QuadratureTrimmedElement<TElementType>::ComputeEliminationCosts;
     using QuadratureTrimmedElement<TElementType>::PointElimination;
 };
 
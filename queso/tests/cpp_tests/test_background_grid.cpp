@@ -213,6 +213,84 @@ BOOST_AUTO_TEST_CASE(TestBackgroundGridZ) {
     QuESo_CHECK_EQUAL(active_element_counter, 23);
 } // End Testcase
 
+BOOST_AUTO_TEST_CASE(TestBackgroundGridFaceAdjacency) {
+    QuESo_INFO << "Testing :: Test Background Grid :: Face Adjacency" << std::endl;
+
+    Vector3i number_of_elements = {3, 4, 2};
+    auto p_grid = CreateTestBackgroundGrid(number_of_elements);
+    p_grid->pGetElement(5)->SetIsTrimmed(true);
+
+    const auto adjacency = p_grid->ComputeFaceAdjacency(false, true, 2);
+
+    // 46 faces in the full 3x4x2 grid. Element 17 (missing) has 5 neighbours.
+    QuESo_CHECK_EQUAL(adjacency.NumberOfRows(), 23);
+    QuESo_CHECK_EQUAL(adjacency.NumberOfEntries(), 82);
+    QuESo_CHECK_EQUAL(adjacency.Offsets().size(), 24);
+    QuESo_CHECK_EQUAL(adjacency.Offsets().back(), 82);
+
+    // Build map: element id -> row.
+    std::unordered_map<IndexType, IndexType> row_map;
+    for( IndexType i = 0; i < adjacency.NumberOfRows(); ++i ){
+        QuESo_CHECK_EQUAL(adjacency.ElementIds()[i], p_grid->GetElements()[i]->GetId());
+        row_map[adjacency.ElementIds()[i]] = i;
+    }
+    QuESo_CHECK( row_map.find(17) == row_map.end() );
+
+    const IndexType nx = number_of_elements[0];
+    const IndexType nxy = number_of_elements[0]*number_of_elements[1];
+    const std::array<int, 6> index_offsets = {1, -1, static_cast<int>(nx), -static_cast<int>(nx),
+                                               static_cast<int>(nxy), -static_cast<int>(nxy)};
+    for( IndexType i = 0; i < adjacency.NumberOfRows(); ++i ){
+        const IndexType element_id = adjacency.ElementIds()[i];
+        for( IndexType j = adjacency.Offsets()[i]; j < adjacency.Offsets()[i+1]; ++j ){
+            const IndexType neighbour_id = adjacency.NeighbourIds()[j];
+            const IndexType direction = adjacency.Directions()[j];
+            QuESo_CHECK_NOT_EQUAL(neighbour_id, 17);
+            QuESo_CHECK_EQUAL(static_cast<int>(neighbour_id), static_cast<int>(element_id) + index_offsets[direction]);
+
+            // Check flags.
+            const bool element_trimmed = (element_id == 5);
+            const bool neighbour_trimmed = (neighbour_id == 5);
+            QuESo_CHECK_EQUAL( static_cast<bool>(adjacency.GetFlags()[j] & FaceAdjacency::element_is_trimmed), element_trimmed );
+            QuESo_CHECK_EQUAL( static_cast<bool>(adjacency.GetFlags()[j] & FaceAdjacency::neighbour_is_trimmed), neighbour_trimmed );
+
+            // Check symmetry: The neighbour must store the opposite face.
+            const IndexType row_neighbour = row_map[neighbour_id];
+            const IndexType opposite_direction = (direction % 2 == 0) ? direction+1 : direction-1;
+            bool found = false;
+            for( IndexType k = adjacency.Offsets()[row_neighbour]; k < adjacency.Offsets()[row_neighbour+1]; ++k ){
+                if( adjacency.NeighbourIds()[k] == element_id ){
+                    QuESo_CHECK_EQUAL( static_cast<IndexType>(adjacency.Directions()[k]), opposite_direction );
+                    found = true;
+                }
+            }
+            QuESo_CHECK(found);
+
+            // Check face points: All elements span [0, 0.1]^3.
+            const IndexType axis = direction / 2;
+            const double expected_coordinate = (direction % 2 == 0) ? 0.1 : 0.0;
+            QuESo_CHECK_EQUAL(adjacency.FacePointOffsets()[j+1] - adjacency.FacePointOffsets()[j], 9);
+            double area = 0.0;
+            for( IndexType k = adjacency.FacePointOffsets()[j]; k < adjacency.FacePointOffsets()[j+1]; ++k ){
+                QuESo_CHECK_NEAR(adjacency.FacePoints()[3*k+axis], expected_coordinate, 1e-14);
+                area += adjacency.FaceWeights()[k];
+            }
+            QuESo_CHECK_NEAR(area, 0.01, 1e-14);
+        }
+    }
+    QuESo_CHECK_EQUAL(adjacency.NumberOfFacePoints(), 9*82);
+
+    // Ghost faces only. Element 5 has 4 active neighbours (Element 17 is missing).
+    const auto ghost_adjacency = p_grid->ComputeFaceAdjacency(true);
+    QuESo_CHECK_EQUAL(ghost_adjacency.NumberOfRows(), 23);
+    QuESo_CHECK_EQUAL(ghost_adjacency.NumberOfEntries(), 8);
+    QuESo_CHECK_IS_FALSE(ghost_adjacency.HasFacePoints());
+    QuESo_CHECK_EQUAL(ghost_adjacency.Offsets()[row_map[5]+1] - ghost_adjacency.Offsets()[row_map[5]], 4);
+    for( const auto flags : ghost_adjacency.GetFlags() ){
+        QuESo_CHECK(FaceAdjacency::IsGhostFace(flags));
+    }
+} // End Testcase
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // End namespace Testing
@@ -0,0 +1,124 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#define BOOST_TEST_DYN_LINK
+
+//// External includes
+#include <boost/test/unit_test.hpp>
+//// Project includes
+#include "queso/includes/checks.hpp"
+#include "queso/embedded_model.h"
+#include "queso/io/io_utilities.h"
+#include "queso/quadrature/background_grid_planner.hpp"
+
+namespace queso {
+namespace Testing {
+
+BOOST_AUTO_TEST_SUITE( BackgroundGridPlannerTestSuite )
+
+typedef BackgroundGridPlanner<EmbeddedModel::ElementType> PlannerType;
+
+Settings CreateSteeringKnuckleSettings() {
+    Settings settings;
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::input_filename, std::string("queso/tests/cpp_tests/data/steering_knuckle.stl"));
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::echo_level, 0u);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::write_output_to_file, false);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::grid_type, GridType::b_spline_grid);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_xyz, PointType{-130.0, -110.0, -110.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_xyz, PointType{20.0, 190.0, 190.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_uvw, PointType{0.0, 0.0, 0.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_uvw, PointType{1.0, 1.0, 1.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::number_of_elements, Vector3i{5, 10, 10});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::polynomial_order, Vector3i{2, 2, 2});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::grid_planning_volume_error, 1e-3);
+    settings[MainSettings::non_trimmed_quadrature_rule_settings].SetValue(NonTrimmedQuadratureRuleSettings::integration_method, IntegrationMethod::gauss);
+    settings[MainSettings::trimmed_quadrature_rule_settings].SetValue(TrimmedQuadratureRuleSettings::auto_tuning_sample_size, 4u);
+
+    return settings;
+}
+
+BOOST_AUTO_TEST_CASE(BackgroundGridPlannerFeatureSizeTest) {
+    QuESo_INFO << "Testing :: Test Background Grid Planner :: Local Feature Size" << std::endl;
+
+    // Cylinder with radius 1 and height 10: The thinnest section is the diameter.
+    TriangleMesh triangle_mesh{};
+    IO::ReadMeshFromSTL(triangle_mesh, "queso/tests/cpp_tests/data/cylinder.stl");
+    const auto feature_size = PlannerType::EstimateLocalFeatureSize(triangle_mesh, PlannerType::NumFeatureSamples);
+    QuESo_CHECK_RELATIVE_NEAR(feature_size.first, 2.0, 1e-2);
+    QuESo_CHECK_RELATIVE_NEAR(feature_size.second, 2.0, 1e-2);
+}
+
+BOOST_AUTO_TEST_CASE(BackgroundGridPlannerNumberOfElementsTest) {
+    QuESo_INFO << "Testing :: Test Background Grid Planner :: Number Of Elements" << std::endl;
+
+    const Settings settings = CreateSteeringKnuckleSettings();
+    QuESo_CHECK_EQUAL(PlannerType::GetNumberOfElements(settings, 30.0), Vector3i({5, 10, 10}));
+    QuESo_CHECK_EQUAL(PlannerType::GetNumberOfElements(settings, 31.0), Vector3i({5, 10, 10}));
+    QuESo_CHECK_EQUAL(PlannerType::GetNumberOfElements(settings, 29.0), Vector3i({6, 11, 11}));
+    QuESo_CHECK_EQUAL(PlannerType::GetNumberOfElements(settings, 1000.0), Vector3i({1, 1, 1}));
+}
+
+BOOST_AUTO_TEST_CASE(BackgroundGridPlannerSteeringKnuckleTest) {
+    QuESo_INFO << "Testing :: Test Background Grid Planner :: Steering Knuckle" << std::endl;
+
+    Settings settings = CreateSteeringKnuckleSettings();
+    const ModelInfo model_info = EmbeddedModel::PlanBackgroundGrid(settings);
+    const auto& r_planning_info = model_info[MainInfo::grid_planning_info];
+
+    // Candidates are ordered from coarse to fine.
+    const auto& r_candidates = r_planning_info.GetList(GridPlanningInfo::candidates_list);
+    QuESo_CHECK_GT(r_candidates.size(), 2);
+    for( IndexType i = 1; i < r_candidates.size(); ++i ){
+        const auto& r_previous = r_candidates[i-1].GetValue<Vector3i>(GridPlanningCandidateInfo::number_of_elements);
+        const auto& r_current = r_candidates[i].GetValue<Vector3i>(GridPlanningCandidateInfo::number_of_elements);
+        QuESo_CHECK_LT(r_previous[0]*r_previous[1]*r_previous[2], r_current[0]*r_current[1]*r_current[2]);
+        QuESo_CHECK( !r_candidates[i-1].GetValue<bool>(GridPlanningCandidateInfo::is_extrapolated)
+            || r_candidates[i].GetValue<bool>(GridPlanningCandidateInfo::is_extrapolated) );
+    }
+
+    const double min_feature_size = r_planning_info.GetValue<double>(GridPlanningInfo::min_feature_size);
+    QuESo_CHECK_GT(min_feature_size, 0.0);
+    QuESo_CHECK_LT(min_feature_size, r_planning_info.GetValue<double>(GridPlanningInfo::median_feature_size)+EPS0);
+    QuESo_CHECK_GT(r_planning_info.GetValue<IndexType>(GridPlanningInfo::num_sampled_elements), 0);
+    QuESo_CHECK_GT(r_planning_info.GetValue<double>(GridPlanningInfo::predicted_runtime), 0.0);
+    QuESo_CHECK_GT(model_info[MainInfo::elapsed_time_info][ElapsedTimeInfo::volume_time_info].GetValue<double>(VolumeTimeInfo::grid_planning), 0.0);
+
+    // Proposal is one of the candidates and resolves the local feature size, if the target is met.
+    const auto& r_proposed = r_planning_info.GetValue<Vector3i>(GridPlanningInfo::proposed_number_of_elements);
+    bool is_candidate = false;
+    for( const auto& r_candidate : r_candidates ){
+        is_candidate |= (r_candidate.GetValue<Vector3i>(GridPlanningCandidateInfo::number_of_elements) == r_proposed);
+    }
+    QuESo_CHECK( is_candidate );
+    if( r_planning_info.GetValue<bool>(GridPlanningInfo::target_met) ){
+        QuESo_CHECK_LT(r_planning_info.GetValue<double>(GridPlanningInfo::predicted_volume_error), 1e-3+EPS0);
+        QuESo_CHECK_LT(150.0/static_cast<double>(r_proposed[0]), min_feature_size+EPS0);
+    }
+
+    // Classified candidates count all cells that are classified as trimmed. The pipeline might neglect some of them.
+    const auto& r_candidate = r_candidates[2];
+    QuESo_CHECK( !r_candidate.GetValue<bool>(GridPlanningCandidateInfo::is_extrapolated) );
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::number_of_elements,
+        r_candidate.GetValue<Vector3i>(GridPlanningCandidateInfo::number_of_elements));
+    EmbeddedModel embedded_model(settings);
+    embedded_model.CreateAllFromSettings();
+    const IndexType num_trimmed_elements = embedded_model.GetModelInfo()[MainInfo::background_grid_info].GetValue<IndexType>(BackgroundGridInfo::num_trimmed_elements);
+    const IndexType predicted_num_trimmed_elements = r_candidate.GetValue<IndexType>(GridPlanningCandidateInfo::num_trimmed_elements);
+    QuESo_CHECK_LT(num_trimmed_elements, predicted_num_trimmed_elements+1);
+    QuESo_CHECK_RELATIVE_NEAR(static_cast<double>(num_trimmed_elements), static_cast<double>(predicted_num_trimmed_elements), 0.1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // End namespace Testing
+} // End namespace queso
@@ -0,0 +1,122 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#define BOOST_TEST_DYN_LINK
+
+//// STL includes
+#include <sstream>
+//// External includes
+#include <boost/test/unit_test.hpp>
+//// Project includes
+#include "queso/includes/checks.hpp"
+#include "queso/batch_runner.h"
+#include "queso/embedded_model.h"
+
+namespace queso {
+namespace Testing {
+
+BOOST_AUTO_TEST_SUITE( BatchRunnerTestSuite )
+
+Settings CreateBatchSettings(const std::string& rFilename, const PointType& rLowerBound, const PointType& rUpperBound, const Vector3i& rNumberOfElements){
+    Settings settings;
+    auto& r_general_settings = settings[MainSettings::general_settings];
+    r_general_settings.SetValue(GeneralSettings::input_filename, rFilename);
+    r_general_settings.SetValue(GeneralSettings::echo_level, 0u);
+    r_general_settings.SetValue(GeneralSettings::write_output_to_file, false);
+    auto& r_grid_settings = settings[MainSettings::background_grid_settings];
+    r_grid_settings.SetValue(BackgroundGridSettings::grid_type, GridType::b_spline_grid);
+    r_grid_settings.SetValue(BackgroundGridSettings::lower_bound_xyz, rLowerBound);
+    r_grid_settings.SetValue(BackgroundGridSettings::upper_bound_xyz, rUpperBound);
+    r_grid_settings.SetValue(BackgroundGridSettings::lower_bound_uvw, rLowerBound);
+    r_grid_settings.SetValue(BackgroundGridSettings::upper_bound_uvw, rUpperBound);
+    r_grid_settings.SetValue(BackgroundGridSettings::number_of_elements, rNumberOfElements);
+    r_grid_settings.SetValue(BackgroundGridSettings::polynomial_order, Vector3i{2, 2, 2});
+    settings[MainSettings::non_trimmed_quadrature_rule_settings].SetValue(NonTrimmedQuadratureRuleSettings::integration_method, IntegrationMethod::gauss);
+
+    return settings;
+}
+
+void CheckBatch(IndexType NumOuterThreads, IndexType NumInnerThreads){
+    const std::string cylinder_filename = "queso/tests/cpp_tests/data/cylinder.stl";
+    const std::string cube_filename = "queso/tests/cpp_tests/data/cube_with_cavity.stl";
+    const std::string missing_filename = "queso/tests/cpp_tests/data/does_not_exist.stl";
+
+    std::vector<Settings> settings_vector{};
+    settings_vector.push_back( CreateBatchSettings(cylinder_filename, {-1.5, -1.5, -1.0}, {1.5, 1.5, 11.0}, {3, 3, 6}) );
+    settings_vector.push_back( CreateBatchSettings(cube_filename, {-1.5, -1.5, -1.5}, {1.5, 1.5, 1.5}, {4, 4, 4}) );
+    settings_vector.push_back( CreateBatchSettings(missing_filename, {-1.5, -1.5, -1.5}, {1.5, 1.5, 1.5}, {4, 4, 4}) );
+    settings_vector.push_back( CreateBatchSettings(cylinder_filename, {-1.5, -1.5, -1.0}, {1.5, 1.5, 11.0}, {4, 4, 8}) );
+
+    BatchRunner batch_runner(NumOuterThreads, NumInnerThreads);
+    for( const auto& r_settings : settings_vector ){
+        batch_runner.AddModel(r_settings);
+    }
+    QuESo_CHECK_EQUAL(batch_runner.NumberOfModels(), 4);
+    QuESo_CHECK_EQUAL(batch_runner.NumberOfOuterThreads(), NumOuterThreads);
+    QuESo_CHECK_EQUAL(batch_runner.NumberOfInnerThreads(), NumInnerThreads);
+
+    const auto& r_results = batch_runner.Run();
+    QuESo_CHECK_EQUAL(r_results.size(), 4);
+    QuESo_CHECK_EQUAL(batch_runner.NumberOfFailedModels(), 1);
+    QuESo_CHECK_GT(batch_runner.GetElapsedTime(), 0.0);
+    QuESo_CHECK_GT(batch_runner.GetAccumulatedModelTime(), 0.0);
+
+    // Results are stored in the order in which the models were added.
+    for( IndexType i = 0; i < settings_vector.size(); ++i ){
+        const auto& r_result = r_results[i];
+        const auto& r_filename = settings_vector[i][MainSettings::general_settings].GetValue<std::string>(GeneralSettings::input_filename);
+        QuESo_CHECK_EQUAL(r_result.input_filename, r_filename);
+        if( r_filename == missing_filename ){
+            QuESo_CHECK_IS_FALSE(r_result.success);
+            QuESo_CHECK( r_result.error_message.find("Could not open file") != std::string::npos );
+            continue;
+        }
+        QuESo_CHECK(r_result.success);
+        QuESo_CHECK_LT(r_result.volume_error, 1e-3);
+        QuESo_CHECK_GT(r_result.num_trimmed_elements, 0);
+        QuESo_CHECK_GT(r_result.elapsed_time, 0.0);
+
+        // Same result as a model that is computed separately.
+        EmbeddedModel embedded_model(settings_vector[i]);
+        embedded_model.CreateAllFromSettings();
+        const auto& r_model_info = embedded_model.GetModelInfo();
+        QuESo_CHECK_EQUAL(r_result.num_active_elements, r_model_info[MainInfo::background_grid_info].GetValue<IndexType>(BackgroundGridInfo::num_active_elements));
+        QuESo_CHECK_EQUAL(r_result.num_trimmed_elements, r_model_info[MainInfo::background_grid_info].GetValue<IndexType>(BackgroundGridInfo::num_trimmed_elements));
+        QuESo_CHECK_EQUAL(r_result.tot_num_points, r_model_info[MainInfo::quadrature_info].GetValue<IndexType>(QuadratureInfo::tot_num_points));
+    }
+
+    // Report contains header, one line per model and summary.
+    std::stringstream report;
+    batch_runner.PrintReport(report);
+    IndexType num_lines = 0;
+    std::string line;
+    while( std::getline(report, line) ){
+        ++num_lines;
+    }
+    QuESo_CHECK_EQUAL(num_lines, 7);
+}
+
+BOOST_AUTO_TEST_CASE(BatchRunnerOuterParallelismTest) {
+    QuESo_INFO << "Testing :: Test Batch Runner :: Outer Parallelism" << std::endl;
+    CheckBatch(3, 1);
+}
+
+BOOST_AUTO_TEST_CASE(BatchRunnerNestedParallelismTest) {
+    QuESo_INFO << "Testing :: Test Batch Runner :: Nested Parallelism" << std::endl;
+    CheckBatch(2, 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // End namespace Testing
+} // End namespace queso
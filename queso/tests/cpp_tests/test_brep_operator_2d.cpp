@@ -0,0 +1,216 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#define BOOST_TEST_DYN_LINK
+
+//// STL includes
+#include <cmath>
+//// External includes
+#include <boost/test/unit_test.hpp>
+//// Project includes
+#include "queso/includes/checks.hpp"
+#include "queso/embedding/brep_operator_2d.h"
+#include "queso/embedding/clipper.h"
+#include "queso/containers/grid_indexer.hpp"
+#include "queso/embedded_model.h"
+
+namespace queso {
+namespace Testing {
+
+BOOST_AUTO_TEST_SUITE( BRepOperator2DTestSuite )
+
+typedef BRepOperator2D::PolylineType PolylineType;
+typedef BRepOperator2D::PolylineVectorType PolylineVectorType;
+
+const double pi = 4.0*std::atan(1.0);
+
+/// Returns circle (polygon) with NumVertices. Counter-clockwise, if Orientation = 1.0. Clockwise, if Orientation = -1.0.
+PolylineType CreateCircle(double Radius, IndexType NumVertices, double Orientation) {
+    PolylineType circle{};
+    for( IndexType i = 0; i < NumVertices; ++i ){
+        const double phi = Orientation*2.0*pi*static_cast<double>(i)/static_cast<double>(NumVertices);
+        circle.push_back( {Radius*std::cos(phi), Radius*std::sin(phi), 0.0} );
+    }
+    return circle;
+}
+
+/// Returns exact integral of x^2 over domain bounded by rPolylines.
+double IntegrateXSquare(const PolylineVectorType& rPolylines) {
+    double value = 0.0;
+    for( const auto& r_polyline : rPolylines ){
+        for( IndexType i = 0; i < r_polyline.size(); ++i ){
+            const auto& r_a = r_polyline[i];
+            const auto& r_b = r_polyline[(i+1) % r_polyline.size()];
+            value += (r_a[0]*r_a[0] + r_a[0]*r_b[0] + r_b[0]*r_b[0])*(r_a[0]*r_b[1] - r_b[0]*r_a[1]);
+        }
+    }
+    return value / 12.0;
+}
+
+Settings CreateAnnulusSettings() {
+    Settings settings;
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::input_filename, std::string("annulus"));
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::echo_level, 0u);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::write_output_to_file, false);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::grid_type, GridType::b_spline_grid);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_xyz, PointType{-1.2, -1.2, 0.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_xyz, PointType{1.2, 1.2, 1.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_uvw, PointType{-1.2, -1.2, 0.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_uvw, PointType{1.2, 1.2, 1.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::number_of_elements, Vector3i{12, 12, 1});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::polynomial_order, Vector3i{2, 2, 2});
+    settings[MainSettings::trimmed_quadrature_rule_settings].SetValue(TrimmedQuadratureRuleSettings::moment_fitting_residual, 1e-10);
+    settings[MainSettings::non_trimmed_quadrature_rule_settings].SetValue(NonTrimmedQuadratureRuleSettings::integration_method, IntegrationMethod::gauss);
+
+    return settings;
+}
+
+BOOST_AUTO_TEST_CASE(ClipPolygonTest) {
+    QuESo_INFO << "Testing :: Test BRepOperator2D :: Clip Polygon" << std::endl;
+
+    // Non-convex L-shape.
+    const PolylineType l_shape = { {0.0, 0.0, 0.0}, {2.0, 0.0, 0.0}, {2.0, 1.0, 0.0}, {1.0, 1.0, 0.0}, {1.0, 2.0, 0.0}, {0.0, 2.0, 0.0} };
+    const auto clipped_1 = Clipper::ClipPolygon(l_shape, {0.5, 0.5, -1.0}, {1.5, 1.5, 1.0});
+    QuESo_CHECK_NEAR(BRepOperator2D::Area({clipped_1}), 0.75, 1e-14);
+    QuESo_CHECK_EQUAL(BRepOperator2D::WindingNumber({1.25, 0.75, 0.0}, {clipped_1}), 1);
+    QuESo_CHECK_EQUAL(BRepOperator2D::WindingNumber({1.25, 1.25, 0.0}, {clipped_1}), 0);
+
+    // Rectangle is fully contained in polygon.
+    const auto clipped_2 = Clipper::ClipPolygon(l_shape, {0.2, 0.2, -1.0}, {0.8, 1.8, 1.0});
+    QuESo_CHECK_NEAR(BRepOperator2D::Area({clipped_2}), 0.6*1.6, 1e-14);
+
+    // Polygon is fully outside of rectangle.
+    const auto clipped_3 = Clipper::ClipPolygon(l_shape, {1.2, 1.2, -1.0}, {1.8, 1.8, 1.0});
+    QuESo_CHECK_EQUAL(clipped_3.size(), 0);
+
+    // Clipped loops of all cells sum up to the entire area. Orientation is kept.
+    const PolylineType circle = CreateCircle(1.0, 100, -1.0);
+    double area = 0.0;
+    for( IndexType i = 0; i < 4; ++i ){
+        for( IndexType j = 0; j < 4; ++j ){
+            const PointType lower_bound{-1.0 + 0.5*i, -1.0 + 0.5*j, 0.0};
+            const PointType upper_bound{-0.5 + 0.5*i, -0.5 + 0.5*j, 0.0};
+            area += BRepOperator2D::Area({Clipper::ClipPolygon(circle, lower_bound, upper_bound)});
+        }
+    }
+    QuESo_CHECK_NEAR(area, BRepOperator2D::Area({circle}), 1e-13);
+    QuESo_CHECK_LT(area, 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(BRepOperator2DClassificationTest) {
+    QuESo_INFO << "Testing :: Test BRepOperator2D :: Element Classification" << std::endl;
+
+    const PolylineVectorType annulus = { CreateCircle(1.0, 200, 1.0), CreateCircle(0.4, 100, -1.0) };
+    BRepOperator2D brep_operator(annulus);
+    QuESo_CHECK_NEAR(brep_operator.Area(), pi*(1.0-0.16), 1e-3);
+    QuESo_CHECK( brep_operator.IsInside({0.7, 0.0, 0.0}) );
+    QuESo_CHECK( !brep_operator.IsInside({0.0, 0.0, 0.0}) );
+    QuESo_CHECK( !brep_operator.IsInside({1.1, 0.0, 0.0}) );
+
+    const Settings settings = CreateAnnulusSettings();
+    const GridIndexer grid_indexer(settings);
+    const auto p_states = brep_operator.pGetElementClassifications(settings);
+    IndexType num_inside = 0;
+    IndexType num_trimmed = 0;
+    for( IndexType index = 0; index < grid_indexer.NumberOfElements(); ++index ){
+        const auto bounding_box = grid_indexer.GetBoundingBoxXYZFromIndex(index);
+        const auto state = (*p_states)[index];
+        if( brep_operator.IsTrimmed(bounding_box.first, bounding_box.second) ){
+            QuESo_CHECK( state == IntersectionState::trimmed );
+            ++num_trimmed;
+        } else {
+            const PointType center = Math::Mult(0.5, Math::Add(bounding_box.first, bounding_box.second));
+            const auto state_ref = brep_operator.IsInside(center) ? IntersectionState::inside : IntersectionState::outside;
+            QuESo_CHECK( state == state_ref );
+            num_inside += (state == IntersectionState::inside);
+        }
+    }
+    QuESo_CHECK_GT(num_inside, 0);
+    QuESo_CHECK_GT(num_trimmed, 0);
+
+    // Trimmed domains of all cells sum up to the entire area.
+    double area = 0.0;
+    for( IndexType index = 0; index < grid_indexer.NumberOfElements(); ++index ){
+        const auto bounding_box = grid_indexer.GetBoundingBoxXYZFromIndex(index);
+        if( (*p_states)[index] == IntersectionState::trimmed ){
+            const auto p_loops = brep_operator.pGetTrimmedDomain(bounding_box.first, bounding_box.second, 0.0);
+            area += p_loops ? BRepOperator2D::Area(*p_loops) : 0.0;
+        } else if( (*p_states)[index] == IntersectionState::inside ){
+            area += (bounding_box.second[0]-bounding_box.first[0])*(bounding_box.second[1]-bounding_box.first[1]);
+        }
+    }
+    QuESo_CHECK_RELATIVE_NEAR(area, brep_operator.Area(), 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(EmbeddedModel2DTest) {
+    QuESo_INFO << "Testing :: Test BRepOperator2D :: Embedded Model 2D" << std::endl;
+
+    const PolylineVectorType annulus = { CreateCircle(1.0, 200, 1.0), CreateCircle(0.4, 100, -1.0) };
+    Settings settings = CreateAnnulusSettings();
+    auto& r_condition_settings = settings.CreateNewConditionSettings();
+    r_condition_settings.SetValue(ConditionSettings::condition_id, 1u);
+    r_condition_settings.SetValue(ConditionSettings::condition_type, std::string("SurfaceLoadCondition"));
+    r_condition_settings.SetValue(ConditionSettings::input_filename, std::string("outer_boundary"));
+
+    EmbeddedModel embedded_model(settings);
+    embedded_model.CreateVolume2D(annulus);
+    // Conditions are given by open polylines. Hence, the closing vertex is added explicitly.
+    PolylineType outer_boundary = annulus[0];
+    outer_boundary.push_back(annulus[0][0]);
+    embedded_model.CreateCondition2D({outer_boundary}, settings.GetList(MainSettings::conditions_settings_list)[0]);
+
+    // Integrate 1 and x^2.
+    double area = 0.0;
+    double x_square = 0.0;
+    IndexType num_trimmed_elements = 0;
+    for( const auto& p_element : embedded_model.GetElements() ){
+        num_trimmed_elements += p_element->IsTrimmed();
+        const double det_j = p_element->DetJ();
+        for( const auto& r_point : p_element->GetIntegrationPoints() ){
+            const PointType point_global = p_element->PointFromParamToGlobal(r_point.data());
+            QuESo_CHECK_NEAR(point_global[2], 0.5, 1e-14);
+            area += r_point.Weight()*det_j;
+            x_square += r_point.Weight()*det_j*point_global[0]*point_global[0];
+        }
+    }
+    QuESo_CHECK_RELATIVE_NEAR(area, BRepOperator2D::Area(annulus), 1e-8);
+    QuESo_CHECK_RELATIVE_NEAR(x_square, IntegrateXSquare(annulus), 1e-8);
+    QuESo_CHECK_EQUAL(embedded_model.GetDiagnostics().NumberOfEvents(), 0);
+
+    // Same structures as in 3D mode.
+    const auto& r_model_info = embedded_model.GetModelInfo();
+    const IndexType num_active_elements = r_model_info[MainInfo::background_grid_info].GetValue<IndexType>(BackgroundGridInfo::num_active_elements);
+    QuESo_CHECK_EQUAL(num_active_elements, embedded_model.GetElements().size());
+    QuESo_CHECK_EQUAL(r_model_info[MainInfo::background_grid_info].GetValue<IndexType>(BackgroundGridInfo::num_trimmed_elements), num_trimmed_elements);
+    QuESo_CHECK_RELATIVE_NEAR(r_model_info[MainInfo::quadrature_info].GetValue<double>(QuadratureInfo::percentage_of_geometry_volume), 100.0, 1e-8);
+
+    // Condition is extruded over z-range of the grid.
+    QuESo_CHECK_EQUAL(embedded_model.GetConditions().size(), 1);
+    const auto& r_condition_info = r_model_info.GetList(MainInfo::conditions_infos_list)[0];
+    QuESo_CHECK_RELATIVE_NEAR(r_condition_info.GetValue<double>(ConditionInfo::surf_area), BRepOperator2D({annulus[0]}).Length(), 1e-12);
+    QuESo_CHECK_RELATIVE_NEAR(r_condition_info.GetValue<double>(ConditionInfo::perc_surf_area_in_active_domain), 100.0, 1e-8);
+
+    // Polylines must be oriented counter-clockwise.
+    EmbeddedModel embedded_model_2(settings);
+    BOOST_REQUIRE_THROW( embedded_model_2.CreateVolume2D({CreateCircle(1.0, 200, -1.0)}), std::exception );
+
+    // Grid must contain a single element in z-direction.
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::number_of_elements, Vector3i{12, 12, 2});
+    EmbeddedModel embedded_model_3(settings);
+    BOOST_REQUIRE_THROW( embedded_model_3.CreateVolume2D(annulus), std::exception );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // End namespace Testing
+} // End namespace queso
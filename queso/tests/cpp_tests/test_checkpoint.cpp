@@ -0,0 +1,294 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#define BOOST_TEST_DYN_LINK
+
+//// STL includes
+#include <cstdio>
+#include <algorithm>
+#include <fstream>
+#include <unordered_map>
+//// External includes
+#include <boost/test/unit_test.hpp>
+//// Project includes
+#include "queso/includes/checks.hpp"
+#include "queso/io/checkpoint.h"
+#include "queso/embedded_model.h"
+#include "queso/utilities/mesh_utilities.h"
+
+namespace queso {
+namespace Testing {
+
+BOOST_AUTO_TEST_SUITE( CheckpointTestSuite )
+
+typedef EmbeddedModel::ElementType ElementType;
+
+/// Returns size of file in bytes.
+std::size_t FileSize(const std::string& rFilename){
+    std::ifstream file(rFilename, std::ios::binary | std::ios::ate);
+    return static_cast<std::size_t>(file.tellg());
+}
+
+/// Truncates file to the given size in bytes.
+void TruncateFile(const std::string& rFilename, std::size_t Size){
+    std::ifstream in_file(rFilename, std::ios::binary);
+    std::vector<char> data( (std::istreambuf_iterator<char>(in_file)), std::istreambuf_iterator<char>() );
+    in_file.close();
+    data.resize( std::min(Size, data.size()) );
+    std::ofstream out_file(rFilename, std::ios::binary | std::ios::trunc);
+    out_file.write(data.data(), data.size());
+}
+
+Settings CreateCylinderSettings(const std::string& rCheckpointFilename, bool CheckpointTrimmedDomains, const Vector3i& rNumberOfElements){
+    Settings settings;
+    auto& r_general_settings = settings[MainSettings::general_settings];
+    r_general_settings.SetValue(GeneralSettings::input_filename, std::string("queso/tests/cpp_tests/data/cylinder.stl"));
+    r_general_settings.SetValue(GeneralSettings::echo_level, 0u);
+    r_general_settings.SetValue(GeneralSettings::write_output_to_file, false);
+    r_general_settings.SetValue(GeneralSettings::checkpoint_filename, rCheckpointFilename);
+    r_general_settings.SetValue(GeneralSettings::checkpoint_interval, 0.01);
+    r_general_settings.SetValue(GeneralSettings::checkpoint_trimmed_domains, CheckpointTrimmedDomains);
+    auto& r_grid_settings = settings[MainSettings::background_grid_settings];
+    r_grid_settings.SetValue(BackgroundGridSettings::grid_type, GridType::b_spline_grid);
+    r_grid_settings.SetValue(BackgroundGridSettings::lower_bound_xyz, PointType{-1.5, -1.5, -1.0});
+    r_grid_settings.SetValue(BackgroundGridSettings::upper_bound_xyz, PointType{1.5, 1.5, 11.0});
+    r_grid_settings.SetValue(BackgroundGridSettings::lower_bound_uvw, PointType{0.0, 0.0, 0.0});
+    r_grid_settings.SetValue(BackgroundGridSettings::upper_bound_uvw, PointType{1.0, 1.0, 1.0});
+    r_grid_settings.SetValue(BackgroundGridSettings::number_of_elements, rNumberOfElements);
+    r_grid_settings.SetValue(BackgroundGridSettings::polynomial_order, Vector3i{2, 2, 2});
+    settings[MainSettings::non_trimmed_quadrature_rule_settings].SetValue(NonTrimmedQuadratureRuleSettings::integration_method, IntegrationMethod::gauss);
+
+    auto& r_cond_settings_1 = settings.CreateNewConditionSettings();
+    r_cond_settings_1.SetValue(ConditionSettings::condition_id, 1u);
+    r_cond_settings_1.SetValue(ConditionSettings::input_filename, std::string("queso/tests/cpp_tests/data/cylinder.stl"));
+    r_cond_settings_1.SetValue(ConditionSettings::condition_type, std::string("PenaltySupportCondition"));
+
+    auto& r_cond_settings_2 = settings.CreateNewConditionSettings();
+    r_cond_settings_2.SetValue(ConditionSettings::condition_id, 2u);
+    r_cond_settings_2.SetValue(ConditionSettings::input_filename, std::string("queso/tests/cpp_tests/data/cylinder_ascii.stl"));
+    r_cond_settings_2.SetValue(ConditionSettings::condition_type, std::string("SurfaceLoadCondition"));
+
+    return settings;
+}
+
+void CheckModelsAreEqual(const EmbeddedModel& rModel, const EmbeddedModel& rRestoredModel, bool CheckTrimmedDomains){
+    // Elements (order within container depends on the threads).
+    const auto& r_elements = rModel.GetElements();
+    const auto& r_restored_elements = rRestoredModel.GetElements();
+    QuESo_CHECK_EQUAL(r_elements.size(), r_restored_elements.size());
+    std::unordered_map<IndexType, const ElementType*> restored_elements_map{};
+    for( const auto& r_element : r_restored_elements ){
+        restored_elements_map[r_element->GetId()] = r_element.get();
+    }
+    for( const auto& r_element : r_elements ){
+        const auto it = restored_elements_map.find(r_element->GetId());
+        QuESo_CHECK( it != restored_elements_map.end() );
+        const ElementType& r_restored_element = *(it->second);
+        QuESo_CHECK_EQUAL(r_element->IsTrimmed(), r_restored_element.IsTrimmed());
+        const auto& r_points = r_element->GetIntegrationPoints();
+        const auto& r_restored_points = r_restored_element.GetIntegrationPoints();
+        QuESo_CHECK_EQUAL(r_points.size(), r_restored_points.size());
+        for( IndexType i = 0; i < r_points.size(); ++i ){
+            QuESo_CHECK_POINT_NEAR(r_points[i].data(), r_restored_points[i].data(), ZEROTOL);
+            QuESo_CHECK_NEAR(r_points[i].Weight(), r_restored_points[i].Weight(), ZEROTOL);
+        }
+        if( CheckTrimmedDomains && r_element->IsTrimmed() ){
+            const auto& r_mesh = r_element->pGetTrimmedDomain()->GetTriangleMesh();
+            const auto& r_restored_mesh = r_restored_element.pGetTrimmedDomain()->GetTriangleMesh();
+            QuESo_CHECK_EQUAL(r_mesh.NumOfTriangles(), r_restored_mesh.NumOfTriangles());
+            QuESo_CHECK_RELATIVE_NEAR(MeshUtilities::Volume(r_mesh), MeshUtilities::Volume(r_restored_mesh), 1e-10);
+        }
+    }
+
+    // Conditions
+    const auto& r_conditions = rModel.GetConditions();
+    const auto& r_restored_conditions = rRestoredModel.GetConditions();
+    QuESo_CHECK_EQUAL(r_conditions.size(), r_restored_conditions.size());
+    for( IndexType i = 0; i < r_conditions.size(); ++i ){
+        QuESo_CHECK_EQUAL(r_conditions[i]->NumberOfSegments(), r_restored_conditions[i]->NumberOfSegments());
+        double area = 0.0;
+        for( const auto& r_segment : r_conditions[i]->GetSegments() ){
+            area += MeshUtilities::Area(r_segment->GetTriangleMesh());
+        }
+        double restored_area = 0.0;
+        for( const auto& r_segment : r_restored_conditions[i]->GetSegments() ){
+            restored_area += MeshUtilities::Area(r_segment->GetTriangleMesh());
+        }
+        QuESo_CHECK_RELATIVE_NEAR(area, restored_area, 1e-10);
+        const auto& r_info = rModel.GetModelInfo().GetList(MainInfo::conditions_infos_list)[i];
+        const auto& r_restored_info = rRestoredModel.GetModelInfo().GetList(MainInfo::conditions_infos_list)[i];
+        QuESo_CHECK_RELATIVE_NEAR(r_info.GetValue<double>(ConditionInfo::perc_surf_area_in_active_domain),
+            r_restored_info.GetValue<double>(ConditionInfo::perc_surf_area_in_active_domain), 1e-10);
+    }
+
+    // Model info
+    const auto& r_grid_info = rModel.GetModelInfo()[MainInfo::background_grid_info];
+    const auto& r_restored_grid_info = rRestoredModel.GetModelInfo()[MainInfo::background_grid_info];
+    QuESo_CHECK_EQUAL(r_grid_info.GetValue<IndexType>(BackgroundGridInfo::num_active_elements),
+        r_restored_grid_info.GetValue<IndexType>(BackgroundGridInfo::num_active_elements));
+    QuESo_CHECK_EQUAL(r_grid_info.GetValue<IndexType>(BackgroundGridInfo::num_trimmed_elements),
+        r_restored_grid_info.GetValue<IndexType>(BackgroundGridInfo::num_trimmed_elements));
+    const auto& r_quad_info = rModel.GetModelInfo()[MainInfo::quadrature_info];
+    const auto& r_restored_quad_info = rRestoredModel.GetModelInfo()[MainInfo::quadrature_info];
+    QuESo_CHECK_EQUAL(r_quad_info.GetValue<IndexType>(QuadratureInfo::tot_num_points),
+        r_restored_quad_info.GetValue<IndexType>(QuadratureInfo::tot_num_points));
+}
+
+double MomentFittingTime(const EmbeddedModel& rModel){
+    return rModel.GetModelInfo()[MainInfo::elapsed_time_info][ElapsedTimeInfo::volume_time_info]
+        .GetValue<double>(VolumeTimeInfo::solution_of_moment_fitting_eqs);
+}
+
+BOOST_AUTO_TEST_CASE(CheckpointRecordsTest) {
+    QuESo_INFO << "Testing :: Test Checkpoint :: Records" << std::endl;
+
+    const std::string filename = "queso_checkpoint_records_test.bin";
+    const std::uint64_t hash = Checkpoint::Hash(std::string("checkpoint_records_test"));
+    {
+        CheckpointWriter writer(filename, hash, 10.0);
+        for( IndexType i = 0; i < 100; ++i ){
+            Checkpoint::BufferType buffer{};
+            Checkpoint::Write(buffer, static_cast<double>(i));
+            Checkpoint::Write(buffer, static_cast<std::uint64_t>(2*i));
+            writer.AddRecord(Checkpoint::RecordType::element, i, buffer);
+        }
+        writer.Flush();
+        QuESo_CHECK_EQUAL(writer.NumberOfWrittenRecords(), 100);
+        Checkpoint::BufferType buffer{};
+        writer.AddRecord(Checkpoint::RecordType::condition, 1000, buffer);
+    } // Destructor writes remaining records.
+
+    auto records = Checkpoint::ReadRecords(filename, hash);
+    QuESo_CHECK_EQUAL(records.size(), 101);
+    for( IndexType i = 0; i < 100; ++i ){
+        QuESo_CHECK(records[i].type == Checkpoint::RecordType::element);
+        QuESo_CHECK_EQUAL(records[i].key, i);
+        std::size_t position = 0;
+        QuESo_CHECK_NEAR(Checkpoint::Read<double>(records[i].data, position), static_cast<double>(i), ZEROTOL);
+        QuESo_CHECK_EQUAL(Checkpoint::Read<std::uint64_t>(records[i].data, position), 2*i);
+        BOOST_REQUIRE_THROW(Checkpoint::Read<double>(records[i].data, position), std::exception);
+    }
+    QuESo_CHECK(records[100].type == Checkpoint::RecordType::condition);
+    QuESo_CHECK_EQUAL(records[100].data.size(), 0);
+
+    // Wrong hash.
+    QuESo_CHECK_EQUAL(Checkpoint::ReadRecords(filename, hash+1).size(), 0);
+
+    // Partially written record at the end of the file.
+    TruncateFile(filename, FileSize(filename)/2);
+    records = Checkpoint::ReadRecords(filename, hash);
+    QuESo_CHECK_GT(records.size(), 10);
+    QuESo_CHECK_LT(records.size(), 60);
+
+    // Corrupted record.
+    {
+        std::fstream file(filename, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(20 + 5*41 + 17); // Header + 5 records + payload offset of 6th record.
+        const char corrupted = 'x';
+        file.write(&corrupted, 1);
+    }
+    QuESo_CHECK_EQUAL(Checkpoint::ReadRecords(filename, hash).size(), 5);
+
+    // Not existing file.
+    std::remove(filename.c_str());
+    QuESo_CHECK_EQUAL(Checkpoint::ReadRecords(filename, hash).size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CheckpointMeshTest) {
+    QuESo_INFO << "Testing :: Test Checkpoint :: Mesh" << std::endl;
+
+    TriangleMesh triangle_mesh{};
+    IO::ReadMeshFromSTL(triangle_mesh, "queso/tests/cpp_tests/data/cylinder.stl");
+
+    Checkpoint::BufferType buffer{};
+    Checkpoint::WriteMesh(buffer, triangle_mesh);
+    std::size_t position = 0;
+    auto p_restored_mesh = Checkpoint::pReadMesh(buffer, position);
+    QuESo_CHECK_EQUAL(position, buffer.size());
+    QuESo_CHECK_EQUAL(p_restored_mesh->NumOfTriangles(), triangle_mesh.NumOfTriangles());
+    QuESo_CHECK_EQUAL(p_restored_mesh->NumOfVertices(), triangle_mesh.NumOfVertices());
+    for( IndexType triangle_id = 0; triangle_id < triangle_mesh.NumOfTriangles(); ++triangle_id ){
+        QuESo_CHECK_POINT_NEAR(p_restored_mesh->P1(triangle_id), triangle_mesh.P1(triangle_id), ZEROTOL);
+        QuESo_CHECK_POINT_NEAR(p_restored_mesh->P2(triangle_id), triangle_mesh.P2(triangle_id), ZEROTOL);
+        QuESo_CHECK_POINT_NEAR(p_restored_mesh->P3(triangle_id), triangle_mesh.P3(triangle_id), ZEROTOL);
+        QuESo_CHECK_POINT_NEAR(p_restored_mesh->Normal(triangle_id), triangle_mesh.Normal(triangle_id), ZEROTOL);
+    }
+    QuESo_CHECK_EQUAL(Checkpoint::Hash(*p_restored_mesh), Checkpoint::Hash(triangle_mesh));
+
+    // Truncated buffer.
+    buffer.resize(buffer.size()/2);
+    position = 0;
+    BOOST_REQUIRE_THROW(Checkpoint::pReadMesh(buffer, position), std::exception);
+}
+
+void RunCylinderRestart(bool CheckpointTrimmedDomains, const Vector3i& rNumberOfElements){
+    const std::string filename = "queso_checkpoint_cylinder_test.bin";
+    std::remove(filename.c_str());
+
+    const Settings settings = CreateCylinderSettings(filename, CheckpointTrimmedDomains, rNumberOfElements);
+    EmbeddedModel embedded_model(settings);
+    embedded_model.CreateAllFromSettings();
+    QuESo_CHECK_GT(MomentFittingTime(embedded_model), 0.0);
+
+    // Restart with complete checkpoint. No element must be recomputed.
+    {
+        EmbeddedModel restored_model(settings);
+        restored_model.CreateAllFromSettings();
+        CheckModelsAreEqual(embedded_model, restored_model, CheckpointTrimmedDomains);
+        QuESo_CHECK_NEAR(MomentFittingTime(restored_model), 0.0, ZEROTOL);
+    }
+
+    // Restart with incomplete checkpoint (e.g. job was killed while writing).
+    // Only header, classification and a few elements remain.
+    TruncateFile(filename, 8192);
+    {
+        EmbeddedModel restored_model(settings);
+        restored_model.CreateAllFromSettings();
+        CheckModelsAreEqual(embedded_model, restored_model, CheckpointTrimmedDomains);
+        QuESo_CHECK_GT(MomentFittingTime(restored_model), 0.0);
+    }
+
+    // Checkpoint must be complete again.
+    {
+        EmbeddedModel restored_model(settings);
+        restored_model.CreateAllFromSettings();
+        CheckModelsAreEqual(embedded_model, restored_model, CheckpointTrimmedDomains);
+        QuESo_CHECK_NEAR(MomentFittingTime(restored_model), 0.0, ZEROTOL);
+    }
+
+    // Different settings. Checkpoint must not be used.
+    {
+        Settings new_settings = CreateCylinderSettings(filename, CheckpointTrimmedDomains, rNumberOfElements);
+        new_settings[MainSettings::trimmed_quadrature_rule_settings].SetValue(TrimmedQuadratureRuleSettings::moment_fitting_residual, 1e-8);
+        EmbeddedModel new_model(new_settings);
+        new_model.CreateAllFromSettings();
+        QuESo_CHECK_GT(MomentFittingTime(new_model), 0.0);
+    }
+
+    std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(CheckpointRestartCylinderTest) {
+    QuESo_INFO << "Testing :: Test Checkpoint :: Restart Cylinder" << std::endl;
+    RunCylinderRestart(false, {6, 6, 12});
+}
+
+BOOST_AUTO_TEST_CASE(CheckpointRestartCylinderTrimmedDomainsTest) {
+    QuESo_INFO << "Testing :: Test Checkpoint :: Restart Cylinder :: Trimmed Domains" << std::endl;
+    RunCylinderRestart(true, {4, 4, 8});
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // End namespace Testing
+} // End namespace queso
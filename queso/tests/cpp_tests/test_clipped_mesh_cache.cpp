@@ -0,0 +1,132 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#define BOOST_TEST_DYN_LINK
+
+//// External includes
+#include <boost/test/unit_test.hpp>
+//// Project includes
+#include "queso/includes/checks.hpp"
+#include "queso/containers/triangle_mesh.hpp"
+#include "queso/containers/grid_indexer.hpp"
+#include "queso/io/io_utilities.h"
+#include "queso/embedding/brep_operator.h"
+
+namespace queso {
+namespace Testing {
+
+BOOST_AUTO_TEST_SUITE( ClippedMeshCacheTestSuite )
+
+void CheckMeshesAreEqual(const TriangleMeshInterface& rMesh1, const TriangleMeshInterface& rMesh2){
+    QuESo_CHECK_EQUAL(rMesh1.NumOfTriangles(), rMesh2.NumOfTriangles());
+    QuESo_CHECK_EQUAL(rMesh1.NumOfVertices(), rMesh2.NumOfVertices());
+    for( IndexType triangle_id = 0; triangle_id < rMesh1.NumOfTriangles(); ++triangle_id ){
+        QuESo_CHECK_POINT_NEAR(rMesh1.P1(triangle_id), rMesh2.P1(triangle_id), ZEROTOL);
+        QuESo_CHECK_POINT_NEAR(rMesh1.P2(triangle_id), rMesh2.P2(triangle_id), ZEROTOL);
+        QuESo_CHECK_POINT_NEAR(rMesh1.P3(triangle_id), rMesh2.P3(triangle_id), ZEROTOL);
+        QuESo_CHECK_POINT_NEAR(rMesh1.Normal(triangle_id), rMesh2.Normal(triangle_id), ZEROTOL);
+    }
+    const auto& r_edges_on_planes_1 = rMesh1.GetEdgesOnPlanes();
+    const auto& r_edges_on_planes_2 = rMesh2.GetEdgesOnPlanes();
+    for( IndexType plane_index = 0; plane_index < 6; ++plane_index ){
+        QuESo_CHECK(r_edges_on_planes_1[plane_index] == r_edges_on_planes_2[plane_index]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ClippedMeshCacheElephantTest) {
+    QuESo_INFO << "Testing :: Test Clipped Mesh Cache :: Elephant" << std::endl;
+
+    TriangleMesh triangle_mesh{};
+    IO::ReadMeshFromSTL(triangle_mesh, "queso/tests/cpp_tests/data/elephant.stl");
+
+    Settings settings;
+    auto& r_grid_settings = settings[MainSettings::background_grid_settings];
+    r_grid_settings.SetValue(BackgroundGridSettings::grid_type, GridType::b_spline_grid);
+    r_grid_settings.SetValue(BackgroundGridSettings::lower_bound_xyz, PointType{-0.37, -0.55, -0.31});
+    r_grid_settings.SetValue(BackgroundGridSettings::upper_bound_xyz, PointType{0.37, 0.55, 0.31});
+    r_grid_settings.SetValue(BackgroundGridSettings::lower_bound_uvw, PointType{-0.37, -0.55, -0.31});
+    r_grid_settings.SetValue(BackgroundGridSettings::upper_bound_uvw, PointType{0.37, 0.55, 0.31});
+    r_grid_settings.SetValue(BackgroundGridSettings::number_of_elements, Vector3i{7, 11, 6});
+
+    BRepOperator brep_operator(triangle_mesh);
+    GridIndexer grid_indexer(settings);
+
+    const PointType zero{0.0, 0.0, 0.0};
+    IndexType num_trimmed = 0;
+    for( IndexType index = 0; index < grid_indexer.NumberOfElements(); ++index ){
+        const auto cell_bounds = grid_indexer.GetBoundingBoxXYZFromIndex(index);
+        if( !brep_operator.IsTrimmed(cell_bounds.first, cell_bounds.second) ){
+            continue;
+        }
+        ++num_trimmed;
+        const double tolerance = 10.0*RelativeSnapTolerance(cell_bounds.first, cell_bounds.second);
+        // Unperturbed cell, offsets as used in FloodFill and perturbations as used in pGetTrimmedDomain.
+        const std::vector<std::pair<PointType, PointType>> offsets = {
+            {zero, zero},
+            {PointType{-tolerance, 0.0, 0.0}, zero},
+            {zero, PointType{0.0, 0.0, tolerance}},
+            {PointType{-50*tolerance, -20*tolerance, -70*tolerance}, PointType{30*tolerance, 90*tolerance, 10*tolerance}} };
+
+        for( const auto& r_offset : offsets ){
+            const PointType lower_bound = Math::Add(cell_bounds.first, r_offset.first);
+            const PointType upper_bound = Math::Add(cell_bounds.second, r_offset.second);
+            auto p_cached_mesh = brep_operator.pClipTriangleMesh(index, cell_bounds, lower_bound, upper_bound);
+            auto p_reference_mesh = brep_operator.pClipTriangleMesh(lower_bound, upper_bound);
+            CheckMeshesAreEqual(*p_cached_mesh, *p_reference_mesh);
+        }
+    }
+
+    const auto& r_cache = brep_operator.GetClippedMeshCache();
+    QuESo_CHECK_GT(num_trimmed, 0);
+    QuESo_CHECK_EQUAL(r_cache.NumberOfEntries(), num_trimmed);
+    QuESo_CHECK_EQUAL(r_cache.NumberOfMisses(), num_trimmed);
+    QuESo_CHECK_EQUAL(r_cache.NumberOfHits(), 3*num_trimmed);
+}
+
+BOOST_AUTO_TEST_CASE(ClippedMeshCacheBoundedTest) {
+    QuESo_INFO << "Testing :: Test Clipped Mesh Cache :: Bounded Memory" << std::endl;
+
+    TriangleMesh triangle_mesh{};
+    IO::ReadMeshFromSTL(triangle_mesh, "queso/tests/cpp_tests/data/cylinder.stl");
+    GeometryQuery geometry_query(triangle_mesh);
+
+    const IndexType max_num_triangles = 500;
+    ClippedMeshCache cache(triangle_mesh, geometry_query, max_num_triangles);
+
+    const double delta = 0.25;
+    for( IndexType i = 0; i < 12; ++i ){
+        const PointType lower_bound{0.0, 0.0, i*delta};
+        const PointType upper_bound{1.5, 1.5, (i+1)*delta};
+        auto p_mesh = cache.pGetClippedMesh(i, std::make_pair(lower_bound, upper_bound), lower_bound, upper_bound);
+        QuESo_CHECK(p_mesh != nullptr);
+        QuESo_CHECK_GT(p_mesh->NumOfTriangles(), 0);
+        QuESo_CHECK_LT(cache.NumberOfTriangles(), max_num_triangles+1);
+    }
+    QuESo_CHECK_LT(cache.NumberOfEntries(), 12);
+    QuESo_CHECK_EQUAL(cache.NumberOfMisses(), 12);
+
+    // AABB too far away from cell.
+    const PointType lower_bound{0.0, 0.0, 0.0};
+    const PointType upper_bound{1.5, 1.5, delta};
+    auto p_mesh = cache.pGetClippedMesh(0, std::make_pair(lower_bound, upper_bound), lower_bound, PointType{1.5, 1.5, 2.0*delta});
+    QuESo_CHECK(p_mesh == nullptr);
+
+    cache.Clear();
+    QuESo_CHECK_EQUAL(cache.NumberOfEntries(), 0);
+    QuESo_CHECK_EQUAL(cache.NumberOfTriangles(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // End namespace Testing
+} // End namespace queso
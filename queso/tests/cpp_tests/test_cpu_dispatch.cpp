@@ -0,0 +1,236 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#define BOOST_TEST_DYN_LINK
+
+//// STL includes
+#include <random>
+#include <sstream>
+//// External includes
+#include <boost/test/unit_test.hpp>
+//// Project includes
+#include "queso/includes/checks.hpp"
+#include "queso/utilities/cpu_dispatch.h"
+#include "queso/utilities/polynomial_utilities.hpp"
+#include "queso/embedding/aabb_primitive.h"
+#include "queso/embedding/ray_aabb_primitive.h"
+
+namespace queso {
+namespace Testing {
+
+BOOST_AUTO_TEST_SUITE( CpuDispatchTestSuite )
+
+std::vector<InstructionSet> GetSupportedInstructionSets() {
+    std::vector<InstructionSet> instruction_sets{};
+    for( auto level : {InstructionSet::scalar, InstructionSet::avx2, InstructionSet::avx512} ){
+        if( CpuDispatch::IsSupported(level) ){
+            instruction_sets.push_back(level);
+        }
+    }
+    return instruction_sets;
+}
+
+// Random triangles close to the unit cube. Every tenth triangle is parallel to rDirection.
+std::vector<double> CreateRandomTriangles(IndexType NumTriangles, const Vector3d& rDirection) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(-0.5, 1.5);
+    std::vector<double> vertices(9*NumTriangles);
+    for( auto& r_value : vertices ){
+        r_value = distribution(generator);
+    }
+    for( IndexType i = 0; i < NumTriangles; i += 10 ){
+        // Edge v0-v2 is parallel to rDirection.
+        vertices[9*i+6] = vertices[9*i] + 0.5*rDirection[0];
+        vertices[9*i+7] = vertices[9*i+1] + 0.5*rDirection[1];
+        vertices[9*i+8] = vertices[9*i+2] + 0.5*rDirection[2];
+    }
+    return vertices;
+}
+
+BOOST_AUTO_TEST_CASE(CpuDispatchSelectionTest) {
+    QuESo_INFO << "Testing :: Test Cpu Dispatch :: Selection of Instruction Set" << std::endl;
+
+    QuESo_CHECK( CpuDispatch::IsSupported(InstructionSet::scalar) );
+    QuESo_CHECK( CpuDispatch::IsSupported(CpuDispatch::GetSupportedInstructionSet()) );
+    QuESo_CHECK( CpuDispatch::IsSupported(CpuDispatch::GetInstructionSet()) );
+
+    const InstructionSet default_level = CpuDispatch::GetInstructionSet();
+    for( auto level : GetSupportedInstructionSets() ){
+        CpuDispatch::SetInstructionSet(level);
+        QuESo_CHECK( CpuDispatch::GetInstructionSet() == level );
+    }
+    if( !CpuDispatch::IsSupported(InstructionSet::avx512) ){
+        BOOST_REQUIRE_THROW( CpuDispatch::SetInstructionSet(InstructionSet::avx512), std::exception );
+    }
+    CpuDispatch::ResetInstructionSet();
+    QuESo_CHECK( CpuDispatch::GetInstructionSet() == default_level );
+
+    std::stringstream stream;
+    stream << InstructionSet::scalar << ' ' << InstructionSet::avx2 << ' ' << InstructionSet::avx512;
+    QuESo_CHECK_EQUAL( stream.str(), "scalar avx2 avx512" );
+}
+
+BOOST_AUTO_TEST_CASE(CpuDispatchLegendreTest) {
+    QuESo_INFO << "Testing :: Test Cpu Dispatch :: Legendre Polynomials and Moment Matrix" << std::endl;
+
+    const IndexType num_points = 37;
+    const double a = -0.3;
+    const double b = 1.7;
+    const Vector3i order{4, 2, 3};
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> distribution(a, b);
+    std::array<std::vector<double>, 3> coordinates;
+    for( auto& r_coordinates : coordinates ){
+        r_coordinates.resize(num_points);
+        for( auto& r_value : r_coordinates ){
+            r_value = distribution(generator);
+        }
+    }
+    const IndexType num_functions = (order[0]+1)*(order[1]+1)*(order[2]+1);
+
+    // Scalar reference.
+    std::array<std::vector<double>, 3> ref_values, ref_int_values;
+    for( IndexType dir = 0; dir < 3; ++dir ){
+        ref_values[dir].resize((order[dir]+1)*num_points);
+        ref_int_values[dir].resize((order[dir]+1)*num_points);
+        CpuDispatch::EvaluateLegendre(coordinates[dir].data(), num_points, order[dir], a, b, ref_values[dir].data(), InstructionSet::scalar);
+        CpuDispatch::EvaluateLegendreIntegral(coordinates[dir].data(), num_points, order[dir], a, b, ref_int_values[dir].data(), InstructionSet::scalar);
+        for( IndexType i_order = 0; i_order <= order[dir]; ++i_order ){
+            for( IndexType i = 0; i < num_points; ++i ){
+                QuESo_CHECK_EQUAL( ref_values[dir][i_order*num_points + i], Polynomial::f_x(coordinates[dir][i], i_order, a, b) );
+                QuESo_CHECK_EQUAL( ref_int_values[dir][i_order*num_points + i], Polynomial::f_x_int(coordinates[dir][i], i_order, a, b) );
+            }
+        }
+    }
+    std::vector<double> ref_matrix(num_functions*num_points);
+    CpuDispatch::AssembleMomentMatrix(ref_values[0].data(), ref_values[1].data(), ref_values[2].data(), num_points, order, ref_matrix.data(), InstructionSet::scalar);
+    IndexType row_index = 0;
+    for( IndexType i_x = 0; i_x <= order[0]; ++i_x ){
+        for( IndexType i_y = 0; i_y <= order[1]; ++i_y ){
+            for( IndexType i_z = 0; i_z <= order[2]; ++i_z ){
+                for( IndexType i = 0; i < num_points; ++i ){
+                    const double value = Polynomial::f_x(coordinates[0][i], i_x, a, b)
+                        * Polynomial::f_x(coordinates[1][i], i_y, a, b)
+                        * Polynomial::f_x(coordinates[2][i], i_z, a, b);
+                    QuESo_CHECK_EQUAL( ref_matrix[i*num_functions + row_index], value );
+                }
+                ++row_index;
+            }
+        }
+    }
+
+    // All variants must be bitwise identical to the scalar reference.
+    for( auto level : GetSupportedInstructionSets() ){
+        for( IndexType dir = 0; dir < 3; ++dir ){
+            std::vector<double> values((order[dir]+1)*num_points);
+            std::vector<double> int_values((order[dir]+1)*num_points);
+            CpuDispatch::EvaluateLegendre(coordinates[dir].data(), num_points, order[dir], a, b, values.data(), level);
+            CpuDispatch::EvaluateLegendreIntegral(coordinates[dir].data(), num_points, order[dir], a, b, int_values.data(), level);
+            QuESo_CHECK( values == ref_values[dir] );
+            QuESo_CHECK( int_values == ref_int_values[dir] );
+        }
+        std::vector<double> matrix(num_functions*num_points);
+        CpuDispatch::AssembleMomentMatrix(ref_values[0].data(), ref_values[1].data(), ref_values[2].data(), num_points, order, matrix.data(), level);
+        QuESo_CHECK( matrix == ref_matrix );
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CpuDispatchTriangleAABBTest) {
+    QuESo_INFO << "Testing :: Test Cpu Dispatch :: Triangle AABB Intersection" << std::endl;
+
+    const IndexType num_triangles = 500;
+    const auto vertices = CreateRandomTriangles(num_triangles, {0.0, 0.0, 1.0});
+    const PointType lower_bound{0.2, 0.1, 0.3};
+    const PointType upper_bound{0.6, 0.4, 0.5};
+    AABB_primitive aabb(lower_bound, upper_bound);
+
+    for( double tolerance : {0.0, 1e-2} ){
+        // Reference: AABB_primitive.
+        std::vector<std::uint8_t> ref_results(num_triangles);
+        IndexType num_intersected = 0;
+        for( IndexType i = 0; i < num_triangles; ++i ){
+            const Vector3d v0{vertices[9*i], vertices[9*i+1], vertices[9*i+2]};
+            const Vector3d v1{vertices[9*i+3], vertices[9*i+4], vertices[9*i+5]};
+            const Vector3d v2{vertices[9*i+6], vertices[9*i+7], vertices[9*i+8]};
+            ref_results[i] = aabb.intersect(v0, v1, v2, tolerance);
+            num_intersected += ref_results[i];
+        }
+        QuESo_CHECK_GT( num_intersected, 0 );
+        QuESo_CHECK_LT( num_intersected, num_triangles );
+
+        for( auto level : GetSupportedInstructionSets() ){
+            std::vector<std::uint8_t> results(num_triangles);
+            CpuDispatch::IntersectTrianglesAABB(lower_bound, upper_bound, aabb.centre, tolerance, vertices.data(), num_triangles, results.data(), level);
+            QuESo_CHECK( results == ref_results );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CpuDispatchRayTriangleTest) {
+    QuESo_INFO << "Testing :: Test Cpu Dispatch :: Ray Triangle Intersection" << std::endl;
+
+    const IndexType num_triangles = 500;
+    const PointType origin{0.4, 0.5, -0.2};
+    const PointType direction{0.1, 0.05, 1.0};
+    const auto vertices = CreateRandomTriangles(num_triangles, direction);
+    Ray_AABB_primitive ray(origin, direction);
+
+    // Reference: Ray_AABB_primitive.
+    std::vector<std::uint8_t> ref_flags(num_triangles);
+    std::vector<double> ref_t(num_triangles), ref_u(num_triangles), ref_v(num_triangles);
+    IndexType num_intersected = 0;
+    IndexType num_parallel = 0;
+    for( IndexType i = 0; i < num_triangles; ++i ){
+        const Vector3d v0{vertices[9*i], vertices[9*i+1], vertices[9*i+2]};
+        const Vector3d v1{vertices[9*i+3], vertices[9*i+4], vertices[9*i+5]};
+        const Vector3d v2{vertices[9*i+6], vertices[9*i+7], vertices[9*i+8]};
+        bool back_facing, parallel;
+        const bool intersected = ray.intersect(v0, v1, v2, ref_t[i], ref_u[i], ref_v[i], back_facing, parallel);
+        ref_flags[i] = (intersected ? CpuDispatch::Intersected : 0) | (back_facing ? CpuDispatch::BackFacing : 0) | (parallel ? CpuDispatch::Parallel : 0);
+        num_intersected += (intersected && !parallel);
+        num_parallel += parallel;
+    }
+    QuESo_CHECK_GT( num_intersected, 0 );
+    QuESo_CHECK_GT( num_parallel, 0 );
+
+    std::vector<double> scalar_t(num_triangles), scalar_u(num_triangles), scalar_v(num_triangles);
+    std::vector<std::uint8_t> scalar_flags(num_triangles);
+    CpuDispatch::IntersectRayTriangles(origin, direction, vertices.data(), num_triangles, scalar_t.data(), scalar_u.data(), scalar_v.data(),
+        scalar_flags.data(), InstructionSet::scalar);
+
+    for( auto level : GetSupportedInstructionSets() ){
+        std::vector<double> t(num_triangles), u(num_triangles), v(num_triangles);
+        std::vector<std::uint8_t> flags(num_triangles);
+        CpuDispatch::IntersectRayTriangles(origin, direction, vertices.data(), num_triangles, t.data(), u.data(), v.data(), flags.data(), level);
+        for( IndexType i = 0; i < num_triangles; ++i ){
+            QuESo_CHECK_EQUAL( static_cast<int>(flags[i]), static_cast<int>(ref_flags[i]) );
+            QuESo_CHECK_EQUAL( static_cast<int>(flags[i]), static_cast<int>(scalar_flags[i]) );
+            // t, u, v are only valid for intersected, non-parallel triangles.
+            if( (flags[i] & CpuDispatch::Intersected) && !(flags[i] & CpuDispatch::Parallel) ){
+                QuESo_CHECK_EQUAL( t[i], ref_t[i] );
+                QuESo_CHECK_EQUAL( u[i], ref_u[i] );
+                QuESo_CHECK_EQUAL( v[i], ref_v[i] );
+            }
+            if( !(flags[i] & CpuDispatch::Parallel) ){
+                QuESo_CHECK_EQUAL( t[i], scalar_t[i] );
+                QuESo_CHECK_EQUAL( u[i], scalar_u[i] );
+                QuESo_CHECK_EQUAL( v[i], scalar_v[i] );
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // End namespace Testing
+} // End namespace queso
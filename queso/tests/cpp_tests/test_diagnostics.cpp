@@ -0,0 +1,157 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#define BOOST_TEST_DYN_LINK
+
+//// STL includes
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+//// External includes
+#include <boost/test/unit_test.hpp>
+//// Project includes
+#include "queso/includes/checks.hpp"
+#include "queso/includes/diagnostics.hpp"
+#include "queso/embedded_model.h"
+#include "queso/io/io_utilities.h"
+
+namespace queso {
+namespace Testing {
+
+BOOST_AUTO_TEST_SUITE( DiagnosticsTestSuite )
+
+BOOST_AUTO_TEST_CASE(DiagnosticsMergeTest) {
+    QuESo_INFO << "Testing :: Test Diagnostics :: Merge" << std::endl;
+
+    Diagnostics diagnostics{};
+    Diagnostics::BufferType buffer_1{};
+    Diagnostics::BufferType buffer_2{};
+    Diagnostics::Record(buffer_1, 7, DiagnosticKind::moment_fitting_residual_not_achieved, 1e-5);
+    Diagnostics::Record(buffer_1, 3, DiagnosticKind::element_neglected_after_moment_fitting, 0.5);
+    Diagnostics::Record(buffer_1, 2, DiagnosticKind::moment_fitting_residual_not_achieved, 1e-3);
+    Diagnostics::Record(buffer_2, 5, DiagnosticKind::moment_fitting_residual_not_achieved, 1e-4);
+    Diagnostics::Record(buffer_2, 1, DiagnosticKind::moment_fitting_residual_not_achieved, 1e-6);
+
+    // Order of merged buffers does not matter.
+    diagnostics.Merge(buffer_2);
+    diagnostics.Merge(buffer_1);
+    QuESo_CHECK_EQUAL(buffer_1.size(), 0);
+    QuESo_CHECK_EQUAL(buffer_2.size(), 0);
+
+    QuESo_CHECK_EQUAL(diagnostics.NumberOfEvents(), 5);
+    QuESo_CHECK_EQUAL(diagnostics.NumberOfEvents(DiagnosticKind::moment_fitting_residual_not_achieved), 4);
+    QuESo_CHECK_EQUAL(diagnostics.NumberOfEvents(DiagnosticKind::element_neglected_after_moment_fitting), 1);
+
+    const std::vector<IndexType> element_ids_ref = {1, 2, 5, 7, 3};
+    const auto& r_events = diagnostics.GetEvents();
+    for( IndexType i = 0; i < r_events.size(); ++i ){
+        QuESo_CHECK_EQUAL(r_events[i].element_id, element_ids_ref[i]);
+    }
+
+    const auto worst_events = diagnostics.GetWorstEvents(DiagnosticKind::moment_fitting_residual_not_achieved, 2);
+    QuESo_CHECK_EQUAL(worst_events.size(), 2);
+    QuESo_CHECK_EQUAL(worst_events[0].element_id, 2);
+    QuESo_CHECK_EQUAL(worst_events[1].element_id, 5);
+    QuESo_CHECK_EQUAL(diagnostics.GetWorstEvents(DiagnosticKind::element_neglected_after_moment_fitting, 10).size(), 1);
+
+    diagnostics.Clear();
+    QuESo_CHECK_EQUAL(diagnostics.NumberOfEvents(), 0);
+    QuESo_CHECK_EQUAL(diagnostics.GetWorstEvents(DiagnosticKind::moment_fitting_residual_not_achieved, 2).size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(DiagnosticsEmbeddedModelTest) {
+    QuESo_INFO << "Testing :: Test Diagnostics :: Embedded Model" << std::endl;
+
+    Settings settings;
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::input_filename, std::string("queso/tests/cpp_tests/data/cylinder.stl"));
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::echo_level, 0u);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::write_output_to_file, false);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::grid_type, GridType::b_spline_grid);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_xyz, PointType{-1.5, -1.5, -1.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_xyz, PointType{1.5, 1.5, 12.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_uvw, PointType{-1.5, -1.5, -1.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_uvw, PointType{1.5, 1.5, 12.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::number_of_elements, Vector3i{3, 3, 13});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::polynomial_order, Vector3i{2, 2, 2});
+    // Flawed elements are not neglected. Hence, the moment fitting equation can not be satisfied.
+    settings[MainSettings::trimmed_quadrature_rule_settings].SetValue(TrimmedQuadratureRuleSettings::neglect_elements_if_stl_is_flawed, false);
+    settings[MainSettings::non_trimmed_quadrature_rule_settings].SetValue(NonTrimmedQuadratureRuleSettings::integration_method, IntegrationMethod::gauss);
+
+    // Cylinder with holes.
+    TriangleMesh triangle_mesh{};
+    IO::ReadMeshFromSTL(triangle_mesh, "queso/tests/cpp_tests/data/cylinder.stl");
+    for( IndexType triangle_id = triangle_mesh.NumOfTriangles(); triangle_id-- > 0; ){
+        if( triangle_id % 7 == 0 ){
+            triangle_mesh.RemoveTriangle(triangle_id);
+            triangle_mesh.RemoveNormal(triangle_id);
+        }
+    }
+
+    EmbeddedModel embedded_model(settings);
+    embedded_model.CreateVolume(triangle_mesh);
+
+    const auto& r_model_info = embedded_model.GetModelInfo();
+    const auto& r_diagnostics = embedded_model.GetDiagnostics();
+    QuESo_CHECK_GT(r_diagnostics.NumberOfEvents(DiagnosticKind::moment_fitting_residual_not_achieved), 0);
+    QuESo_CHECK_GT(r_diagnostics.NumberOfEvents(DiagnosticKind::element_neglected_after_moment_fitting), 0);
+    const IndexType num_trimmed_elements = r_model_info[MainInfo::background_grid_info].GetValue<IndexType>(BackgroundGridInfo::num_trimmed_elements);
+    QuESo_CHECK_LT(r_diagnostics.NumberOfEvents(DiagnosticKind::moment_fitting_residual_not_achieved), num_trimmed_elements+1);
+
+    // Summary in ModelInfo.
+    const auto& r_diagnostics_info = r_model_info[MainInfo::diagnostics_info];
+    QuESo_CHECK_EQUAL(r_diagnostics_info.GetValue<IndexType>(DiagnosticsInfo::num_events), r_diagnostics.NumberOfEvents());
+    IndexType num_events = 0;
+    for( const auto& r_summary_info : r_diagnostics_info.GetList(DiagnosticsInfo::events_summary_list) ){
+        num_events += r_summary_info.GetValue<IndexType>(DiagnosticsSummaryInfo::num_events);
+        const double max_value = r_summary_info.GetValue<double>(DiagnosticsSummaryInfo::max_value);
+        const std::string kind = r_summary_info.GetValue<std::string>(DiagnosticsSummaryInfo::kind);
+        bool worst_element_found = false;
+        for( const auto& r_event : r_diagnostics.GetEvents() ){
+            if( kind == Diagnostics::GetKindName(r_event.kind) ){
+                QuESo_CHECK_LT(r_event.value, max_value+EPS0);
+                worst_element_found |= (r_event.element_id == r_summary_info.GetValue<IndexType>(DiagnosticsSummaryInfo::worst_element_id));
+            }
+        }
+        QuESo_CHECK( worst_element_found );
+    }
+    QuESo_CHECK_EQUAL(num_events, r_diagnostics.NumberOfEvents());
+
+    // Machine-readable output.
+    const std::string filename = "diagnostics_test.json";
+    IO::WriteDiagnosticsToJSON(r_diagnostics, filename);
+    std::ifstream file(filename);
+    QuESo_CHECK( file.is_open() );
+    std::stringstream content;
+    content << file.rdbuf();
+    file.close();
+    std::remove(filename.c_str());
+    const std::string text = content.str();
+    IndexType num_entries = 0;
+    for( std::size_t pos = text.find("\"element_id\""); pos != std::string::npos; pos = text.find("\"element_id\"", pos+1) ){
+        ++num_entries;
+    }
+    QuESo_CHECK_EQUAL(num_entries, r_diagnostics.NumberOfEvents());
+
+    // No warnings, if the targeted residual is achieved.
+    settings[MainSettings::trimmed_quadrature_rule_settings].SetValue(TrimmedQuadratureRuleSettings::moment_fitting_residual, 1e-2);
+    EmbeddedModel embedded_model_2(settings);
+    embedded_model_2.CreateAllFromSettings();
+    QuESo_CHECK_EQUAL(embedded_model_2.GetDiagnostics().NumberOfEvents(DiagnosticKind::moment_fitting_residual_not_achieved), 0);
+    const IndexType num_kinds_ref = (embedded_model_2.GetDiagnostics().NumberOfEvents() > 0) ? 1 : 0;
+    QuESo_CHECK_EQUAL(embedded_model_2.GetModelInfo()[MainInfo::diagnostics_info].GetList(DiagnosticsInfo::events_summary_list).size(), num_kinds_ref);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // End namespace Testing
+} // End namespace queso
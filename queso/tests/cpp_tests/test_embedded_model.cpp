@@ -17,11 +17,13 @@
 #include <boost/test/unit_test.hpp>
 #include <numeric>      // std::accumulate
 #include <memory>       //std::addressof
+#include <filesystem>   //std::filesystem
 //// Project includes
 #include "queso/includes/checks.hpp"
 #include "queso/containers/grid_indexer.hpp"
 #include "queso/io/io_utilities.h"
 #include "queso/embedded_model.h"
+#include "queso/quadrature/trimmed_element.hpp"
 
 namespace queso {
 namespace Testing {
@@ -465,11 +467,14 @@ BOOST_AUTO_TEST_CASE(SteeringKnuckleModelInfoTest) {
     IO::ReadMeshFromSTL(triangle_mesh, filename);
     double volume_ref = MeshUtilities::VolumeOMP(triangle_mesh);
     QuESo_CHECK_NEAR(r_geo_info.GetValue<double>(EmbeddedGeometryInfo::volume), volume_ref, 1e-10);
+    QuESo_CHECK_EQUAL(r_geo_info.GetValue<IndexType>(EmbeddedGeometryInfo::num_triangles), triangle_mesh.NumOfTriangles());
+    QuESo_CHECK( !r_geo_info.IsSet(EmbeddedGeometryInfo::num_input_triangles) );
+    QuESo_CHECK( !r_geo_info.IsSet(EmbeddedGeometryInfo::decimation_deviation) );
     // quadrature_info
     const auto& r_quad_info = r_model_info[MainInfo::quadrature_info];
     QuESo_CHECK_RELATIVE_NEAR( r_quad_info.GetValue<double>(QuadratureInfo::represented_volume), volume_ref, 1e-5)
     QuESo_CHECK_RELATIVE_NEAR( r_quad_info.GetValue<double>(QuadratureInfo::percentage_of_geometry_volume), 100.0, 1e-5)
-    QuESo_CHECK_EQUAL(r_quad_info.GetValue<IndexType>(QuadratureInfo::tot_num_points), 9508);
+    QuESo_CHECK_EQUAL(r_quad_info.GetValue<IndexType>(QuadratureInfo::tot_num_points), 9499);
     QuESo_CHECK_RELATIVE_NEAR( r_quad_info.GetValue<double>(QuadratureInfo::num_of_points_per_full_element), 25.2, 1e-5)
     const double num_of_points_per_trimmed_element = r_quad_info.GetValue<double>(QuadratureInfo::num_of_points_per_trimmed_element);
     QuESo_CHECK_GT(num_of_points_per_trimmed_element, 26);
@@ -519,6 +524,337 @@ BOOST_AUTO_TEST_CASE(SteeringKnuckleModelInfoTest) {
     QuESo_CHECK_NEAR( r_condition_info_1.GetValue<double>(ConditionInfo::perc_surf_area_in_active_domain), 100.0, 1e-5);
 }
 
+BOOST_AUTO_TEST_CASE(SteeringKnuckleMeshDecimationTest) {
+    QuESo_INFO << "Testing :: Test Embedded Model :: Mesh Decimation :: Steering Knuckle" << std::endl;
+
+    const std::string filename = "queso/tests/cpp_tests/data/steering_knuckle.stl";
+    Settings settings;
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::input_filename, filename);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::echo_level, 0u);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::write_output_to_file, false);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::mesh_decimation_tolerance, 0.01);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::grid_type, GridType::b_spline_grid);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_xyz, PointType{-130.0, -110.0, -110.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_xyz, PointType{20.0, 190.0, 190.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_uvw, PointType{-130.0, -110.0, -110.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_uvw, PointType{20.0, 190.0, 190.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::number_of_elements, Vector3i{10, 20, 20});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::polynomial_order, Vector3i{2, 2, 2});
+    settings[MainSettings::non_trimmed_quadrature_rule_settings].SetValue(NonTrimmedQuadratureRuleSettings::integration_method, IntegrationMethod::gauss);
+
+    EmbeddedModel embedded_model(settings);
+    embedded_model.CreateAllFromSettings();
+
+    TriangleMesh triangle_mesh{};
+    IO::ReadMeshFromSTL(triangle_mesh, filename);
+    const double volume_ref = MeshUtilities::VolumeOMP(triangle_mesh);
+
+    // Element size is 15. Hence, the absolute tolerance is 0.15.
+    const auto& r_geo_info = embedded_model.GetModelInfo()[MainInfo::embedded_geometry_info];
+    QuESo_CHECK(r_geo_info.GetValue<bool>(EmbeddedGeometryInfo::is_closed));
+    QuESo_CHECK_EQUAL(r_geo_info.GetValue<IndexType>(EmbeddedGeometryInfo::num_input_triangles), triangle_mesh.NumOfTriangles());
+    QuESo_CHECK_LT(r_geo_info.GetValue<IndexType>(EmbeddedGeometryInfo::num_triangles), triangle_mesh.NumOfTriangles()/2);
+    QuESo_CHECK_GT(r_geo_info.GetValue<double>(EmbeddedGeometryInfo::decimation_deviation), 0.0);
+    QuESo_CHECK( r_geo_info.GetValue<double>(EmbeddedGeometryInfo::decimation_deviation) <= 0.15 );
+    QuESo_CHECK_RELATIVE_NEAR(r_geo_info.GetValue<double>(EmbeddedGeometryInfo::volume), volume_ref, 5e-3);
+
+    const auto& r_quad_info = embedded_model.GetModelInfo()[MainInfo::quadrature_info];
+    QuESo_CHECK_RELATIVE_NEAR(r_quad_info.GetValue<double>(QuadratureInfo::represented_volume), volume_ref, 5e-3);
+
+    // Decimation is not available for out-of-core processing.
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::out_of_core_slab_thickness, 5u);
+    EmbeddedModel embedded_model_out_of_core(settings);
+    BOOST_REQUIRE_THROW( embedded_model_out_of_core.CreateAllFromSettings(), std::exception );
+}
+
+BOOST_AUTO_TEST_CASE(SteeringKnuckleVerificationTest) {
+    QuESo_INFO << "Testing :: Test Embedded Model :: Verification Of Quadrature Rules :: Steering Knuckle" << std::endl;
+
+    const std::string filename = "queso/tests/cpp_tests/data/steering_knuckle.stl";
+    Settings settings;
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::input_filename, filename);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::echo_level, 0u);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::write_output_to_file, false);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::grid_type, GridType::b_spline_grid);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_xyz, PointType{-130.0, -110.0, -110.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_xyz, PointType{20.0, 190.0, 190.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_uvw, PointType{-130.0, -110.0, -110.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_uvw, PointType{20.0, 190.0, 190.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::number_of_elements, Vector3i{10, 20, 20});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::polynomial_order, Vector3i{2, 2, 2});
+    settings[MainSettings::trimmed_quadrature_rule_settings].SetValue(TrimmedQuadratureRuleSettings::verify_quadrature_rules, true);
+    settings[MainSettings::non_trimmed_quadrature_rule_settings].SetValue(NonTrimmedQuadratureRuleSettings::integration_method, IntegrationMethod::gauss);
+    // The entire surface is also used as condition.
+    auto& r_condition_settings = settings.CreateNewConditionSettings();
+    r_condition_settings.SetValue(ConditionSettings::condition_id, 1u);
+    r_condition_settings.SetValue(ConditionSettings::input_filename, filename);
+    r_condition_settings.SetValue(ConditionSettings::condition_type, std::string("SurfaceLoadCondition"));
+
+    EmbeddedModel embedded_model(settings);
+    embedded_model.CreateAllFromSettings();
+
+    const auto& r_model_info = embedded_model.GetModelInfo();
+    const auto& r_verification_info = r_model_info[MainInfo::verification_info];
+    const IndexType num_trimmed_elements = r_model_info[MainInfo::background_grid_info].GetValue<IndexType>(BackgroundGridInfo::num_trimmed_elements);
+    const IndexType num_verified_elements = r_verification_info.GetValue<IndexType>(VerificationInfo::num_verified_elements);
+    QuESo_CHECK_GT(num_verified_elements, 0);
+    QuESo_CHECK_EQUAL(num_verified_elements, num_trimmed_elements);
+    QuESo_CHECK_EQUAL(r_verification_info.GetValue<IndexType>(VerificationInfo::num_skipped_elements), 0);
+    QuESo_CHECK_EQUAL(r_verification_info.GetValue<Vector3i>(VerificationInfo::test_polynomial_order)[0], 3);
+
+    // Rules are fitted to p=2. Moments of order p+1 are only approximated.
+    const double max_moment_error = r_verification_info.GetValue<double>(VerificationInfo::max_moment_error);
+    const double mean_moment_error = r_verification_info.GetValue<double>(VerificationInfo::mean_moment_error);
+    QuESo_CHECK_GT(max_moment_error, 1e-3);
+    QuESo_CHECK_LT(max_moment_error, 1.0);
+    QuESo_CHECK_LT(mean_moment_error, max_moment_error);
+
+    // All verified elements are contained in the histogram.
+    IndexType num_elements_in_histogram = 0;
+    double previous_upper_bound = 0.0;
+    for( const auto& r_bin : r_verification_info.GetList(VerificationInfo::moment_error_histogram) ){
+        QuESo_CHECK_GT(r_bin.GetValue<IndexType>(MomentErrorHistogramInfo::num_elements), 0);
+        QuESo_CHECK(r_bin.GetValue<double>(MomentErrorHistogramInfo::lower_bound) >= previous_upper_bound);
+        previous_upper_bound = r_bin.GetValue<double>(MomentErrorHistogramInfo::upper_bound);
+        num_elements_in_histogram += r_bin.GetValue<IndexType>(MomentErrorHistogramInfo::num_elements);
+    }
+    QuESo_CHECK_EQUAL(num_elements_in_histogram, num_verified_elements);
+
+    // Worst elements are sorted in descending order.
+    const auto& r_worst_elements = r_verification_info.GetList(VerificationInfo::worst_elements_list);
+    QuESo_CHECK_EQUAL(r_worst_elements.size(), 10);
+    QuESo_CHECK_NEAR(r_worst_elements[0].GetValue<double>(WorstElementInfo::moment_error), max_moment_error, 1e-14);
+    for( IndexType i = 1; i < r_worst_elements.size(); ++i ){
+        QuESo_CHECK(r_worst_elements[i].GetValue<double>(WorstElementInfo::moment_error) <= r_worst_elements[i-1].GetValue<double>(WorstElementInfo::moment_error));
+    }
+    const IndexType worst_element_id = r_worst_elements[0].GetValue<IndexType>(WorstElementInfo::element_id);
+    const auto p_worst_element = std::find_if(embedded_model.GetElements().begin(), embedded_model.GetElements().end(),
+        [worst_element_id](const auto& rElement){ return rElement->GetId() == worst_element_id; });
+    QuESo_CHECK( p_worst_element != embedded_model.GetElements().end() );
+    QuESo_CHECK_NEAR(QuadratureTrimmedElement<EmbeddedModel::ElementType>::ComputeMomentError(**p_worst_element, {3, 3, 3}), max_moment_error, 1e-14);
+    // Moments up to order p are integrated exactly.
+    QuESo_CHECK_LT(QuadratureTrimmedElement<EmbeddedModel::ElementType>::ComputeMomentError(**p_worst_element, {2, 2, 2}), 1e-10);
+
+    // Surface area of all conditions.
+    TriangleMesh triangle_mesh{};
+    IO::ReadMeshFromSTL(triangle_mesh, filename);
+    QuESo_CHECK_RELATIVE_NEAR(r_verification_info.GetValue<double>(VerificationInfo::surface_area), MeshUtilities::Area(triangle_mesh), 1e-10);
+    const double percentage_of_surface_area = r_verification_info.GetValue<double>(VerificationInfo::percentage_of_surface_area);
+    const auto& r_condition_info = r_model_info.GetList(MainInfo::conditions_infos_list)[0];
+    QuESo_CHECK_GT(percentage_of_surface_area, 95.0);
+    QuESo_CHECK_RELATIVE_NEAR(percentage_of_surface_area, r_condition_info.GetValue<double>(ConditionInfo::perc_surf_area_in_active_domain), 1e-10);
+
+    // Verification must be cheaper than the moment fitting itself.
+    const auto& r_volume_time_info = r_model_info[MainInfo::elapsed_time_info][ElapsedTimeInfo::volume_time_info];
+    QuESo_CHECK_LT(r_volume_time_info.GetValue<double>(VolumeTimeInfo::verification_of_quadrature_rules),
+                   r_volume_time_info.GetValue<double>(VolumeTimeInfo::solution_of_moment_fitting_eqs));
+
+    // Out-of-core processing yields the same results.
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::out_of_core_slab_thickness, 5u);
+    EmbeddedModel embedded_model_out_of_core(settings);
+    embedded_model_out_of_core.CreateAllFromSettings();
+    const auto& r_verification_info_out_of_core = embedded_model_out_of_core.GetModelInfo()[MainInfo::verification_info];
+    QuESo_CHECK_EQUAL(r_verification_info_out_of_core.GetValue<IndexType>(VerificationInfo::num_verified_elements), num_verified_elements);
+    QuESo_CHECK_RELATIVE_NEAR(r_verification_info_out_of_core.GetValue<double>(VerificationInfo::max_moment_error), max_moment_error, 1e-8);
+    QuESo_CHECK_RELATIVE_NEAR(r_verification_info_out_of_core.GetValue<double>(VerificationInfo::surface_area),
+                              r_verification_info.GetValue<double>(VerificationInfo::surface_area), 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(SteeringKnuckleShapeSensitivitiesTest) {
+    QuESo_INFO << "Testing :: Test Embedded Model :: Shape Sensitivities :: Steering Knuckle" << std::endl;
+
+    const std::string filename = "queso/tests/cpp_tests/data/steering_knuckle.stl";
+    Settings settings;
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::input_filename, filename);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::echo_level, 0u);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::write_output_to_file, false);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::grid_type, GridType::b_spline_grid);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_xyz, PointType{-130.0, -110.0, -110.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_xyz, PointType{20.0, 190.0, 190.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_uvw, PointType{0.0, 0.0, 0.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_uvw, PointType{1.0, 1.0, 1.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::number_of_elements, Vector3i{5, 10, 10});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::polynomial_order, Vector3i{2, 2, 2});
+    settings[MainSettings::trimmed_quadrature_rule_settings].SetValue(TrimmedQuadratureRuleSettings::compute_shape_sensitivities, true);
+    settings[MainSettings::non_trimmed_quadrature_rule_settings].SetValue(NonTrimmedQuadratureRuleSettings::integration_method, IntegrationMethod::gauss);
+
+    EmbeddedModel embedded_model(settings);
+    embedded_model.CreateAllFromSettings();
+
+    TriangleMesh triangle_mesh{};
+    IO::ReadMeshFromSTL(triangle_mesh, filename);
+    const IndexType num_vertices = triangle_mesh.NumOfVertices();
+
+    // Only trimmed elements store shape sensitivities.
+    IndexType num_elements_with_sensitivities = 0;
+    for( const auto& r_element : embedded_model.GetElements() ){
+        QuESo_CHECK_EQUAL(r_element->HasShapeSensitivities(), r_element->IsTrimmed());
+        if( r_element->HasShapeSensitivities() ){
+            const auto& r_shape_sensitivities = r_element->GetShapeSensitivities();
+            QuESo_CHECK_EQUAL(r_shape_sensitivities.NumberOfPoints(), r_element->GetIntegrationPoints().size());
+            QuESo_CHECK_GT(r_shape_sensitivities.NumberOfVertices(), 0);
+            const auto& r_vertex_ids = r_shape_sensitivities.VertexIds();
+            QuESo_CHECK( std::is_sorted(r_vertex_ids.begin(), r_vertex_ids.end()) );
+            QuESo_CHECK_LT(r_vertex_ids.back(), num_vertices);
+            ++num_elements_with_sensitivities;
+        }
+    }
+    QuESo_CHECK_EQUAL(num_elements_with_sensitivities,
+        embedded_model.GetModelInfo()[MainInfo::background_grid_info].GetValue<IndexType>(BackgroundGridInfo::num_trimmed_elements));
+
+    // Shape sensitivities refer to the vertices of the input mesh and are not stored in checkpoints.
+    Settings settings_decimation = settings;
+    settings_decimation[MainSettings::general_settings].SetValue(GeneralSettings::mesh_decimation_tolerance, 0.1);
+    EmbeddedModel embedded_model_decimation(settings_decimation);
+    BOOST_REQUIRE_THROW( embedded_model_decimation.CreateAllFromSettings(), std::exception );
+
+    Settings settings_out_of_core = settings;
+    settings_out_of_core[MainSettings::general_settings].SetValue(GeneralSettings::out_of_core_slab_thickness, 5u);
+    EmbeddedModel embedded_model_out_of_core(settings_out_of_core);
+    BOOST_REQUIRE_THROW( embedded_model_out_of_core.CreateAllFromSettings(), std::exception );
+}
+
+BOOST_AUTO_TEST_CASE(SteeringKnuckleGridLevelsTest) {
+    QuESo_INFO << "Testing :: Test Embedded Model :: Coarse Grid Levels :: Steering Knuckle" << std::endl;
+
+    const std::string filename = "queso/tests/cpp_tests/data/steering_knuckle.stl";
+    Settings settings;
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::input_filename, filename);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::echo_level, 0u);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::write_output_to_file, false);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::grid_type, GridType::b_spline_grid);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_xyz, PointType{-130.0, -110.0, -110.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_xyz, PointType{20.0, 190.0, 190.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_uvw, PointType{0.0, 0.0, 0.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_uvw, PointType{1.0, 1.0, 1.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::number_of_elements, Vector3i{8, 16, 16});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::polynomial_order, Vector3i{2, 2, 2});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::number_of_grid_levels, 3u);
+    settings[MainSettings::non_trimmed_quadrature_rule_settings].SetValue(NonTrimmedQuadratureRuleSettings::integration_method, IntegrationMethod::gauss);
+
+    EmbeddedModel embedded_model(settings);
+    embedded_model.CreateAllFromSettings();
+    QuESo_CHECK_EQUAL(embedded_model.NumberOfGridLevels(), 3);
+    QuESo_CHECK( std::addressof(embedded_model.GetBackgroundGrid(0)) == std::addressof(embedded_model.GetBackgroundGrid()) );
+    BOOST_REQUIRE_THROW( embedded_model.GetBackgroundGrid(3), std::exception );
+
+    // Integrates 1, x, y*z and x^2 (relative to the center of the steering knuckle).
+    auto integrate = [](const EmbeddedModel::BackgroundGridType& rGrid) -> std::array<double, 4> {
+        std::array<double, 4> values{0.0, 0.0, 0.0, 0.0};
+        for( const auto& p_element : rGrid.GetElements() ){
+            const double det_j = p_element->DetJ();
+            for( const auto& r_point : p_element->GetIntegrationPoints() ){
+                const PointType point = p_element->PointFromParamToGlobal(r_point.data());
+                const double x = (point[0] + 55.0) / 75.0;
+                const double y = (point[1] - 40.0) / 150.0;
+                const double z = (point[2] - 40.0) / 150.0;
+                const double weight = r_point.Weight()*det_j;
+                values[0] += weight;
+                values[1] += weight*x;
+                values[2] += weight*y*z;
+                values[3] += weight*x*x;
+            }
+        }
+        return values;
+    };
+
+    // Nested grids integrate the same polynomials (p <= 2).
+    const auto values_ref = integrate(embedded_model.GetBackgroundGrid(0));
+    const double volume = embedded_model.GetModelInfo()[MainInfo::embedded_geometry_info].GetValue<double>(EmbeddedGeometryInfo::volume);
+    QuESo_CHECK_RELATIVE_NEAR(values_ref[0], volume, 1e-3);
+    const std::array<Vector3i, 3> number_of_elements = {Vector3i{8, 16, 16}, Vector3i{4, 8, 8}, Vector3i{2, 4, 4}};
+    for( IndexType level = 1; level < 3; ++level ){
+        const auto& r_grid = embedded_model.GetBackgroundGrid(level);
+        const auto& r_fine_grid = embedded_model.GetBackgroundGrid(level-1);
+        QuESo_CHECK_GT(r_grid.NumberOfActiveElements(), 0);
+        QuESo_CHECK_LT(r_grid.NumberOfActiveElements(), r_fine_grid.NumberOfActiveElements());
+        QuESo_CHECK_EQUAL(r_grid.NumberOfConditions(), 0);
+        const IndexType num_elements = number_of_elements[level][0]*number_of_elements[level][1]*number_of_elements[level][2];
+        for( const auto& p_element : r_grid.GetElements() ){
+            QuESo_CHECK_LT(p_element->GetId(), num_elements+1);
+            QuESo_CHECK( !p_element->HasTrimmedDomain() );
+        }
+        const auto values = integrate(r_grid);
+        for( IndexType i = 0; i < 4; ++i ){
+            QuESo_CHECK_RELATIVE_NEAR(values[i], values_ref[i], 1e-6);
+        }
+    }
+
+    // Coarse grid levels must be nested.
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::number_of_elements, Vector3i{8, 16, 14});
+    BOOST_REQUIRE_THROW( EmbeddedModel embedded_model_invalid(settings), std::exception );
+}
+
+BOOST_AUTO_TEST_CASE(SteeringKnuckleSurfaceOnlyTest) {
+    QuESo_INFO << "Testing :: Test Embedded Model :: Surface Only :: Steering Knuckle" << std::endl;
+
+    Settings settings;
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::input_filename, std::string("queso/tests/cpp_tests/data/steering_knuckle.stl"));
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::echo_level, 0u);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::write_output_to_file, false);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::grid_type, GridType::b_spline_grid);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_xyz, PointType{-130.0, -110.0, -110.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_xyz, PointType{20.0, 190.0, 190.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_uvw, PointType{-130.0, -110.0, -110.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_uvw, PointType{20.0, 190.0, 190.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::number_of_elements, Vector3i{10, 20, 20});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::polynomial_order, Vector3i{2, 2, 2});
+    settings[MainSettings::non_trimmed_quadrature_rule_settings].SetValue(NonTrimmedQuadratureRuleSettings::integration_method, IntegrationMethod::gauss);
+
+    auto& r_cond_settings = settings.CreateNewConditionSettings();
+    r_cond_settings.SetValue(ConditionSettings::condition_id, 2u);
+    r_cond_settings.SetValue(ConditionSettings::input_filename, std::string("queso/tests/cpp_tests/data/steering_knuckle_N1.stl"));
+    r_cond_settings.SetValue(ConditionSettings::condition_type, std::string("SurfaceLoadCondition"));
+
+    EmbeddedModel embedded_model(settings);
+    embedded_model.CreateAllFromSettings();
+
+    const std::string output_directory_name = "surface_only_test_output";
+    std::filesystem::create_directories(output_directory_name);
+    Settings settings_surface_only = settings;
+    settings_surface_only[MainSettings::general_settings].SetValue(GeneralSettings::surface_only, true);
+    settings_surface_only[MainSettings::general_settings].SetValue(GeneralSettings::write_output_to_file, true);
+    settings_surface_only[MainSettings::general_settings].SetValue(GeneralSettings::output_directory_name, output_directory_name);
+    EmbeddedModel embedded_model_surface_only(settings_surface_only);
+    embedded_model_surface_only.CreateAllFromSettings();
+
+    // No volume is computed.
+    QuESo_CHECK_EQUAL(embedded_model_surface_only.GetElements().size(), 0);
+    QuESo_CHECK_EQUAL(embedded_model_surface_only.GetConditions().size(), 1);
+
+    // Same segments as in the full run.
+    const auto& r_condition = *embedded_model.GetConditions()[0];
+    const auto& r_condition_surface_only = *embedded_model_surface_only.GetConditions()[0];
+    QuESo_CHECK_EQUAL(r_condition_surface_only.NumberOfSegments(), r_condition.NumberOfSegments());
+    auto get_segments = [](const EmbeddedModel::BackgroundGridType::ConditionType& rCondition) {
+        std::vector<std::pair<IndexType, double>> segments{};
+        for( const auto& p_segment : rCondition.GetSegments() ){
+            segments.push_back(std::make_pair(p_segment->GetBackgroundGridIndex(), MeshUtilities::Area(p_segment->GetTriangleMesh())));
+        }
+        std::sort(segments.begin(), segments.end());
+        return segments;
+    };
+    const auto segments = get_segments(r_condition);
+    const auto segments_surface_only = get_segments(r_condition_surface_only);
+    double area = 0.0;
+    for( IndexType i = 0; i < segments.size(); ++i ){
+        QuESo_CHECK_EQUAL(segments_surface_only[i].first, segments[i].first);
+        QuESo_CHECK_NEAR(segments_surface_only[i].second, segments[i].second, 1e-10);
+        area += segments_surface_only[i].second;
+    }
+    const auto& r_condition_info = r_condition_surface_only.GetInfo();
+    QuESo_CHECK_RELATIVE_NEAR(area, r_condition_info.GetValue<double>(ConditionInfo::surf_area), 1e-10);
+    QuESo_CHECK_RELATIVE_NEAR(r_condition_info.GetValue<double>(ConditionInfo::perc_surf_area_in_active_domain), 100.0, 1e-10);
+
+    // Condition is written to file, elements are not.
+    QuESo_CHECK( std::filesystem::exists(output_directory_name + "/condition_id_2.stl") );
+    QuESo_CHECK( !std::filesystem::exists(output_directory_name + "/elements.vtk") );
+    TriangleMesh triangle_mesh_output{};
+    IO::ReadMeshFromSTL(triangle_mesh_output, output_directory_name + "/condition_id_2.stl");
+    QuESo_CHECK_RELATIVE_NEAR(MeshUtilities::Area(triangle_mesh_output), area, 1e-5);
+    std::filesystem::remove_all(output_directory_name);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // End namespace Testing
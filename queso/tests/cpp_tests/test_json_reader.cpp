@@ -0,0 +1,207 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#define BOOST_TEST_DYN_LINK
+
+//// STL includes
+#include <cstdio>
+#include <sstream>
+//// External includes
+#include <boost/test/unit_test.hpp>
+//// Project includes
+#include "queso/includes/checks.hpp"
+#include "queso/io/json_reader.h"
+#include "queso/io/io_utilities.h"
+
+namespace queso {
+namespace Testing {
+
+BOOST_AUTO_TEST_SUITE( JsonReaderTestSuite )
+
+void CheckCustomizedValues(const Settings& rSettings) {
+    /// General settings
+    const auto& r_general_settings = rSettings[MainSettings::general_settings];
+    QuESo_CHECK_EQUAL( r_general_settings.GetValue<std::string>(GeneralSettings::input_filename), std::string("dummy.stl") );
+    QuESo_CHECK_EQUAL( r_general_settings.GetValue<std::string>(GeneralSettings::output_directory_name), std::string("new_output") );
+    QuESo_CHECK_EQUAL( r_general_settings.GetValue<IndexType>(GeneralSettings::echo_level), 2u );
+    QuESo_CHECK_EQUAL( r_general_settings.GetValue<bool>(GeneralSettings::write_output_to_file), false );
+    QuESo_CHECK_EQUAL( r_general_settings.GetValue<InsideTestMethod>(GeneralSettings::inside_test_method), InsideTestMethod::winding_number );
+    QuESo_CHECK_EQUAL( r_general_settings.GetValue<std::string>(GeneralSettings::checkpoint_filename), std::string("checkpoint.bin") );
+    QuESo_CHECK_EQUAL( r_general_settings.GetValue<double>(GeneralSettings::checkpoint_interval), 5.0 );
+    QuESo_CHECK_EQUAL( r_general_settings.GetValue<bool>(GeneralSettings::checkpoint_trimmed_domains), true );
+    QuESo_CHECK_EQUAL( r_general_settings.GetValue<IndexType>(GeneralSettings::out_of_core_slab_thickness), 4u );
+    QuESo_CHECK_EQUAL( r_general_settings.GetValue<std::string>(GeneralSettings::out_of_core_directory), std::string("slabs") );
+    QuESo_CHECK_NEAR( r_general_settings.GetValue<double>(GeneralSettings::mesh_decimation_tolerance), 0.25, EPS4 );
+    QuESo_CHECK_EQUAL( r_general_settings.GetValue<bool>(GeneralSettings::surface_only), true );
+
+    /// Background grid settings
+    const auto& r_grid_settings = rSettings[MainSettings::background_grid_settings];
+    QuESo_CHECK_EQUAL( r_grid_settings.GetValue<GridType>(BackgroundGridSettings::grid_type), GridType::b_spline_grid );
+    QuESo_CHECK_POINT_NEAR( r_grid_settings.GetValue<PointType>(BackgroundGridSettings::lower_bound_xyz), PointType({-130.0, -110.0, -110.0}), EPS4 );
+    QuESo_CHECK_POINT_NEAR( r_grid_settings.GetValue<PointType>(BackgroundGridSettings::upper_bound_xyz), PointType({20.0, 190.0, 190.0}), EPS4 );
+    QuESo_CHECK_POINT_NEAR( r_grid_settings.GetValue<PointType>(BackgroundGridSettings::lower_bound_uvw), PointType({1.23, 3.334, 5.66}), EPS4 );
+    QuESo_CHECK_POINT_NEAR( r_grid_settings.GetValue<PointType>(BackgroundGridSettings::upper_bound_uvw), PointType({4.4, 5.5, 2.2}), EPS4 );
+    QuESo_CHECK_EQUAL( r_grid_settings.GetValue<Vector3i>(BackgroundGridSettings::polynomial_order), Vector3i({2, 3, 2}) );
+    QuESo_CHECK_EQUAL( r_grid_settings.GetValue<Vector3i>(BackgroundGridSettings::number_of_elements), Vector3i({5, 2, 13}) );
+    QuESo_CHECK_EQUAL( r_grid_settings.GetValue<bool>(BackgroundGridSettings::grid_planning), true );
+    QuESo_CHECK_NEAR( r_grid_settings.GetValue<double>(BackgroundGridSettings::grid_planning_volume_error), 0.002, EPS4 );
+    QuESo_CHECK_NEAR( r_grid_settings.GetValue<double>(BackgroundGridSettings::grid_planning_runtime_budget), 30.0, EPS4 );
+    QuESo_CHECK_EQUAL( r_grid_settings.GetValue<IndexType>(BackgroundGridSettings::number_of_grid_levels), 3 );
+
+    /// Trimmed quadrature rule settings
+    const auto& r_trimmed_settings = rSettings[MainSettings::trimmed_quadrature_rule_settings];
+    QuESo_CHECK_NEAR( r_trimmed_settings.GetValue<double>(TrimmedQuadratureRuleSettings::moment_fitting_residual), 0.0023, EPS4 );
+    QuESo_CHECK_NEAR( r_trimmed_settings.GetValue<double>(TrimmedQuadratureRuleSettings::min_element_volume_ratio), 0.012, EPS4 );
+    QuESo_CHECK_EQUAL( r_trimmed_settings.GetValue<IndexType>(TrimmedQuadratureRuleSettings::min_num_boundary_triangles), 233u );
+    QuESo_CHECK_EQUAL( r_trimmed_settings.GetValue<NNLSSolver>(TrimmedQuadratureRuleSettings::nnls_solver), NNLSSolver::active_set_cholesky );
+    QuESo_CHECK_EQUAL( r_trimmed_settings.GetValue<IndexType>(TrimmedQuadratureRuleSettings::init_point_distribution_factor), 2u );
+    QuESo_CHECK_EQUAL( r_trimmed_settings.GetValue<IndexType>(TrimmedQuadratureRuleSettings::max_octree_refinement_level), 3u );
+    QuESo_CHECK_EQUAL( r_trimmed_settings.GetValue<bool>(TrimmedQuadratureRuleSettings::auto_tuning), true );
+    QuESo_CHECK_EQUAL( r_trimmed_settings.GetValue<IndexType>(TrimmedQuadratureRuleSettings::auto_tuning_sample_size), 32u );
+    QuESo_CHECK_NEAR( r_trimmed_settings.GetValue<double>(TrimmedQuadratureRuleSettings::auto_tuning_volume_error), 1e-5, EPS4 );
+    QuESo_CHECK_EQUAL( r_trimmed_settings.GetValue<IndexType>(TrimmedQuadratureRuleSettings::max_num_cut_planes), 3u );
+    QuESo_CHECK_EQUAL( r_trimmed_settings.GetValue<bool>(TrimmedQuadratureRuleSettings::verify_quadrature_rules), true );
+    QuESo_CHECK_EQUAL( r_trimmed_settings.GetValue<bool>(TrimmedQuadratureRuleSettings::compute_shape_sensitivities), true );
+    // Not given in file. Must keep default value.
+    QuESo_CHECK_EQUAL( r_trimmed_settings.GetValue<bool>(TrimmedQuadratureRuleSettings::neglect_elements_if_stl_is_flawed), true );
+
+    /// Non trimmed quadrature rule settings
+    QuESo_CHECK_EQUAL( rSettings[MainSettings::non_trimmed_quadrature_rule_settings].GetValue<IntegrationMethod>(NonTrimmedQuadratureRuleSettings::integration_method),
+        IntegrationMethod::ggq_optimal );
+
+    /// Conditions settings list
+    const auto& r_conditions_settings_list = rSettings.GetList(MainSettings::conditions_settings_list);
+    QuESo_CHECK_EQUAL( r_conditions_settings_list.size(), 4 );
+
+    const auto& r_condition_1 = r_conditions_settings_list[0];
+    QuESo_CHECK_EQUAL( r_condition_1.GetValue<IndexType>(ConditionSettings::condition_id), 3u );
+    QuESo_CHECK_EQUAL( r_condition_1.GetValue<std::string>(ConditionSettings::condition_type), std::string("test_type1") );
+    QuESo_CHECK_EQUAL( r_condition_1.GetValue<std::string>(ConditionSettings::input_filename), std::string("test_filename_1.stl") );
+    QuESo_CHECK_NEAR( r_condition_1.GetValue<double>(ConditionSettings::modulus), 5.0, EPS4 );
+    QuESo_CHECK_POINT_NEAR( r_condition_1.GetValue<PointType>(ConditionSettings::direction), PointType({-1.0, 2.0, 3.0}), EPS4 );
+    QuESo_CHECK_POINT_NEAR( r_condition_1.GetValue<PointType>(ConditionSettings::value), PointType({1.0, 2.0, 2.0}), EPS4 );
+    QuESo_CHECK_NEAR( r_condition_1.GetValue<double>(ConditionSettings::penalty_factor), 1e5, EPS4 );
+
+    const auto& r_condition_2 = r_conditions_settings_list[1];
+    QuESo_CHECK_EQUAL( r_condition_2.GetValue<IndexType>(ConditionSettings::condition_id), 1u );
+    QuESo_CHECK_NEAR( r_condition_2.GetValue<double>(ConditionSettings::modulus), 2.0, EPS4 );
+    QuESo_CHECK_IS_FALSE( r_condition_2.IsSet(ConditionSettings::direction) );
+
+    const auto& r_condition_3 = r_conditions_settings_list[2];
+    QuESo_CHECK_IS_FALSE( r_condition_3.IsSet(ConditionSettings::condition_id) );
+    QuESo_CHECK_POINT_NEAR( r_condition_3.GetValue<PointType>(ConditionSettings::value), PointType({0.0, 0.3, 0.0}), EPS4 );
+
+    const auto& r_condition_4 = r_conditions_settings_list[3];
+    QuESo_CHECK_IS_FALSE( r_condition_4.IsSet(ConditionSettings::input_filename) );
+    QuESo_CHECK_POINT_NEAR( r_condition_4.GetValue<PointType>(ConditionSettings::value), PointType({0.0, 0.0, 0.0}), EPS4 );
+    QuESo_CHECK_NEAR( r_condition_4.GetValue<double>(ConditionSettings::penalty_factor), 1e10, EPS4 );
+}
+
+BOOST_AUTO_TEST_CASE(JsonReaderCustomizedValuesTest) {
+    QuESo_INFO << "Testing :: Test Json Reader :: Customized Values" << std::endl;
+
+    for( const std::string filename : {"queso/tests/settings_container/QuESoSettings_custom_1.json",
+                                       "queso/tests/settings_container/QuESoSettings_custom_2.json"} ){
+        const Settings settings = JsonReader::ReadSettings(filename);
+        CheckCustomizedValues(settings);
+
+        // Write and read again.
+        const std::string new_filename = "queso/tests/settings_container/QuESoSettings_custom_cpp_new.json";
+        IO::WriteDictionaryToJSON(settings, new_filename);
+        const Settings settings_new = JsonReader::ReadSettings(new_filename);
+        std::remove(new_filename.c_str());
+        CheckCustomizedValues(settings_new);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(JsonReaderDefaultValuesTest) {
+    QuESo_INFO << "Testing :: Test Json Reader :: Default Values" << std::endl;
+
+    const Settings settings = JsonReader::ReadSettings("queso/tests/settings_container/QuESoSettings_default.json");
+    const Settings settings_default;
+
+    const auto& r_general_settings = settings[MainSettings::general_settings];
+    QuESo_CHECK_IS_FALSE( r_general_settings.IsSet(GeneralSettings::input_filename) );
+    QuESo_CHECK_EQUAL( r_general_settings.GetValue<std::string>(GeneralSettings::output_directory_name), std::string("queso_output") );
+    QuESo_CHECK_EQUAL( r_general_settings.GetValue<IndexType>(GeneralSettings::echo_level), 1u );
+    QuESo_CHECK_EQUAL( r_general_settings.GetValue<InsideTestMethod>(GeneralSettings::inside_test_method), InsideTestMethod::ray_tracing );
+    QuESo_CHECK_IS_FALSE( settings[MainSettings::background_grid_settings].IsSet(BackgroundGridSettings::lower_bound_xyz) );
+    QuESo_CHECK_EQUAL( settings[MainSettings::trimmed_quadrature_rule_settings].GetValue<NNLSSolver>(TrimmedQuadratureRuleSettings::nnls_solver),
+        NNLSSolver::lawson_hanson );
+
+    // Empty objects create empty list items.
+    const auto& r_conditions_settings_list = settings.GetList(MainSettings::conditions_settings_list);
+    QuESo_CHECK_EQUAL( r_conditions_settings_list.size(), 4 );
+    for( const auto& r_condition_settings : r_conditions_settings_list ){
+        QuESo_CHECK_IS_FALSE( r_condition_settings.IsSet(ConditionSettings::condition_id) );
+        QuESo_CHECK_IS_FALSE( r_condition_settings.IsSet(ConditionSettings::value) );
+    }
+
+    // Printed unset values ("Not Set.") are ignored.
+    std::stringstream buffer;
+    buffer << settings_default;
+    const Settings settings_new = JsonReader::ReadSettingsFromString(buffer.str());
+    QuESo_CHECK_IS_FALSE( settings_new[MainSettings::general_settings].IsSet(GeneralSettings::input_filename) );
+    QuESo_CHECK_IS_FALSE( settings_new[MainSettings::background_grid_settings].IsSet(BackgroundGridSettings::grid_type) );
+    QuESo_CHECK_IS_FALSE( settings_new[MainSettings::background_grid_settings].IsSet(BackgroundGridSettings::polynomial_order) );
+    QuESo_CHECK_EQUAL( settings_new[MainSettings::general_settings].GetValue<double>(GeneralSettings::checkpoint_interval), 60.0 );
+    QuESo_CHECK_EQUAL( settings_new.GetList(MainSettings::conditions_settings_list).size(), 0 );
+}
+
+BOOST_AUTO_TEST_CASE(JsonReaderCastAmbiguousTypesTest) {
+    QuESo_INFO << "Testing :: Test Json Reader :: Cast Ambiguous Types" << std::endl;
+
+    const Settings settings = JsonReader::ReadSettingsFromString(
+        "{ \"general_settings\" : { \"checkpoint_interval\" : 3, \"input_filename\" : \"a \\\"b\\\"\\u00e4.stl\" },\n"
+        "  \"background_grid_settings\" : { \"lower_bound_xyz\" : [1, 2, 3], \"upper_bound_xyz\" : [-1, 2e1, 3.5],\n"
+        "                                   \"number_of_elements\" : [1, 2, 3] } }");
+    QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<double>(GeneralSettings::checkpoint_interval), 3.0 );
+    QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<std::string>(GeneralSettings::input_filename), std::string("a \"b\"\xC3\xA4.stl") );
+    QuESo_CHECK_POINT_NEAR( settings[MainSettings::background_grid_settings].GetValue<PointType>(BackgroundGridSettings::lower_bound_xyz),
+        PointType({1.0, 2.0, 3.0}), EPS4 );
+    QuESo_CHECK_POINT_NEAR( settings[MainSettings::background_grid_settings].GetValue<PointType>(BackgroundGridSettings::upper_bound_xyz),
+        PointType({-1.0, 20.0, 3.5}), EPS4 );
+    QuESo_CHECK_EQUAL( settings[MainSettings::background_grid_settings].GetValue<Vector3i>(BackgroundGridSettings::number_of_elements),
+        Vector3i({1, 2, 3}) );
+}
+
+BOOST_AUTO_TEST_CASE(JsonReaderErrorsTest) {
+    QuESo_INFO << "Testing :: Test Json Reader :: Errors" << std::endl;
+
+    BOOST_REQUIRE_THROW( JsonReader::ReadSettings("not_existing_file.json"), std::exception );
+    // Invalid keys
+    BOOST_REQUIRE_THROW( JsonReader::ReadSettingsFromString("{ \"general_setting\" : {} }"), std::exception );
+    BOOST_REQUIRE_THROW( JsonReader::ReadSettingsFromString("{ \"general_settings\" : { \"echo\" : 1 } }"), std::exception );
+    BOOST_REQUIRE_THROW( JsonReader::ReadSettingsFromString("{ \"general_settings\" : [ {} ] }"), std::exception );
+    // Invalid types
+    BOOST_REQUIRE_THROW( JsonReader::ReadSettingsFromString("{ \"general_settings\" : { \"echo_level\" : 1.0 } }"), std::exception );
+    BOOST_REQUIRE_THROW( JsonReader::ReadSettingsFromString("{ \"general_settings\" : { \"echo_level\" : -1 } }"), std::exception );
+    BOOST_REQUIRE_THROW( JsonReader::ReadSettingsFromString("{ \"general_settings\" : { \"echo_level\" : \"1\" } }"), std::exception );
+    BOOST_REQUIRE_THROW( JsonReader::ReadSettingsFromString("{ \"general_settings\" : { \"echo_level\" : null } }"), std::exception );
+    BOOST_REQUIRE_THROW( JsonReader::ReadSettingsFromString("{ \"background_grid_settings\" : { \"number_of_elements\" : [1.0, 2, 3] } }"), std::exception );
+    BOOST_REQUIRE_THROW( JsonReader::ReadSettingsFromString("{ \"background_grid_settings\" : { \"number_of_elements\" : [1, 2] } }"), std::exception );
+    // Invalid enums
+    BOOST_REQUIRE_THROW( JsonReader::ReadSettingsFromString("{ \"background_grid_settings\" : { \"grid_type\" : \"b_spline\" } }"), std::exception );
+    BOOST_REQUIRE_THROW( JsonReader::ReadSettingsFromString("{ \"non_trimmed_quadrature_rule_settings\" : { \"integration_method\" : \"gauss\" } }"), std::exception );
+    // Invalid syntax
+    BOOST_REQUIRE_THROW( JsonReader::ReadSettingsFromString(""), std::exception );
+    BOOST_REQUIRE_THROW( JsonReader::ReadSettingsFromString("{ \"general_settings\" : { \"echo_level\" : 1, } }"), std::exception );
+    BOOST_REQUIRE_THROW( JsonReader::ReadSettingsFromString("{ \"general_settings\" : { \"echo_level\" : 1 }"), std::exception );
+    BOOST_REQUIRE_THROW( JsonReader::ReadSettingsFromString("{ \"general_settings\" : { \"echo_level\" : 1 } } }"), std::exception );
+    BOOST_REQUIRE_THROW( JsonReader::ReadSettingsFromString("{ \"general_settings\" : { \"write_output_to_file\" : tru } }"), std::exception );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // End namespace Testing
+} // End namespace queso
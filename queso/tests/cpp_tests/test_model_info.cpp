@@ -42,6 +42,18 @@ BOOST_AUTO_TEST_CASE(ModelInfoDefaultValuesTest) {
         if( !NOTDEBUG ) {
             BOOST_REQUIRE_THROW( model_info[MainInfo::embedded_geometry_info].GetValue<double>(EmbeddedGeometryInfo::volume), std::exception );
         }
+        QuESo_CHECK( !model_info[MainInfo::embedded_geometry_info].IsSet(EmbeddedGeometryInfo::num_triangles) );
+        if( !NOTDEBUG ) {
+            BOOST_REQUIRE_THROW( model_info[MainInfo::embedded_geometry_info].GetValue<IndexType>(EmbeddedGeometryInfo::num_triangles), std::exception );
+        }
+        QuESo_CHECK( !model_info[MainInfo::embedded_geometry_info].IsSet(EmbeddedGeometryInfo::num_input_triangles) );
+        if( !NOTDEBUG ) {
+            BOOST_REQUIRE_THROW( model_info[MainInfo::embedded_geometry_info].GetValue<IndexType>(EmbeddedGeometryInfo::num_input_triangles), std::exception );
+        }
+        QuESo_CHECK( !model_info[MainInfo::embedded_geometry_info].IsSet(EmbeddedGeometryInfo::decimation_deviation) );
+        if( !NOTDEBUG ) {
+            BOOST_REQUIRE_THROW( model_info[MainInfo::embedded_geometry_info].GetValue<double>(EmbeddedGeometryInfo::decimation_deviation), std::exception );
+        }
         /// quadrature_info
         QuESo_CHECK( !model_info[MainInfo::quadrature_info].IsSet(QuadratureInfo::represented_volume) );
         if( !NOTDEBUG ) {
@@ -63,6 +75,10 @@ BOOST_AUTO_TEST_CASE(ModelInfoDefaultValuesTest) {
         if( !NOTDEBUG ) {
             BOOST_REQUIRE_THROW( model_info[MainInfo::quadrature_info].GetValue<IndexType>(QuadratureInfo::num_of_points_per_trimmed_element), std::exception );
         }
+        QuESo_CHECK( !model_info[MainInfo::quadrature_info].IsSet(QuadratureInfo::num_planar_cut_elements) );
+        if( !NOTDEBUG ) {
+            BOOST_REQUIRE_THROW( model_info[MainInfo::quadrature_info].GetValue<IndexType>(QuadratureInfo::num_planar_cut_elements), std::exception );
+        }
         /// background_grid_info
         QuESo_CHECK( !model_info[MainInfo::background_grid_info].IsSet(BackgroundGridInfo::num_active_elements) );
         if( !NOTDEBUG ) {
@@ -81,6 +97,61 @@ BOOST_AUTO_TEST_CASE(ModelInfoDefaultValuesTest) {
             BOOST_REQUIRE_THROW( model_info[MainInfo::background_grid_info].GetValue<IndexType>(BackgroundGridInfo::num_inactive_elements), std::exception );
         }
 
+        /// system_info
+        QuESo_CHECK( !model_info[MainInfo::system_info].IsSet(SystemInfo::instruction_set) );
+        if( !NOTDEBUG ) {
+            BOOST_REQUIRE_THROW( model_info[MainInfo::system_info].GetValue<std::string>(SystemInfo::instruction_set), std::exception );
+        }
+
+        /// auto_tuning_info
+        QuESo_CHECK( !model_info[MainInfo::auto_tuning_info].IsSet(AutoTuningInfo::min_num_boundary_triangles) );
+        QuESo_CHECK( !model_info[MainInfo::auto_tuning_info].IsSet(AutoTuningInfo::init_point_distribution_factor) );
+        QuESo_CHECK( !model_info[MainInfo::auto_tuning_info].IsSet(AutoTuningInfo::max_octree_refinement_level) );
+        QuESo_CHECK( !model_info[MainInfo::auto_tuning_info].IsSet(AutoTuningInfo::num_sampled_elements) );
+        QuESo_CHECK( !model_info[MainInfo::auto_tuning_info].IsSet(AutoTuningInfo::num_candidates) );
+        QuESo_CHECK( !model_info[MainInfo::auto_tuning_info].IsSet(AutoTuningInfo::volume_error) );
+        QuESo_CHECK( !model_info[MainInfo::auto_tuning_info].IsSet(AutoTuningInfo::speedup) );
+        if( !NOTDEBUG ) {
+            BOOST_REQUIRE_THROW( model_info[MainInfo::auto_tuning_info].GetValue<IndexType>(AutoTuningInfo::num_candidates), std::exception );
+        }
+
+        /// verification_info
+        QuESo_CHECK( !model_info[MainInfo::verification_info].IsSet(VerificationInfo::test_polynomial_order) );
+        QuESo_CHECK( !model_info[MainInfo::verification_info].IsSet(VerificationInfo::num_verified_elements) );
+        QuESo_CHECK( !model_info[MainInfo::verification_info].IsSet(VerificationInfo::num_skipped_elements) );
+        QuESo_CHECK( !model_info[MainInfo::verification_info].IsSet(VerificationInfo::max_moment_error) );
+        QuESo_CHECK( !model_info[MainInfo::verification_info].IsSet(VerificationInfo::mean_moment_error) );
+        QuESo_CHECK( !model_info[MainInfo::verification_info].IsSet(VerificationInfo::surface_area) );
+        QuESo_CHECK( !model_info[MainInfo::verification_info].IsSet(VerificationInfo::represented_surface_area) );
+        QuESo_CHECK( !model_info[MainInfo::verification_info].IsSet(VerificationInfo::percentage_of_surface_area) );
+        QuESo_CHECK_EQUAL( model_info[MainInfo::verification_info].GetList(VerificationInfo::moment_error_histogram).size(), 0 );
+        QuESo_CHECK_EQUAL( model_info[MainInfo::verification_info].GetList(VerificationInfo::worst_elements_list).size(), 0 );
+        if( !NOTDEBUG ) {
+            BOOST_REQUIRE_THROW( model_info[MainInfo::verification_info].GetValue<double>(VerificationInfo::max_moment_error), std::exception );
+        }
+
+        /// grid_planning_info
+        QuESo_CHECK( !model_info[MainInfo::grid_planning_info].IsSet(GridPlanningInfo::proposed_number_of_elements) );
+        QuESo_CHECK( !model_info[MainInfo::grid_planning_info].IsSet(GridPlanningInfo::min_feature_size) );
+        QuESo_CHECK( !model_info[MainInfo::grid_planning_info].IsSet(GridPlanningInfo::median_feature_size) );
+        QuESo_CHECK( !model_info[MainInfo::grid_planning_info].IsSet(GridPlanningInfo::predicted_num_trimmed_elements) );
+        QuESo_CHECK( !model_info[MainInfo::grid_planning_info].IsSet(GridPlanningInfo::predicted_volume_error) );
+        QuESo_CHECK( !model_info[MainInfo::grid_planning_info].IsSet(GridPlanningInfo::predicted_runtime) );
+        QuESo_CHECK( !model_info[MainInfo::grid_planning_info].IsSet(GridPlanningInfo::target_met) );
+        QuESo_CHECK( !model_info[MainInfo::grid_planning_info].IsSet(GridPlanningInfo::num_sampled_elements) );
+        QuESo_CHECK_EQUAL( model_info[MainInfo::grid_planning_info].GetList(GridPlanningInfo::candidates_list).size(), 0 );
+        if( !NOTDEBUG ) {
+            BOOST_REQUIRE_THROW( model_info[MainInfo::grid_planning_info].GetValue<Vector3i>(GridPlanningInfo::proposed_number_of_elements), std::exception );
+        }
+
+        /// diagnostics_info
+        QuESo_CHECK( model_info[MainInfo::diagnostics_info].IsSet(DiagnosticsInfo::num_events) );
+        QuESo_CHECK_EQUAL( model_info[MainInfo::diagnostics_info].GetValue<IndexType>(DiagnosticsInfo::num_events), 0 );
+        QuESo_CHECK_EQUAL( model_info[MainInfo::diagnostics_info].GetList(DiagnosticsInfo::events_summary_list).size(), 0 );
+        if( !NOTDEBUG ) { // Wrong type
+            BOOST_REQUIRE_THROW( model_info[MainInfo::diagnostics_info].GetValue<double>(DiagnosticsInfo::num_events), std::exception );
+        }
+
         /// elapsed_time_info
         const auto& r_elpased_time_info = model_info[MainInfo::elapsed_time_info];
         QuESo_CHECK( r_elpased_time_info.IsSet(ElapsedTimeInfo::total) );
@@ -112,6 +183,13 @@ BOOST_AUTO_TEST_CASE(ModelInfoDefaultValuesTest) {
         }
         QuESo_CHECK( r_elpased_time_info[ElapsedTimeInfo::volume_time_info].IsSet(VolumeTimeInfo::construction_of_ggq_rules) );
         QuESo_CHECK_NEAR(r_elpased_time_info[ElapsedTimeInfo::volume_time_info].GetValue<double>(VolumeTimeInfo::construction_of_ggq_rules), 0.0, EPS0);
+        QuESo_CHECK_NEAR(r_elpased_time_info[ElapsedTimeInfo::volume_time_info].GetValue<double>(VolumeTimeInfo::auto_tuning), 0.0, EPS0);
+        QuESo_CHECK( r_elpased_time_info[ElapsedTimeInfo::volume_time_info].IsSet(VolumeTimeInfo::verification_of_quadrature_rules) );
+        QuESo_CHECK_NEAR(r_elpased_time_info[ElapsedTimeInfo::volume_time_info].GetValue<double>(VolumeTimeInfo::verification_of_quadrature_rules), 0.0, EPS0);
+        QuESo_CHECK( r_elpased_time_info[ElapsedTimeInfo::volume_time_info].IsSet(VolumeTimeInfo::grid_planning) );
+        QuESo_CHECK_NEAR(r_elpased_time_info[ElapsedTimeInfo::volume_time_info].GetValue<double>(VolumeTimeInfo::grid_planning), 0.0, EPS0);
+        QuESo_CHECK( r_elpased_time_info[ElapsedTimeInfo::volume_time_info].IsSet(VolumeTimeInfo::construction_of_coarse_grid_levels) );
+        QuESo_CHECK_NEAR(r_elpased_time_info[ElapsedTimeInfo::volume_time_info].GetValue<double>(VolumeTimeInfo::construction_of_coarse_grid_levels), 0.0, EPS0);
         if( !NOTDEBUG ) { // Wrong type
             BOOST_REQUIRE_THROW( r_elpased_time_info[ElapsedTimeInfo::volume_time_info].GetValue<IndexType>(VolumeTimeInfo::construction_of_ggq_rules), std::exception );
         }
@@ -135,6 +213,12 @@ BOOST_AUTO_TEST_CASE(ModelInfoDefaultValuesTest) {
         BOOST_REQUIRE_THROW( model_info["embedded_geometry_info"].GetValue<bool>("is_closed"), std::exception );
         QuESo_CHECK( !model_info["embedded_geometry_info"].IsSet("volume") );
         BOOST_REQUIRE_THROW( model_info["embedded_geometry_info"].GetValue<double>("volume"), std::exception );
+        QuESo_CHECK( !model_info["embedded_geometry_info"].IsSet("num_triangles") );
+        BOOST_REQUIRE_THROW( model_info["embedded_geometry_info"].GetValue<IndexType>("num_triangles"), std::exception );
+        QuESo_CHECK( !model_info["embedded_geometry_info"].IsSet("num_input_triangles") );
+        BOOST_REQUIRE_THROW( model_info["embedded_geometry_info"].GetValue<IndexType>("num_input_triangles"), std::exception );
+        QuESo_CHECK( !model_info["embedded_geometry_info"].IsSet("decimation_deviation") );
+        BOOST_REQUIRE_THROW( model_info["embedded_geometry_info"].GetValue<double>("decimation_deviation"), std::exception );
 
         /// quadrature_info
         QuESo_CHECK( !model_info["quadrature_info"].IsSet("represented_volume") );
@@ -147,6 +231,8 @@ BOOST_AUTO_TEST_CASE(ModelInfoDefaultValuesTest) {
         BOOST_REQUIRE_THROW( model_info["quadrature_info"].GetValue<double>("num_of_points_per_full_element"), std::exception );
         QuESo_CHECK( !model_info["quadrature_info"].IsSet("num_of_points_per_trimmed_element") );
         BOOST_REQUIRE_THROW( model_info["quadrature_info"].GetValue<double>("num_of_points_per_trimmed_element"), std::exception );
+        QuESo_CHECK( !model_info["quadrature_info"].IsSet("num_planar_cut_elements") );
+        BOOST_REQUIRE_THROW( model_info["quadrature_info"].GetValue<IndexType>("num_planar_cut_elements"), std::exception );
 
         /// background_grid_info
         QuESo_CHECK( !model_info["background_grid_info"].IsSet("num_active_elements") );
@@ -159,6 +245,46 @@ BOOST_AUTO_TEST_CASE(ModelInfoDefaultValuesTest) {
         BOOST_REQUIRE_THROW( model_info["background_grid_info"].GetValue<IndexType>("num_inactive_elements"), std::exception );
 
 
+        /// system_info
+        QuESo_CHECK( !model_info["system_info"].IsSet("instruction_set") );
+        BOOST_REQUIRE_THROW( model_info["system_info"].GetValue<std::string>("instruction_set"), std::exception );
+
+        /// auto_tuning_info
+        QuESo_CHECK( !model_info["auto_tuning_info"].IsSet("min_num_boundary_triangles") );
+        BOOST_REQUIRE_THROW( model_info["auto_tuning_info"].GetValue<IndexType>("min_num_boundary_triangles"), std::exception );
+        QuESo_CHECK( !model_info["auto_tuning_info"].IsSet("speedup") );
+        BOOST_REQUIRE_THROW( model_info["auto_tuning_info"].GetValue<double>("speedup"), std::exception );
+
+        /// verification_info
+        QuESo_CHECK( !model_info["verification_info"].IsSet("test_polynomial_order") );
+        BOOST_REQUIRE_THROW( model_info["verification_info"].GetValue<Vector3i>("test_polynomial_order"), std::exception );
+        QuESo_CHECK( !model_info["verification_info"].IsSet("num_verified_elements") );
+        BOOST_REQUIRE_THROW( model_info["verification_info"].GetValue<IndexType>("num_verified_elements"), std::exception );
+        QuESo_CHECK( !model_info["verification_info"].IsSet("num_skipped_elements") );
+        QuESo_CHECK( !model_info["verification_info"].IsSet("max_moment_error") );
+        QuESo_CHECK( !model_info["verification_info"].IsSet("mean_moment_error") );
+        QuESo_CHECK( !model_info["verification_info"].IsSet("surface_area") );
+        QuESo_CHECK( !model_info["verification_info"].IsSet("represented_surface_area") );
+        QuESo_CHECK( !model_info["verification_info"].IsSet("percentage_of_surface_area") );
+        BOOST_REQUIRE_THROW( model_info["verification_info"].GetValue<double>("percentage_of_surface_area"), std::exception );
+        QuESo_CHECK_EQUAL( model_info["verification_info"].GetList("moment_error_histogram").size(), 0 );
+        QuESo_CHECK_EQUAL( model_info["verification_info"].GetList("worst_elements_list").size(), 0 );
+
+        /// grid_planning_info
+        QuESo_CHECK( !model_info["grid_planning_info"].IsSet("proposed_number_of_elements") );
+        BOOST_REQUIRE_THROW( model_info["grid_planning_info"].GetValue<Vector3i>("proposed_number_of_elements"), std::exception );
+        QuESo_CHECK( !model_info["grid_planning_info"].IsSet("min_feature_size") );
+        QuESo_CHECK( !model_info["grid_planning_info"].IsSet("predicted_volume_error") );
+        QuESo_CHECK( !model_info["grid_planning_info"].IsSet("target_met") );
+        BOOST_REQUIRE_THROW( model_info["grid_planning_info"].GetValue<bool>("target_met"), std::exception );
+        QuESo_CHECK_EQUAL( model_info["grid_planning_info"].GetList("candidates_list").size(), 0 );
+
+        /// diagnostics_info
+        QuESo_CHECK( model_info["diagnostics_info"].IsSet("num_events") );
+        QuESo_CHECK_EQUAL( model_info["diagnostics_info"].GetValue<IndexType>("num_events"), 0 );
+        BOOST_REQUIRE_THROW( model_info["diagnostics_info"].GetValue<double>("num_events"), std::exception );
+        QuESo_CHECK_EQUAL( model_info["diagnostics_info"].GetList("events_summary_list").size(), 0 );
+
         /// elapsed_time_info
         auto& r_elpased_time_info = model_info["elapsed_time_info"];
 
@@ -181,6 +307,12 @@ BOOST_AUTO_TEST_CASE(ModelInfoDefaultValuesTest) {
         QuESo_CHECK( r_elpased_time_info["volume_time_info"].IsSet("construction_of_ggq_rules") );
         QuESo_CHECK_NEAR( r_elpased_time_info["volume_time_info"].GetValue<double>("construction_of_ggq_rules"), 0.0, EPS0);
         BOOST_REQUIRE_THROW( r_elpased_time_info["volume_time_info"].GetValue<IndexType>("construction_of_ggq_rules"), std::exception );  // Wrong type
+        QuESo_CHECK( r_elpased_time_info["volume_time_info"].IsSet("verification_of_quadrature_rules") );
+        QuESo_CHECK_NEAR( r_elpased_time_info["volume_time_info"].GetValue<double>("verification_of_quadrature_rules"), 0.0, EPS0);
+        QuESo_CHECK( r_elpased_time_info["volume_time_info"].IsSet("grid_planning") );
+        QuESo_CHECK_NEAR( r_elpased_time_info["volume_time_info"].GetValue<double>("grid_planning"), 0.0, EPS0);
+        QuESo_CHECK( r_elpased_time_info["volume_time_info"].IsSet("construction_of_coarse_grid_levels") );
+        QuESo_CHECK_NEAR( r_elpased_time_info["volume_time_info"].GetValue<double>("construction_of_coarse_grid_levels"), 0.0, EPS0);
 
         QuESo_CHECK( r_elpased_time_info["conditions_time_info"].IsSet("total") );
         QuESo_CHECK_NEAR( r_elpased_time_info["conditions_time_info"].GetValue<double>("total"), 0.0, EPS0);
@@ -469,6 +601,56 @@ BOOST_AUTO_TEST_CASE(ModelInfoConditionsInfoCustomizedValuesTest) {
     }
 };
 
+BOOST_AUTO_TEST_CASE(ModelInfoVerificationInfoListsTest) {
+    QuESo_INFO << "Testing :: Test ModelInfo :: Test Verification Info Lists" << std::endl;
+
+    {   /// Enum access
+        ModelInfo model_info;
+        auto& r_bin_info = model_info.CreateNewMomentErrorHistogramInfo();
+        QuESo_CHECK( !r_bin_info.IsSet(MomentErrorHistogramInfo::lower_bound) );
+        QuESo_CHECK( !r_bin_info.IsSet(MomentErrorHistogramInfo::upper_bound) );
+        QuESo_CHECK( !r_bin_info.IsSet(MomentErrorHistogramInfo::num_elements) );
+        r_bin_info.SetValue(MomentErrorHistogramInfo::lower_bound, 1e-4);
+        r_bin_info.SetValue(MomentErrorHistogramInfo::upper_bound, 1e-3);
+        r_bin_info.SetValue(MomentErrorHistogramInfo::num_elements, 12u);
+
+        auto& r_element_info = model_info.CreateNewWorstElementInfo();
+        QuESo_CHECK( !r_element_info.IsSet(WorstElementInfo::element_id) );
+        QuESo_CHECK( !r_element_info.IsSet(WorstElementInfo::moment_error) );
+        r_element_info.SetValue(WorstElementInfo::element_id, 42u);
+        r_element_info.SetValue(WorstElementInfo::moment_error, 2.5e-4);
+
+        const auto& r_histogram = model_info[MainInfo::verification_info].GetList(VerificationInfo::moment_error_histogram);
+        QuESo_CHECK_EQUAL( r_histogram.size(), 1 );
+        QuESo_CHECK_NEAR( r_histogram[0].GetValue<double>(MomentErrorHistogramInfo::lower_bound), 1e-4, EPS4 );
+        QuESo_CHECK_NEAR( r_histogram[0].GetValue<double>(MomentErrorHistogramInfo::upper_bound), 1e-3, EPS4 );
+        QuESo_CHECK_EQUAL( r_histogram[0].GetValue<IndexType>(MomentErrorHistogramInfo::num_elements), 12 );
+        if( !NOTDEBUG ) { // Wrong type
+            BOOST_REQUIRE_THROW( r_histogram[0].GetValue<double>(MomentErrorHistogramInfo::num_elements), std::exception );
+        }
+
+        const auto& r_worst_elements = model_info[MainInfo::verification_info].GetList(VerificationInfo::worst_elements_list);
+        QuESo_CHECK_EQUAL( r_worst_elements.size(), 1 );
+        QuESo_CHECK_EQUAL( r_worst_elements[0].GetValue<IndexType>(WorstElementInfo::element_id), 42 );
+        QuESo_CHECK_NEAR( r_worst_elements[0].GetValue<double>(WorstElementInfo::moment_error), 2.5e-4, EPS4 );
+    }
+    {   /// String access
+        ModelInfo model_info;
+        auto& r_bin_info = model_info.CreateNewMomentErrorHistogramInfo();
+        r_bin_info.SetValue("num_elements", 3u);
+        QuESo_CHECK( !r_bin_info.IsSet("lower_bound") );
+        QuESo_CHECK( r_bin_info.IsSet("num_elements") );
+
+        auto& r_element_info = model_info.CreateNewWorstElementInfo();
+        r_element_info.SetValue("moment_error", 0.5);
+        QuESo_CHECK( !r_element_info.IsSet("element_id") );
+
+        QuESo_CHECK_EQUAL( model_info["verification_info"].GetList("moment_error_histogram")[0].GetValue<IndexType>("num_elements"), 3 );
+        QuESo_CHECK_NEAR( model_info["verification_info"].GetList("worst_elements_list")[0].GetValue<double>("moment_error"), 0.5, EPS4 );
+        BOOST_REQUIRE_THROW( model_info["verification_info"].GetList("worst_elements_list")[0].GetValue<IndexType>("moment_error"), std::exception ); // Wrong type
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // End namespace Testing
@@ -206,6 +206,106 @@ BOOST_AUTO_TEST_CASE(MomentFittingP4) {
     QuESo_CHECK_LT(1.0/125.0*std::sqrt(error_norm), 1e-7);
 } // End Testcase
 
+BOOST_AUTO_TEST_CASE(MomentFittingShapeSensitivities) {
+    QuESo_INFO << "Testing :: Test Moment Fitting :: Shape Sensitivities" << std::endl;
+
+    typedef IntegrationPoint IntegrationPointType;
+    typedef BoundaryIntegrationPoint BoundaryIntegrationPointType;
+    typedef Element<IntegrationPointType, BoundaryIntegrationPointType> ElementType;
+    typedef QuadratureTrimmedElementTester<ElementType> TesterType;
+
+    const PointType lower_bound = {0.0, 0.0, 0.0};
+    const PointType upper_bound = {1.0, 1.0, 1.0};
+    const Vector3i polynomial_order = {2, 2, 2};
+
+    // Cuboid cuts the element at x=0.6.
+    auto p_cuboid = MeshUtilities::pGetCuboid({-1.0, -1.0, -1.0}, {0.6, 2.0, 2.0});
+    const auto& r_vertices = p_cuboid->GetVertices();
+    const IndexType vertex_id = std::find(r_vertices.begin(), r_vertices.end(), Vector3d{0.6, -1.0, -1.0}) - r_vertices.begin();
+    QuESo_CHECK_LT(vertex_id, r_vertices.size());
+
+    // Returns copy of cuboid, where vertex_id is moved by Delta in Direction.
+    auto create_mesh = [&](IndexType Direction, double Delta){
+        TriangleMesh triangle_mesh{};
+        for( auto vertex : r_vertices ){
+            triangle_mesh.AddVertex(vertex);
+        }
+        triangle_mesh.GetVertices()[vertex_id][Direction] += Delta;
+        for( IndexType triangle_id = 0; triangle_id < p_cuboid->NumOfTriangles(); ++triangle_id ){
+            triangle_mesh.AddTriangle(p_cuboid->VertexIds(triangle_id));
+            triangle_mesh.AddNormal(TriangleMeshInterface::Normal(triangle_mesh.P1(triangle_id), triangle_mesh.P2(triangle_id), triangle_mesh.P3(triangle_id)));
+        }
+        return triangle_mesh;
+    };
+
+    // Returns element with trimmed domain.
+    auto create_element = [&](const TriangleMeshInterface& rTriangleMesh){
+        auto p_element = MakeUnique<ElementType>(1, MakeBox(lower_bound, upper_bound), MakeBox({-1.0, -1.0, -1.0}, {1.0, 1.0, 1.0}));
+        BRepOperator brep_operator(rTriangleMesh);
+        auto p_trimmed_domain = brep_operator.pGetTrimmedDomain(lower_bound, upper_bound, 1e-3, 100, false);
+        QuESo_CHECK( p_trimmed_domain != nullptr );
+        p_element->SetIsTrimmed(true);
+        p_element->pSetTrimmedDomain(p_trimmed_domain);
+        return p_element;
+    };
+
+    // Returns constant terms computed via the boundary integration points.
+    auto compute_constant_terms = [&](const ElementType& rElement){
+        std::vector<double> constant_terms{};
+        TesterType::ComputeConstantTerms(constant_terms, rElement.pGetTrimmedDomain()->pGetBoundaryIps<BoundaryIntegrationPointType>(), rElement, polynomial_order);
+        return constant_terms;
+    };
+
+    const TriangleMesh triangle_mesh = create_mesh(0, 0.0);
+    auto p_element = create_element(triangle_mesh);
+    TesterType::AssembleIPs(*p_element, polynomial_order, 1e-10);
+    const IndexType num_points = p_element->GetIntegrationPoints().size();
+    QuESo_CHECK_GT(num_points, 0);
+
+    BRepOperator brep_operator(triangle_mesh);
+    const auto p_triangle_ids = brep_operator.GetIntersectedTriangleIds(lower_bound, upper_bound);
+    TesterType::ComputeShapeSensitivities(*p_element, polynomial_order, triangle_mesh, *p_triangle_ids);
+    QuESo_CHECK( p_element->HasShapeSensitivities() );
+    const auto& r_shape_sensitivities = p_element->GetShapeSensitivities();
+    QuESo_CHECK_EQUAL(r_shape_sensitivities.NumberOfPoints(), num_points);
+    const auto& r_vertex_ids = r_shape_sensitivities.VertexIds();
+    const IndexType vertex_index = std::find(r_vertex_ids.begin(), r_vertex_ids.end(), vertex_id) - r_vertex_ids.begin();
+    QuESo_CHECK_LT(vertex_index, r_vertex_ids.size());
+
+    std::vector<IndexType> vertex_ids{};
+    std::vector<double> constant_term_derivatives{};
+    TesterType::ComputeConstantTermSensitivities(vertex_ids, constant_term_derivatives, *p_element, polynomial_order, triangle_mesh, *p_triangle_ids);
+    QuESo_CHECK( vertex_ids == r_vertex_ids );
+    const IndexType number_of_functions = constant_term_derivatives.size() / (3*vertex_ids.size());
+
+    // Moving the vertex normal to the cut face changes the volume within the element.
+    QuESo_CHECK_GT(std::abs(constant_term_derivatives[(vertex_index*3 + 0)*number_of_functions]), 1e-2);
+
+    // Compare against central finite differences. The points are kept fixed.
+    const double delta = 1e-5;
+    for( IndexType dir = 0; dir < 3; ++dir ){
+        const TriangleMesh triangle_mesh_plus = create_mesh(dir, delta);
+        const TriangleMesh triangle_mesh_minus = create_mesh(dir, -delta);
+        const auto p_element_plus = create_element(triangle_mesh_plus);
+        const auto p_element_minus = create_element(triangle_mesh_minus);
+        const auto constant_terms_plus = compute_constant_terms(*p_element_plus);
+        const auto constant_terms_minus = compute_constant_terms(*p_element_minus);
+        for( IndexType k = 0; k < number_of_functions; ++k ){
+            const double fd_derivative = (constant_terms_plus[k] - constant_terms_minus[k]) / (2.0*delta);
+            QuESo_CHECK_NEAR(constant_term_derivatives[(vertex_index*3 + dir)*number_of_functions + k], fd_derivative, 1e-6);
+        }
+
+        auto points_plus = p_element->GetIntegrationPoints();
+        auto points_minus = p_element->GetIntegrationPoints();
+        TesterType::MomentFitting(constant_terms_plus, points_plus, *p_element, polynomial_order);
+        TesterType::MomentFitting(constant_terms_minus, points_minus, *p_element, polynomial_order);
+        for( IndexType j = 0; j < num_points; ++j ){
+            const double fd_derivative = (points_plus[j].Weight() - points_minus[j].Weight()) / (2.0*delta);
+            QuESo_CHECK_NEAR(r_shape_sensitivities.Derivative(vertex_index, j, dir), fd_derivative, 1e-6);
+        }
+    }
+} // End Testcase
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // End namespace Testing
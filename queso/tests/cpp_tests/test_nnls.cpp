@@ -15,6 +15,9 @@
 
 //// External includes
 #include <boost/test/unit_test.hpp>
+//// STL includes
+#include <random>
+#include <cmath>
 //// Project includes
 #include "queso/includes/checks.hpp"
 #include "queso/solvers/nnls.h"
@@ -73,6 +76,96 @@ BOOST_AUTO_TEST_CASE(NNLS_Square_Matrix) {
         QuESo_CHECK_NEAR(x[i], x_reference[i], 1e-10);
 }
 
+void RunRandomComparison(NNLSSolverType Solver, IndexType NumRows, IndexType NumColumns, double ColumnScaleSpread){
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    for( IndexType sample = 0; sample < 20; ++sample ){
+        NNLS::MatrixType A(NumRows*NumColumns);
+        for( IndexType j = 0; j < NumColumns; ++j ){
+            // Spread column norms over several orders of magnitude.
+            const double column_scale = std::pow(ColumnScaleSpread, distribution(generator));
+            for( IndexType i = 0; i < NumRows; ++i ){
+                A[j*NumRows + i] = column_scale*distribution(generator);
+            }
+        }
+        NNLS::VectorType b(NumRows);
+        for( IndexType i = 0; i < NumRows; ++i ){
+            b[i] = distribution(generator);
+        }
+
+        NNLS::MatrixType A_ref(A);
+        NNLS::VectorType b_ref(b);
+        NNLS::VectorType x_ref{};
+        const double residual_ref = NNLS::solve(A_ref, b_ref, x_ref);
+
+        NNLS::MatrixType A_copy(A);
+        NNLS::VectorType b_copy(b);
+        NNLS::VectorType x{};
+        const double residual = NNLS::solve(A_copy, b_copy, x, Solver);
+
+        QuESo_CHECK_EQUAL(x.size(), NumColumns);
+        QuESo_CHECK_NEAR(residual, residual_ref, 1e-8);
+
+        // Residual must match actual residual of solution.
+        double residual_check = 0.0;
+        for( IndexType i = 0; i < NumRows; ++i ){
+            double value = b[i];
+            for( IndexType j = 0; j < NumColumns; ++j ){
+                value -= A[j*NumRows + i]*x[j];
+            }
+            residual_check += value*value;
+        }
+        QuESo_CHECK_NEAR(std::sqrt(residual_check), residual, 1e-8);
+        for( IndexType j = 0; j < NumColumns; ++j ){
+            QuESo_CHECK_GT(x[j], -ZEROTOL);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(NNLS_Backends_Reference_Matrices) {
+    QuESo_INFO << "Testing :: Test nnls :: Backends :: Reference Matrices" << std::endl;
+
+    for( auto solver : {NNLSSolver::scaled_lawson_hanson, NNLSSolver::active_set_cholesky} ){
+        NNLS::MatrixType A = {
+            0.1, 0.3, 0.2, 0.5,
+            0.2, 0.7, 0.5, 0.3,
+            3.0, 0.6, 1.1, 0.9};
+        NNLS::VectorType b = {0.1, 0.1, 0.7, 0.3};
+        NNLS::VectorType x(3);
+        double Rnorm = NNLS::solve(A, b, x, solver);
+
+        QuESo_CHECK_NEAR(Rnorm, 0.5080235032184826, 1e-10);
+        QuESo_CHECK_NEAR(x[0], 0.26527761625544183, 1e-10);
+        QuESo_CHECK_NEAR(x[1], 0.39411741902728925, 1e-10);
+        QuESo_CHECK_NEAR(x[2], 0.032491624806329486, 1e-10);
+
+        NNLS::MatrixType A_2 = {
+            0.2, 0.3, 0.87, 0.22,
+            0.5, 0.7, 0.5,  0.45,
+            6.0, 0.6, 1.1,  0.9,
+            0.3, 0.3, 0.2,  1.1};
+        NNLS::VectorType b_2 = {0.33, 0.12, 0.12, 0.3};
+        NNLS::VectorType x_2(4);
+        Rnorm = NNLS::solve(A_2, b_2, x_2, solver);
+
+        QuESo_CHECK_NEAR(Rnorm, 0.0, 1e-10);
+        QuESo_CHECK_NEAR(x_2[0], 0.015692959503716887, 1e-10);
+        QuESo_CHECK_NEAR(x_2[1], 0.0347636417196625, 1e-10);
+        QuESo_CHECK_NEAR(x_2[2], 0.0404670415359823, 1e-10);
+        QuESo_CHECK_NEAR(x_2[3], 0.22225779341177274, 1e-10);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(NNLS_Backends_Random_Matrices) {
+    QuESo_INFO << "Testing :: Test nnls :: Backends :: Random Matrices" << std::endl;
+
+    for( auto solver : {NNLSSolver::lawson_hanson, NNLSSolver::scaled_lawson_hanson, NNLSSolver::active_set_cholesky} ){
+        RunRandomComparison(solver, 30, 10, 1.0);
+        RunRandomComparison(solver, 20, 60, 1.0);
+        RunRandomComparison(solver, 27, 80, 1e4);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // End namespace Testing
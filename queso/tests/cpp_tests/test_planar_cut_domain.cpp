@@ -0,0 +1,234 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#define BOOST_TEST_DYN_LINK
+
+//// External includes
+#include <boost/test/unit_test.hpp>
+//// Project includes
+#include "queso/includes/checks.hpp"
+#include "queso/embedded_model.h"
+#include "queso/embedding/brep_operator.h"
+#include "queso/embedding/planar_cut_domain.h"
+#include "queso/quadrature/trimmed_element.hpp"
+#include "queso/utilities/mesh_utilities.h"
+
+namespace queso {
+namespace Testing {
+
+BOOST_AUTO_TEST_SUITE( PlanarCutDomainTestSuite )
+
+typedef Element<IntegrationPoint, BoundaryIntegrationPoint> ElementType;
+
+/// Returns closed mesh of tetrahedron: (0,0,0), (L,0,0), (0,L,0), (0,0,L).
+TriangleMesh CreateTetrahedronMesh(double Length) {
+    TriangleMesh mesh{};
+    mesh.AddVertex({0.0, 0.0, 0.0});
+    mesh.AddVertex({Length, 0.0, 0.0});
+    mesh.AddVertex({0.0, Length, 0.0});
+    mesh.AddVertex({0.0, 0.0, Length});
+    mesh.AddTriangle({0, 2, 1});
+    mesh.AddNormal({0.0, 0.0, -1.0});
+    mesh.AddTriangle({0, 1, 3});
+    mesh.AddNormal({0.0, -1.0, 0.0});
+    mesh.AddTriangle({0, 3, 2});
+    mesh.AddNormal({-1.0, 0.0, 0.0});
+    mesh.AddTriangle({1, 2, 3});
+    const double value = 1.0/std::sqrt(3.0);
+    mesh.AddNormal({value, value, value});
+    return mesh;
+}
+
+/// Returns closed mesh of cuboid (rLowerBound, rUpperBound) with a cuboid cavity (rLowerBoundCavity, rUpperBoundCavity).
+TriangleMesh CreateCuboidWithCavityMesh(const PointType& rLowerBound, const PointType& rUpperBound,
+                                        const PointType& rLowerBoundCavity, const PointType& rUpperBoundCavity) {
+    TriangleMesh mesh{};
+    auto p_outer = MeshUtilities::pGetCuboid(rLowerBound, rUpperBound);
+    auto p_inner = MeshUtilities::pGetCuboid(rLowerBoundCavity, rUpperBoundCavity);
+    for( IndexType i = 0; i < p_outer->NumOfTriangles(); ++i ){
+        const IndexType id_1 = mesh.AddVertex(p_outer->P1(i));
+        const IndexType id_2 = mesh.AddVertex(p_outer->P2(i));
+        const IndexType id_3 = mesh.AddVertex(p_outer->P3(i));
+        mesh.AddTriangle({id_1, id_2, id_3});
+        mesh.AddNormal(p_outer->Normal(i));
+    }
+    // Cavity: Reverse orientation.
+    for( IndexType i = 0; i < p_inner->NumOfTriangles(); ++i ){
+        const IndexType id_1 = mesh.AddVertex(p_inner->P1(i));
+        const IndexType id_2 = mesh.AddVertex(p_inner->P3(i));
+        const IndexType id_3 = mesh.AddVertex(p_inner->P2(i));
+        mesh.AddTriangle({id_1, id_2, id_3});
+        mesh.AddNormal(Math::Mult(-1.0, p_inner->Normal(i)));
+    }
+    return mesh;
+}
+
+/// Returns trimmed element of given AABB. Parametric space: (0,1)^3.
+Unique<ElementType> CreateElement(const BRepOperator& rBRepOperator, const PointType& rLowerBound, const PointType& rUpperBound) {
+    auto p_element = MakeUnique<ElementType>(1, MakeBox(rLowerBound, rUpperBound), MakeBox({0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}));
+    auto p_trimmed_domain = rBRepOperator.pGetTrimmedDomain(rLowerBound, rUpperBound, 1e-3, 100, false);
+    QuESo_CHECK( p_trimmed_domain );
+    p_element->SetIsTrimmed(true);
+    p_element->pSetTrimmedDomain(p_trimmed_domain);
+    return p_element;
+}
+
+double RepresentedVolume(const ElementType& rElement) {
+    double volume = 0.0;
+    for( const auto& r_point : rElement.GetIntegrationPoints() ){
+        volume += r_point.Weight()*rElement.DetJ();
+    }
+    return volume;
+}
+
+BOOST_AUTO_TEST_CASE(PlanarCutDomainSinglePlaneTest) {
+    QuESo_INFO << "Testing :: Test Planar Cut Domain :: Single Plane" << std::endl;
+
+    const auto mesh = CreateTetrahedronMesh(10.0);
+    BRepOperator brep_operator(mesh);
+
+    // Cell is only cut by: x + y + z = 10.
+    const PointType lower_bound{2.0, 2.0, 4.5};
+    const PointType upper_bound{3.0, 3.0, 5.5};
+    auto p_element = CreateElement(brep_operator, lower_bound, upper_bound);
+    const auto& r_boundary_mesh = p_element->pGetTrimmedDomain()->GetTriangleMesh();
+
+    auto p_planar_cut_domain = PlanarCutDomain::pCreate(r_boundary_mesh, lower_bound, upper_bound, 1, 1e-10);
+    QuESo_CHECK( p_planar_cut_domain );
+    QuESo_CHECK_EQUAL( p_planar_cut_domain->GetPlanes().size(), 1 );
+    const double value = 1.0/std::sqrt(3.0);
+    QuESo_CHECK_POINT_NEAR( p_planar_cut_domain->GetPlanes()[0].normal, PointType({value, value, value}), 1e-12 );
+    QuESo_CHECK_NEAR( p_planar_cut_domain->GetPlanes()[0].offset, 10.0*value, 1e-12 );
+
+    // Plane passes through the center of the cell: Half of the cell is inside.
+    const double volume_ref = MeshUtilities::Volume(r_boundary_mesh);
+    QuESo_CHECK_RELATIVE_NEAR( p_planar_cut_domain->Volume(), volume_ref, 1e-12 );
+    QuESo_CHECK_RELATIVE_NEAR( p_planar_cut_domain->Volume(), 0.5, 1e-12 );
+    QuESo_CHECK_RELATIVE_NEAR( MeshUtilities::Volume(p_planar_cut_domain->GetTriangleMesh()), volume_ref, 1e-12 );
+    for( const auto& r_tetrahedron : p_planar_cut_domain->GetTetrahedra() ){
+        QuESo_CHECK_GT( PlanarCutDomain::Volume(r_tetrahedron), 0.0 );
+    }
+
+    // Quadrature: Same accuracy as standard path.
+    const Vector3i order{2, 2, 2};
+    const double residual = QuadratureTrimmedElement<ElementType>::AssembleIPsPlanarCut(*p_element, order, 1e-10, 1);
+    QuESo_CHECK_LT( residual, 1e-10 );
+    QuESo_CHECK_GT( p_element->GetIntegrationPoints().size(), 0 );
+    QuESo_CHECK_LT( p_element->GetIntegrationPoints().size(), 28 );
+    for( const auto& r_point : p_element->GetIntegrationPoints() ){
+        QuESo_CHECK_GT( r_point.Weight(), 0.0 );
+        const auto point_global = p_element->PointFromParamToGlobal(r_point.data());
+        QuESo_CHECK_LT( point_global[0] + point_global[1] + point_global[2], 10.0 + 1e-10 );
+    }
+    QuESo_CHECK_RELATIVE_NEAR( RepresentedVolume(*p_element), volume_ref, 1e-10 );
+
+    auto p_element_ref = CreateElement(brep_operator, lower_bound, upper_bound);
+    QuadratureTrimmedElement<ElementType>::AssembleIPs(*p_element_ref, order, 1e-10);
+    QuESo_CHECK_RELATIVE_NEAR( RepresentedVolume(*p_element), RepresentedVolume(*p_element_ref), 1e-9 );
+}
+
+BOOST_AUTO_TEST_CASE(PlanarCutDomainTwoPlanesTest) {
+    QuESo_INFO << "Testing :: Test Planar Cut Domain :: Two Planes" << std::endl;
+
+    const auto mesh = CreateTetrahedronMesh(10.0);
+    BRepOperator brep_operator(mesh);
+
+    // Cell is cut by: x = 0 and x + y + z = 10.
+    const PointType lower_bound{-0.5, 4.0, 5.5};
+    const PointType upper_bound{0.5, 5.0, 6.5};
+    auto p_element = CreateElement(brep_operator, lower_bound, upper_bound);
+    const auto& r_boundary_mesh = p_element->pGetTrimmedDomain()->GetTriangleMesh();
+
+    QuESo_CHECK( !PlanarCutDomain::pCreate(r_boundary_mesh, lower_bound, upper_bound, 1, 1e-10) );
+    auto p_planar_cut_domain = PlanarCutDomain::pCreate(r_boundary_mesh, lower_bound, upper_bound, 2, 1e-10);
+    QuESo_CHECK( p_planar_cut_domain );
+    QuESo_CHECK_EQUAL( p_planar_cut_domain->GetPlanes().size(), 2 );
+    QuESo_CHECK_RELATIVE_NEAR( p_planar_cut_domain->Volume(), MeshUtilities::Volume(r_boundary_mesh), 1e-12 );
+
+    // Fast path is not applied, if more planes are required.
+    QuESo_CHECK_EQUAL( QuadratureTrimmedElement<ElementType>::AssembleIPsPlanarCut(*p_element, {2, 2, 2}, 1e-10, 1), MAXD );
+    QuESo_CHECK_EQUAL( p_element->GetIntegrationPoints().size(), 0 );
+
+    const double residual = QuadratureTrimmedElement<ElementType>::AssembleIPsPlanarCut(*p_element, {3, 2, 3}, 1e-10, 2);
+    QuESo_CHECK_LT( residual, 1e-10 );
+    QuESo_CHECK_RELATIVE_NEAR( RepresentedVolume(*p_element), MeshUtilities::Volume(r_boundary_mesh), 1e-10 );
+}
+
+BOOST_AUTO_TEST_CASE(PlanarCutDomainNonConvexTest) {
+    QuESo_INFO << "Testing :: Test Planar Cut Domain :: Non-Convex" << std::endl;
+
+    const auto mesh = CreateCuboidWithCavityMesh({0.0, 0.0, 0.0}, {10.0, 10.0, 10.0}, {2.2, 2.2, 2.2}, {7.7, 7.7, 7.7});
+    BRepOperator brep_operator(mesh);
+
+    // Cell contains corner of the cavity: Domain is not an intersection of half spaces.
+    const PointType lower_bound{1.9, 1.9, 1.9};
+    const PointType upper_bound{2.6, 2.6, 2.6};
+    auto p_element = CreateElement(brep_operator, lower_bound, upper_bound);
+    const auto& r_boundary_mesh = p_element->pGetTrimmedDomain()->GetTriangleMesh();
+    QuESo_CHECK( !PlanarCutDomain::pCreate(r_boundary_mesh, lower_bound, upper_bound, 3, 1e-10) );
+    QuESo_CHECK_EQUAL( QuadratureTrimmedElement<ElementType>::AssembleIPsPlanarCut(*p_element, {2, 2, 2}, 1e-10, 3), MAXD );
+
+    // Cell that only contains a face of the cavity.
+    const PointType lower_bound_face{4.0, 4.0, 1.9};
+    const PointType upper_bound_face{4.7, 4.7, 2.6};
+    auto p_element_face = CreateElement(brep_operator, lower_bound_face, upper_bound_face);
+    const auto& r_boundary_mesh_face = p_element_face->pGetTrimmedDomain()->GetTriangleMesh();
+    auto p_planar_cut_domain = PlanarCutDomain::pCreate(r_boundary_mesh_face, lower_bound_face, upper_bound_face, 3, 1e-10);
+    QuESo_CHECK( p_planar_cut_domain );
+    QuESo_CHECK_EQUAL( p_planar_cut_domain->GetPlanes().size(), 1 );
+    QuESo_CHECK_RELATIVE_NEAR( p_planar_cut_domain->Volume(), 0.7*0.7*0.3, 1e-12 );
+}
+
+BOOST_AUTO_TEST_CASE(PlanarCutDomainEmbeddedModelTest) {
+    QuESo_INFO << "Testing :: Test Planar Cut Domain :: Embedded Model" << std::endl;
+
+    Settings settings;
+    // Mesh is passed directly via CreateVolume(). Filename is not used.
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::input_filename, std::string("tetrahedron.stl"));
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::echo_level, 0u);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::write_output_to_file, false);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::grid_type, GridType::b_spline_grid);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_xyz, PointType{-1.0, -1.0, -1.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_xyz, PointType{11.0, 11.0, 11.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_uvw, PointType{0.0, 0.0, 0.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_uvw, PointType{1.0, 1.0, 1.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::number_of_elements, Vector3i{6, 6, 6});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::polynomial_order, Vector3i{2, 2, 2});
+    settings[MainSettings::non_trimmed_quadrature_rule_settings].SetValue(NonTrimmedQuadratureRuleSettings::integration_method, IntegrationMethod::gauss);
+    settings[MainSettings::trimmed_quadrature_rule_settings].SetValue(TrimmedQuadratureRuleSettings::max_num_cut_planes, 3u);
+
+    // All trimmed cells are bounded by at most three planes.
+    const auto mesh = CreateTetrahedronMesh(10.0);
+    EmbeddedModel embedded_model(settings);
+    embedded_model.CreateVolume(mesh);
+
+    const auto& r_model_info = embedded_model.GetModelInfo();
+    const IndexType num_trimmed_elements = r_model_info[MainInfo::background_grid_info].GetValue<IndexType>(BackgroundGridInfo::num_trimmed_elements);
+    const IndexType num_planar_cut_elements = r_model_info[MainInfo::quadrature_info].GetValue<IndexType>(QuadratureInfo::num_planar_cut_elements);
+    QuESo_CHECK_GT( num_trimmed_elements, 0 );
+    QuESo_CHECK_EQUAL( num_planar_cut_elements, num_trimmed_elements );
+    QuESo_CHECK_RELATIVE_NEAR( r_model_info[MainInfo::quadrature_info].GetValue<double>(QuadratureInfo::represented_volume), 1000.0/6.0, 1e-8 );
+
+    // Fast path is disabled by default.
+    settings[MainSettings::trimmed_quadrature_rule_settings].SetValue(TrimmedQuadratureRuleSettings::max_num_cut_planes, 0u);
+    EmbeddedModel embedded_model_ref(settings);
+    embedded_model_ref.CreateVolume(mesh);
+    const auto& r_model_info_ref = embedded_model_ref.GetModelInfo();
+    QuESo_CHECK_EQUAL( r_model_info_ref[MainInfo::quadrature_info].GetValue<IndexType>(QuadratureInfo::num_planar_cut_elements), 0 );
+    QuESo_CHECK_EQUAL( r_model_info_ref[MainInfo::background_grid_info].GetValue<IndexType>(BackgroundGridInfo::num_trimmed_elements), num_trimmed_elements );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // End namespace Testing
+} // End namespace queso
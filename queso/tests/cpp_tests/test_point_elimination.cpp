@@ -29,7 +29,7 @@ namespace Testing {
 
 BOOST_AUTO_TEST_SUITE( PointEliminationTestSuite )
 
-void RunCylinder(const Vector3i& rOrder, double Residual){
+void RunCylinder(const Vector3i& rOrder, double Residual, NNLSSolverType Solver=NNLSSolver::lawson_hanson){
     typedef IntegrationPoint IntegrationPointType;
     typedef BoundaryIntegrationPoint BoundaryIntegrationPointType;
     typedef Element<IntegrationPointType, BoundaryIntegrationPointType> ElementType;
@@ -78,7 +78,7 @@ void RunCylinder(const Vector3i& rOrder, double Residual){
                 element.pSetTrimmedDomain(p_trimmed_domain);
 
                 // Run point elimination
-                const auto residual = QuadratureTrimmedElementTester<ElementType>::AssembleIPs(element, rOrder, Residual);
+                const auto residual = QuadratureTrimmedElementTester<ElementType>::AssembleIPs(element, rOrder, Residual, Solver);
 
                 // Check if residual is smaller than targeted.
                 QuESo_CHECK_LT(residual, 1e-6);
@@ -98,7 +98,7 @@ void RunCylinder(const Vector3i& rOrder, double Residual){
                 QuadratureTrimmedElementTester<ElementType>::ComputeConstantTerms(constant_terms, p_boundary_ips, element, rOrder);
 
                 // Run moment fitting again.
-                const auto residual_2 = QuadratureTrimmedElementTester<ElementType>::MomentFitting(constant_terms, r_points, element, rOrder);
+                const auto residual_2 = QuadratureTrimmedElementTester<ElementType>::MomentFitting(constant_terms, r_points, element, rOrder, Solver);
 
                 // Check if residual and weights are the same.
                 QuESo_CHECK_NEAR( residual, residual_2, EPS4 );
@@ -135,6 +135,97 @@ BOOST_AUTO_TEST_CASE(PointEliminationCylinder4Test) {
     RunCylinder({2, 3, 4}, 1e-7);
 }
 
+BOOST_AUTO_TEST_CASE(PointEliminationCylinderScaledLawsonHansonTest) {
+    QuESo_INFO << "Testing :: Test Point Elimination :: Cylinder Cubic :: Scaled Lawson-Hanson" << std::endl;
+    RunCylinder({3, 3, 3}, 1e-8, NNLSSolver::scaled_lawson_hanson);
+}
+
+BOOST_AUTO_TEST_CASE(PointEliminationCylinderActiveSetCholeskyTest) {
+    QuESo_INFO << "Testing :: Test Point Elimination :: Cylinder Cubic :: Active Set Cholesky" << std::endl;
+    RunCylinder({3, 3, 3}, 1e-8, NNLSSolver::active_set_cholesky);
+}
+
+BOOST_AUTO_TEST_CASE(PointEliminationCylinderActiveSetCholeskyMixedTest) {
+    QuESo_INFO << "Testing :: Test Point Elimination :: Cylinder Mixed :: Active Set Cholesky" << std::endl;
+    RunCylinder({2, 3, 4}, 1e-7, NNLSSolver::active_set_cholesky);
+}
+
+
+BOOST_AUTO_TEST_CASE(PointEliminationPredictedResidualTest) {
+    QuESo_INFO << "Testing :: Test Point Elimination :: Predicted Residual" << std::endl;
+    typedef IntegrationPoint IntegrationPointType;
+    typedef BoundaryIntegrationPoint BoundaryIntegrationPointType;
+    typedef Element<IntegrationPointType, BoundaryIntegrationPointType> ElementType;
+    typedef QuadratureTrimmedElementTester<ElementType> TesterType;
+
+    Settings settings;
+    auto& r_grid_settings = settings[MainSettings::background_grid_settings];
+    r_grid_settings.SetValue(BackgroundGridSettings::grid_type, GridType::b_spline_grid);
+    r_grid_settings.SetValue(BackgroundGridSettings::lower_bound_xyz, PointType{-1.5, -1.5, -1.0});
+    r_grid_settings.SetValue(BackgroundGridSettings::upper_bound_xyz, PointType{1.5, 1.5, 12.0});
+    r_grid_settings.SetValue(BackgroundGridSettings::lower_bound_uvw, PointType{0.0, 0.0, 0.0});
+    r_grid_settings.SetValue(BackgroundGridSettings::upper_bound_uvw, PointType{1.0, 1.0, 1.0});
+    r_grid_settings.SetValue(BackgroundGridSettings::number_of_elements, Vector3i{6, 6, 13});
+
+    TriangleMesh triangle_mesh{};
+    IO::ReadMeshFromSTL(triangle_mesh, "queso/tests/cpp_tests/data/cylinder.stl");
+    BRepOperator brep_operator(triangle_mesh);
+
+    const Vector3i order{2, 2, 2};
+    GridIndexer grid_indexer(settings);
+    IndexType number_checked_elements = 0;
+    for( IndexType i = 0; i < grid_indexer.NumberOfElements(); ++i){
+        const BoundingBoxType bounding_box = grid_indexer.GetBoundingBoxXYZFromIndex(i);
+        const BoundingBoxType bounding_box_uvw = grid_indexer.GetBoundingBoxUVWFromIndex(i);
+        ElementType element(1, bounding_box, bounding_box_uvw);
+
+        if( brep_operator.GetIntersectionState(bounding_box.first, bounding_box.second) != IntersectionState::trimmed){
+            continue;
+        }
+        auto p_trimmed_domain = brep_operator.pGetTrimmedDomain(bounding_box.first, bounding_box.second, 1e-3, 500);
+        if( !p_trimmed_domain ){
+            continue;
+        }
+        element.SetIsTrimmed(true);
+        element.pSetTrimmedDomain(p_trimmed_domain);
+
+        // Fit on all initial points.
+        std::vector<double> constant_terms{};
+        auto p_boundary_ips = element.pGetTrimmedDomain()->pGetBoundaryIps<BoundaryIntegrationPoint>();
+        TesterType::ComputeConstantTerms(constant_terms, p_boundary_ips, element, order);
+        ElementType::IntegrationPointVectorType points{};
+        const auto domain_bounding_box = element.pGetTrimmedDomain()->GetBoundingBoxOfTrimmedDomain();
+        const BoundingBoxType domain_bounding_box_uvw = MakeBox( element.PointFromGlobalToParam(domain_bounding_box.first),
+                                                                 element.PointFromGlobalToParam(domain_bounding_box.second));
+        Octree<TrimmedDomain> octree(element.pGetTrimmedDomain(), domain_bounding_box, domain_bounding_box_uvw);
+        TesterType::DistributeIntegrationPoints(points, octree, 27, order);
+        const double residual = TesterType::MomentFitting(constant_terms, points, element, order);
+        const double l2_norm_ct_2 = std::inner_product(constant_terms.begin(), constant_terms.end(), constant_terms.begin(), 0.0);
+
+        const auto costs = TesterType::ComputeEliminationCosts(points, element, order);
+        QuESo_CHECK_EQUAL(costs.size(), points.size());
+        for( IndexType j = 0; j < points.size(); ++j ){
+            QuESo_CHECK( !(costs[j] < 0.0) );
+            if( points[j].Weight() <= 0.0 ){
+                QuESo_CHECK_NEAR(costs[j], 0.0, ZEROTOL);
+            }
+        }
+
+        // Remove the most expensive point and all points with zero weight. The NNLS residual on the remaining points
+        // can not be smaller than the predicted (unconstrained) residual.
+        const IndexType max_index = std::distance(costs.begin(), std::max_element(costs.begin(), costs.end()));
+        const double predicted_residual_2 = residual*residual + costs[max_index]/l2_norm_ct_2;
+        points[max_index].SetWeight(0.0);
+        points.erase(std::remove_if(points.begin(), points.end(), [](const IntegrationPointType& rPoint) {
+            return rPoint.Weight() <= 0.0; }), points.end());
+        const double new_residual = TesterType::MomentFitting(constant_terms, points, element, order);
+        QuESo_CHECK_GT( new_residual*new_residual, predicted_residual_2*(1.0-1e-4) - 1e-16 );
+        QuESo_CHECK_GT( new_residual, residual );
+        ++number_checked_elements;
+    }
+    QuESo_CHECK_GT(number_checked_elements, 0);
+}
+
 
 BOOST_AUTO_TEST_CASE(PointEliminationKnuckleTest) {
     QuESo_INFO << "Testing :: Test Point Elimination :: Knuckle" << std::endl;
@@ -46,6 +46,14 @@ BOOST_AUTO_TEST_CASE(SettingsWrongTypeTest) {
             BOOST_REQUIRE_THROW(r_general_settings.GetValue<PointType>(GeneralSettings::echo_level), std::exception); // Wrong Value type
             BOOST_REQUIRE_THROW(r_general_settings.SetValue(GeneralSettings::echo_level, -1), std::exception); // Negative value
             BOOST_REQUIRE_THROW(r_general_settings.GetValue<PointType>(GeneralSettings::write_output_to_file), std::exception); // Wrong Value type
+            BOOST_REQUIRE_THROW(r_general_settings.GetValue<bool>(GeneralSettings::inside_test_method), std::exception); // Wrong Value type
+            BOOST_REQUIRE_THROW(r_general_settings.GetValue<PointType>(GeneralSettings::checkpoint_filename), std::exception); // Wrong Value type
+            BOOST_REQUIRE_THROW(r_general_settings.GetValue<IndexType>(GeneralSettings::checkpoint_interval), std::exception); // Wrong Value type
+            BOOST_REQUIRE_THROW(r_general_settings.GetValue<double>(GeneralSettings::checkpoint_trimmed_domains), std::exception); // Wrong Value type
+            BOOST_REQUIRE_THROW(r_general_settings.GetValue<double>(GeneralSettings::out_of_core_slab_thickness), std::exception); // Wrong Value type
+            BOOST_REQUIRE_THROW(r_general_settings.GetValue<bool>(GeneralSettings::out_of_core_directory), std::exception); // Wrong Value type
+            BOOST_REQUIRE_THROW(r_general_settings.GetValue<IndexType>(GeneralSettings::mesh_decimation_tolerance), std::exception); // Wrong Value type
+            BOOST_REQUIRE_THROW(r_general_settings.GetValue<double>(GeneralSettings::surface_only), std::exception); // Wrong Value type
 
             /// Mesh settings
             auto& r_mesh_settings = setting[MainSettings::background_grid_settings];
@@ -108,6 +116,7 @@ BOOST_AUTO_TEST_CASE(SettingsWrongTypeTest) {
             BOOST_REQUIRE_THROW(r_trimmed_quad_rule_settings.GetValue<Vector3i>(TrimmedQuadratureRuleSettings::moment_fitting_residual), std::exception); // Wrong Value type
             BOOST_REQUIRE_THROW(r_trimmed_quad_rule_settings.GetValue<Vector3i>(TrimmedQuadratureRuleSettings::min_element_volume_ratio), std::exception); // Wrong Value type
             BOOST_REQUIRE_THROW(r_trimmed_quad_rule_settings.GetValue<Vector3i>(TrimmedQuadratureRuleSettings::min_num_boundary_triangles), std::exception); // Wrong Value type
+            BOOST_REQUIRE_THROW(r_trimmed_quad_rule_settings.GetValue<PointType>(TrimmedQuadratureRuleSettings::nnls_solver), std::exception); // Wrong Value type
 
             /// Non trimmed quadrature rule settings
             auto& r_non_trimmed_quad_rule_settings = setting[MainSettings::non_trimmed_quadrature_rule_settings];
@@ -130,6 +139,14 @@ BOOST_AUTO_TEST_CASE(SettingsWrongTypeTest) {
         BOOST_REQUIRE_THROW(r_general_settings.GetValue<PointType>("echo_level"), std::exception); // Wrong Value type
         BOOST_REQUIRE_THROW(r_general_settings.SetValue("echo_level", -1), std::exception); // Negative value
         BOOST_REQUIRE_THROW(r_general_settings.GetValue<PointType>("write_output_to_file"), std::exception); // Wrong Value type
+        BOOST_REQUIRE_THROW(r_general_settings.GetValue<bool>("inside_test_method"), std::exception); // Wrong Value type
+        BOOST_REQUIRE_THROW(r_general_settings.GetValue<PointType>("checkpoint_filename"), std::exception); // Wrong Value type
+        BOOST_REQUIRE_THROW(r_general_settings.GetValue<IndexType>("checkpoint_interval"), std::exception); // Wrong Value type
+        BOOST_REQUIRE_THROW(r_general_settings.GetValue<double>("checkpoint_trimmed_domains"), std::exception); // Wrong Value type
+        BOOST_REQUIRE_THROW(r_general_settings.GetValue<double>("out_of_core_slab_thickness"), std::exception); // Wrong Value type
+        BOOST_REQUIRE_THROW(r_general_settings.GetValue<bool>("out_of_core_directory"), std::exception); // Wrong Value type
+        BOOST_REQUIRE_THROW(r_general_settings.GetValue<IndexType>("mesh_decimation_tolerance"), std::exception); // Wrong Value type
+        BOOST_REQUIRE_THROW(r_general_settings.GetValue<double>("surface_only"), std::exception); // Wrong Value type
 
         /// Mesh settings
         auto& r_mesh_settings = setting["background_grid_settings"];
@@ -191,6 +208,7 @@ BOOST_AUTO_TEST_CASE(SettingsWrongTypeTest) {
         BOOST_REQUIRE_THROW(r_trimmed_quad_rule_settings.GetValue<Vector3i>("moment_fitting_residual"), std::exception); // Wrong Value type
         BOOST_REQUIRE_THROW(r_trimmed_quad_rule_settings.GetValue<Vector3i>("min_element_volume_ratio"), std::exception); // Wrong Value type
         BOOST_REQUIRE_THROW(r_trimmed_quad_rule_settings.GetValue<Vector3i>("min_num_boundary_triangles"), std::exception); // Wrong Value type
+        BOOST_REQUIRE_THROW(r_trimmed_quad_rule_settings.GetValue<PointType>("nnls_solver"), std::exception); // Wrong Value type
 
         /// Non trimmed quadrature rule settings
         auto& r_non_trimmed_quad_rule_settings = setting["non_trimmed_quadrature_rule_settings"];
@@ -220,6 +238,28 @@ BOOST_AUTO_TEST_CASE(SettingsDefaultValuesTest) {
         QuESo_CHECK( settings[MainSettings::general_settings].IsSet(GeneralSettings::write_output_to_file) );
         QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<bool>(GeneralSettings::write_output_to_file), true);
 
+        QuESo_CHECK( settings[MainSettings::general_settings].IsSet(GeneralSettings::inside_test_method) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<InsideTestMethod>(GeneralSettings::inside_test_method), InsideTestMethod::ray_tracing);
+
+        QuESo_CHECK( settings[MainSettings::general_settings].IsSet(GeneralSettings::checkpoint_filename) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<std::string>(GeneralSettings::checkpoint_filename), std::string("") );
+
+        QuESo_CHECK( settings[MainSettings::general_settings].IsSet(GeneralSettings::checkpoint_interval) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<double>(GeneralSettings::checkpoint_interval), 60.0 );
+
+        QuESo_CHECK( settings[MainSettings::general_settings].IsSet(GeneralSettings::checkpoint_trimmed_domains) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<bool>(GeneralSettings::checkpoint_trimmed_domains), false );
+
+        QuESo_CHECK( settings[MainSettings::general_settings].IsSet(GeneralSettings::out_of_core_slab_thickness) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<IndexType>(GeneralSettings::out_of_core_slab_thickness), 0 );
+
+        QuESo_CHECK( settings[MainSettings::general_settings].IsSet(GeneralSettings::out_of_core_directory) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<std::string>(GeneralSettings::out_of_core_directory), std::string("") );
+        QuESo_CHECK( settings[MainSettings::general_settings].IsSet(GeneralSettings::mesh_decimation_tolerance) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<double>(GeneralSettings::mesh_decimation_tolerance), 0.0 );
+        QuESo_CHECK( settings[MainSettings::general_settings].IsSet(GeneralSettings::surface_only) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<bool>(GeneralSettings::surface_only), false );
+
         /// Mesh settings
         QuESo_CHECK( !settings[MainSettings::background_grid_settings].IsSet(BackgroundGridSettings::grid_type) );
         if( !NOTDEBUG ) {
@@ -249,6 +289,18 @@ BOOST_AUTO_TEST_CASE(SettingsDefaultValuesTest) {
         if( !NOTDEBUG ) {
             BOOST_REQUIRE_THROW( settings[MainSettings::background_grid_settings].GetValue<Vector3i>(BackgroundGridSettings::number_of_elements), std::exception );
         }
+        QuESo_CHECK( settings[MainSettings::background_grid_settings].IsSet(BackgroundGridSettings::grid_planning) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::background_grid_settings].GetValue<bool>(BackgroundGridSettings::grid_planning), false );
+
+        QuESo_CHECK( settings[MainSettings::background_grid_settings].IsSet(BackgroundGridSettings::grid_planning_volume_error) );
+        QuESo_CHECK_RELATIVE_NEAR( settings[MainSettings::background_grid_settings].GetValue<double>(BackgroundGridSettings::grid_planning_volume_error), 1e-4, 1e-10 );
+
+        QuESo_CHECK( settings[MainSettings::background_grid_settings].IsSet(BackgroundGridSettings::grid_planning_runtime_budget) );
+        QuESo_CHECK_NEAR( settings[MainSettings::background_grid_settings].GetValue<double>(BackgroundGridSettings::grid_planning_runtime_budget), 0.0, 1e-10 );
+
+        QuESo_CHECK( settings[MainSettings::background_grid_settings].IsSet(BackgroundGridSettings::number_of_grid_levels) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::background_grid_settings].GetValue<IndexType>(BackgroundGridSettings::number_of_grid_levels), 1 );
+
         /// TrimmedQuadratureRuleSettings settings
         QuESo_CHECK( settings[MainSettings::trimmed_quadrature_rule_settings].IsSet(TrimmedQuadratureRuleSettings::moment_fitting_residual) );
         QuESo_CHECK_RELATIVE_NEAR( settings[MainSettings::trimmed_quadrature_rule_settings].GetValue<double>(TrimmedQuadratureRuleSettings::moment_fitting_residual), 1e-10,1e-10 );
@@ -262,6 +314,25 @@ BOOST_AUTO_TEST_CASE(SettingsDefaultValuesTest) {
         QuESo_CHECK( settings[MainSettings::trimmed_quadrature_rule_settings].IsSet(TrimmedQuadratureRuleSettings::neglect_elements_if_stl_is_flawed) );
         QuESo_CHECK_EQUAL( settings[MainSettings::trimmed_quadrature_rule_settings].GetValue<bool>(TrimmedQuadratureRuleSettings::neglect_elements_if_stl_is_flawed), true );
 
+        QuESo_CHECK( settings[MainSettings::trimmed_quadrature_rule_settings].IsSet(TrimmedQuadratureRuleSettings::nnls_solver) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::trimmed_quadrature_rule_settings].GetValue<NNLSSolver>(TrimmedQuadratureRuleSettings::nnls_solver), NNLSSolver::lawson_hanson );
+        QuESo_CHECK( settings[MainSettings::trimmed_quadrature_rule_settings].IsSet(TrimmedQuadratureRuleSettings::init_point_distribution_factor) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::trimmed_quadrature_rule_settings].GetValue<IndexType>(TrimmedQuadratureRuleSettings::init_point_distribution_factor), 1 );
+        QuESo_CHECK( settings[MainSettings::trimmed_quadrature_rule_settings].IsSet(TrimmedQuadratureRuleSettings::max_octree_refinement_level) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::trimmed_quadrature_rule_settings].GetValue<IndexType>(TrimmedQuadratureRuleSettings::max_octree_refinement_level), 4 );
+        QuESo_CHECK( settings[MainSettings::trimmed_quadrature_rule_settings].IsSet(TrimmedQuadratureRuleSettings::auto_tuning) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::trimmed_quadrature_rule_settings].GetValue<bool>(TrimmedQuadratureRuleSettings::auto_tuning), false );
+        QuESo_CHECK( settings[MainSettings::trimmed_quadrature_rule_settings].IsSet(TrimmedQuadratureRuleSettings::auto_tuning_sample_size) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::trimmed_quadrature_rule_settings].GetValue<IndexType>(TrimmedQuadratureRuleSettings::auto_tuning_sample_size), 16 );
+        QuESo_CHECK( settings[MainSettings::trimmed_quadrature_rule_settings].IsSet(TrimmedQuadratureRuleSettings::auto_tuning_volume_error) );
+        QuESo_CHECK_RELATIVE_NEAR( settings[MainSettings::trimmed_quadrature_rule_settings].GetValue<double>(TrimmedQuadratureRuleSettings::auto_tuning_volume_error), 1e-6, 1e-10 );
+        QuESo_CHECK( settings[MainSettings::trimmed_quadrature_rule_settings].IsSet(TrimmedQuadratureRuleSettings::max_num_cut_planes) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::trimmed_quadrature_rule_settings].GetValue<IndexType>(TrimmedQuadratureRuleSettings::max_num_cut_planes), 0 );
+        QuESo_CHECK( settings[MainSettings::trimmed_quadrature_rule_settings].IsSet(TrimmedQuadratureRuleSettings::verify_quadrature_rules) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::trimmed_quadrature_rule_settings].GetValue<bool>(TrimmedQuadratureRuleSettings::verify_quadrature_rules), false );
+        QuESo_CHECK( settings[MainSettings::trimmed_quadrature_rule_settings].IsSet(TrimmedQuadratureRuleSettings::compute_shape_sensitivities) );
+        QuESo_CHECK_EQUAL( settings[MainSettings::trimmed_quadrature_rule_settings].GetValue<bool>(TrimmedQuadratureRuleSettings::compute_shape_sensitivities), false );
+
         // NonTrimmedQuadratureRuleSettings settings
         QuESo_CHECK( settings[MainSettings::non_trimmed_quadrature_rule_settings].IsSet(NonTrimmedQuadratureRuleSettings::integration_method) );
         QuESo_CHECK_EQUAL( settings[MainSettings::non_trimmed_quadrature_rule_settings].GetValue<IntegrationMethod>(NonTrimmedQuadratureRuleSettings::integration_method), IntegrationMethod::gauss );
@@ -282,6 +353,28 @@ BOOST_AUTO_TEST_CASE(SettingsDefaultValuesTest) {
         QuESo_CHECK( settings["general_settings"].IsSet("write_output_to_file") );
         QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<bool>("write_output_to_file"), true);
 
+        QuESo_CHECK( settings["general_settings"].IsSet("inside_test_method") );
+        QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<InsideTestMethod>("inside_test_method"), InsideTestMethod::ray_tracing);
+
+        QuESo_CHECK( settings["general_settings"].IsSet("checkpoint_filename") );
+        QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<std::string>("checkpoint_filename"), std::string("") );
+
+        QuESo_CHECK( settings["general_settings"].IsSet("checkpoint_interval") );
+        QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<double>("checkpoint_interval"), 60.0 );
+
+        QuESo_CHECK( settings["general_settings"].IsSet("checkpoint_trimmed_domains") );
+        QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<bool>("checkpoint_trimmed_domains"), false );
+
+        QuESo_CHECK( settings["general_settings"].IsSet("out_of_core_slab_thickness") );
+        QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<IndexType>("out_of_core_slab_thickness"), 0 );
+
+        QuESo_CHECK( settings["general_settings"].IsSet("out_of_core_directory") );
+        QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<std::string>("out_of_core_directory"), std::string("") );
+        QuESo_CHECK( settings["general_settings"].IsSet("mesh_decimation_tolerance") );
+        QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<double>("mesh_decimation_tolerance"), 0.0 );
+        QuESo_CHECK( settings["general_settings"].IsSet("surface_only") );
+        QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<bool>("surface_only"), false );
+
         /// Mesh settings
         QuESo_CHECK( !settings["background_grid_settings"].IsSet("grid_type") );
         BOOST_REQUIRE_THROW( settings["background_grid_settings"].GetValue<PointType>("grid_type"), std::exception );
@@ -304,6 +397,18 @@ BOOST_AUTO_TEST_CASE(SettingsDefaultValuesTest) {
         QuESo_CHECK( !settings["background_grid_settings"].IsSet("number_of_elements") );
         BOOST_REQUIRE_THROW( settings["background_grid_settings"].GetValue<Vector3i>("number_of_elements"), std::exception );
 
+        QuESo_CHECK( settings["background_grid_settings"].IsSet("grid_planning") );
+        QuESo_CHECK_EQUAL( settings["background_grid_settings"].GetValue<bool>("grid_planning"), false );
+
+        QuESo_CHECK( settings["background_grid_settings"].IsSet("grid_planning_volume_error") );
+        QuESo_CHECK_RELATIVE_NEAR( settings["background_grid_settings"].GetValue<double>("grid_planning_volume_error"), 1e-4, 1e-10 );
+
+        QuESo_CHECK( settings["background_grid_settings"].IsSet("grid_planning_runtime_budget") );
+        QuESo_CHECK_NEAR( settings["background_grid_settings"].GetValue<double>("grid_planning_runtime_budget"), 0.0, 1e-10 );
+
+        QuESo_CHECK( settings["background_grid_settings"].IsSet("number_of_grid_levels") );
+        QuESo_CHECK_EQUAL( settings["background_grid_settings"].GetValue<IndexType>("number_of_grid_levels"), 1 );
+
         /// TrimmedQuadratureRuleSettings settings
         QuESo_CHECK( settings["trimmed_quadrature_rule_settings"].IsSet("moment_fitting_residual") );
         QuESo_CHECK_RELATIVE_NEAR( settings["trimmed_quadrature_rule_settings"].GetValue<double>("moment_fitting_residual"), 1e-10,1e-10 );
@@ -317,6 +422,25 @@ BOOST_AUTO_TEST_CASE(SettingsDefaultValuesTest) {
         QuESo_CHECK( settings["trimmed_quadrature_rule_settings"].IsSet("neglect_elements_if_stl_is_flawed") );
         QuESo_CHECK_EQUAL( settings["trimmed_quadrature_rule_settings"].GetValue<bool>("neglect_elements_if_stl_is_flawed"), true );
 
+        QuESo_CHECK( settings["trimmed_quadrature_rule_settings"].IsSet("nnls_solver") );
+        QuESo_CHECK_EQUAL( settings["trimmed_quadrature_rule_settings"].GetValue<NNLSSolver>("nnls_solver"), NNLSSolver::lawson_hanson );
+        QuESo_CHECK( settings["trimmed_quadrature_rule_settings"].IsSet("init_point_distribution_factor") );
+        QuESo_CHECK_EQUAL( settings["trimmed_quadrature_rule_settings"].GetValue<IndexType>("init_point_distribution_factor"), 1 );
+        QuESo_CHECK( settings["trimmed_quadrature_rule_settings"].IsSet("max_octree_refinement_level") );
+        QuESo_CHECK_EQUAL( settings["trimmed_quadrature_rule_settings"].GetValue<IndexType>("max_octree_refinement_level"), 4 );
+        QuESo_CHECK( settings["trimmed_quadrature_rule_settings"].IsSet("auto_tuning") );
+        QuESo_CHECK_EQUAL( settings["trimmed_quadrature_rule_settings"].GetValue<bool>("auto_tuning"), false );
+        QuESo_CHECK( settings["trimmed_quadrature_rule_settings"].IsSet("auto_tuning_sample_size") );
+        QuESo_CHECK_EQUAL( settings["trimmed_quadrature_rule_settings"].GetValue<IndexType>("auto_tuning_sample_size"), 16 );
+        QuESo_CHECK( settings["trimmed_quadrature_rule_settings"].IsSet("auto_tuning_volume_error") );
+        QuESo_CHECK_RELATIVE_NEAR( settings["trimmed_quadrature_rule_settings"].GetValue<double>("auto_tuning_volume_error"), 1e-6, 1e-10 );
+        QuESo_CHECK( settings["trimmed_quadrature_rule_settings"].IsSet("max_num_cut_planes") );
+        QuESo_CHECK_EQUAL( settings["trimmed_quadrature_rule_settings"].GetValue<IndexType>("max_num_cut_planes"), 0 );
+        QuESo_CHECK( settings["trimmed_quadrature_rule_settings"].IsSet("verify_quadrature_rules") );
+        QuESo_CHECK_EQUAL( settings["trimmed_quadrature_rule_settings"].GetValue<bool>("verify_quadrature_rules"), false );
+        QuESo_CHECK( settings["trimmed_quadrature_rule_settings"].IsSet("compute_shape_sensitivities") );
+        QuESo_CHECK_EQUAL( settings["trimmed_quadrature_rule_settings"].GetValue<bool>("compute_shape_sensitivities"), false );
+
         // NonTrimmedQuadratureRuleSettings settings
         QuESo_CHECK( settings["non_trimmed_quadrature_rule_settings"].IsSet("integration_method") );
         QuESo_CHECK_EQUAL( settings["non_trimmed_quadrature_rule_settings"].GetValue<IntegrationMethod>("integration_method"), IntegrationMethod::gauss );
@@ -335,7 +459,14 @@ BOOST_AUTO_TEST_CASE(SettingsCustomizedValuesTest) {
         settings[MainSettings::general_settings].SetValue(GeneralSettings::output_directory_name, std::string("new_output/"));
         settings[MainSettings::general_settings].SetValue(GeneralSettings::echo_level, 2u);
         settings[MainSettings::general_settings].SetValue(GeneralSettings::write_output_to_file, false);
-
+        settings[MainSettings::general_settings].SetValue(GeneralSettings::inside_test_method, InsideTestMethod::winding_number);
+        settings[MainSettings::general_settings].SetValue(GeneralSettings::checkpoint_filename, std::string("checkpoint.bin"));
+        settings[MainSettings::general_settings].SetValue(GeneralSettings::checkpoint_interval, 5.0);
+        settings[MainSettings::general_settings].SetValue(GeneralSettings::checkpoint_trimmed_domains, true);
+        settings[MainSettings::general_settings].SetValue(GeneralSettings::out_of_core_slab_thickness, 4u);
+        settings[MainSettings::general_settings].SetValue(GeneralSettings::out_of_core_directory, std::string("slabs"));
+        settings[MainSettings::general_settings].SetValue(GeneralSettings::mesh_decimation_tolerance, 0.25);
+        settings[MainSettings::general_settings].SetValue(GeneralSettings::surface_only, true);
 
         QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<std::string>(GeneralSettings::input_filename), std::string("test_filename.stl") );
 
@@ -345,6 +476,15 @@ BOOST_AUTO_TEST_CASE(SettingsCustomizedValuesTest) {
 
         QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<bool>(GeneralSettings::write_output_to_file), false );
 
+        QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<InsideTestMethod>(GeneralSettings::inside_test_method), InsideTestMethod::winding_number );
+        QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<std::string>(GeneralSettings::checkpoint_filename), std::string("checkpoint.bin") );
+        QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<double>(GeneralSettings::checkpoint_interval), 5.0 );
+        QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<bool>(GeneralSettings::checkpoint_trimmed_domains), true );
+        QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<IndexType>(GeneralSettings::out_of_core_slab_thickness), 4u );
+        QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<std::string>(GeneralSettings::out_of_core_directory), std::string("slabs") );
+        QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<double>(GeneralSettings::mesh_decimation_tolerance), 0.25 );
+        QuESo_CHECK_EQUAL( settings[MainSettings::general_settings].GetValue<bool>(GeneralSettings::surface_only), true );
+
         /// Mesh settings
         settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::grid_type, GridType::b_spline_grid);
         settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_xyz, PointType({1.0, 1.0, 2.0}));
@@ -368,11 +508,13 @@ BOOST_AUTO_TEST_CASE(SettingsCustomizedValuesTest) {
         settings[MainSettings::trimmed_quadrature_rule_settings].SetValue(TrimmedQuadratureRuleSettings::min_element_volume_ratio, 0.45);
         settings[MainSettings::trimmed_quadrature_rule_settings].SetValue(TrimmedQuadratureRuleSettings::min_num_boundary_triangles, IndexType(234));
         settings[MainSettings::trimmed_quadrature_rule_settings].SetValue(TrimmedQuadratureRuleSettings::neglect_elements_if_stl_is_flawed, false);
+        settings[MainSettings::trimmed_quadrature_rule_settings].SetValue(TrimmedQuadratureRuleSettings::nnls_solver, NNLSSolver::active_set_cholesky);
 
         QuESo_CHECK_RELATIVE_NEAR( settings[MainSettings::trimmed_quadrature_rule_settings].GetValue<double>(TrimmedQuadratureRuleSettings::moment_fitting_residual), 5.6e-5, 1e-10 );
         QuESo_CHECK_RELATIVE_NEAR( settings[MainSettings::trimmed_quadrature_rule_settings].GetValue<double>(TrimmedQuadratureRuleSettings::min_element_volume_ratio), 0.45, 1e-10 );
         QuESo_CHECK_EQUAL( settings[MainSettings::trimmed_quadrature_rule_settings].GetValue<IndexType>(TrimmedQuadratureRuleSettings::min_num_boundary_triangles), 234u );
         QuESo_CHECK_EQUAL( settings[MainSettings::trimmed_quadrature_rule_settings].GetValue<bool>(TrimmedQuadratureRuleSettings::neglect_elements_if_stl_is_flawed), false );
+        QuESo_CHECK_EQUAL( settings[MainSettings::trimmed_quadrature_rule_settings].GetValue<NNLSSolver>(TrimmedQuadratureRuleSettings::nnls_solver), NNLSSolver::active_set_cholesky );
 
         /// Non trimmed quadrature rule settings
         settings[MainSettings::non_trimmed_quadrature_rule_settings].SetValue(NonTrimmedQuadratureRuleSettings::integration_method, IntegrationMethod::ggq_optimal);
@@ -387,13 +529,28 @@ BOOST_AUTO_TEST_CASE(SettingsCustomizedValuesTest) {
         settings["general_settings"].SetValue("output_directory_name", std::string("new_output/"));
         settings["general_settings"].SetValue("echo_level", 2u);
         settings["general_settings"].SetValue("write_output_to_file", false);
-
+        settings["general_settings"].SetValue("inside_test_method", InsideTestMethod::winding_number);
+        settings["general_settings"].SetValue("checkpoint_filename", std::string("checkpoint.bin"));
+        settings["general_settings"].SetValue("checkpoint_interval", 5.0);
+        settings["general_settings"].SetValue("checkpoint_trimmed_domains", true);
+        settings["general_settings"].SetValue("out_of_core_slab_thickness", 4u);
+        settings["general_settings"].SetValue("out_of_core_directory", std::string("slabs"));
+        settings["general_settings"].SetValue("mesh_decimation_tolerance", 0.25);
+        settings["general_settings"].SetValue("surface_only", true);
 
         QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<std::string>("input_filename"), std::string("test_filename.stl") );
 
         QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<std::string>("output_directory_name"), std::string("new_output/") );
         QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<IndexType>("echo_level"), 2u );
         QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<bool>("write_output_to_file"), false );
+        QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<InsideTestMethod>("inside_test_method"), InsideTestMethod::winding_number );
+        QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<std::string>("checkpoint_filename"), std::string("checkpoint.bin") );
+        QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<double>("checkpoint_interval"), 5.0 );
+        QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<bool>("checkpoint_trimmed_domains"), true );
+        QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<IndexType>("out_of_core_slab_thickness"), 4u );
+        QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<std::string>("out_of_core_directory"), std::string("slabs") );
+        QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<double>("mesh_decimation_tolerance"), 0.25 );
+        QuESo_CHECK_EQUAL( settings["general_settings"].GetValue<bool>("surface_only"), true );
 
         /// Mesh settings
         settings["background_grid_settings"].SetValue("grid_type", GridType::b_spline_grid);
@@ -418,11 +575,13 @@ BOOST_AUTO_TEST_CASE(SettingsCustomizedValuesTest) {
         settings["trimmed_quadrature_rule_settings"].SetValue("min_element_volume_ratio", 0.45);
         settings["trimmed_quadrature_rule_settings"].SetValue("min_num_boundary_triangles", IndexType(234));
         settings["trimmed_quadrature_rule_settings"].SetValue("neglect_elements_if_stl_is_flawed", false);
+        settings["trimmed_quadrature_rule_settings"].SetValue("nnls_solver", NNLSSolver::active_set_cholesky);
 
         QuESo_CHECK_RELATIVE_NEAR( settings["trimmed_quadrature_rule_settings"].GetValue<double>("moment_fitting_residual"), 5.6e-5, 1e-10 );
         QuESo_CHECK_RELATIVE_NEAR( settings["trimmed_quadrature_rule_settings"].GetValue<double>("min_element_volume_ratio"), 0.45, 1e-10 );
         QuESo_CHECK_EQUAL( settings["trimmed_quadrature_rule_settings"].GetValue<IndexType>("min_num_boundary_triangles"), 234u );
         QuESo_CHECK_EQUAL( settings["trimmed_quadrature_rule_settings"].GetValue<bool>("neglect_elements_if_stl_is_flawed"), false );
+        QuESo_CHECK_EQUAL( settings["trimmed_quadrature_rule_settings"].GetValue<NNLSSolver>("nnls_solver"), NNLSSolver::active_set_cholesky );
 
         /// Non trimmed quadrature rule settings
         settings["non_trimmed_quadrature_rule_settings"].SetValue("integration_method", IntegrationMethod::ggq_optimal);
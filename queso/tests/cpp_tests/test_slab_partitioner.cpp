@@ -0,0 +1,180 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#define BOOST_TEST_DYN_LINK
+
+//// External includes
+#include <boost/test/unit_test.hpp>
+//// Project includes
+#include "queso/includes/checks.hpp"
+#include "queso/embedded_model.h"
+#include "queso/io/io_utilities.h"
+#include "queso/io/slab_partitioner.h"
+#include "queso/utilities/mesh_utilities.h"
+
+namespace queso {
+namespace Testing {
+
+BOOST_AUTO_TEST_SUITE( SlabPartitionerTestSuite )
+
+Settings CreateSlabSettings(const std::string& rFilename, IndexType SlabThickness, const PointType& rLowerBound,
+        const PointType& rUpperBound, const Vector3i& rNumberOfElements){
+    Settings settings;
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::input_filename, rFilename);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::echo_level, 0u);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::write_output_to_file, false);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::out_of_core_slab_thickness, SlabThickness);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::grid_type, GridType::b_spline_grid);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_xyz, rLowerBound);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_xyz, rUpperBound);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_uvw, rLowerBound);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_uvw, rUpperBound);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::number_of_elements, rNumberOfElements);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::polynomial_order, Vector3i{2, 2, 2});
+    settings[MainSettings::non_trimmed_quadrature_rule_settings].SetValue(NonTrimmedQuadratureRuleSettings::integration_method, IntegrationMethod::gauss);
+    return settings;
+}
+
+BOOST_AUTO_TEST_CASE(SlabPartitionerTest) {
+    QuESo_INFO << "Testing :: Test Slab Partitioner :: Split STL" << std::endl;
+
+    const std::string filename = "queso/tests/cpp_tests/data/steering_knuckle.stl";
+    TriangleMesh triangle_mesh{};
+    IO::ReadMeshFromSTL(triangle_mesh, filename);
+
+    const std::string directory = "queso_slab_partitioner_test";
+    {
+        Settings settings = CreateSlabSettings(filename, 5u, {-130.0, -110.0, -110.0}, {20.0, 190.0, 190.0}, {5, 12, 10});
+        settings[MainSettings::general_settings].SetValue(GeneralSettings::out_of_core_directory, directory);
+        SlabPartitioner slab_partitioner(filename, settings);
+        // Partition direction is y (12 elements). 12 layers -> 3 slabs.
+        QuESo_CHECK_EQUAL(slab_partitioner.GetDirection(), 1);
+        QuESo_CHECK_EQUAL(slab_partitioner.NumberOfSlabs(), 3);
+        QuESo_CHECK_EQUAL(slab_partitioner.GetPartitions()[2].first[1], 10);
+        QuESo_CHECK_EQUAL(slab_partitioner.GetPartitions()[2].second[1], 11);
+        QuESo_CHECK_EQUAL(slab_partitioner.NumberOfTriangles(), triangle_mesh.NumOfTriangles());
+
+        // Volume and closedness are computed while streaming.
+        QuESo_CHECK_RELATIVE_NEAR(slab_partitioner.Volume(), MeshUtilities::Volume(triangle_mesh), 1e-10);
+        QuESo_CHECK_LT(slab_partitioner.EstimateQuality(), 1e-10);
+        const auto bounding_box = MeshUtilities::BoundingBox(triangle_mesh);
+        QuESo_CHECK_POINT_NEAR(slab_partitioner.GetBoundingBox().first, bounding_box.first, 1e-10);
+        QuESo_CHECK_POINT_NEAR(slab_partitioner.GetBoundingBox().second, bounding_box.second, 1e-10);
+
+        // Each triangle is stored in all slabs that it touches (including halo). Input order is preserved.
+        const double delta = 300.0 / 12.0;
+        IndexType num_triangles_total = 0;
+        for( IndexType slab_index = 0; slab_index < slab_partitioner.NumberOfSlabs(); ++slab_index ){
+            TriangleMesh slab_mesh{};
+            slab_partitioner.ReadSlab(slab_index, slab_mesh);
+            QuESo_CHECK_EQUAL(slab_mesh.NumOfTriangles(), slab_partitioner.NumberOfTriangles(slab_index));
+            num_triangles_total += slab_mesh.NumOfTriangles();
+
+            const auto& r_partition = slab_partitioner.GetPartitions()[slab_index];
+            const double lower_bound = -110.0 + delta*r_partition.first[1] - 1.1*delta;
+            const double upper_bound = -110.0 + delta*(r_partition.second[1]+1) + 1.1*delta;
+            IndexType current_id = 0;
+            for( IndexType i = 0; i < triangle_mesh.NumOfTriangles(); ++i ){
+                const double min_y = std::min({triangle_mesh.P1(i)[1], triangle_mesh.P2(i)[1], triangle_mesh.P3(i)[1]});
+                const double max_y = std::max({triangle_mesh.P1(i)[1], triangle_mesh.P2(i)[1], triangle_mesh.P3(i)[1]});
+                if( max_y >= lower_bound && min_y <= upper_bound ){
+                    QuESo_CHECK_LT(current_id, slab_mesh.NumOfTriangles());
+                    QuESo_CHECK_POINT_NEAR(slab_mesh.P1(current_id), triangle_mesh.P1(i), 1e-12);
+                    QuESo_CHECK_POINT_NEAR(slab_mesh.P3(current_id), triangle_mesh.P3(i), 1e-12);
+                    ++current_id;
+                }
+            }
+            QuESo_CHECK_EQUAL(current_id, slab_mesh.NumOfTriangles());
+        }
+        QuESo_CHECK_GT(num_triangles_total, triangle_mesh.NumOfTriangles());
+        QuESo_CHECK( !std::filesystem::is_empty(directory) );
+    }
+    // Slab files are removed.
+    QuESo_CHECK( std::filesystem::is_empty(directory) );
+    std::filesystem::remove(directory);
+}
+
+void TestOutOfCore(const EmbeddedModel& rEmbeddedModel, IndexType SlabThickness){
+    // Out-of-core
+    Settings settings_out_of_core = rEmbeddedModel.GetSettings();
+    settings_out_of_core[MainSettings::general_settings].SetValue(GeneralSettings::out_of_core_slab_thickness, SlabThickness);
+    EmbeddedModel embedded_model_out_of_core(settings_out_of_core);
+    embedded_model_out_of_core.CreateAllFromSettings();
+
+    const auto& r_info = rEmbeddedModel.GetModelInfo();
+    const auto& r_info_out_of_core = embedded_model_out_of_core.GetModelInfo();
+    QuESo_CHECK_EQUAL(r_info[MainInfo::background_grid_info].GetValue<IndexType>(BackgroundGridInfo::num_active_elements),
+                      r_info_out_of_core[MainInfo::background_grid_info].GetValue<IndexType>(BackgroundGridInfo::num_active_elements));
+    QuESo_CHECK_EQUAL(r_info[MainInfo::background_grid_info].GetValue<IndexType>(BackgroundGridInfo::num_trimmed_elements),
+                      r_info_out_of_core[MainInfo::background_grid_info].GetValue<IndexType>(BackgroundGridInfo::num_trimmed_elements));
+    QuESo_CHECK_EQUAL(r_info[MainInfo::quadrature_info].GetValue<IndexType>(QuadratureInfo::tot_num_points),
+                      r_info_out_of_core[MainInfo::quadrature_info].GetValue<IndexType>(QuadratureInfo::tot_num_points));
+    QuESo_CHECK_RELATIVE_NEAR(r_info[MainInfo::embedded_geometry_info].GetValue<double>(EmbeddedGeometryInfo::volume),
+                              r_info_out_of_core[MainInfo::embedded_geometry_info].GetValue<double>(EmbeddedGeometryInfo::volume), 1e-10);
+    QuESo_CHECK( r_info_out_of_core[MainInfo::embedded_geometry_info].GetValue<bool>(EmbeddedGeometryInfo::is_closed) );
+
+    // Compare all elements.
+    QuESo_CHECK_EQUAL(rEmbeddedModel.GetElements().size(), embedded_model_out_of_core.GetElements().size());
+    for( const auto& p_element : rEmbeddedModel.GetElements() ){
+        const auto p_element_out_of_core = std::find_if(embedded_model_out_of_core.GetElements().begin(), embedded_model_out_of_core.GetElements().end(),
+            [&p_element](const auto& rOther){ return rOther->GetId() == p_element->GetId(); });
+        QuESo_CHECK( p_element_out_of_core != embedded_model_out_of_core.GetElements().end() );
+        QuESo_CHECK_EQUAL(p_element->IsTrimmed(), (*p_element_out_of_core)->IsTrimmed());
+        const auto& r_points = p_element->GetIntegrationPoints();
+        const auto& r_points_out_of_core = (*p_element_out_of_core)->GetIntegrationPoints();
+        QuESo_CHECK_EQUAL(r_points.size(), r_points_out_of_core.size());
+        for( IndexType i = 0; i < r_points.size(); ++i ){
+            QuESo_CHECK_POINT_NEAR(r_points[i].data(), r_points_out_of_core[i].data(), 1e-12);
+            QuESo_CHECK_NEAR(r_points[i].Weight(), r_points_out_of_core[i].Weight(), 1e-12);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(OutOfCoreSteeringKnuckleTest) {
+    QuESo_INFO << "Testing :: Test Slab Partitioner :: Out-Of-Core Steering Knuckle" << std::endl;
+    const Settings settings = CreateSlabSettings("queso/tests/cpp_tests/data/steering_knuckle.stl", 0u,
+        {-130.0, -110.0, -110.0}, {20.0, 190.0, 190.0}, {5, 12, 10});
+    EmbeddedModel embedded_model(settings);
+    embedded_model.CreateAllFromSettings();
+
+    // Last slab is thinner than the others.
+    TestOutOfCore(embedded_model, 5u);
+}
+
+BOOST_AUTO_TEST_CASE(OutOfCoreCylinderTest) {
+    QuESo_INFO << "Testing :: Test Slab Partitioner :: Out-Of-Core Cylinder" << std::endl;
+    const Settings settings = CreateSlabSettings("queso/tests/cpp_tests/data/cylinder.stl", 0u,
+        {-1.5, -1.5, -1.0}, {1.5, 1.5, 11.0}, {4, 4, 12});
+    EmbeddedModel embedded_model(settings);
+    embedded_model.CreateAllFromSettings();
+
+    // Thin slabs and a single slab.
+    for( IndexType slab_thickness : {1u, 12u} ){
+        TestOutOfCore(embedded_model, slab_thickness);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(OutOfCoreCylinderAsciiTest) {
+    QuESo_INFO << "Testing :: Test Slab Partitioner :: Out-Of-Core Cylinder (ASCII)" << std::endl;
+    const Settings settings = CreateSlabSettings("queso/tests/cpp_tests/data/cylinder_ascii.stl", 0u,
+        {-1.5, -1.5, -1.0}, {1.5, 1.5, 11.0}, {4, 4, 12});
+    EmbeddedModel embedded_model(settings);
+    embedded_model.CreateAllFromSettings();
+
+    TestOutOfCore(embedded_model, 3u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // End namespace Testing
+} // End namespace queso
@@ -217,6 +217,52 @@ BOOST_AUTO_TEST_CASE(TriangleMeshComputeCubeTest) {
     QuESo_CHECK_LT( std::abs(volume - volume_ref) / volume_ref, 1e-9);
     QuESo_CHECK_LT( std::abs(volume_omp - volume_ref) / volume_ref, 1e-9);
 }
+
+void TestDecimate(const std::string& rFilename, double Tolerance, double MinReduction){
+    TriangleMesh triangle_mesh{};
+    IO::ReadMeshFromSTL(triangle_mesh, rFilename.c_str());
+    const auto p_original_mesh = triangle_mesh.Clone();
+
+    const double deviation = MeshUtilities::Decimate(triangle_mesh, Tolerance);
+    triangle_mesh.Check();
+
+    // Deviation is bounded by the tolerance.
+    QuESo_CHECK( deviation <= Tolerance );
+    QuESo_CHECK_RELATIVE_NEAR( deviation, MeshUtilities::HausdorffDistance(triangle_mesh, *p_original_mesh), 1e-12 );
+    QuESo_CHECK_LT( triangle_mesh.NumOfTriangles(), (1.0-MinReduction)*p_original_mesh->NumOfTriangles() );
+
+    // Mesh remains closed.
+    QuESo_CHECK_LT( MeshUtilities::EstimateQuality(triangle_mesh), 1e-10 );
+    const double volume_ref = MeshUtilities::Volume(*p_original_mesh);
+    const double area_ref = MeshUtilities::Area(*p_original_mesh);
+    QuESo_CHECK_LT( std::abs(MeshUtilities::Volume(triangle_mesh) - volume_ref), Tolerance*area_ref );
+}
+
+BOOST_AUTO_TEST_CASE(TriangleMeshDecimateTest) {
+    QuESo_INFO << "Testing :: Test Triangle Mesh :: Test Decimate" << std::endl;
+
+    TestDecimate("queso/tests/cpp_tests/data/stanford_bunny.stl", 0.1, 0.9);
+    TestDecimate("queso/tests/cpp_tests/data/elephant.stl", 0.002, 0.5);
+    TestDecimate("queso/tests/cpp_tests/data/cylinder.stl", 0.01, 0.3);
+
+    // Zero tolerance does not change the mesh.
+    TriangleMesh triangle_mesh{};
+    IO::ReadMeshFromSTL(triangle_mesh, "queso/tests/cpp_tests/data/cylinder.stl");
+    const IndexType num_triangles = triangle_mesh.NumOfTriangles();
+    QuESo_CHECK_EQUAL( MeshUtilities::Decimate(triangle_mesh, 0.0), 0.0 );
+    QuESo_CHECK_EQUAL( triangle_mesh.NumOfTriangles(), num_triangles );
+    QuESo_CHECK_NEAR( MeshUtilities::HausdorffDistance(triangle_mesh, triangle_mesh), 0.0, 1e-10 );
+}
+
+BOOST_AUTO_TEST_CASE(TriangleMeshHausdorffDistanceTest) {
+    QuESo_INFO << "Testing :: Test Triangle Mesh :: Test Hausdorff Distance" << std::endl;
+
+    const auto p_cube = MeshUtilities::pGetCuboid({0.0, 0.0, 0.0}, {1.0, 1.0, 1.0});
+    const auto p_larger_cube = MeshUtilities::pGetCuboid({0.0, 0.0, 0.0}, {1.0, 1.0, 1.5});
+    QuESo_CHECK_NEAR( MeshUtilities::HausdorffDistance(*p_cube, *p_larger_cube), 0.5, 1e-12 );
+    QuESo_CHECK_NEAR( MeshUtilities::HausdorffDistance(*p_larger_cube, *p_cube), 0.5, 1e-12 );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // End namespace Testing
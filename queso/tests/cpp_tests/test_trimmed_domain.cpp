@@ -20,6 +20,7 @@
 #include "queso/containers/triangle_mesh.hpp"
 #include "queso/io/io_utilities.h"
 #include "queso/embedding/brep_operator.h"
+#include "queso/embedding/trimmed_domain.h"
 #include "queso/quadrature/trimmed_element.hpp"
 #include "queso/tests/cpp_tests/class_testers/trimmed_element_tester.hpp"
 
@@ -361,6 +362,86 @@ BOOST_AUTO_TEST_CASE(TestTrimemdDomainCube6Test) {
     }
 }
 
+// Returns prism, where rPolygon (y-z plane, counter-clockwise) is extruded from X0 to X1 in x-direction.
+// rPolygon must be star-shaped with respect to its first vertex.
+Unique<TriangleMesh> CreatePrism(const std::vector<std::array<double, 2>>& rPolygon, double X0, double X1){
+    auto p_triangle_mesh = MakeUnique<TriangleMesh>();
+    const IndexType num_vertices = rPolygon.size();
+    for( const auto& r_point : rPolygon ){
+        p_triangle_mesh->AddVertex({X0, r_point[0], r_point[1]});
+    }
+    for( const auto& r_point : rPolygon ){
+        p_triangle_mesh->AddVertex({X1, r_point[0], r_point[1]});
+    }
+    auto add_triangle = [&p_triangle_mesh](IndexType A, IndexType B, IndexType C){
+        p_triangle_mesh->AddTriangle({A, B, C});
+        const auto& r_vertices = p_triangle_mesh->GetVertices();
+        p_triangle_mesh->AddNormal(TriangleMeshInterface::Normal(r_vertices[A], r_vertices[B], r_vertices[C]));
+    };
+    for( IndexType i = 0; i < num_vertices; ++i ){
+        const IndexType j = (i+1) % num_vertices;
+        // Side faces
+        add_triangle(i, j, num_vertices+j);
+        add_triangle(i, num_vertices+j, num_vertices+i);
+        // Caps
+        if( i > 0 && j > 0 ){
+            add_triangle(0, j, i);
+            add_triangle(num_vertices, num_vertices+i, num_vertices+j);
+        }
+    }
+    return p_triangle_mesh;
+}
+
+BOOST_AUTO_TEST_CASE(TestTrimmedDomainAlignedEdgesTest) {
+    QuESo_INFO << "Testing :: Test Trimmed Domain :: Aligned Edges" << std::endl;
+
+    // Ridges (y=0.5) touch the boundary (z=1.0) between the lower and upper elements.
+    // Wedges: The domain between the walls degenerates on the plane (upper and lower plane).
+    // Groove: The domain is on both sides of the walls (lower plane).
+    const std::vector<std::vector<std::array<double, 2>>> polygons = {
+        {{0.2, 0.2}, {0.8, 0.2}, {0.5, 1.0}},
+        {{0.5, 1.0}, {0.8, 1.8}, {0.2, 1.8}},
+        {{0.5, 1.0}, {0.2, 1.8}, {0.1, 1.8}, {0.1, 0.5}, {0.9, 0.5}, {0.9, 1.8}, {0.8, 1.8}} };
+
+    Settings settings;
+    auto& r_grid_settings = settings[MainSettings::background_grid_settings];
+    r_grid_settings.SetValue(BackgroundGridSettings::grid_type, GridType::b_spline_grid);
+    r_grid_settings.SetValue(BackgroundGridSettings::lower_bound_xyz, PointType{0.0, 0.0, 0.0});
+    r_grid_settings.SetValue(BackgroundGridSettings::upper_bound_xyz, PointType{2.0, 2.0, 2.0});
+    r_grid_settings.SetValue(BackgroundGridSettings::lower_bound_uvw, PointType{0.0, 0.0, 0.0});
+    r_grid_settings.SetValue(BackgroundGridSettings::upper_bound_uvw, PointType{2.0, 2.0, 2.0});
+    r_grid_settings.SetValue(BackgroundGridSettings::number_of_elements, Vector3i{2, 2, 2});
+    r_grid_settings.SetValue(BackgroundGridSettings::polynomial_order, Vector3i{2, 2, 2});
+    GridIndexer grid_indexer(settings);
+
+    for( const auto& r_polygon : polygons ){
+        auto p_triangle_mesh = CreatePrism(r_polygon, 0.25, 1.75);
+        BRepOperator brep_operator(*p_triangle_mesh);
+        const double volume_ref = MeshUtilities::Volume(*p_triangle_mesh);
+
+        // Both plane orientations must yield closed trimmed domains (no fallback, see: BRepOperator::pGetTrimmedDomain()).
+        for( bool switch_plane_orientation : {false, true} ){
+            double volume = 0.0;
+            for( IndexType i = 0; i < grid_indexer.NumberOfElements(); ++i){
+                const auto bounding_box = grid_indexer.GetBoundingBoxXYZFromIndex(i);
+                const auto status = brep_operator.GetIntersectionState(bounding_box.first, bounding_box.second);
+                if( status == IntersectionState::trimmed ){
+                    TrimmedDomain trimmed_domain(brep_operator.pClipTriangleMesh(bounding_box.first, bounding_box.second),
+                        bounding_box.first, bounding_box.second, &brep_operator, 100, switch_plane_orientation);
+                    const auto& r_mesh = trimmed_domain.GetTriangleMesh();
+                    CheckTriangleOrientation(r_mesh);
+                    std::cout << "DBGQ " << r_polygon.size() << " " << switch_plane_orientation << " " << i << " " << MeshUtilities::EstimateQuality(r_mesh) << " " << MeshUtilities::Volume(r_mesh) << std::endl;
+                    volume += MeshUtilities::Volume(r_mesh);
+                }
+                else if( status == IntersectionState::inside ){
+                    volume += 1.0;
+                }
+            }
+            QuESo_CHECK_RELATIVE_NEAR(volume, volume_ref, 1e-10);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // End namespace Testing
@@ -0,0 +1,127 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#define BOOST_TEST_DYN_LINK
+
+//// External includes
+#include <boost/test/unit_test.hpp>
+//// Project includes
+#include "queso/includes/checks.hpp"
+#include "queso/embedded_model.h"
+#include "queso/io/io_utilities.h"
+#include "queso/utilities/mesh_utilities.h"
+#include "queso/quadrature/trimmed_element_tuner.hpp"
+
+namespace queso {
+namespace Testing {
+
+BOOST_AUTO_TEST_SUITE( TrimmedElementTunerTestSuite )
+
+typedef QuadratureTrimmedElementTuner<EmbeddedModel::ElementType> TunerType;
+
+BOOST_AUTO_TEST_CASE(TrimmedElementTunerSampleTest) {
+    QuESo_INFO << "Testing :: Test Trimmed Element Tuner :: Stratified Sample" << std::endl;
+
+    std::vector<IndexType> cell_indices(100);
+    for( IndexType i = 0; i < cell_indices.size(); ++i ){
+        cell_indices[i] = 3*i;
+    }
+
+    // One cell per chunk of 10 cells.
+    const auto sample = TunerType::DrawSample(cell_indices, 10);
+    QuESo_CHECK_EQUAL(sample.size(), 10);
+    for( IndexType i = 0; i < sample.size(); ++i ){
+        QuESo_CHECK_GT(sample[i]+1, 30*i);
+        QuESo_CHECK_LT(sample[i], 30*(i+1));
+        QuESo_CHECK_EQUAL(sample[i] % 3, 0);
+    }
+    // Sample is reproducible.
+    QuESo_CHECK( sample == TunerType::DrawSample(cell_indices, 10) );
+
+    // All cells are taken, if sample size exceeds number of cells.
+    const auto sample_all = TunerType::DrawSample(cell_indices, 200);
+    QuESo_CHECK( sample_all == cell_indices );
+}
+
+BOOST_AUTO_TEST_CASE(TrimmedElementTunerCandidatesTest) {
+    QuESo_INFO << "Testing :: Test Trimmed Element Tuner :: Candidates" << std::endl;
+
+    // Baseline is the first candidate.
+    const TunerType::Parameters baseline{100, 1, 4};
+    const auto candidates = TunerType::GetCandidates(baseline);
+    QuESo_CHECK_EQUAL(candidates.size(), 12);
+    QuESo_CHECK( candidates[0] == baseline );
+
+    // Candidates are unique.
+    for( IndexType i = 0; i < candidates.size(); ++i ){
+        for( IndexType j = i+1; j < candidates.size(); ++j ){
+            QuESo_CHECK( !(candidates[i] == candidates[j]) );
+        }
+    }
+
+    // Small baselines lead to duplicates, which are removed.
+    const auto candidates_small = TunerType::GetCandidates({1, 2, 5});
+    QuESo_CHECK_EQUAL(candidates_small.size(), 5);
+    for( const auto& r_candidate : candidates_small ){
+        QuESo_CHECK_EQUAL(r_candidate.min_num_boundary_triangles, 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TrimmedElementTunerEmbeddedModelTest) {
+    QuESo_INFO << "Testing :: Test Trimmed Element Tuner :: Embedded Model" << std::endl;
+
+    const std::string filename = "queso/tests/cpp_tests/data/steering_knuckle.stl";
+    Settings settings;
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::input_filename, filename);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::echo_level, 0u);
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::write_output_to_file, false);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::grid_type, GridType::b_spline_grid);
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_xyz, PointType{-130.0, -110.0, -110.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_xyz, PointType{20.0, 190.0, 190.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::lower_bound_uvw, PointType{0.0, 0.0, 0.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::upper_bound_uvw, PointType{1.0, 1.0, 1.0});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::number_of_elements, Vector3i{5, 10, 10});
+    settings[MainSettings::background_grid_settings].SetValue(BackgroundGridSettings::polynomial_order, Vector3i{2, 2, 2});
+    settings[MainSettings::non_trimmed_quadrature_rule_settings].SetValue(NonTrimmedQuadratureRuleSettings::integration_method, IntegrationMethod::gauss);
+    settings[MainSettings::trimmed_quadrature_rule_settings].SetValue(TrimmedQuadratureRuleSettings::auto_tuning, true);
+    settings[MainSettings::trimmed_quadrature_rule_settings].SetValue(TrimmedQuadratureRuleSettings::auto_tuning_sample_size, 8u);
+    settings[MainSettings::trimmed_quadrature_rule_settings].SetValue(TrimmedQuadratureRuleSettings::auto_tuning_volume_error, 1e-4);
+
+    EmbeddedModel embedded_model(settings);
+    embedded_model.CreateAllFromSettings();
+
+    // Selected parameters are one of the candidates.
+    const auto& r_model_info = embedded_model.GetModelInfo();
+    const auto& r_auto_tuning_info = r_model_info[MainInfo::auto_tuning_info];
+    const TunerType::Parameters selected{ r_auto_tuning_info.GetValue<IndexType>(AutoTuningInfo::min_num_boundary_triangles),
+                                          r_auto_tuning_info.GetValue<IndexType>(AutoTuningInfo::init_point_distribution_factor),
+                                          r_auto_tuning_info.GetValue<IndexType>(AutoTuningInfo::max_octree_refinement_level) };
+    const auto candidates = TunerType::GetCandidates(TunerType::GetParameters(settings));
+    QuESo_CHECK( std::find(candidates.begin(), candidates.end(), selected) != candidates.end() );
+    QuESo_CHECK_EQUAL(r_auto_tuning_info.GetValue<IndexType>(AutoTuningInfo::num_candidates), candidates.size());
+    QuESo_CHECK_EQUAL(r_auto_tuning_info.GetValue<IndexType>(AutoTuningInfo::num_sampled_elements), 8);
+    QuESo_CHECK_LT(r_auto_tuning_info.GetValue<double>(AutoTuningInfo::volume_error), 1e-4+EPS0);
+    QuESo_CHECK_GT(r_auto_tuning_info.GetValue<double>(AutoTuningInfo::speedup), 0.0);
+    QuESo_CHECK_GT(r_model_info[MainInfo::elapsed_time_info][ElapsedTimeInfo::volume_time_info].GetValue<double>(VolumeTimeInfo::auto_tuning), 0.0);
+
+    // Represented volume is still accurate.
+    TriangleMesh triangle_mesh{};
+    IO::ReadMeshFromSTL(triangle_mesh, filename);
+    const double volume_ref = MeshUtilities::Volume(triangle_mesh);
+    QuESo_CHECK_RELATIVE_NEAR(r_model_info[MainInfo::quadrature_info].GetValue<double>(QuadratureInfo::represented_volume), volume_ref, 1e-3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // End namespace Testing
+} // End namespace queso
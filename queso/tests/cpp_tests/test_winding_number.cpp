@@ -0,0 +1,153 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#define BOOST_TEST_DYN_LINK
+
+//// External includes
+#include <boost/test/unit_test.hpp>
+//// Project includes
+#include "queso/includes/checks.hpp"
+#include "queso/containers/triangle_mesh.hpp"
+#include "queso/io/io_utilities.h"
+#include "queso/embedding/brep_operator.h"
+#include "queso/embedding/fast_winding_number.h"
+
+namespace queso {
+namespace Testing {
+
+BOOST_AUTO_TEST_SUITE( WindingNumberTestSuite )
+
+BOOST_AUTO_TEST_CASE(WindingNumberSolidAngleTest) {
+    QuESo_INFO << "Testing :: Test Winding Number :: Solid Angle" << std::endl;
+
+    const double pi = 4.0*std::atan(1.0);
+    // Each face of a cube subtends 4pi/6 as seen from the center of the cube.
+    const PointType center{0.5, 0.5, 0.5};
+    const double solid_angle = FastWindingNumber::SolidAngle(center, {0.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {1.0, 1.0, 0.0})
+                             + FastWindingNumber::SolidAngle(center, {0.0, 0.0, 0.0}, {1.0, 1.0, 0.0}, {1.0, 0.0, 0.0});
+    QuESo_CHECK_NEAR(solid_angle, 4.0*pi/6.0, 1e-12);
+
+    // Orientation flips sign.
+    const double solid_angle_flipped = FastWindingNumber::SolidAngle(center, {0.0, 0.0, 0.0}, {1.0, 1.0, 0.0}, {0.0, 1.0, 0.0})
+                                     + FastWindingNumber::SolidAngle(center, {0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {1.0, 1.0, 0.0});
+    QuESo_CHECK_NEAR(solid_angle_flipped, (-4.0*pi/6.0), 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(WindingNumberCylinderTest) {
+    QuESo_INFO << "Testing :: Test Winding Number :: Cylinder" << std::endl;
+
+    TriangleMesh triangle_mesh{};
+    IO::ReadMeshFromSTL(triangle_mesh, "queso/tests/cpp_tests/data/cylinder.stl");
+
+    Settings settings;
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::inside_test_method, InsideTestMethod::winding_number);
+    BRepOperator brep_operator(triangle_mesh, settings);
+    QuESo_CHECK(brep_operator.GetInsideTestMethod() == InsideTestMethod::winding_number);
+
+    for(double x = -1.5; x <= 1.5; x += 0.09){
+        for(double y = -1.5; y <= 1.5; y += 0.09){
+            for(double z = -1; z <= 12; z += 0.27){
+                const PointType point{x, y, z};
+                const double radius = std::sqrt( x*x + y*y );
+                if( radius < 1.0 && z > 0.0 && z < 10.0){
+                    QuESo_CHECK( brep_operator.IsInside(point) );
+                }
+                else {
+                    QuESo_CHECK_IS_FALSE( brep_operator.IsInside(point) );
+                }
+            }
+        }
+    }
+
+    // Far away from the surface, the winding number is (close to) an integer.
+    QuESo_CHECK_NEAR( brep_operator.WindingNumber({0.0, 0.0, 5.0}), 1.0, 1e-3 );
+    QuESo_CHECK_NEAR( brep_operator.WindingNumber({0.0, 0.0, 20.0}), 0.0, 1e-3 );
+    QuESo_CHECK_NEAR( brep_operator.WindingNumber({5.0, -3.0, 5.0}), 0.0, 1e-3 );
+}
+
+BOOST_AUTO_TEST_CASE(WindingNumberElephantTest) {
+    QuESo_INFO << "Testing :: Test Winding Number :: Elephant" << std::endl;
+
+    TriangleMesh triangle_mesh{};
+    IO::ReadMeshFromSTL(triangle_mesh, "queso/tests/cpp_tests/data/elephant.stl");
+
+    BRepOperator brep_operator(triangle_mesh);
+    QuESo_CHECK(brep_operator.GetInsideTestMethod() == InsideTestMethod::ray_tracing);
+
+    // Exact evaluation (no far field approximation).
+    GeometryQuery geometry_query(triangle_mesh);
+    FastWindingNumber exact_winding_number(triangle_mesh, geometry_query.GetAABBTree(), 1e10);
+
+    IndexType num_points = 0;
+    IndexType num_inside = 0;
+    for(double x = -0.36; x <= 0.36; x += 0.04){
+        for(double y = -0.54; y <= 0.54; y += 0.04){
+            for(double z = -0.30; z <= 0.30; z += 0.04){
+                const PointType point{x, y, z};
+                const double winding_number = brep_operator.WindingNumber(point);
+                QuESo_CHECK_NEAR( winding_number, exact_winding_number.WindingNumber(point), 5e-2 );
+                const bool is_inside = brep_operator.IsInside(point);
+                // Points close to the surface are ambiguous.
+                if( std::abs(winding_number - 0.5) < 0.4 ){
+                    continue;
+                }
+                const bool is_inside_winding_number = winding_number > 0.5;
+                QuESo_CHECK_EQUAL( is_inside_winding_number, is_inside );
+                ++num_points;
+                if( is_inside ){
+                    ++num_inside;
+                }
+            }
+        }
+    }
+    QuESo_CHECK_GT(num_inside, 0);
+    QuESo_CHECK_GT(num_points, num_inside);
+}
+
+BOOST_AUTO_TEST_CASE(WindingNumberOpenMeshTest) {
+    QuESo_INFO << "Testing :: Test Winding Number :: Open Mesh" << std::endl;
+
+    TriangleMesh triangle_mesh{};
+    IO::ReadMeshFromSTL(triangle_mesh, "queso/tests/cpp_tests/data/cylinder.stl");
+
+    // Remove every 50th triangle to create holes.
+    TriangleMesh open_triangle_mesh{};
+    for( IndexType triangle_id = 0; triangle_id < triangle_mesh.NumOfTriangles(); ++triangle_id ){
+        if( triangle_id % 50 == 0 ){
+            continue;
+        }
+        const IndexType num_v = open_triangle_mesh.NumOfVertices();
+        open_triangle_mesh.AddVertex( triangle_mesh.P1(triangle_id) );
+        open_triangle_mesh.AddVertex( triangle_mesh.P2(triangle_id) );
+        open_triangle_mesh.AddVertex( triangle_mesh.P3(triangle_id) );
+        open_triangle_mesh.AddTriangle( {num_v+0, num_v+1, num_v+2} );
+        open_triangle_mesh.AddNormal( triangle_mesh.Normal(triangle_id) );
+    }
+    QuESo_CHECK_LT(open_triangle_mesh.NumOfTriangles(), triangle_mesh.NumOfTriangles());
+
+    Settings settings;
+    settings[MainSettings::general_settings].SetValue(GeneralSettings::inside_test_method, InsideTestMethod::winding_number);
+    BRepOperator brep_operator(open_triangle_mesh, settings);
+
+    for( double z = 1.0; z < 9.5; z += 0.5 ){
+        QuESo_CHECK( brep_operator.IsInside({0.0, 0.0, z}) );
+        QuESo_CHECK( brep_operator.IsInside({0.5, -0.3, z}) );
+        QuESo_CHECK_IS_FALSE( brep_operator.IsInside({1.5, 0.0, z}) );
+        QuESo_CHECK_IS_FALSE( brep_operator.IsInside({-0.8, 1.2, z}) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // End namespace Testing
+} // End namespace queso
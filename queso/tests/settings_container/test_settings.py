@@ -27,6 +27,37 @@ class TestSettingsContainer(QuESoTestCase):
         write_output_to_file = general_settings.GetBool("write_output_to_file")
         self.assertFalse(write_output_to_file)
 
+        self.assertTrue(general_settings.IsSet("inside_test_method"))
+        inside_test_method = general_settings.GetInsideTestMethod("inside_test_method")
+        self.assertEqual(inside_test_method, QuESo.InsideTestMethod.winding_number)
+
+        self.assertTrue(general_settings.IsSet("checkpoint_filename"))
+        checkpoint_filename = general_settings.GetString("checkpoint_filename")
+        self.assertEqual(checkpoint_filename, "checkpoint.bin")
+
+        self.assertTrue(general_settings.IsSet("checkpoint_interval"))
+        checkpoint_interval = general_settings.GetDouble("checkpoint_interval")
+        self.assertAlmostEqual(checkpoint_interval, 5.0, 10)
+
+        self.assertTrue(general_settings.IsSet("checkpoint_trimmed_domains"))
+        checkpoint_trimmed_domains = general_settings.GetBool("checkpoint_trimmed_domains")
+        self.assertTrue(checkpoint_trimmed_domains)
+
+        self.assertTrue(general_settings.IsSet("out_of_core_slab_thickness"))
+        out_of_core_slab_thickness = general_settings.GetInt("out_of_core_slab_thickness")
+        self.assertEqual(out_of_core_slab_thickness, 4)
+
+        self.assertTrue(general_settings.IsSet("out_of_core_directory"))
+        out_of_core_directory = general_settings.GetString("out_of_core_directory")
+        self.assertEqual(out_of_core_directory, "slabs")
+        self.assertTrue(general_settings.IsSet("mesh_decimation_tolerance"))
+        mesh_decimation_tolerance = general_settings.GetDouble("mesh_decimation_tolerance")
+        self.assertAlmostEqual(mesh_decimation_tolerance, 0.25, 10)
+
+        self.assertTrue(general_settings.IsSet("surface_only"))
+        surface_only = general_settings.GetBool("surface_only")
+        self.assertTrue(surface_only)
+
         # Check background_grid_settings
         background_grid_settings = settings["background_grid_settings"]
 
@@ -58,6 +89,22 @@ class TestSettingsContainer(QuESoTestCase):
         number_of_elements = background_grid_settings.GetIntVector("number_of_elements")
         self.assertListsEqual(number_of_elements, [5, 2, 13] )
 
+        self.assertTrue(background_grid_settings.IsSet("grid_planning"))
+        grid_planning = background_grid_settings.GetBool("grid_planning")
+        self.assertEqual(grid_planning, True)
+
+        self.assertTrue(background_grid_settings.IsSet("grid_planning_volume_error"))
+        grid_planning_volume_error = background_grid_settings.GetDouble("grid_planning_volume_error")
+        self.assertAlmostEqual(grid_planning_volume_error, 0.002, 10)
+
+        self.assertTrue(background_grid_settings.IsSet("grid_planning_runtime_budget"))
+        grid_planning_runtime_budget = background_grid_settings.GetDouble("grid_planning_runtime_budget")
+        self.assertAlmostEqual(grid_planning_runtime_budget, 30.0, 10)
+
+        self.assertTrue(background_grid_settings.IsSet("number_of_grid_levels"))
+        number_of_grid_levels = background_grid_settings.GetInt("number_of_grid_levels")
+        self.assertEqual(number_of_grid_levels, 3)
+
         # Check trimmed_quadrature_rule_settings
         trimmed_quadrature_rule_settings = settings["trimmed_quadrature_rule_settings"]
 
@@ -73,6 +120,42 @@ class TestSettingsContainer(QuESoTestCase):
         min_num_boundary_triangles = trimmed_quadrature_rule_settings.GetInt("min_num_boundary_triangles")
         self.assertEqual(min_num_boundary_triangles, 233)
 
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("nnls_solver"))
+        nnls_solver = trimmed_quadrature_rule_settings.GetNNLSSolver("nnls_solver")
+        self.assertEqual(nnls_solver, QuESo.NNLSSolver.active_set_cholesky)
+
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("init_point_distribution_factor"))
+        init_point_distribution_factor = trimmed_quadrature_rule_settings.GetInt("init_point_distribution_factor")
+        self.assertEqual(init_point_distribution_factor, 2)
+
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("max_octree_refinement_level"))
+        max_octree_refinement_level = trimmed_quadrature_rule_settings.GetInt("max_octree_refinement_level")
+        self.assertEqual(max_octree_refinement_level, 3)
+
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("auto_tuning"))
+        auto_tuning = trimmed_quadrature_rule_settings.GetBool("auto_tuning")
+        self.assertEqual(auto_tuning, True)
+
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("auto_tuning_sample_size"))
+        auto_tuning_sample_size = trimmed_quadrature_rule_settings.GetInt("auto_tuning_sample_size")
+        self.assertEqual(auto_tuning_sample_size, 32)
+
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("auto_tuning_volume_error"))
+        auto_tuning_volume_error = trimmed_quadrature_rule_settings.GetDouble("auto_tuning_volume_error")
+        self.assertAlmostEqual(auto_tuning_volume_error, 1e-5, 12)
+
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("max_num_cut_planes"))
+        max_num_cut_planes = trimmed_quadrature_rule_settings.GetInt("max_num_cut_planes")
+        self.assertEqual(max_num_cut_planes, 3)
+
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("verify_quadrature_rules"))
+        verify_quadrature_rules = trimmed_quadrature_rule_settings.GetBool("verify_quadrature_rules")
+        self.assertEqual(verify_quadrature_rules, True)
+
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("compute_shape_sensitivities"))
+        compute_shape_sensitivities = trimmed_quadrature_rule_settings.GetBool("compute_shape_sensitivities")
+        self.assertEqual(compute_shape_sensitivities, True)
+
         # Check non_trimmed_quadrature_rule_settings
         non_trimmed_quadrature_rule_settings = settings["non_trimmed_quadrature_rule_settings"]
 
@@ -189,6 +272,37 @@ class TestSettingsContainer(QuESoTestCase):
         write_output_to_file = general_settings.GetBool("write_output_to_file")
         self.assertTrue(write_output_to_file)
 
+        self.assertTrue(general_settings.IsSet("inside_test_method"))
+        inside_test_method = general_settings.GetInsideTestMethod("inside_test_method")
+        self.assertEqual(inside_test_method, QuESo.InsideTestMethod.ray_tracing)
+
+        self.assertTrue(general_settings.IsSet("checkpoint_filename"))
+        checkpoint_filename = general_settings.GetString("checkpoint_filename")
+        self.assertEqual(checkpoint_filename, "")
+
+        self.assertTrue(general_settings.IsSet("checkpoint_interval"))
+        checkpoint_interval = general_settings.GetDouble("checkpoint_interval")
+        self.assertAlmostEqual(checkpoint_interval, 60.0, 10)
+
+        self.assertTrue(general_settings.IsSet("checkpoint_trimmed_domains"))
+        checkpoint_trimmed_domains = general_settings.GetBool("checkpoint_trimmed_domains")
+        self.assertFalse(checkpoint_trimmed_domains)
+
+        self.assertTrue(general_settings.IsSet("out_of_core_slab_thickness"))
+        out_of_core_slab_thickness = general_settings.GetInt("out_of_core_slab_thickness")
+        self.assertEqual(out_of_core_slab_thickness, 0)
+
+        self.assertTrue(general_settings.IsSet("out_of_core_directory"))
+        out_of_core_directory = general_settings.GetString("out_of_core_directory")
+        self.assertEqual(out_of_core_directory, "")
+        self.assertTrue(general_settings.IsSet("mesh_decimation_tolerance"))
+        mesh_decimation_tolerance = general_settings.GetDouble("mesh_decimation_tolerance")
+        self.assertAlmostEqual(mesh_decimation_tolerance, 0.0, 10)
+
+        self.assertTrue(general_settings.IsSet("surface_only"))
+        surface_only = general_settings.GetBool("surface_only")
+        self.assertFalse(surface_only)
+
         # Check background_grid_settings
         background_grid_settings = settings["background_grid_settings"]
 
@@ -206,6 +320,22 @@ class TestSettingsContainer(QuESoTestCase):
 
         self.assertFalse(background_grid_settings.IsSet("number_of_elements"))
 
+        self.assertTrue(background_grid_settings.IsSet("grid_planning"))
+        grid_planning = background_grid_settings.GetBool("grid_planning")
+        self.assertEqual(grid_planning, False)
+
+        self.assertTrue(background_grid_settings.IsSet("grid_planning_volume_error"))
+        grid_planning_volume_error = background_grid_settings.GetDouble("grid_planning_volume_error")
+        self.assertAlmostEqual(grid_planning_volume_error, 1e-4, 10)
+
+        self.assertTrue(background_grid_settings.IsSet("grid_planning_runtime_budget"))
+        grid_planning_runtime_budget = background_grid_settings.GetDouble("grid_planning_runtime_budget")
+        self.assertAlmostEqual(grid_planning_runtime_budget, 0.0, 10)
+
+        self.assertTrue(background_grid_settings.IsSet("number_of_grid_levels"))
+        number_of_grid_levels = background_grid_settings.GetInt("number_of_grid_levels")
+        self.assertEqual(number_of_grid_levels, 1)
+
         # Check trimmed_quadrature_rule_settings
         trimmed_quadrature_rule_settings = settings["trimmed_quadrature_rule_settings"]
 
@@ -221,6 +351,42 @@ class TestSettingsContainer(QuESoTestCase):
         min_num_boundary_triangles = trimmed_quadrature_rule_settings.GetInt("min_num_boundary_triangles")
         self.assertEqual(min_num_boundary_triangles, 100)
 
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("nnls_solver"))
+        nnls_solver = trimmed_quadrature_rule_settings.GetNNLSSolver("nnls_solver")
+        self.assertEqual(nnls_solver, QuESo.NNLSSolver.lawson_hanson)
+
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("init_point_distribution_factor"))
+        init_point_distribution_factor = trimmed_quadrature_rule_settings.GetInt("init_point_distribution_factor")
+        self.assertEqual(init_point_distribution_factor, 1)
+
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("max_octree_refinement_level"))
+        max_octree_refinement_level = trimmed_quadrature_rule_settings.GetInt("max_octree_refinement_level")
+        self.assertEqual(max_octree_refinement_level, 4)
+
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("auto_tuning"))
+        auto_tuning = trimmed_quadrature_rule_settings.GetBool("auto_tuning")
+        self.assertEqual(auto_tuning, False)
+
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("auto_tuning_sample_size"))
+        auto_tuning_sample_size = trimmed_quadrature_rule_settings.GetInt("auto_tuning_sample_size")
+        self.assertEqual(auto_tuning_sample_size, 16)
+
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("auto_tuning_volume_error"))
+        auto_tuning_volume_error = trimmed_quadrature_rule_settings.GetDouble("auto_tuning_volume_error")
+        self.assertAlmostEqual(auto_tuning_volume_error, 1e-6, 12)
+
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("max_num_cut_planes"))
+        max_num_cut_planes = trimmed_quadrature_rule_settings.GetInt("max_num_cut_planes")
+        self.assertEqual(max_num_cut_planes, 0)
+
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("verify_quadrature_rules"))
+        verify_quadrature_rules = trimmed_quadrature_rule_settings.GetBool("verify_quadrature_rules")
+        self.assertEqual(verify_quadrature_rules, False)
+
+        self.assertTrue(trimmed_quadrature_rule_settings.IsSet("compute_shape_sensitivities"))
+        compute_shape_sensitivities = trimmed_quadrature_rule_settings.GetBool("compute_shape_sensitivities")
+        self.assertEqual(compute_shape_sensitivities, False)
+
         # Check non_trimmed_quadrature_rule_settings
         non_trimmed_quadrature_rule_settings = settings["non_trimmed_quadrature_rule_settings"]
 
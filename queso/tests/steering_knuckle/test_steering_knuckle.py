@@ -37,13 +37,13 @@ class TestStrainEnergySteeringKnuckleKratos(QuESoTestCase):
         self.assertAlmostEqual(json_dict["embedded_geometry_info"]["volume"], volume, places=4)
         # quadrature_info
         self.assertAlmostEqual(model_info["quadrature_info"].GetDouble("percentage_of_geometry_volume"), 100.0, places=5)
-        self.assertEqual(model_info["quadrature_info"].GetInt("tot_num_points"), 13251)
+        self.assertEqual(model_info["quadrature_info"].GetInt("tot_num_points"), 13203)
         self.assertAlmostEqual(model_info["quadrature_info"].GetDouble("num_of_points_per_full_element"), 23.25, places=5)
         self.assertGreater(model_info["quadrature_info"].GetDouble("num_of_points_per_trimmed_element"), 26)
         self.assertLess(model_info["quadrature_info"].GetDouble("num_of_points_per_trimmed_element"), 27)
 
         self.assertAlmostEqual(json_dict["quadrature_info"]["percentage_of_geometry_volume"], 100.0, places=5)
-        self.assertEqual(json_dict["quadrature_info"]["tot_num_points"], 13251)
+        self.assertEqual(json_dict["quadrature_info"]["tot_num_points"], 13203)
         self.assertAlmostEqual(json_dict["quadrature_info"]["num_of_points_per_full_element"], 23.25, places=5)
         self.assertGreater(json_dict["quadrature_info"]["num_of_points_per_trimmed_element"], 26)
         self.assertLess(json_dict["quadrature_info"]["num_of_points_per_trimmed_element"], 27)
@@ -95,6 +95,40 @@ class TestStrainEnergySteeringKnuckleKratos(QuESoTestCase):
     def test_1(self):
         self.run_test("queso/tests/steering_knuckle/QuESoSettings1.json", 0.005)
 
+    def test_grid_planning(self):
+        pyqueso = PyQuESo("queso/tests/steering_knuckle/QuESoSettings1.json")
+        model_info = pyqueso.PlanBackgroundGrid(apply=True)
+
+        planning_info = model_info["grid_planning_info"]
+        proposed_number_of_elements = planning_info.GetIntVector("proposed_number_of_elements")
+        number_of_elements = pyqueso.settings["background_grid_settings"].GetIntVector("number_of_elements")
+        self.assertListsEqual(number_of_elements, proposed_number_of_elements)
+
+        candidates = planning_info.GetList("candidates_list")
+        self.assertGreater(len(candidates), 0)
+        self.assertIn(proposed_number_of_elements, [candidate.GetIntVector("number_of_elements") for candidate in candidates])
+        self.assertGreater(planning_info.GetDouble("min_feature_size"), 0.0)
+        self.assertGreater(model_info["elapsed_time_info"]["volume_time_info"].GetDouble("grid_planning"), 0.0)
+
+    def test_shape_sensitivities(self):
+        pyqueso = PyQuESo("queso/tests/steering_knuckle/QuESoSettings1.json")
+        pyqueso.settings["trimmed_quadrature_rule_settings"].SetValue("compute_shape_sensitivities", True)
+        pyqueso.Run()
+
+        num_trimmed_elements = 0
+        for element in pyqueso.GetElements():
+            self.assertEqual(element.HasShapeSensitivities(), element.IsTrimmed())
+            if element.HasShapeSensitivities():
+                num_trimmed_elements += 1
+                shape_sensitivities = element.GetShapeSensitivities()
+                vertex_ids = shape_sensitivities.vertex_ids
+                derivatives = shape_sensitivities.derivatives
+                # Arrays reference the C++ data and are read-only.
+                self.assertFalse(derivatives.flags.writeable)
+                self.assertEqual(derivatives.shape, (len(vertex_ids), len(element.GetIntegrationPoints()), 3))
+                self.assertAlmostEqual(derivatives[-1, -1, 2], shape_sensitivities.Derivative(len(vertex_ids)-1, len(element.GetIntegrationPoints())-1, 2), 14)
+        self.assertGreater(num_trimmed_elements, 0)
+
     def tearDown(self):
         dir_name = "queso/tests/steering_knuckle/output"
         if os.path.isdir(dir_name):
@@ -0,0 +1,374 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+//// STL includes
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+//// Project includes
+#include "queso/utilities/cpu_dispatch.h"
+#include "queso/utilities/math_utilities.hpp"
+#include "queso/utilities/polynomial_utilities.hpp"
+
+// Wide variants are only generated for x86 with GCC/Clang. All other platforms use the scalar reference.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define QuESo_CPU_DISPATCH_X86
+    #define QuESo_TARGET_AVX2 __attribute__((target("avx2")))
+    #define QuESo_TARGET_AVX512 __attribute__((target("avx512f,avx512dq")))
+    #define QuESo_FORCE_INLINE inline __attribute__((always_inline))
+#else
+    #define QuESo_FORCE_INLINE inline
+#endif
+
+namespace queso {
+
+namespace {
+
+///////////////////////////////////////////////
+///// Kernels (scalar reference) //////////////
+///////////////////////////////////////////////
+
+// Note: Kernels are force-inlined into the target specific wrappers below. Hence, the compiler generates
+// one version per instruction set from the same source.
+
+// Triangles are processed in blocks. Each block is transposed (AoS -> SoA), such that the loops over the triangles can be vectorized.
+constexpr IndexType BlockSize = 16;
+
+// Transposes vertices of triangles [Start, Start+Size) into rBlock[component][triangle].
+QuESo_FORCE_INLINE void TransposeTriangles(const double* pVertices, IndexType Start, IndexType Size, double (&rBlock)[9][BlockSize]) {
+    for( IndexType i = 0; i < Size; ++i ){
+        for( IndexType k = 0; k < 9; ++k ){
+            rBlock[k][i] = pVertices[9*(Start+i) + k];
+        }
+    }
+}
+
+// Order is a compile-time constant. Hence, the switch in Polynomial::f_x() vanishes and the loop can be vectorized.
+template<IndexType TOrder, bool TIntegral>
+QuESo_FORCE_INLINE void EvaluateLegendreOrderKernel(const double* pX, IndexType NumPoints, double a, double b, double* pValues) {
+    for( IndexType i = 0; i < NumPoints; ++i ){
+        pValues[i] = TIntegral ? Polynomial::f_x_int(pX[i], TOrder, a, b) : Polynomial::f_x(pX[i], TOrder, a, b);
+    }
+}
+
+template<bool TIntegral>
+QuESo_FORCE_INLINE void EvaluateLegendreKernel(const double* pX, IndexType NumPoints, IndexType Order, double a, double b, double* pValues) {
+    for( IndexType order = 0; order <= Order; ++order ){
+        double* p_values = pValues + order*NumPoints;
+        switch(order) {
+            case 0: EvaluateLegendreOrderKernel<0, TIntegral>(pX, NumPoints, a, b, p_values); break;
+            case 1: EvaluateLegendreOrderKernel<1, TIntegral>(pX, NumPoints, a, b, p_values); break;
+            case 2: EvaluateLegendreOrderKernel<2, TIntegral>(pX, NumPoints, a, b, p_values); break;
+            case 3: EvaluateLegendreOrderKernel<3, TIntegral>(pX, NumPoints, a, b, p_values); break;
+            case 4: EvaluateLegendreOrderKernel<4, TIntegral>(pX, NumPoints, a, b, p_values); break;
+            case 5: EvaluateLegendreOrderKernel<5, TIntegral>(pX, NumPoints, a, b, p_values); break;
+            case 6: EvaluateLegendreOrderKernel<6, TIntegral>(pX, NumPoints, a, b, p_values); break;
+            case 7: EvaluateLegendreOrderKernel<7, TIntegral>(pX, NumPoints, a, b, p_values); break;
+            case 8: EvaluateLegendreOrderKernel<8, TIntegral>(pX, NumPoints, a, b, p_values); break;
+            default: std::fill(p_values, p_values + NumPoints, 0.0); // Same as Polynomial::f_x().
+        }
+    }
+}
+
+QuESo_FORCE_INLINE void AssembleMomentMatrixKernel(const double* pValuesX, const double* pValuesY, const double* pValuesZ, IndexType NumPoints,
+                                                   const Vector3i& rOrder, double* pMatrix) {
+    const IndexType number_of_functions = (rOrder[0]+1)*(rOrder[1]+1)*(rOrder[2]+1);
+    IndexType row_index = 0;
+    for( IndexType i_x = 0; i_x <= rOrder[0]; ++i_x ){
+        const double* p_x = pValuesX + i_x*NumPoints;
+        for( IndexType i_y = 0; i_y <= rOrder[1]; ++i_y ){
+            const double* p_y = pValuesY + i_y*NumPoints;
+            for( IndexType i_z = 0; i_z <= rOrder[2]; ++i_z ){
+                const double* p_z = pValuesZ + i_z*NumPoints;
+                for( IndexType column_index = 0; column_index < NumPoints; ++column_index ){
+                    pMatrix[column_index*number_of_functions + row_index] = p_x[column_index] * p_y[column_index] * p_z[column_index];
+                }
+                ++row_index;
+            }
+        }
+    }
+}
+
+// Projects triangle and AABB onto axis. Returns true, if axis does not separate both. Same operations as AABB_primitive::check_axis(),
+// with the normals of the AABB: u0=(1,0,0), u1=(0,1,0), u2=(0,0,1).
+QuESo_FORCE_INLINE bool CheckAxis(const double (&v0)[3], const double (&v1)[3], const double (&v2)[3], const double (&rExtent)[3], const double (&rAxis)[3]) {
+    const double pv0 = v0[0]*rAxis[0] + v0[1]*rAxis[1] + v0[2]*rAxis[2];
+    const double pv1 = v1[0]*rAxis[0] + v1[1]*rAxis[1] + v1[2]*rAxis[2];
+    const double pv2 = v2[0]*rAxis[0] + v2[1]*rAxis[1] + v2[2]*rAxis[2];
+
+    const double pu0 = 1.0*rAxis[0] + 0.0*rAxis[1] + 0.0*rAxis[2];
+    const double pu1 = 0.0*rAxis[0] + 1.0*rAxis[1] + 0.0*rAxis[2];
+    const double pu2 = 0.0*rAxis[0] + 0.0*rAxis[1] + 1.0*rAxis[2];
+
+    const double r = rExtent[0] * std::abs(pu0) + rExtent[1] * std::abs(pu1) + rExtent[2] * std::abs(pu2);
+
+    const double max_pv = std::max(std::max(pv0, pv1), pv2);
+    const double min_pv = std::min(std::min(pv0, pv1), pv2);
+    return !( std::max(-max_pv, min_pv) > r );
+}
+
+QuESo_FORCE_INLINE void IntersectTrianglesAABBKernel(const PointType& rLowerBound, const PointType& rUpperBound, const PointType& rCentre, double Tolerance,
+                                                     const double* pVertices, IndexType NumTriangles, std::uint8_t* pResults) {
+    const double extent[3] = {(rUpperBound[0] - rLowerBound[0])/2.0 - Tolerance,
+                              (rUpperBound[1] - rLowerBound[1])/2.0 - Tolerance,
+                              (rUpperBound[2] - rLowerBound[2])/2.0 - Tolerance};
+    const double u0[3] = {1.0, 0.0, 0.0};
+    const double u1[3] = {0.0, 1.0, 0.0};
+    const double u2[3] = {0.0, 0.0, 1.0};
+
+    double block[9][BlockSize];
+    std::int64_t results[BlockSize]; // Same width as double. Mixed widths within one loop prevent vectorization.
+    for( IndexType start = 0; start < NumTriangles; start += BlockSize ){
+        const IndexType size = std::min(BlockSize, NumTriangles - start);
+        TransposeTriangles(pVertices, start, size, block);
+
+        // No early exit. Allows the compiler to vectorize over the triangles.
+        for( IndexType i = 0; i < size; ++i ){
+            const double v0[3] = {block[0][i], block[1][i], block[2][i]};
+            const double v1[3] = {block[3][i], block[4][i], block[5][i]};
+            const double v2[3] = {block[6][i], block[7][i], block[8][i]};
+
+            // Translate triangle to origin.
+            const double v0_orig[3] = {v0[0] - rCentre[0], v0[1] - rCentre[1], v0[2] - rCentre[2]};
+            const double v1_orig[3] = {v1[0] - rCentre[0], v1[1] - rCentre[1], v1[2] - rCentre[2]};
+            const double v2_orig[3] = {v2[0] - rCentre[0], v2[1] - rCentre[1], v2[2] - rCentre[2]};
+
+            // Edge vectors.
+            const double f0[3] = {v1[0] - v0[0], v1[1] - v0[1], v1[2] - v0[2]};
+            const double f1[3] = {v2[0] - v1[0], v2[1] - v1[1], v2[2] - v1[2]};
+            const double f2[3] = {v0[0] - v2[0], v0[1] - v2[1], v0[2] - v2[2]};
+
+            // (u0, u1, u2) vs. (f0, f1, f2).
+            const double axis_u0_f0[3] = {u0[1]*f0[2] - u0[2]*f0[1], u0[2]*f0[0] - u0[0]*f0[2], u0[0]*f0[1] - u0[1]*f0[0]};
+            const double axis_u0_f1[3] = {u0[1]*f1[2] - u0[2]*f1[1], u0[2]*f1[0] - u0[0]*f1[2], u0[0]*f1[1] - u0[1]*f1[0]};
+            const double axis_u0_f2[3] = {u0[1]*f2[2] - u0[2]*f2[1], u0[2]*f2[0] - u0[0]*f2[2], u0[0]*f2[1] - u0[1]*f2[0]};
+            const double axis_u1_f0[3] = {u1[1]*f0[2] - u1[2]*f0[1], u1[2]*f0[0] - u1[0]*f0[2], u1[0]*f0[1] - u1[1]*f0[0]};
+            const double axis_u1_f1[3] = {u1[1]*f1[2] - u1[2]*f1[1], u1[2]*f1[0] - u1[0]*f1[2], u1[0]*f1[1] - u1[1]*f1[0]};
+            const double axis_u1_f2[3] = {u1[1]*f2[2] - u1[2]*f2[1], u1[2]*f2[0] - u1[0]*f2[2], u1[0]*f2[1] - u1[1]*f2[0]};
+            const double axis_u2_f0[3] = {u2[1]*f0[2] - u2[2]*f0[1], u2[2]*f0[0] - u2[0]*f0[2], u2[0]*f0[1] - u2[1]*f0[0]};
+            const double axis_u2_f1[3] = {u2[1]*f1[2] - u2[2]*f1[1], u2[2]*f1[0] - u2[0]*f1[2], u2[0]*f1[1] - u2[1]*f1[0]};
+            const double axis_u2_f2[3] = {u2[1]*f2[2] - u2[2]*f2[1], u2[2]*f2[0] - u2[0]*f2[2], u2[0]*f2[1] - u2[1]*f2[0]};
+            // Face normal of triangle.
+            const double normal[3] = {f0[1]*f1[2] - f0[2]*f1[1], f0[2]*f1[0] - f0[0]*f1[2], f0[0]*f1[1] - f0[1]*f1[0]};
+
+            const bool intersected = CheckAxis(v0_orig, v1_orig, v2_orig, extent, axis_u0_f0)
+                                   & CheckAxis(v0_orig, v1_orig, v2_orig, extent, axis_u0_f1)
+                                   & CheckAxis(v0_orig, v1_orig, v2_orig, extent, axis_u0_f2)
+                                   & CheckAxis(v0_orig, v1_orig, v2_orig, extent, axis_u1_f0)
+                                   & CheckAxis(v0_orig, v1_orig, v2_orig, extent, axis_u1_f1)
+                                   & CheckAxis(v0_orig, v1_orig, v2_orig, extent, axis_u1_f2)
+                                   & CheckAxis(v0_orig, v1_orig, v2_orig, extent, axis_u2_f0)
+                                   & CheckAxis(v0_orig, v1_orig, v2_orig, extent, axis_u2_f1)
+                                   & CheckAxis(v0_orig, v1_orig, v2_orig, extent, axis_u2_f2)
+                                   & CheckAxis(v0_orig, v1_orig, v2_orig, extent, u0)
+                                   & CheckAxis(v0_orig, v1_orig, v2_orig, extent, u1)
+                                   & CheckAxis(v0_orig, v1_orig, v2_orig, extent, u2)
+                                   & CheckAxis(v0_orig, v1_orig, v2_orig, extent, normal);
+
+            results[i] = intersected;
+        }
+        for( IndexType i = 0; i < size; ++i ){
+            pResults[start+i] = static_cast<std::uint8_t>(results[i]);
+        }
+    }
+}
+
+QuESo_FORCE_INLINE void IntersectRayTrianglesKernel(const PointType& rOrigin, const PointType& rDirection, const double* pVertices, IndexType NumTriangles,
+                                                    double* pT, double* pU, double* pV, std::uint8_t* pFlags) {
+    double block[9][BlockSize];
+    std::int64_t flags[BlockSize]; // Same width as double. Mixed widths within one loop prevent vectorization.
+    for( IndexType start = 0; start < NumTriangles; start += BlockSize ){
+        const IndexType size = std::min(BlockSize, NumTriangles - start);
+        TransposeTriangles(pVertices, start, size, block);
+
+        for( IndexType i = 0; i < size; ++i ){
+            const double v0[3] = {block[0][i], block[1][i], block[2][i]};
+            const double v0v1[3] = {block[3][i] - v0[0], block[4][i] - v0[1], block[5][i] - v0[2]};
+            const double v0v2[3] = {block[6][i] - v0[0], block[7][i] - v0[1], block[8][i] - v0[2]};
+
+            // Cross product: rDirection x v0v2
+            const double pvec[3] = { rDirection[1]*v0v2[2] - rDirection[2]*v0v2[1],
+                                     rDirection[2]*v0v2[0] - rDirection[0]*v0v2[2],
+                                     rDirection[0]*v0v2[1] - rDirection[1]*v0v2[0] };
+            const double det = v0v1[0]*pvec[0] + v0v1[1]*pvec[1] + v0v1[2]*pvec[2];
+
+            const bool parallel = std::abs(det) < 10.0*ZEROTOL;
+            const bool back_facing = !parallel & (det < ZEROTOL);
+
+            const double inv_det = 1 / det;
+            const double tvec[3] = {rOrigin[0] - v0[0], rOrigin[1] - v0[1], rOrigin[2] - v0[2]};
+            const double u = (tvec[0]*pvec[0] + tvec[1]*pvec[1] + tvec[2]*pvec[2]) * inv_det;
+
+            // Cross product: tvec x v0v1
+            const double qvec[3] = { tvec[1]*v0v1[2] - tvec[2]*v0v1[1],
+                                     tvec[2]*v0v1[0] - tvec[0]*v0v1[2],
+                                     tvec[0]*v0v1[1] - tvec[1]*v0v1[0] };
+            const double v = (rDirection[0]*qvec[0] + rDirection[1]*qvec[1] + rDirection[2]*qvec[2]) * inv_det;
+            const double t = (v0v2[0]*qvec[0] + v0v2[1]*qvec[1] + v0v2[2]*qvec[2]) * inv_det;
+
+            const bool outside = (u < -ZEROTOL) | (u > 1+ZEROTOL) | (v < -ZEROTOL) | (u + v > 1+ZEROTOL) | (t < -ZEROTOL);
+            const bool intersected = parallel | !outside;
+
+            pT[start+i] = t;
+            pU[start+i] = u;
+            pV[start+i] = v;
+            flags[i] = intersected*std::int64_t(CpuDispatch::Intersected) + back_facing*std::int64_t(CpuDispatch::BackFacing)
+                     + parallel*std::int64_t(CpuDispatch::Parallel);
+        }
+        for( IndexType i = 0; i < size; ++i ){
+            pFlags[start+i] = static_cast<std::uint8_t>(flags[i]);
+        }
+    }
+}
+
+///////////////////////////////////////////////
+///// Instruction set specific variants ///////
+///////////////////////////////////////////////
+
+// Defines one function per kernel and instruction set: <Kernel>_<suffix>(...).
+#define QuESo_DEFINE_KERNEL_VARIANTS(ATTRIBUTE, SUFFIX)                                                                                     \
+ATTRIBUTE void EvaluateLegendre_##SUFFIX(const double* pX, IndexType NumPoints, IndexType Order, double a, double b, double* pValues) {    \
+    EvaluateLegendreKernel<false>(pX, NumPoints, Order, a, b, pValues);                                                                          \
+}                                                                                                                                         \
+ATTRIBUTE void EvaluateLegendreIntegral_##SUFFIX(const double* pX, IndexType NumPoints, IndexType Order, double a, double b, double* pValues) { \
+    EvaluateLegendreKernel<true>(pX, NumPoints, Order, a, b, pValues);                                                                  \
+}                                                                                                                                         \
+ATTRIBUTE void AssembleMomentMatrix_##SUFFIX(const double* pValuesX, const double* pValuesY, const double* pValuesZ, IndexType NumPoints, \
+                                             const Vector3i& rOrder, double* pMatrix) {                                                  \
+    AssembleMomentMatrixKernel(pValuesX, pValuesY, pValuesZ, NumPoints, rOrder, pMatrix);                                                 \
+}                                                                                                                                         \
+ATTRIBUTE void IntersectTrianglesAABB_##SUFFIX(const PointType& rLowerBound, const PointType& rUpperBound, const PointType& rCentre,      \
+                                               double Tolerance, const double* pVertices, IndexType NumTriangles, std::uint8_t* pResults) { \
+    IntersectTrianglesAABBKernel(rLowerBound, rUpperBound, rCentre, Tolerance, pVertices, NumTriangles, pResults);                        \
+}                                                                                                                                         \
+ATTRIBUTE void IntersectRayTriangles_##SUFFIX(const PointType& rOrigin, const PointType& rDirection, const double* pVertices,              \
+                                              IndexType NumTriangles, double* pT, double* pU, double* pV, std::uint8_t* pFlags) {         \
+    IntersectRayTrianglesKernel(rOrigin, rDirection, pVertices, NumTriangles, pT, pU, pV, pFlags);                                        \
+}
+
+QuESo_DEFINE_KERNEL_VARIANTS(, scalar)
+#ifdef QuESo_CPU_DISPATCH_X86
+QuESo_DEFINE_KERNEL_VARIANTS(QuESo_TARGET_AVX2, avx2)
+QuESo_DEFINE_KERNEL_VARIANTS(QuESo_TARGET_AVX512, avx512)
+#endif
+
+#undef QuESo_DEFINE_KERNEL_VARIANTS
+
+// Calls variant of KERNEL that corresponds to LEVEL.
+#ifdef QuESo_CPU_DISPATCH_X86
+    #define QuESo_DISPATCH(LEVEL, KERNEL, ...)                                    \
+        switch(LEVEL) {                                                           \
+            case InstructionSet::avx512: KERNEL##_avx512(__VA_ARGS__); break;     \
+            case InstructionSet::avx2: KERNEL##_avx2(__VA_ARGS__); break;         \
+            default: KERNEL##_scalar(__VA_ARGS__);                                \
+        }
+#else
+    #define QuESo_DISPATCH(LEVEL, KERNEL, ...) KERNEL##_scalar(__VA_ARGS__);
+#endif
+
+///////////////////////////////////////////////
+///// Detection ///////////////////////////////
+///////////////////////////////////////////////
+
+InstructionSet DetectInstructionSet() {
+#ifdef QuESo_CPU_DISPATCH_X86
+    __builtin_cpu_init();
+    if( __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") ){
+        return InstructionSet::avx512;
+    }
+    if( __builtin_cpu_supports("avx2") ){
+        return InstructionSet::avx2;
+    }
+#endif
+    return InstructionSet::scalar;
+}
+
+InstructionSet DefaultInstructionSet() {
+    const InstructionSet supported = CpuDispatch::GetSupportedInstructionSet();
+    const char* p_env = std::getenv("QUESO_INSTRUCTION_SET");
+    if( p_env ){
+        const InstructionSet candidates[3] = {InstructionSet::scalar, InstructionSet::avx2, InstructionSet::avx512};
+        const char* names[3] = {"scalar", "avx2", "avx512"};
+        for( IndexType i = 0; i < 3; ++i ){
+            if( std::strcmp(p_env, names[i]) == 0 && CpuDispatch::IsSupported(candidates[i]) ){
+                return candidates[i];
+            }
+        }
+    }
+    return supported;
+}
+
+std::atomic<int>& ActiveInstructionSet() {
+    static std::atomic<int> s_instruction_set( static_cast<int>(DefaultInstructionSet()) );
+    return s_instruction_set;
+}
+
+} // End anonymous namespace
+
+/////////////////////////
+///// CpuDispatch ///////
+/////////////////////////
+
+InstructionSet CpuDispatch::GetSupportedInstructionSet() {
+    static const InstructionSet s_supported = DetectInstructionSet();
+    return s_supported;
+}
+
+InstructionSet CpuDispatch::GetInstructionSet() {
+    return static_cast<InstructionSet>( ActiveInstructionSet().load(std::memory_order_relaxed) );
+}
+
+bool CpuDispatch::IsSupported(InstructionSet Level) {
+    return static_cast<int>(Level) <= static_cast<int>(GetSupportedInstructionSet());
+}
+
+void CpuDispatch::SetInstructionSet(InstructionSet Level) {
+    QuESo_ERROR_IF( !IsSupported(Level) ) << "Instruction set '" << Level << "' is not supported by this CPU. Supported: '"
+        << GetSupportedInstructionSet() << "'.\n";
+    ActiveInstructionSet().store(static_cast<int>(Level), std::memory_order_relaxed);
+}
+
+void CpuDispatch::ResetInstructionSet() {
+    ActiveInstructionSet().store(static_cast<int>(DefaultInstructionSet()), std::memory_order_relaxed);
+}
+
+void CpuDispatch::EvaluateLegendre(const double* pX, IndexType NumPoints, IndexType Order, double a, double b,
+                                   double* pValues, InstructionSet Level) {
+    QuESo_DISPATCH(Level, EvaluateLegendre, pX, NumPoints, Order, a, b, pValues)
+}
+
+void CpuDispatch::EvaluateLegendreIntegral(const double* pX, IndexType NumPoints, IndexType Order, double a, double b,
+                                           double* pValues, InstructionSet Level) {
+    QuESo_DISPATCH(Level, EvaluateLegendreIntegral, pX, NumPoints, Order, a, b, pValues)
+}
+
+void CpuDispatch::AssembleMomentMatrix(const double* pValuesX, const double* pValuesY, const double* pValuesZ, IndexType NumPoints,
+                                       const Vector3i& rOrder, double* pMatrix, InstructionSet Level) {
+    QuESo_DISPATCH(Level, AssembleMomentMatrix, pValuesX, pValuesY, pValuesZ, NumPoints, rOrder, pMatrix)
+}
+
+void CpuDispatch::IntersectTrianglesAABB(const PointType& rLowerBound, const PointType& rUpperBound, const PointType& rCentre, double Tolerance,
+                                         const double* pVertices, IndexType NumTriangles, std::uint8_t* pResults, InstructionSet Level) {
+    QuESo_DISPATCH(Level, IntersectTrianglesAABB, rLowerBound, rUpperBound, rCentre, Tolerance, pVertices, NumTriangles, pResults)
+}
+
+void CpuDispatch::IntersectRayTriangles(const PointType& rOrigin, const PointType& rDirection, const double* pVertices, IndexType NumTriangles,
+                                        double* pT, double* pU, double* pV, std::uint8_t* pFlags, InstructionSet Level) {
+    QuESo_DISPATCH(Level, IntersectRayTriangles, rOrigin, rDirection, pVertices, NumTriangles, pT, pU, pV, pFlags)
+}
+
+#undef QuESo_DISPATCH
+
+} // End namespace queso
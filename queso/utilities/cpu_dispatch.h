@@ -0,0 +1,139 @@
+//   ____        ______  _____
+//  / __ \      |  ____|/ ____|
+// | |  | |_   _| |__  | (___   ___
+// | |  | | | | |  __|  \___ \ / _ \'
+// | |__| | |_| | |____ ____) | (_) |
+//  \___\_\\__,_|______|_____/ \___/
+//         Quadrature for Embedded Solids
+//
+//  License:    BSD 4-Clause License
+//              See: https://github.com/manuelmessmer/QuESo/blob/main/LICENSE
+//
+//  Authors:    Manuel Messmer
+
+#ifndef CPU_DISPATCH_INCLUDE_H
+#define CPU_DISPATCH_INCLUDE_H
+
+//// STL includes
+#include <cstdint>
+//// Project includes
+#include "queso/includes/define.hpp"
+
+namespace queso {
+
+///@name QuESo Classes
+///@{
+
+/**
+ * @class  CpuDispatch
+ * @author Manuel Messmer
+ * @brief  Provides hot kernels in multiple instruction set variants and selects the best supported variant at runtime.
+ * @details All variants are compiled into the same library from the same source (scalar reference). The wide variants are
+ *          generated with target attributes (avx2, avx512). The instruction set is detected once via cpuid. It can be
+ *          overridden by the environment variable QUESO_INSTRUCTION_SET (scalar, avx2, avx512) or via SetInstructionSet().
+ *          Floating point contraction is disabled for this translation unit. Hence, all variants give bitwise identical results.
+ *          All kernels operate on batches, such that the dispatch overhead is negligible.
+**/
+class CpuDispatch {
+public:
+    ///@name Operations
+    ///@{
+
+    /// @brief Returns best instruction set supported by the CPU (and compiler).
+    /// @return InstructionSet
+    static InstructionSet GetSupportedInstructionSet();
+
+    /// @brief Returns instruction set that is currently used by all kernels.
+    /// @return InstructionSet
+    static InstructionSet GetInstructionSet();
+
+    /// @brief Overrides instruction set used by all kernels. Throws, if InstructionSet is not supported.
+    /// @param Level
+    static void SetInstructionSet(InstructionSet Level);
+
+    /// @brief Resets instruction set to GetSupportedInstructionSet() (or the value given by QUESO_INSTRUCTION_SET).
+    static void ResetInstructionSet();
+
+    /// @brief Returns true, if Level is supported by the CPU.
+    /// @param Level
+    /// @return bool
+    static bool IsSupported(InstructionSet Level);
+
+    /// @brief Evaluates Legendre polynomials (defined on (a,b)) of order 0 to Order at all points.
+    ///        Values are stored order-major: pValues[order*NumPoints + point].
+    /// @param pX Coordinates of the points.
+    /// @param NumPoints
+    /// @param Order Maximum order.
+    /// @param a Lower bound.
+    /// @param b Upper bound.
+    /// @param[out] pValues Size: (Order+1)*NumPoints.
+    /// @param Level Default: GetInstructionSet().
+    static void EvaluateLegendre(const double* pX, IndexType NumPoints, IndexType Order, double a, double b,
+                                 double* pValues, InstructionSet Level = GetInstructionSet());
+
+    /// @brief Evaluates integrals of Legendre polynomials (defined on (a,b)) of order 0 to Order at all points.
+    ///        Values are stored order-major: pValues[order*NumPoints + point].
+    /// @param pX Coordinates of the points.
+    /// @param NumPoints
+    /// @param Order Maximum order.
+    /// @param a Lower bound.
+    /// @param b Upper bound.
+    /// @param[out] pValues Size: (Order+1)*NumPoints.
+    /// @param Level Default: GetInstructionSet().
+    static void EvaluateLegendreIntegral(const double* pX, IndexType NumPoints, IndexType Order, double a, double b,
+                                         double* pValues, InstructionSet Level = GetInstructionSet());
+
+    /// @brief Assembles moment fitting matrix from the tables given by EvaluateLegendre(). Matrix is serialized: Column first.
+    ///        Each column corresponds to one point. Entry (i_x, i_y, i_z) of column j is: (pValuesX[i_x][j]*pValuesY[i_y][j])*pValuesZ[i_z][j].
+    /// @param pValuesX
+    /// @param pValuesY
+    /// @param pValuesZ
+    /// @param NumPoints
+    /// @param rOrder
+    /// @param[out] pMatrix Size: (rOrder[0]+1)*(rOrder[1]+1)*(rOrder[2]+1)*NumPoints.
+    /// @param Level Default: GetInstructionSet().
+    static void AssembleMomentMatrix(const double* pValuesX, const double* pValuesY, const double* pValuesZ, IndexType NumPoints,
+                                     const Vector3i& rOrder, double* pMatrix, InstructionSet Level = GetInstructionSet());
+
+    /// @brief Tests a batch of triangles for intersection with an AABB (seperating axis theorem).
+    ///        Gives the same results as AABB_primitive::intersect(v0, v1, v2, Tolerance).
+    /// @param rLowerBound of AABB.
+    /// @param rUpperBound of AABB.
+    /// @param rCentre of AABB.
+    /// @param Tolerance Reduces extent of AABB.
+    /// @param pVertices 9 values per triangle: (v0, v1, v2).
+    /// @param NumTriangles
+    /// @param[out] pResults 1 if intersected, 0 otherwise.
+    /// @param Level Default: GetInstructionSet().
+    static void IntersectTrianglesAABB(const PointType& rLowerBound, const PointType& rUpperBound, const PointType& rCentre, double Tolerance,
+                                       const double* pVertices, IndexType NumTriangles, std::uint8_t* pResults, InstructionSet Level = GetInstructionSet());
+
+    /// @brief Tests a batch of triangles for intersection with a ray (Moeller-Trumbore).
+    ///        Gives the same results as Ray_AABB_primitive::intersect(v0, v1, v2, t, u, v, BackFacing, Parallel).
+    /// @param rOrigin of ray.
+    /// @param rDirection of ray.
+    /// @param pVertices 9 values per triangle: (v0, v1, v2).
+    /// @param NumTriangles
+    /// @param[out] pT Distance to intersection. Only valid, if intersected and not parallel.
+    /// @param[out] pU Parametric coordinate 1. Only valid, if intersected and not parallel.
+    /// @param[out] pV Parametric coordinate 2. Only valid, if intersected and not parallel.
+    /// @param[out] pFlags Bit 0: intersected, Bit 1: back facing, Bit 2: parallel.
+    /// @param Level Default: GetInstructionSet().
+    static void IntersectRayTriangles(const PointType& rOrigin, const PointType& rDirection, const double* pVertices, IndexType NumTriangles,
+                                      double* pT, double* pU, double* pV, std::uint8_t* pFlags, InstructionSet Level = GetInstructionSet());
+
+    ///@}
+    ///@name Flags of IntersectRayTriangles()
+    ///@{
+
+    static constexpr std::uint8_t Intersected = 1;
+    static constexpr std::uint8_t BackFacing = 2;
+    static constexpr std::uint8_t Parallel = 4;
+
+    ///@}
+}; // End class CpuDispatch
+///@} // End QuESo classes
+
+} // End namespace queso
+
+#endif // CPU_DISPATCH_INCLUDE_H
@@ -13,12 +13,15 @@
 
 //// STL includes
 #include <map>
+#include <queue>
+#include <limits>
 #include <numeric>
 #include <algorithm>
 
 /// Project includes
 #include "queso/utilities/mesh_utilities.h"
 #include "queso/utilities/math_utilities.hpp"
+#include "queso/embedding/aabb_tree.h"
 
 namespace queso {
 
@@ -358,4 +361,553 @@ std::pair<PointType, PointType> MeshUtilities::BoundingBox(const TriangleMeshInt
     return std::make_pair(lower_bound, upper_bound);
 }
 
-} // End namespace queso
\ No newline at end of file
+namespace {
+
+/// @brief Quadric error metric: Q(x) = x^T*A*x + 2*b^T*x + c. Stores the upper triangle of A, b and c.
+class Quadric {
+public:
+    /// @brief Adds the squared distance to the plane rNormal*x + Offset = 0. rNormal must be a unit vector.
+    void AddPlane(const Vector3d& rNormal, double Offset) {
+        mA[0] += rNormal[0]*rNormal[0]; mA[1] += rNormal[0]*rNormal[1]; mA[2] += rNormal[0]*rNormal[2];
+        mA[3] += rNormal[1]*rNormal[1]; mA[4] += rNormal[1]*rNormal[2]; mA[5] += rNormal[2]*rNormal[2];
+        for( IndexType i = 0; i < 3; ++i ){
+            mB[i] += Offset*rNormal[i];
+        }
+        mC += Offset*Offset;
+    }
+
+    void Add(const Quadric& rOther) {
+        for( IndexType i = 0; i < 6; ++i ){
+            mA[i] += rOther.mA[i];
+        }
+        for( IndexType i = 0; i < 3; ++i ){
+            mB[i] += rOther.mB[i];
+        }
+        mC += rOther.mC;
+    }
+
+    double Evaluate(const Vector3d& rPoint) const {
+        const double ax_0 = mA[0]*rPoint[0] + mA[1]*rPoint[1] + mA[2]*rPoint[2];
+        const double ax_1 = mA[1]*rPoint[0] + mA[3]*rPoint[1] + mA[4]*rPoint[2];
+        const double ax_2 = mA[2]*rPoint[0] + mA[4]*rPoint[1] + mA[5]*rPoint[2];
+        const double value = rPoint[0]*ax_0 + rPoint[1]*ax_1 + rPoint[2]*ax_2 + 2.0*Math::Dot(mB, rPoint) + mC;
+        return std::max(value, 0.0);
+    }
+
+    /// @brief Solves A*x = -b. Returns false, if A is (almost) singular, e.g., for flat regions or creases.
+    bool Minimize(Vector3d& rPoint) const {
+        const double c_00 = mA[3]*mA[5] - mA[4]*mA[4];
+        const double c_01 = mA[2]*mA[4] - mA[1]*mA[5];
+        const double c_02 = mA[1]*mA[4] - mA[2]*mA[3];
+        const double det = mA[0]*c_00 + mA[1]*c_01 + mA[2]*c_02;
+        const double trace = mA[0] + mA[3] + mA[5];
+        if( std::abs(det) <= 1e-6*trace*trace*trace ){
+            return false;
+        }
+        const double c_11 = mA[0]*mA[5] - mA[2]*mA[2];
+        const double c_12 = mA[1]*mA[2] - mA[0]*mA[4];
+        const double c_22 = mA[0]*mA[3] - mA[1]*mA[1];
+        rPoint[0] = -(c_00*mB[0] + c_01*mB[1] + c_02*mB[2]) / det;
+        rPoint[1] = -(c_01*mB[0] + c_11*mB[1] + c_12*mB[2]) / det;
+        rPoint[2] = -(c_02*mB[0] + c_12*mB[1] + c_22*mB[2]) / det;
+        return true;
+    }
+
+private:
+    std::array<double, 6> mA{};
+    Vector3d mB{0.0, 0.0, 0.0};
+    double mC = 0.0;
+};
+
+/// @brief Returns the squared distance between rPoint and the triangle (rA, rB, rC) (see: Ericson, Real-Time Collision Detection).
+double SquaredDistancePointTriangle(const Vector3d& rPoint, const Vector3d& rA, const Vector3d& rB, const Vector3d& rC) {
+    const auto squared_norm = [](const Vector3d& rVector){ return Math::Dot(rVector, rVector); };
+    const Vector3d ab = Math::Subtract(rB, rA);
+    const Vector3d ac = Math::Subtract(rC, rA);
+    const Vector3d ap = Math::Subtract(rPoint, rA);
+    const double d_1 = Math::Dot(ab, ap);
+    const double d_2 = Math::Dot(ac, ap);
+    if( d_1 <= 0.0 && d_2 <= 0.0 ){
+        return squared_norm(ap);
+    }
+    const Vector3d bp = Math::Subtract(rPoint, rB);
+    const double d_3 = Math::Dot(ab, bp);
+    const double d_4 = Math::Dot(ac, bp);
+    if( d_3 >= 0.0 && d_4 <= d_3 ){
+        return squared_norm(bp);
+    }
+    const double v_c = d_1*d_4 - d_3*d_2;
+    if( v_c <= 0.0 && d_1 >= 0.0 && d_3 <= 0.0 ){
+        const double v = d_1 / (d_1 - d_3);
+        return squared_norm( Math::Subtract(ap, Math::Mult(v, ab)) );
+    }
+    const Vector3d cp = Math::Subtract(rPoint, rC);
+    const double d_5 = Math::Dot(ab, cp);
+    const double d_6 = Math::Dot(ac, cp);
+    if( d_6 >= 0.0 && d_5 <= d_6 ){
+        return squared_norm(cp);
+    }
+    const double v_b = d_5*d_2 - d_1*d_6;
+    if( v_b <= 0.0 && d_2 >= 0.0 && d_6 <= 0.0 ){
+        const double w = d_2 / (d_2 - d_6);
+        return squared_norm( Math::Subtract(ap, Math::Mult(w, ac)) );
+    }
+    const double v_a = d_3*d_6 - d_5*d_4;
+    if( v_a <= 0.0 && (d_4 - d_3) >= 0.0 && (d_5 - d_6) >= 0.0 ){
+        const double w = (d_4 - d_3) / ((d_4 - d_3) + (d_5 - d_6));
+        return squared_norm( Math::Subtract(bp, Math::Mult(w, Math::Subtract(rC, rB))) );
+    }
+    const double sum = v_a + v_b + v_c;
+    if( sum <= 0.0 ){ // Degenerated triangle.
+        return std::min({squared_norm(ap), squared_norm(bp), squared_norm(cp)});
+    }
+    const double v = v_b / sum;
+    const double w = v_c / sum;
+    return squared_norm( Math::Subtract(ap, Math::Add(Math::Mult(v, ab), Math::Mult(w, ac))) );
+}
+
+/// @brief Returns AABB around the given points, which is enlarged by Offset.
+AABB_primitive GetAABB(const std::vector<Vector3d>& rPoints, double Offset) {
+    Vector3d lower_bound{MAXD, MAXD, MAXD};
+    Vector3d upper_bound{LOWESTD, LOWESTD, LOWESTD};
+    for( const auto& r_point : rPoints ){
+        for( IndexType i = 0; i < 3; ++i ){
+            lower_bound[i] = std::min(lower_bound[i], r_point[i] - Offset);
+            upper_bound[i] = std::max(upper_bound[i], r_point[i] + Offset);
+        }
+    }
+    return AABB_primitive(lower_bound, upper_bound);
+}
+
+/// @brief Returns true, if rPoint is within Radius to any of the given triangles.
+bool IsWithinRadius(const TriangleMeshInterface& rTriangleMesh, const std::vector<IndexType>& rTriangleIds, const Vector3d& rPoint, double Radius) {
+    const double squared_radius = Radius*Radius;
+    for( const IndexType triangle_id : rTriangleIds ){
+        if( SquaredDistancePointTriangle(rPoint, rTriangleMesh.P1(triangle_id), rTriangleMesh.P2(triangle_id), rTriangleMesh.P3(triangle_id)) <= squared_radius ){
+            return true;
+        }
+    }
+    return false;
+}
+
+/// @brief Returns the distance between rPoint and rTriangleMesh, if it is smaller than Radius. Otherwise, returns MAXD.
+double DistanceWithinRadius(const AABB_tree& rTree, const TriangleMeshInterface& rTriangleMesh, const Vector3d& rPoint, double Radius) {
+    const AABB_primitive aabb = GetAABB({rPoint}, Radius);
+    double min_squared_distance = MAXD;
+    for( const IndexType triangle_id : rTree.Query(aabb) ){
+        min_squared_distance = std::min(min_squared_distance,
+            SquaredDistancePointTriangle(rPoint, rTriangleMesh.P1(triangle_id), rTriangleMesh.P2(triangle_id), rTriangleMesh.P3(triangle_id)) );
+    }
+    // Any triangle within the sphere of size Radius intersects the box. Hence, the distance is exact, if it is smaller than Radius.
+    const double distance = std::sqrt(min_squared_distance);
+    return (distance <= Radius) ? distance : MAXD;
+}
+
+/// @brief Returns the distance between rPoint and rTriangleMesh (non-empty).
+double Distance(const AABB_tree& rTree, const TriangleMeshInterface& rTriangleMesh, const Vector3d& rPoint, double InitialRadius) {
+    double radius = std::max(InitialRadius, ZEROTOL);
+    while( true ){
+        const double distance = DistanceWithinRadius(rTree, rTriangleMesh, rPoint, radius);
+        if( distance < MAXD ){
+            return distance;
+        }
+        radius *= 2.0;
+    }
+}
+
+/// @brief Returns the one-sided Hausdorff distance from rTriangleMeshA to rTriangleMeshB.
+double OneSidedHausdorffDistance(const TriangleMeshInterface& rTriangleMeshA, const TriangleMeshInterface& rTriangleMeshB) {
+    const AABB_tree tree_b(rTriangleMeshB);
+    const IndexType num_triangles = rTriangleMeshA.NumOfTriangles();
+    double max_distance = 0.0;
+    #pragma omp parallel for reduction(max: max_distance)
+    for( int i = 0; i < static_cast<int>(num_triangles); ++i ){
+        const auto& r_p1 = rTriangleMeshA.P1(i);
+        const auto& r_p2 = rTriangleMeshA.P2(i);
+        const auto& r_p3 = rTriangleMeshA.P3(i);
+        const std::array<Vector3d, 7> samples = { r_p1, r_p2, r_p3,
+            Math::AddAndMult(0.5, r_p1, r_p2), Math::AddAndMult(0.5, r_p2, r_p3), Math::AddAndMult(0.5, r_p3, r_p1),
+            Math::Mult(1.0/3.0, Math::Add(r_p1, Math::Add(r_p2, r_p3))) };
+        for( const auto& r_sample : samples ){
+            // Only samples further away than the current maximum are of interest.
+            const double radius = std::max(max_distance, ZEROTOL);
+            if( !IsWithinRadius(rTriangleMeshB, tree_b.Query(GetAABB({r_sample}, radius)), r_sample, radius) ){
+                max_distance = std::max(max_distance, Distance(tree_b, rTriangleMeshB, r_sample, 2.0*radius));
+            }
+        }
+    }
+    return max_distance;
+}
+
+/// @brief Candidate for an edge collapse: Vertex 'remove' is merged into vertex 'keep', which is moved to 'position'.
+struct EdgeCollapse {
+    double cost;
+    IndexType keep;
+    IndexType remove;
+    IndexType version_keep;
+    IndexType version_remove;
+    Vector3d position;
+};
+
+/// @brief Orders collapses by increasing costs. Ties are broken by the vertex ids to obtain deterministic results.
+struct EdgeCollapseGreater {
+    bool operator()(const EdgeCollapse& rLhs, const EdgeCollapse& rRhs) const {
+        if( rLhs.cost != rRhs.cost ){
+            return rLhs.cost > rRhs.cost;
+        }
+        return std::make_pair(rLhs.keep, rLhs.remove) > std::make_pair(rRhs.keep, rRhs.remove);
+    }
+};
+
+} // End anonymous namespace
+
+double MeshUtilities::Decimate(TriangleMeshInterface& rTriangleMesh, double Tolerance) {
+    const IndexType num_triangles = rTriangleMesh.NumOfTriangles();
+    const IndexType num_vertices = rTriangleMesh.NumOfVertices();
+    if( num_triangles == 0 || Tolerance <= 0.0 ){
+        return 0.0;
+    }
+
+    const auto p_original_mesh = rTriangleMesh.Clone();
+    const AABB_tree original_tree(*p_original_mesh);
+
+    std::vector<Vector3d> vertices = rTriangleMesh.GetVertices();
+    std::vector<Vector3i> triangles(num_triangles);
+    for( IndexType i = 0; i < num_triangles; ++i ){
+        triangles[i] = rTriangleMesh.VertexIds(i);
+    }
+
+    // Classify edges. Vertices on open or non-manifold edges are locked. Manifold edges are shared by two triangles with opposite orientation.
+    // Each half edge stores: (min vertex id, max vertex id, orientation, triangle id).
+    std::vector<std::array<IndexType, 4>> half_edges{};
+    half_edges.reserve(3*num_triangles);
+    for( IndexType i = 0; i < num_triangles; ++i ){
+        for( IndexType j = 0; j < 3; ++j ){
+            const IndexType v_1 = triangles[i][j];
+            const IndexType v_2 = triangles[i][(j+1) % 3];
+            half_edges.push_back( {std::min(v_1, v_2), std::max(v_1, v_2), static_cast<IndexType>(v_1 < v_2), i} );
+        }
+    }
+    std::sort(half_edges.begin(), half_edges.end());
+
+    // Samples of the original surface (vertices, edge midpoints and centroids). Each sample is assigned to one triangle,
+    // which is within Tolerance. The assignment is updated for each collapse, such that the final mesh stays close to all samples.
+    std::vector<Vector3d> samples{};
+    samples.reserve(num_vertices + half_edges.size()/2 + num_triangles);
+    std::vector<IndexType> sample_origins{}; // Original triangle of each sample.
+    sample_origins.reserve(samples.capacity());
+    std::vector<std::vector<IndexType>> triangle_samples(num_triangles);
+    const auto add_sample = [&samples, &sample_origins, &triangle_samples](const Vector3d& rPoint, IndexType TriangleId){
+        triangle_samples[TriangleId].push_back(samples.size());
+        samples.push_back(rPoint);
+        sample_origins.push_back(TriangleId);
+    };
+
+    std::vector<bool> is_locked(num_vertices, false);
+    std::vector<std::pair<IndexType, IndexType>> manifold_edges{};
+    manifold_edges.reserve(half_edges.size()/2);
+    for( IndexType i = 0; i < half_edges.size(); ){
+        IndexType j = i + 1;
+        while( j < half_edges.size() && half_edges[j][0] == half_edges[i][0] && half_edges[j][1] == half_edges[i][1] ){
+            ++j;
+        }
+        if( j - i == 2 && half_edges[i][2] != half_edges[i+1][2] ){
+            manifold_edges.push_back( std::make_pair(half_edges[i][0], half_edges[i][1]) );
+        } else {
+            is_locked[half_edges[i][0]] = true;
+            is_locked[half_edges[i][1]] = true;
+        }
+        add_sample(Math::AddAndMult(0.5, vertices[half_edges[i][0]], vertices[half_edges[i][1]]), half_edges[i][3]);
+        i = j;
+    }
+    half_edges.clear();
+    half_edges.shrink_to_fit();
+
+    // Triangles attached to each vertex and quadrics. Vertices of degenerated triangles are locked.
+    std::vector<std::vector<IndexType>> vertex_triangles(num_vertices);
+    std::vector<Quadric> quadrics(num_vertices);
+    for( IndexType i = 0; i < num_triangles; ++i ){
+        const auto& r_triangle = triangles[i];
+        const auto& r_p1 = vertices[r_triangle[0]];
+        const auto& r_p2 = vertices[r_triangle[1]];
+        const auto& r_p3 = vertices[r_triangle[2]];
+        for( const IndexType vertex_id : r_triangle ){
+            if( vertex_triangles[vertex_id].empty() ){
+                add_sample(vertices[vertex_id], i);
+            }
+            vertex_triangles[vertex_id].push_back(i);
+        }
+        add_sample(Math::Mult(1.0/3.0, Math::Add(r_p1, Math::Add(r_p2, r_p3))), i);
+
+        Vector3d normal = Math::Cross( Math::Subtract(r_p2, r_p1), Math::Subtract(r_p3, r_p1) );
+        const double norm = Math::Norm(normal);
+        if( norm > 0.0 ){
+            Math::DivideSelf(normal, norm);
+            const double offset = -Math::Dot(normal, r_p1);
+            for( const IndexType vertex_id : r_triangle ){
+                quadrics[vertex_id].AddPlane(normal, offset);
+            }
+        } else {
+            for( const IndexType vertex_id : r_triangle ){
+                is_locked[vertex_id] = true;
+            }
+        }
+    }
+
+    std::vector<IndexType> versions(num_vertices, 0);
+    std::vector<bool> is_removed_vertex(num_vertices, false);
+    std::vector<bool> is_removed_triangle(num_triangles, false);
+    std::priority_queue<EdgeCollapse, std::vector<EdgeCollapse>, EdgeCollapseGreater> queue{};
+
+    const auto add_collapse = [&](IndexType VertexA, IndexType VertexB){
+        if( is_locked[VertexA] && is_locked[VertexB] ){
+            return;
+        }
+        const IndexType keep = is_locked[VertexB] ? VertexB : VertexA;
+        const IndexType remove = is_locked[VertexB] ? VertexA : VertexB;
+
+        Quadric quadric = quadrics[keep];
+        quadric.Add(quadrics[remove]);
+
+        const auto& r_p_keep = vertices[keep];
+        const auto& r_p_remove = vertices[remove];
+        Vector3d position = r_p_keep;
+        if( !is_locked[keep] ){
+            const Vector3d midpoint = Math::AddAndMult(0.5, r_p_keep, r_p_remove);
+            const double length = Math::Norm( Math::Subtract(r_p_keep, r_p_remove) );
+            if( !quadric.Minimize(position) || Math::Norm( Math::Subtract(position, midpoint) ) > length ){
+                // Fall back to the best of both end points and the midpoint.
+                position = r_p_keep;
+                double min_cost = quadric.Evaluate(position);
+                for( const auto& r_candidate : {r_p_remove, midpoint} ){
+                    const double cost = quadric.Evaluate(r_candidate);
+                    if( cost < min_cost ){
+                        min_cost = cost;
+                        position = r_candidate;
+                    }
+                }
+            }
+        }
+        queue.push( {quadric.Evaluate(position), keep, remove, versions[keep], versions[remove], position} );
+    };
+
+    const auto get_neighbours = [&](IndexType VertexId){
+        std::vector<IndexType> neighbours{};
+        for( const IndexType triangle_id : vertex_triangles[VertexId] ){
+            for( const IndexType other_id : triangles[triangle_id] ){
+                if( other_id != VertexId ){
+                    neighbours.push_back(other_id);
+                }
+            }
+        }
+        std::sort(neighbours.begin(), neighbours.end());
+        neighbours.erase( std::unique(neighbours.begin(), neighbours.end()), neighbours.end() );
+        return neighbours;
+    };
+
+    for( const auto& r_edge : manifold_edges ){
+        add_collapse(r_edge.first, r_edge.second);
+    }
+    manifold_edges.clear();
+    manifold_edges.shrink_to_fit();
+
+    const double squared_tolerance = Tolerance*Tolerance;
+    std::vector<IndexType> shared_triangles{};
+    std::vector<IndexType> new_triangle_ids{};
+    std::vector<std::array<Vector3d, 3>> new_triangles{};
+    std::vector<IndexType> modified_samples{};
+    std::vector<IndexType> new_sample_triangles{};
+    std::vector<IndexType> local_original_ids{};
+    std::vector<Vector3d> new_points{};
+    while( !queue.empty() ){
+        const EdgeCollapse collapse = queue.top();
+        queue.pop();
+        const IndexType keep = collapse.keep;
+        const IndexType remove = collapse.remove;
+        if( is_removed_vertex[keep] || is_removed_vertex[remove]
+                || versions[keep] != collapse.version_keep || versions[remove] != collapse.version_remove ){
+            continue; // Outdated.
+        }
+
+        // Edge must still be shared by exactly two triangles.
+        shared_triangles.clear();
+        for( const IndexType triangle_id : vertex_triangles[keep] ){
+            const auto& r_triangle = triangles[triangle_id];
+            if( std::find(r_triangle.begin(), r_triangle.end(), remove) != r_triangle.end() ){
+                shared_triangles.push_back(triangle_id);
+            }
+        }
+        if( shared_triangles.size() != 2 ){
+            continue;
+        }
+
+        // Link condition: The only common neighbours are the two opposite vertices. Also, the merged vertex needs at least three neighbours.
+        const auto neighbours_keep = get_neighbours(keep);
+        const auto neighbours_remove = get_neighbours(remove);
+        std::vector<IndexType> common_neighbours{};
+        std::set_intersection(neighbours_keep.begin(), neighbours_keep.end(), neighbours_remove.begin(), neighbours_remove.end(),
+            std::back_inserter(common_neighbours));
+        if( common_neighbours.size() != 2 || neighbours_keep.size() + neighbours_remove.size() - 4 < 3 ){
+            continue;
+        }
+
+        // Remaining triangles must neither flip nor degenerate.
+        new_triangle_ids.clear();
+        new_triangles.clear();
+        bool is_valid = true;
+        for( const IndexType vertex_id : {keep, remove} ){
+            for( const IndexType triangle_id : vertex_triangles[vertex_id] ){
+                if( triangle_id == shared_triangles[0] || triangle_id == shared_triangles[1] ){
+                    continue;
+                }
+                const auto& r_triangle = triangles[triangle_id];
+                std::array<Vector3d, 3> new_points{};
+                for( IndexType j = 0; j < 3; ++j ){
+                    new_points[j] = (r_triangle[j] == keep || r_triangle[j] == remove) ? collapse.position : vertices[r_triangle[j]];
+                }
+                const Vector3d old_normal = Math::Cross( Math::Subtract(vertices[r_triangle[1]], vertices[r_triangle[0]]),
+                                                         Math::Subtract(vertices[r_triangle[2]], vertices[r_triangle[0]]) );
+                const Vector3d new_normal = Math::Cross( Math::Subtract(new_points[1], new_points[0]),
+                                                         Math::Subtract(new_points[2], new_points[0]) );
+                if( Math::Dot(old_normal, new_normal) <= 0.5*Math::Norm(old_normal)*Math::Norm(new_normal) ){
+                    is_valid = false;
+                    break;
+                }
+                new_triangle_ids.push_back(triangle_id);
+                new_triangles.push_back(new_points);
+            }
+            if( !is_valid ){
+                break;
+            }
+        }
+        if( !is_valid ){
+            continue;
+        }
+
+        // Samples of the modified triangles.
+        modified_samples.clear();
+        for( const IndexType vertex_id : {keep, remove} ){
+            for( const IndexType triangle_id : vertex_triangles[vertex_id] ){
+                if( vertex_id == remove && (triangle_id == shared_triangles[0] || triangle_id == shared_triangles[1]) ){
+                    continue; // Already visited.
+                }
+                modified_samples.insert(modified_samples.end(), triangle_samples[triangle_id].begin(), triangle_samples[triangle_id].end());
+            }
+        }
+
+        // New triangles must be close to the original surface. Only the new vertex, the centroids and the midpoints of the modified edges change.
+        new_points.clear();
+        new_points.push_back(collapse.position);
+        for( IndexType i = 0; i < new_triangles.size(); ++i ){
+            const auto& r_points = new_triangles[i];
+            const auto& r_triangle = triangles[new_triangle_ids[i]];
+            new_points.push_back( Math::Mult(1.0/3.0, Math::Add(r_points[0], Math::Add(r_points[1], r_points[2]))) );
+            for( IndexType j = 0; j < 3; ++j ){
+                const IndexType v_1 = r_triangle[j];
+                const IndexType v_2 = r_triangle[(j+1) % 3];
+                if( v_1 == keep || v_1 == remove || v_2 == keep || v_2 == remove ){
+                    new_points.push_back( Math::AddAndMult(0.5, r_points[j], r_points[(j+1) % 3]) );
+                }
+            }
+        }
+        // Test the original triangles of the modified samples first. Query AABB tree only if required.
+        local_original_ids.clear();
+        for( const IndexType sample_id : modified_samples ){
+            local_original_ids.push_back(sample_origins[sample_id]);
+        }
+        std::sort(local_original_ids.begin(), local_original_ids.end());
+        local_original_ids.erase( std::unique(local_original_ids.begin(), local_original_ids.end()), local_original_ids.end() );
+        for( IndexType i = 0; i < new_points.size() && is_valid; ++i ){
+            is_valid = IsWithinRadius(*p_original_mesh, local_original_ids, new_points[i], Tolerance)
+                || IsWithinRadius(*p_original_mesh, original_tree.Query(GetAABB({new_points[i]}, Tolerance)), new_points[i], Tolerance);
+        }
+        if( !is_valid ){
+            continue;
+        }
+
+        // All samples of the modified triangles must be close to one of the new triangles.
+        new_sample_triangles.clear();
+        for( const IndexType sample_id : modified_samples ){
+            IndexType i = 0;
+            while( i < new_triangles.size() && SquaredDistancePointTriangle(samples[sample_id],
+                    new_triangles[i][0], new_triangles[i][1], new_triangles[i][2]) > squared_tolerance ){
+                ++i;
+            }
+            if( i == new_triangles.size() ){
+                is_valid = false;
+                break;
+            }
+            new_sample_triangles.push_back(new_triangle_ids[i]);
+        }
+        if( !is_valid ){
+            continue;
+        }
+
+        // Collapse edge and reassign samples.
+        for( const IndexType vertex_id : {keep, remove} ){
+            for( const IndexType triangle_id : vertex_triangles[vertex_id] ){
+                triangle_samples[triangle_id].clear();
+            }
+        }
+        for( IndexType i = 0; i < modified_samples.size(); ++i ){
+            triangle_samples[new_sample_triangles[i]].push_back(modified_samples[i]);
+        }
+        for( const IndexType triangle_id : shared_triangles ){
+            is_removed_triangle[triangle_id] = true;
+            triangle_samples[triangle_id].shrink_to_fit();
+            for( const IndexType vertex_id : triangles[triangle_id] ){
+                auto& r_vertex_triangles = vertex_triangles[vertex_id];
+                r_vertex_triangles.erase( std::remove(r_vertex_triangles.begin(), r_vertex_triangles.end(), triangle_id), r_vertex_triangles.end() );
+            }
+        }
+        for( const IndexType triangle_id : vertex_triangles[remove] ){
+            for( auto& r_vertex_id : triangles[triangle_id] ){
+                if( r_vertex_id == remove ){
+                    r_vertex_id = keep;
+                }
+            }
+            vertex_triangles[keep].push_back(triangle_id);
+        }
+        vertex_triangles[remove].clear();
+        vertex_triangles[remove].shrink_to_fit();
+        quadrics[keep].Add(quadrics[remove]);
+        vertices[keep] = collapse.position;
+        is_removed_vertex[remove] = true;
+        ++versions[keep];
+
+        for( const IndexType neighbour_id : get_neighbours(keep) ){
+            add_collapse(keep, neighbour_id);
+        }
+    }
+
+    // Write simplified mesh. Vertices are renumbered in the order of their first occurrence.
+    rTriangleMesh.Clear();
+    rTriangleMesh.Reserve(num_triangles);
+    std::vector<IndexType> new_vertex_ids(num_vertices, std::numeric_limits<IndexType>::max());
+    for( IndexType i = 0; i < num_triangles; ++i ){
+        if( is_removed_triangle[i] ){
+            continue;
+        }
+        Vector3i new_triangle{};
+        for( IndexType j = 0; j < 3; ++j ){
+            const IndexType vertex_id = triangles[i][j];
+            if( new_vertex_ids[vertex_id] == std::numeric_limits<IndexType>::max() ){
+                new_vertex_ids[vertex_id] = rTriangleMesh.AddVertex(vertices[vertex_id]);
+            }
+            new_triangle[j] = new_vertex_ids[vertex_id];
+        }
+        rTriangleMesh.AddTriangle(new_triangle);
+        rTriangleMesh.AddNormal( TriangleMeshInterface::Normal(vertices[triangles[i][0]], vertices[triangles[i][1]], vertices[triangles[i][2]]) );
+    }
+
+    return HausdorffDistance(*p_original_mesh, rTriangleMesh);
+}
+
+double MeshUtilities::HausdorffDistance(const TriangleMeshInterface& rTriangleMeshA, const TriangleMeshInterface& rTriangleMeshB) {
+    if( rTriangleMeshA.NumOfTriangles() == 0 || rTriangleMeshB.NumOfTriangles() == 0 ){
+        return 0.0;
+    }
+    return std::max( OneSidedHausdorffDistance(rTriangleMeshA, rTriangleMeshB), OneSidedHausdorffDistance(rTriangleMeshB, rTriangleMeshA) );
+}
+
+} // End namespace queso
@@ -108,6 +108,23 @@ public:
     static double AverageAspectRatio(const TriangleMeshInterface& rTriangleMesh);
 
 
+    /// @brief Simplifies the triangle mesh by quadric error metric edge collapses (Garland and Heckbert, 1997).
+    /// @details Only edges shared by exactly two triangles are collapsed and the link condition is enforced. Hence, the topology
+    ///          is preserved and closed meshes remain closed. Vertices on open or non-manifold edges are not moved.
+    ///          A collapse is rejected if the new vertex deviates more than Tolerance from the original surface or from the planes
+    ///          of the merged triangles, or if any adjacent triangle would flip or degenerate.
+    /// @param rTriangleMesh Triangle mesh to simplify. Normals are recomputed and edges on planes are removed.
+    /// @param Tolerance Maximum allowed deviation (absolute length).
+    /// @return double Achieved deviation, see HausdorffDistance().
+    static double Decimate(TriangleMeshInterface& rTriangleMesh, double Tolerance);
+
+    /// @brief Returns the (two-sided) Hausdorff distance between both triangle meshes.
+    ///        The distance is sampled at all vertices, edge midpoints and triangle centroids.
+    /// @param rTriangleMeshA
+    /// @param rTriangleMeshB
+    /// @return double
+    static double HausdorffDistance(const TriangleMeshInterface& rTriangleMeshA, const TriangleMeshInterface& rTriangleMeshB);
+
     ///@brief Returns axis-aligned bounding box of triangle mesh.
     ///@param rTriangleMesh
     ///@return std::pair<PointType, PointType>